@@ -1 +1 @@
-⼯䌠灯特杩瑨䔠楰⁣慇敭ⱳ䤠据‮汁⁬楒桧獴删獥牥敶⹤ਊ瀣慲浧⁡湯散ਊ椣据畬敤∠潃敲楍楮慭⹬≨ਊ⼯敤楦敮挠獵潴⁭潣汬獩潩⁮档湡敮⁬潦⁲潢摩愠潶摩湡散琠慲楣杮⌊敤楦敮䌠䱏䥌䥓乏䅟佖䑉乁䕃उउ䍅彃慇敭牔捡䍥慨湮汥
\ No newline at end of file
+⼯䌠灯特杩瑨䔠楰⁣慇敭ⱳ䤠据‮汁⁬楒桧獴删獥牥敶⹤ਊ瀣慲浧⁡湯散ਊ椣据畬敤∠潃敲楍楮慭⹬≨ਊ⼯敤楦敮挠獵潴⁭潣汬獩潩⁮档湡敮⁬潦⁲潢摩愠潶摩湡散琠慲楣杮⌊敤楦敮䌠䱏䥌䥓乏䅟佖䑉乁䕃उउ䍅彃慇敭牔捡䍥慨湮汥਱⼊猯慴⁴牧畯⁰景映潬正猠浩汵瑡潩⁮慴歳ⱳ猠潨湷眠瑩⁨猢慴⁴潂摩≳䐊䍅䅌䕒卟䅔協䝟佒偕吨塅⡔䈢楯獤⤢‬呓呁則問彐潂摩ⱳ匠䅔䍔呁䅟癤湡散⥤
\ No newline at end of file
@@ -1,360 +1 @@
-// Copyright ©2020 Samuel Harrison
-
-//includes
-#include "Boid.h"
-#include "Components/SphereComponent.h"
-#include "Components/StaticMeshComponent.h"
-#include "FlockManager.h"
-#include "DrawDebugHelpers.h"
-#include "Boids/Boids.h"						//used for project global collision preset "COLLISION_AVOIDANCE"
-
-ABoid::ABoid()
-{
-	//enable actor ticking
-	PrimaryActorTick.bCanEverTick = true;
-
-	//setup boid collision component and set as root
-	BoidCollision = CreateDefaultSubobject<USphereComponent>(TEXT("Boid Collision Component"));
-	RootComponent = BoidCollision;
-	BoidCollision->SetCollisionObjectType(ECC_Pawn);
-	BoidCollision->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-	BoidCollision->SetCollisionResponseToAllChannels(ECR_Overlap);
-
-	//setup boid mesh component & attach to root
-	BoidMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Boid Mesh Component"));
-	BoidMesh->SetupAttachment(RootComponent);
-	BoidMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-	BoidMesh->SetCollisionResponseToAllChannels(ECR_Ignore);
-
-	//setup cohesion sensor component
-	PerceptionSensor = CreateDefaultSubobject<USphereComponent>(TEXT("Perception Sensor Component"));
-	PerceptionSensor->SetupAttachment(RootComponent);
-	PerceptionSensor->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-	PerceptionSensor->SetCollisionResponseToAllChannels(ECR_Ignore);
-	PerceptionSensor->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
-	PerceptionSensor->SetSphereRadius(300.0f);
-
-	//set default velocity
-	BoidVelocity = FVector::ZeroVector;
-}
-
-void ABoid::BeginPlay()
-{
-	Super::BeginPlay();
-
-	//check if boid is owned by a flock manager
-	AFlockManager* BoidOwner = Cast<AFlockManager>(this->GetOwner());
-	if (BoidOwner)
-	{
-		//set flock manager
-		FlockManager = BoidOwner;
-
-		//set velocity based on spawn rotation and flock speed settings
-		BoidVelocity = this->GetActorForwardVector();
-		BoidVelocity.Normalize();
-		BoidVelocity *= FMath::FRandRange(FlockManager->GetMinSpeed(), FlockManager->GetMaxSpeed());
-
-		//set current mesh rotation
-		CurrentRotation = this->GetActorRotation();
-	}
-	else
-	{
-		//log warning to console
-		UE_LOG(LogTemp, Warning, TEXT("No FlockManager found for Boid: %s."), *GetName());
-
-		//TODO: attempt to find a suitable flock manager or set lifespan of boid since it won't be able to properly move without one
-	}
-}
-
-void ABoid::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-	//steer and move boid
-	Steer(DeltaTime);
-	
-	//update boid mesh rotation
-	UpdateMeshRotation();
-}
-
-void ABoid::UpdateMeshRotation()
-{
-	//TODO: need to create more complex and sophisticated system for "banking" that mimic boid's flight mechanics
-
-	//rotate toward current boid heading smoothly
-	CurrentRotation = FMath::RInterpTo(CurrentRotation, this->GetActorRotation(), GetWorld()->DeltaTimeSeconds, 7.0f);
-	this->BoidMesh->SetWorldRotation(CurrentRotation);
-}
-
-FVector ABoid::Separate(TArray<AActor*> Flock)
-{
-	//check for valid flock manager
-	if (FlockManager == nullptr) { return FVector::ZeroVector; }
-
-	FVector Steering = FVector::ZeroVector;
-	int32 FlockCount = 0;
-	FVector SeparationDirection = FVector::ZeroVector;
-	float ProximityFactor = 0.0f;
-
-	//get separation steering force for each of the boid's flockmates
-	for (AActor* OverlapActor : Flock)
-	{
-		ABoid* Flockmate = Cast<ABoid>(OverlapActor);
-		if (Flockmate != nullptr && Flockmate != this)
-		{
-			//check if flockmate is outside perception fov
-			//TODO: find way to offload this check to collision based solution, sphere collision that have slices for perception FOV elastic grow/shrinking (), (<, (|, (>, etc.?
-			if (FVector::DotProduct(this->GetActorForwardVector(), (Flockmate->GetActorLocation() - this->GetActorLocation()).GetSafeNormal()) <= FlockManager->GetSeparationFOV())
-			{
-				continue;	//flockmate is outside perception angle, disregard it and continue the loop
-			}
-
-			//get normalized direction away from nearby boid
-			SeparationDirection = this->GetActorLocation() - Flockmate->GetActorLocation();
-			SeparationDirection = SeparationDirection.GetSafeNormal();
-
-			//get scaling factor based off other boid's proximity. 0 = very far away (no separation force) & 1 = very close (full separation force)
-			ProximityFactor = 1.0f - (SeparationDirection.Size() / this->PerceptionSensor->GetScaledSphereRadius());
-
-			//check if flockmate's center of mass is outside perception radius (i.e. colliding but not within radius)
-			//TODO: add flockmate's collision radius to perception radius so they can be included in calculations
-			if (ProximityFactor < 0.0f)
-			{
-				continue;	//flockmate is outside of perception radius, disregard and continue loop
-			}
-
-			//add steering force of flockmate and increase flock count
-			Steering += (ProximityFactor * SeparationDirection);
-			FlockCount++;
-		}
-	}
-
-	if (FlockCount > 0)
-	{
-		//get flock average separation steering force, apply separation steering strength factor and return force
-		Steering /= FlockCount;
-		Steering.GetSafeNormal() -= this->BoidVelocity.GetSafeNormal();
-		Steering *= FlockManager->GetSeparationStrength();
-		return Steering;
-	}
-	else
-	{
-		return FVector::ZeroVector;
-	}
-}
-
-FVector ABoid::Align(TArray<AActor*> Flock)
-{
-	//check for valid flock manager
-	if (FlockManager == nullptr) { return FVector::ZeroVector; }
-
-	FVector Steering = FVector::ZeroVector;
-	int32 FlockCount = 0.0f;
-
-	//get alignment steering force for each of the boid's flockmates
-	for (AActor* OverlapActor : Flock)
-	{
-		ABoid* Flockmate = Cast<ABoid>(OverlapActor);
-		if (Flockmate != nullptr && Flockmate != this)
-		{
-			//check if flockmate is outside alignment perception fov
-			//TODO: find way to offload this check to collision based solution, sphere collision that have slices for perception FOV elastic grow/shrinking (), (<, (|, (>, etc.?
-			if (FVector::DotProduct(this->GetActorForwardVector(), (Flockmate->GetActorLocation() - this->GetActorLocation()).GetSafeNormal()) <= FlockManager->GetAlignmentFOV())
-			{
-				continue;	//flockmate is outside viewing angle, disregard it and continue the loop
-			}
-			//add flockmate's alignment force
-			Steering += Flockmate->BoidVelocity.GetSafeNormal();
-			FlockCount++;
-		}
-	}
-
-	if (FlockCount > 0)
-	{
-		//get alignment force to average flock direction
-		Steering /= FlockCount;
-		Steering.GetSafeNormal() -= this->BoidVelocity.GetSafeNormal();
-		Steering *= FlockManager->GetAlignmentStrength();
-		return Steering;
-	}
-	else
-	{
-		return FVector::ZeroVector;
-	}
-}
-
-FVector ABoid::GroupUp(TArray<AActor*> Flock)
-{
-	//check for valid flock manager
-	if (FlockManager == nullptr) { return FVector::ZeroVector; }
-
-	FVector Steering = FVector::ZeroVector;
-	int32 FlockCount = 0.0f;
-	FVector AveragePosition = FVector::ZeroVector;
-
-	//get sum of flockmate positions
-	for (AActor* OverlapActor : Flock)
-	{
-		ABoid* Flockmate = Cast<ABoid>(OverlapActor);
-		if (Flockmate != nullptr && Flockmate != this)
-		{
-			//check if flockmate is outside cohesion perception angle
-			//TODO: find way to offload this check to collision based solution, sphere collision that have slices for perception FOV elastic grow/shrinking (), (<, (|, (>, etc.?
-			if (FVector::DotProduct(this->GetActorForwardVector(), (Flockmate->GetActorLocation() - this->GetActorLocation()).GetSafeNormal()) <= FlockManager->GetCohesionFOV())
-			{
-				continue;	//flockmate is outside viewing angle, disregard this flockmate and continue the loop
-			}
-			//get cohesive force to group with flockmate
-			AveragePosition += Flockmate->GetActorLocation();
-			FlockCount++;
-		}
-	}
-
-	if (FlockCount > 0)
-	{
-		//average cohesion force of flock
-		AveragePosition /= FlockCount;
-		Steering = AveragePosition - this->GetActorLocation();
-		Steering.GetSafeNormal() -= this->BoidVelocity.GetSafeNormal();
-		Steering *= FlockManager->GetCohesionStrength();
-		return Steering;
-	}
-	else
-	{
-		return FVector::ZeroVector;
-	}
-}
-
-void ABoid::Steer(float DeltaTime)
-{
-	//check for valid flock manager
-	if (FlockManager == nullptr) { return; }
-
-	FVector Acceleration = FVector::ZeroVector;
-
-	//update position and rotation
-	//AddActorLocalOffset(Velocity * DeltaTime, true);	//TODO: using this prevents boids from rotating to face velocity???
-	this->SetActorLocation(this->GetActorLocation() + (BoidVelocity * DeltaTime));
-	this->SetActorRotation(BoidVelocity.ToOrientationQuat());
-
-	//apply steering forces to boid acceleration
-	//find flockmates in general area to fly with
-	TArray<AActor*> Flockmates;
-	PerceptionSensor->GetOverlappingActors(Flockmates, TSubclassOf<ABoid>());
-	Acceleration += Separate(Flockmates);
-	Acceleration += Align(Flockmates);
-	Acceleration += GroupUp(Flockmates);
-
-	//TODO: add logic to disregard other steering forces if collision is found. Prioritize avoidance and reduce chance they steer into obstacle due to swarm forces.
-	//check if heading for collision
-	if (IsObstacleAhead())
-	{
-		//apply obstacle avoidance force
-		Acceleration += AvoidObstacle();
-	}
-
-	//apply target forces and remove from stack
-	for (FVector TargetForce : TargetForces)
-	{
-		Acceleration += TargetForce;
-		TargetForces.Remove(TargetForce);
-	}
-
-	//update velocity
-	BoidVelocity += (Acceleration * DeltaTime);
-	BoidVelocity = BoidVelocity.GetClampedToSize(FlockManager->GetMinSpeed(), FlockManager->GetMaxSpeed());
-}
-
-bool ABoid::IsObstacleAhead()
-{
-	//check for valid flock manager
-	if (FlockManager == nullptr) { return false; }
-
-	if (FlockManager->GetAvoidanceSensors().Num() > 0)
-	{
-		//check forward sensor for collision
-		//TODO: remove sensor array rotation, add simple line trace in forward direction to optimize, not critical that array is aligned with boid's orientation for obstacle check
-		//rotate 1st sensor towards forward direction of boid
-		FQuat SensorRotation = FQuat::FindBetweenVectors(FlockManager->GetAvoidanceSensors()[0], this->GetActorForwardVector());
-		FVector NewSensorDirection = FVector::ZeroVector;
-		NewSensorDirection = SensorRotation.RotateVector(FlockManager->GetAvoidanceSensors()[0]);
-		//set collision properties and parameters for collision trace
-		FCollisionQueryParams TraceParameters;
-		FHitResult Hit;
-		//run line trace for collision check on 1st sensor
-		GetWorld()->LineTraceSingleByChannel(Hit, this->GetActorLocation(), this->GetActorLocation() + NewSensorDirection * FlockManager->GetSensorRadius(), COLLISION_AVOIDANCE, TraceParameters);
-
-		//check hit result for collision and draw collision probe status
-		//TODO remove debug lines when not needed. possible toggle?
-		/*if (Hit.bBlockingHit)
-		{
-			DrawDebugLine(GetWorld(), this->GetActorLocation(), this->GetActorLocation() + NewSensorDirection * FlockManager->GetSensorRadius(), FColor::Red, false, -1.0f, 0, 1.5f);
-			DrawDebugSphere(GetWorld(), Hit.ImpactPoint, 8.0f, 12, FColor::Red, false, -1.0f, 0, 1.0f);
-		}
-		else
-		{
-			DrawDebugLine(GetWorld(), this->GetActorLocation(), this->GetActorLocation() + NewSensorDirection * FlockManager->GetSensorRadius(), FColor::Green, false, -1.0f, 0, 1.5f);
-		}*/
-
-		//check if boid is inside object (i.e. no need to avoid/impossible to)
-		if (Hit.bBlockingHit)
-		{
-			TArray<AActor*> OverlapActors;
-			BoidCollision->GetOverlappingActors(OverlapActors);
-			for (AActor* OverlapActor : OverlapActors)
-			{
-				if (Hit.Actor == OverlapActor)
-				{
-					return false;
-				}
-			}
-		}
-
-		return Hit.bBlockingHit;
-
-
-	}
-
-	//there are no sensors to check
-	return false;
-}
-
-FVector ABoid::AvoidObstacle()
-{
-	//check for valid flock manager
-	if (FlockManager == nullptr) { return FVector::ZeroVector; }
-
-	FVector Steering = FVector::ZeroVector;
-	FQuat SensorRotation = FQuat::FindBetweenVectors(FlockManager->GetAvoidanceSensors()[0], this->GetActorForwardVector());
-	FVector NewSensorDirection = FVector::ZeroVector;
-	FCollisionQueryParams TraceParameters;
-	FHitResult Hit;
-
-	for (FVector AvoidanceSensor : FlockManager->GetAvoidanceSensors())
-	{
-		//rotate avoidance sensor to align with boid orientation and trace for collision
-		NewSensorDirection = SensorRotation.RotateVector(AvoidanceSensor);
-		GetWorld()->LineTraceSingleByChannel(Hit, this->GetActorLocation(), this->GetActorLocation() + NewSensorDirection * FlockManager->GetSensorRadius(), COLLISION_AVOIDANCE, TraceParameters);
-		if (Hit.bBlockingHit)
-		{
-			/*DrawDebugLine(GetWorld(), this->GetActorLocation(), this->GetActorLocation() + NewSensorDirection * FlockManager->GetSensorRadius(), FColor::Red, false, -1.0f, 0, 1.5f);
-			DrawDebugSphere(GetWorld(), Hit.ImpactPoint, 8.0f, 12, FColor::Red, false, -1.0f, 0, 1.0f);*/
-		}
-		else
-		{
-			//DrawDebugLine(GetWorld(), this->GetActorLocation(), this->GetActorLocation() + NewSensorDirection * FlockManager->GetSensorRadius(), FColor::Green, false, -1.0f, 0, 1.5f);
-			//TODO add proximity factor to avoidance. The closer to collision the stronger the force.
-			Steering = NewSensorDirection.GetSafeNormal() - this->BoidVelocity.GetSafeNormal();
-			Steering *= FlockManager->GetAvoidanceStrength();
-			//DrawDebugDirectionalArrow(GetWorld(), this->GetActorLocation(), this->GetActorLocation() + Steering, 5.0f, FColor::Yellow, false, -1.0f, 0, 3.0f);
-			return Steering;
-		}
-	}
-
-	return FVector::ZeroVector;
-}
-
-void ABoid::AddTargetForce(FVector TargetForce)
-{
-	TargetForces.Add(TargetForce);
-}
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠潂摩栮ਢ椣据畬敤∠潃灭湯湥獴匯桰牥䍥浯潰敮瑮栮ਢ椣据畬敤∠潃灭湯湥獴匯慴楴䵣獥䍨浯潰敮瑮栮ਢ椣据畬敤∠汆捯䵫湡条牥栮ਢ䄊潂摩㨺䉁楯⡤਩੻⼉搯獩扡敬愠瑣牯琠捩楫杮‬潢摩椠⁳潭敶⁤祢椠獴映潬正洠湡条牥ऊ牐浩牡䅹瑣牯楔正戮慃䕮敶呲捩⁫‽慦獬㭥ਊ⼉猯瑥灵戠楯⁤潣汬獩潩⁮潣灭湯湥⁴湡⁤敳⁴獡爠潯ੴ䈉楯䍤汯楬楳湯㴠䌠敲瑡䑥晥畡瑬畓潢橢捥㱴单桰牥䍥浯潰敮瑮⠾䕔员∨潂摩䌠汯楬楳湯䌠浯潰敮瑮⤢㬩ऊ潒瑯潃灭湯湥⁴‽潂摩潃汬獩潩㭮ऊ潂摩潃汬獩潩⵮匾瑥潃汬獩潩佮橢捥呴灹⡥䍅彃慐湷㬩ऊ潂摩潃汬獩潩⵮匾瑥潃汬獩潩䕮慮汢摥䔨潃汬獩潩䕮慮汢摥㨺畑牥佹汮⥹਻䈉楯䍤汯楬楳湯㸭敓䍴汯楬楳湯敒灳湯敳潔汁䍬慨湮汥⡳䍅归癏牥慬⥰਻ऊ⼯敳畴⁰潢摩洠獥⁨潣灭湯湥⁴…瑡慴档琠⁯潲瑯ऊ潂摩敍桳㴠䌠敲瑡䑥晥畡瑬畓潢橢捥㱴单慴楴䵣獥䍨浯潰敮瑮⠾䕔员∨潂摩䴠獥⁨潃灭湯湥≴⤩਻䈉楯䵤獥⵨匾瑥灵瑁慴档敭瑮刨潯䍴浯潰敮瑮㬩ऊ潂摩敍桳㸭敓䍴汯楬楳湯湅扡敬⡤䍅汯楬楳湯湅扡敬㩤为䍯汯楬楳湯㬩ऊ潂摩敍桳㸭敓䍴汯楬楳湯敒灳湯敳潔汁䍬慨湮汥⡳䍅归杉潮敲㬩ਊ⼉猯瑥灵挠桯獥潩⁮敳獮牯挠浯潰敮瑮ऊ敐捲灥楴湯敓獮牯㴠䌠敲瑡䑥晥畡瑬畓潢橢捥㱴单桰牥䍥浯潰敮瑮⠾䕔员∨敐捲灥楴湯匠湥潳⁲潃灭湯湥≴⤩਻倉牥散瑰潩卮湥潳⵲匾瑥灵瑁慴档敭瑮刨潯䍴浯潰敮瑮㬩ऊ敐捲灥楴湯敓獮牯㸭敓䍴汯楬楳湯湅扡敬⡤䍅汯楬楳湯湅扡敬㩤儺敵祲湏祬㬩ऊ敐捲灥楴湯敓獮牯㸭敓䍴汯楬楳湯敒灳湯敳潔汁䍬慨湮汥⡳䍅归杉潮敲㬩ऊ敐捲灥楴湯敓獮牯㸭敓䍴汯楬楳湯敒灳湯敳潔桃湡敮⡬䍅彃慐湷‬䍅归癏牥慬⥰਻倉牥散瑰潩卮湥潳⵲匾瑥灓敨敲慒楤獵㌨〰〮⥦਻ऊ⼯潢摩椠湳琧椠⁮⁡汦捯⁫湵楴⁬桴⁥汦捯⁫慭慮敧⁲獡楳湧⁳瑩愠栠湡汤੥䘉潬正慈摮敬㴠䤠䑎塅也乏㭅ਊ⼉是楬桧⁴湡浩瑡潩⁮獩眠楲瑴湥戠⁹桴⁥汦捯⁫慭慮敧ੲ䘉楬桧䑴瑡⁡‽噆捥潴㑲〨〮ⱦ〠〮ⱦ〠〮ⱦ〠〮⥦਻䘉楬桧䑴瑡䥡摮硥㴠䤠䑎塅也乏㭅紊ਊ潶摩䄠潂摩㨺敂楧偮慬⡹਩੻匉灵牥㨺敂楧偮慬⡹㬩ਊ⼉振敨正椠⁦潢摩椠⁳睯敮⁤祢愠映潬正洠湡条牥ऊ䙁潬正慍慮敧⩲䈠楯佤湷牥㴠䌠獡㱴䙁潬正慍慮敧㹲琨楨⵳䜾瑥睏敮⡲⤩਻椉⁦䈨楯佤湷牥਩笉ऊ⼉猯瑥映潬正洠湡条牥ऊ䘉潬正慍慮敧⁲‽潂摩睏敮㭲ऊ੽攉獬੥笉ऊ⼉氯杯眠牡楮杮琠⁯潣獮汯੥उ䕕䱟䝏䰨杯敔灭‬慗湲湩Ⱨ吠塅⡔丢⁯汆捯䵫湡条牥映畯摮映牯䈠楯㩤┠⹳⤢‬䜪瑥慎敭⤨㬩ਊउ⼯佔佄›瑡整灭⁴潴映湩⁤⁡畳瑩扡敬映潬正洠湡条牥漠⁲敳⁴楬敦灳湡漠⁦潢摩猠湩散椠⁴潷❮⁴敢愠汢⁥潴瀠潲数汲⁹潭敶眠瑩潨瑵漠敮ऊ੽੽瘊楯⁤䉁楯㩤䔺摮汐祡挨湯瑳䔠湅偤慬剹慥潳㩮吺灹⁥湅偤慬剹慥潳⥮笊ऊ⼯慭敫猠牵⁥汦捯⁫慭慮敧⁲獩❮⁴敬瑦眠瑩⁨瑳瑡⁥潦⁲⁡潢摩琠慨⁴潮氠湯敧⁲硥獩獴ऊ晩⠠汆捯䵫湡条牥਩笉ऊ䘉潬正慍慮敧⵲刾浥癯䉥楯䙤潲䙭潬正琨楨⥳਻紉ਊ匉灵牥㨺湅偤慬⡹湅偤慬剹慥潳⥮਻੽昊潬瑡䄠潂摩㨺敇側牥散瑰潩剮摡畩⡳਩੻爉瑥牵⁮敐捲灥楴湯敓獮牯㸭敇却慣敬卤桰牥剥摡畩⡳㬩紊ਊ汦慯⁴䉁楯㩤䜺瑥潃汬獩潩剮摡畩⡳਩੻爉瑥牵⁮潂摩潃汬獩潩⵮䜾瑥捓污摥灓敨敲慒楤獵⤨਻੽戊潯⁬䉁楯㩤䤺䥳獮摩佥獢慴汣⡥潣獮⁴䅁瑣牯‪扏瑳捡敬਩੻爉瑥牵⁮扏瑳捡敬℠‽畮汬瑰⁲☦䈠楯䍤汯楬楳湯㸭獉癏牥慬灰湩䅧瑣牯伨獢慴汣⥥਻੽瘊楯⁤䉁楯㩤唺摰瑡䵥獥剨瑯瑡潩⡮潣獮⁴剆瑯瑡牯…敍桳潒慴楴湯਩੻⼉戯湡楫杮愠摮眠湩⁧汦灡楰杮愠敲瀠慬敹⁤祢琠敨洠獥❨⁳慭整楲污‬敳⁥灕慤整汆杩瑨湁浩瑡潩੮琉楨⵳䈾楯䵤獥⵨匾瑥潗汲剤瑯瑡潩⡮敍桳潒慴楴湯㬩紊ਊ潢汯䄠潂摩㨺灕慤整汆杩瑨湁浩瑡潩⡮湩㍴′慄慴湉敤ⱸ映潬瑡䘠慬偰慨敳‬汦慯⁴汆灡慒整‬汦慯⁴汆灡晅潦瑲‬汦慯⁴慂歮湁汧ⱥ映潬瑡吠浩ⱥ映潬瑡吠汯牥湡散਩੻⼉猯楫⁰牷瑩⁥桷汩⁥桴⁥慭整楲污猧眠湩⁧敢瑡⠠牷灡数⁤牡畯摮琠敨挠捹敬Ⱙ攠晦牯⁴湡⁤慢歮愠敲挠潬敳攠潮杵੨椉⁦䐨瑡䥡摮硥㴠‽汆杩瑨慄慴湉敤⥸ऊ੻उ潣獮⁴汦慯⁴桐獡䕥牲牯㴠䘠慍桴㨺扁⡳䵆瑡㩨䘺慲⡣汆杩瑨慄慴堮⬠䘠楬桧䑴瑡⹡⁙‪楔敭 ‭汆灡桐獡⥥਻उ晩⠠䵆瑡㩨䴺湩倨慨敳牅潲Ⱳㄠ〮⁦‭桐獡䕥牲牯 㴼吠汯牥湡散☠…䵆瑡㩨䄺獢䘨楬桧䑴瑡⹡⁚‭汆灡晅潦瑲 㴼吠汯牥湡散☠…䵆瑡㩨䄺獢䘨楬桧䑴瑡⹡⁗‭慂歮湁汧⥥㰠‽潔敬慲据⥥ऊ笉ऊउ敲畴湲映污敳਻उ੽紉ਊ⼉猯瑥愠汬瘠污敵⁳瑡漠据⁥潳琠敨洠獥❨⁳敲摮牥猠慴整椠⁳湯祬甠摰瑡摥漠据੥䘉楬桧䑴瑡⁡‽噆捥潴㑲䘨慍桴㨺牆捡䘨慬偰慨敳ⴠ䘠慬剰瑡⁥‪楔敭Ⱙ䘠慬剰瑡ⱥ䘠慬䕰晦牯ⱴ䈠湡䅫杮敬㬩ऊ汆杩瑨慄慴湉敤⁸‽慄慴湉敤㭸ऊ潂摩敍桳㸭敓䍴獵潴偭楲業楴敶慄慴敖瑣牯⠴慄慴湉敤ⱸ䘠楬桧䑴瑡⥡਻爉瑥牵⁮牴敵਻੽戊潯⁬䉁楯㩤场獡敍桳敒散瑮祬敒摮牥摥昨潬瑡吠汯牥湡散਩੻爉瑥牵⁮潂摩敍桳㸭慗剳捥湥汴剹湥敤敲⡤潔敬慲据⥥਻੽䘊敖瑣牯䄠潂摩㨺敇䉴楯噤汥捯瑩⡹਩੻⼉振敨正映牯瘠污摩映潬正洠湡条牥ऊ晩⠠汆捯䵫湡条牥㴠‽畮汬瑰⥲笠爠瑥牵⁮噆捥潴㩲娺牥噯捥潴㭲素ਊ爉瑥牵⁮汆捯䵫湡条牥㸭敇䉴楯噤汥捯瑩⡹汆捯䡫湡汤⥥਻੽瘊楯⁤䉁楯㩤区瑥潂摩潌慣楴湯挨湯瑳䘠敖瑣牯…敎䱷捯瑡潩⥮笊ऊ⼯灵慤整猠浩汵瑡摥氠捯瑡潩⁮潳琠敨映潬正洠湡条牥搠敯湳琧洠癯⁥桴⁥潢摩戠捡੫椉⁦䘨潬正慍慮敧⥲ऊ੻उ汆捯䵫湡条牥㸭敓䉴楯䱤捯瑡潩⡮汆捯䡫湡汤ⱥ丠睥潌慣楴湯㬩ऊ੽ऊ桴獩㸭敓䅴瑣牯潌慣楴湯丨睥潌慣楴湯㬩紊ਊ潶摩䄠潂摩㨺摁呤牡敧䙴牯散䘨敖瑣牯吠牡敧䙴牯散਩੻椉⁦䘨潬正慍慮敧⥲ऊ੻उ汆捯䵫湡条牥㸭摁䉤楯䙤牯散䘨潬正慈摮敬‬慔杲瑥潆捲⥥਻紉紊
\ No newline at end of file
@@ -1,156 +1 @@
-// Copyright ©2020 Samuel Harrison
-
-
-#include "BoidCageSpawner.h"
-#include "Components/BoxComponent.h"
-#include "Components/StaticMeshComponent.h"
-#include "Boid.h"
-#include "FlockManager.h"
-
-ABoidCageSpawner::ABoidCageSpawner()
-{
-	//disable actor ticking
-	PrimaryActorTick.bCanEverTick = false;
-
-	//setup cage collision component
-	CageCollision = CreateDefaultSubobject<UBoxComponent>(TEXT("Cage Collision Component"));
-	RootComponent = CageCollision;
-	CageCollision->SetBoxExtent(FVector(2500));
-	CageCollision->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-	CageCollision->SetCollisionResponseToAllChannels(ECR_Ignore);
-	CageCollision->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
-
-	//setup cage mesh component
-	CageMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Cage Mesh Component"));
-	CageMesh->SetupAttachment(RootComponent);
-	CageMesh->SetRelativeLocation(FVector(0.0f, 0.0f, 0.0f));
-	CageMesh->SetWorldScale3D(FVector(1.0f, 1.0f, 1.0f));
-
-	//set initial flock size in cage
-	NumBoidsToSpawn = 0;
-}
-
-void ABoidCageSpawner::BeginPlay()
-{
-	Super::BeginPlay();
-
-	//bind collision component overlap event to delegate that gets called to perform logic
-	if (CageCollision)
-	{
-		CageCollision->OnComponentEndOverlap.AddDynamic(this, &ABoidCageSpawner::OnCageOverlapEnd);
-	}
-
-	//spawn flock of boids
-	SpawnBoids(NumBoidsToSpawn);
-}
-
-void ABoidCageSpawner::OnCageOverlapEnd(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
-{
-	//check if actor leaving cage is a valid boid and not being destroyed
-	ABoid* EscapingBoid = Cast<ABoid>(OtherActor);
-	if (EscapingBoid)
-	{
-		if (EscapingBoid->IsActorBeingDestroyed()) { return; }
-
-		FVector NewBoidLocation = EscapingBoid->GetActorLocation();
-		//check which side(s) of the cage the boid is leaving
-		//exited front side
-		if (EscapingBoid->GetActorLocation().X > this->GetActorLocation().X + CageCollision->GetScaledBoxExtent().X)
-		{
-			//move boid to back side
-			NewBoidLocation.X = this->GetActorLocation().X - CageCollision->GetScaledBoxExtent().X;
-			NewBoidLocation.Y = FMath::Clamp(NewBoidLocation.Y, this->GetActorLocation().Y - CageCollision->GetScaledBoxExtent().Y, this->GetActorLocation().Y + CageCollision->GetScaledBoxExtent().Y);
-			NewBoidLocation.Z = FMath::Clamp(NewBoidLocation.Z, this->GetActorLocation().Z - CageCollision->GetScaledBoxExtent().Z, this->GetActorLocation().Z + CageCollision->GetScaledBoxExtent().Z);
-			EscapingBoid->SetActorLocation(NewBoidLocation);
-		}
-		//exited back side
-		else if (EscapingBoid->GetActorLocation().X < this->GetActorLocation().X - CageCollision->GetScaledBoxExtent().X)
-		{
-			//move boid to front side
-			NewBoidLocation.X = this->GetActorLocation().X + CageCollision->GetScaledBoxExtent().X;
-			NewBoidLocation.Y = FMath::Clamp(NewBoidLocation.Y, this->GetActorLocation().Y - CageCollision->GetScaledBoxExtent().Y, this->GetActorLocation().Y + CageCollision->GetScaledBoxExtent().Y);
-			NewBoidLocation.Z = FMath::Clamp(NewBoidLocation.Z, this->GetActorLocation().Z - CageCollision->GetScaledBoxExtent().Z, this->GetActorLocation().Z + CageCollision->GetScaledBoxExtent().Z);
-			EscapingBoid->SetActorLocation(NewBoidLocation);
-		}
-		//exited right side
-		else if (EscapingBoid->GetActorLocation().Y > this->GetActorLocation().Y + CageCollision->GetScaledBoxExtent().Y)
-		{
-			//move boid to left side
-			NewBoidLocation.X = FMath::Clamp(NewBoidLocation.X, this->GetActorLocation().X - CageCollision->GetScaledBoxExtent().X, this->GetActorLocation().X + CageCollision->GetScaledBoxExtent().X);
-			NewBoidLocation.Y = this->GetActorLocation().Y - CageCollision->GetScaledBoxExtent().Y;
-			NewBoidLocation.Z = FMath::Clamp(NewBoidLocation.Z, this->GetActorLocation().Z - CageCollision->GetScaledBoxExtent().Z, this->GetActorLocation().Z + CageCollision->GetScaledBoxExtent().Z);
-			EscapingBoid->SetActorLocation(NewBoidLocation);
-		}
-		//exited left side
-		else if (EscapingBoid->GetActorLocation().Y < this->GetActorLocation().Y - CageCollision->GetScaledBoxExtent().Y)
-		{
-			//move boid to right side
-			NewBoidLocation.X = FMath::Clamp(NewBoidLocation.X, this->GetActorLocation().X - CageCollision->GetScaledBoxExtent().X, this->GetActorLocation().X + CageCollision->GetScaledBoxExtent().X);
-			NewBoidLocation.Y = this->GetActorLocation().Y + CageCollision->GetScaledBoxExtent().Y;
-			NewBoidLocation.Z = FMath::Clamp(NewBoidLocation.Z, this->GetActorLocation().Z - CageCollision->GetScaledBoxExtent().Z, this->GetActorLocation().Z + CageCollision->GetScaledBoxExtent().Z);
-			EscapingBoid->SetActorLocation(NewBoidLocation);
-		}
-		//exited top side
-		else if (EscapingBoid->GetActorLocation().Z > this->GetActorLocation().Z + CageCollision->GetScaledBoxExtent().Z)
-		{
-			//move boid to bottom side
-			NewBoidLocation.X = FMath::Clamp(NewBoidLocation.X, this->GetActorLocation().X - CageCollision->GetScaledBoxExtent().X, this->GetActorLocation().X + CageCollision->GetScaledBoxExtent().X);
-			NewBoidLocation.Y = FMath::Clamp(NewBoidLocation.Y, this->GetActorLocation().Y - CageCollision->GetScaledBoxExtent().Y, this->GetActorLocation().Y + CageCollision->GetScaledBoxExtent().Y);
-			NewBoidLocation.Z = this->GetActorLocation().Z - CageCollision->GetScaledBoxExtent().Z;
-			EscapingBoid->SetActorLocation(NewBoidLocation);
-		}
-		//exited bottom side
-		else if (EscapingBoid->GetActorLocation().Z < this->GetActorLocation().Z - CageCollision->GetScaledBoxExtent().Z)
-		{
-			//move boid to top side
-			NewBoidLocation.X = FMath::Clamp(NewBoidLocation.X, this->GetActorLocation().X - CageCollision->GetScaledBoxExtent().X, this->GetActorLocation().X + CageCollision->GetScaledBoxExtent().X);
-			NewBoidLocation.Y = FMath::Clamp(NewBoidLocation.Y, this->GetActorLocation().Y - CageCollision->GetScaledBoxExtent().Y, this->GetActorLocation().Y + CageCollision->GetScaledBoxExtent().Y);
-			NewBoidLocation.Z = this->GetActorLocation().Z + CageCollision->GetScaledBoxExtent().Z;
-			EscapingBoid->SetActorLocation(NewBoidLocation);
-		}
-		//unexpected exit occurred, remove boid from flock, destroy it, and spawn new one
-		else
-		{
-			EscapingBoid->GetFlockManager()->RemoveBoidFromFlock(EscapingBoid);
-			GetWorld()->DestroyActor(EscapingBoid);
-			SpawnBoids(1);
-		}
-	}
-}
-
-void ABoidCageSpawner::SpawnBoids(int32 NumBoids)
-{
-	//check for assigned flock manager
-	if (AssignedFlockManager == nullptr)
-	{
-		//log warning to console
-		UE_LOG(LogTemp, Warning, TEXT("No FlockManager found for Boid spawner: %s."), *GetName());
-		return;
-	}
-
-	//check BoidType is set in BP
-	if (BoidType == nullptr)
-	{
-		//log warning to console
-		UE_LOG(LogTemp, Warning, TEXT("BoidType not set for Spawner: %s"), *GetName());
-		return;
-	}
-
-	//spawn boids
-	FVector SpawnLocation = FVector::ZeroVector;
-	FRotator SpawnRotation = FRotator::ZeroRotator;
-	FActorSpawnParameters BoidSpawnParams;
-	BoidSpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-	BoidSpawnParams.Owner = AssignedFlockManager;
-
-	for (int i = 0; i < NumBoids; ++i)
-	{
-		//spawn boids randomly within cage
-		SpawnLocation.X = FMath::FRandRange(-CageCollision->GetScaledBoxExtent().X, CageCollision->GetScaledBoxExtent().X);
-		SpawnLocation.Y = FMath::FRandRange(-CageCollision->GetScaledBoxExtent().Y, CageCollision->GetScaledBoxExtent().Y);
-		SpawnLocation.Z = FMath::FRandRange(-CageCollision->GetScaledBoxExtent().Z, CageCollision->GetScaledBoxExtent().Z);
-		SpawnLocation += this->GetActorLocation();
-		SpawnRotation = FMath::VRand().ToOrientationRotator();
-		AssignedFlockManager->AddBoidToFlock(GetWorld()->SpawnActor<ABoid>(BoidType, SpawnLocation, SpawnRotation, BoidSpawnParams));
-	}
-}
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮ਊ椣据畬敤∠潂摩慃敧灓睡敮⹲≨⌊湩汣摵⁥䌢浯潰敮瑮⽳潂䍸浯潰敮瑮栮ਢ椣据畬敤∠潃灭湯湥獴匯慴楴䵣獥䍨浯潰敮瑮栮ਢ椣据畬敤∠潂摩栮ਢ椣据畬敤∠汆捯䵫湡条牥栮ਢ䄊潂摩慃敧灓睡敮㩲䄺潂摩慃敧灓睡敮⡲਩੻⼉搯獩扡敬愠瑣牯琠捩楫杮ऊ牐浩牡䅹瑣牯楔正戮慃䕮敶呲捩⁫‽慦獬㭥ਊ⼉猯瑥灵挠条⁥潣汬獩潩⁮潣灭湯湥ੴ䌉条䍥汯楬楳湯㴠䌠敲瑡䑥晥畡瑬畓潢橢捥㱴䉕硯潃灭湯湥㹴吨塅⡔䌢条⁥潃汬獩潩⁮潃灭湯湥≴⤩਻刉潯䍴浯潰敮瑮㴠䌠条䍥汯楬楳湯਻䌉条䍥汯楬楳湯㸭敓䉴硯硅整瑮䘨敖瑣牯㈨〵⤰㬩ऊ慃敧潃汬獩潩⵮匾瑥潃汬獩潩䕮慮汢摥䔨潃汬獩潩䕮慮汢摥㨺畑牥佹汮⥹਻䌉条䍥汯楬楳湯㸭敓䍴汯楬楳湯敒灳湯敳潔汁䍬慨湮汥⡳䍅归杉潮敲㬩ऊ慃敧潃汬獩潩⵮匾瑥潃汬獩潩剮獥潰獮呥䍯慨湮汥䔨䍃偟睡Ɱ䔠剃佟敶汲灡㬩ਊ⼉猯瑥灵挠条⁥敭桳挠浯潰敮瑮ऊ慃敧敍桳㴠䌠敲瑡䑥晥畡瑬畓潢橢捥㱴单慴楴䵣獥䍨浯潰敮瑮⠾䕔员∨慃敧䴠獥⁨潃灭湯湥≴⤩਻䌉条䵥獥⵨匾瑥灵瑁慴档敭瑮刨潯䍴浯潰敮瑮㬩ऊ慃敧敍桳㸭敓剴汥瑡癩䱥捯瑡潩⡮噆捥潴⡲⸰昰‬⸰昰‬⸰昰⤩਻䌉条䵥獥⵨匾瑥潗汲卤慣敬䐳䘨敖瑣牯ㄨ〮ⱦㄠ〮ⱦㄠ〮⥦㬩ਊ⼉猯瑥椠楮楴污映潬正猠穩⁥湩挠条੥三浵潂摩味卯慰湷㴠〠਻੽瘊楯⁤䉁楯䍤条卥慰湷牥㨺敂楧偮慬⡹਩੻匉灵牥㨺敂楧偮慬⡹㬩ਊ⼉戯湩⁤潣汬獩潩⁮潣灭湯湥⁴癯牥慬⁰癥湥⁴潴搠汥来瑡⁥桴瑡朠瑥⁳慣汬摥琠⁯数晲牯⁭潬楧੣椉⁦䌨条䍥汯楬楳湯਩笉ऊ䌉条䍥汯楬楳湯㸭湏潃灭湯湥䕴摮癏牥慬⹰摁䑤湹浡捩琨楨ⱳ☠䉁楯䍤条卥慰湷牥㨺湏慃敧癏牥慬䕰摮㬩ऊ੽ऊ⼯灳睡⁮汦捯⁫景戠楯獤⠠汦捯⁫慭慮敧⁲敲瑳牯獥椠獴映潬正映潲⁭⁡湳灡桳瑯椠獮整摡眠敨⁮慷浲猠慴瑲摥਩椉⁦䄨獳杩敮䙤潬正慍慮敧⁲㴽渠汵灬牴簠⁼䄡獳杩敮䙤潬正慍慮敧⵲䤾坳牡卭慴瑲摥⤨਩笉ऊ匉慰湷潂摩⡳畎䉭楯獤潔灓睡⥮਻紉紊ਊ潶摩䄠潂摩慃敧灓睡敮㩲伺䍮条佥敶汲灡湅⡤偕楲業楴敶潃灭湯湥⩴传敶汲灡数䍤浯潰敮瑮‬䅁瑣牯‪瑏敨䅲瑣牯‬偕楲業楴敶潃灭湯湥⩴传桴牥潃灭‬湩㍴′瑏敨䉲摯䥹摮硥਩੻⼉振敨正椠⁦捡潴⁲敬癡湩⁧慣敧椠⁳⁡慶楬⁤潢摩愠摮渠瑯戠楥杮搠獥牴祯摥ऊ䉁楯⩤䔠捳灡湩䉧楯⁤‽慃瑳䄼潂摩⠾瑏敨䅲瑣牯㬩ऊ晩⠠獅慣楰杮潂摩਩笉ऊ椉⁦䔨捳灡湩䉧楯ⵤ䤾䅳瑣牯敂湩䑧獥牴祯摥⤨ ⁻敲畴湲※੽ऊ䘉敖瑣牯丠睥潂摩潌慣楴湯㴠䔠捳灡湩䉧楯ⵤ䜾瑥捁潴䱲捯瑡潩⡮㬩ऊ⼉振敨正眠楨档猠摩⡥⥳漠⁦桴⁥慣敧琠敨戠楯⁤獩氠慥楶杮ऊ⼉支楸整⁤牦湯⁴楳敤ऊ椉⁦䔨捳灡湩䉧楯ⵤ䜾瑥捁潴䱲捯瑡潩⡮⸩⁘‾桴獩㸭敇䅴瑣牯潌慣楴湯⤨堮⬠䌠条䍥汯楬楳湯㸭敇却慣敬䉤硯硅整瑮⤨堮਩उ੻उ⼉洯癯⁥潢摩琠⁯慢正猠摩੥उ三睥潂摩潌慣楴湯堮㴠琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁘‭慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩㭘ऊउ敎䉷楯䱤捯瑡潩⹮⁙‽䵆瑡㩨䌺慬灭丨睥潂摩潌慣楴湯央‬桴獩㸭敇䅴瑣牯潌慣楴湯⤨央ⴠ䌠条䍥汯楬楳湯㸭敇却慣敬䉤硯硅整瑮⤨央‬桴獩㸭敇䅴瑣牯潌慣楴湯⤨央⬠䌠条䍥汯楬楳湯㸭敇却慣敬䉤硯硅整瑮⤨央㬩ऊउ敎䉷楯䱤捯瑡潩⹮⁚‽䵆瑡㩨䌺慬灭丨睥潂摩潌慣楴湯娮‬桴獩㸭敇䅴瑣牯潌慣楴湯⤨娮ⴠ䌠条䍥汯楬楳湯㸭敇却慣敬䉤硯硅整瑮⤨娮‬桴獩㸭敇䅴瑣牯潌慣楴湯⤨娮⬠䌠条䍥汯楬楳湯㸭敇却慣敬䉤硯硅整瑮⤨娮㬩ऊउ獅慣楰杮潂摩㸭敓䉴楯䱤捯瑡潩⡮敎䉷楯䱤捯瑡潩⥮਻उ੽उ⼯硥瑩摥戠捡⁫楳敤ऊ攉獬⁥晩⠠獅慣楰杮潂摩㸭敇䅴瑣牯潌慣楴湯⤨堮㰠琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁘‭慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩⥘ऊ笉ऊउ⼯潭敶戠楯⁤潴映潲瑮猠摩੥उ三睥潂摩潌慣楴湯堮㴠琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁘‫慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩㭘ऊउ敎䉷楯䱤捯瑡潩⹮⁙‽䵆瑡㩨䌺慬灭丨睥潂摩潌慣楴湯央‬桴獩㸭敇䅴瑣牯潌慣楴湯⤨央ⴠ䌠条䍥汯楬楳湯㸭敇却慣敬䉤硯硅整瑮⤨央‬桴獩㸭敇䅴瑣牯潌慣楴湯⤨央⬠䌠条䍥汯楬楳湯㸭敇却慣敬䉤硯硅整瑮⤨央㬩ऊउ敎䉷楯䱤捯瑡潩⹮⁚‽䵆瑡㩨䌺慬灭丨睥潂摩潌慣楴湯娮‬桴獩㸭敇䅴瑣牯潌慣楴湯⤨娮ⴠ䌠条䍥汯楬楳湯㸭敇却慣敬䉤硯硅整瑮⤨娮‬桴獩㸭敇䅴瑣牯潌慣楴湯⤨娮⬠䌠条䍥汯楬楳湯㸭敇却慣敬䉤硯硅整瑮⤨娮㬩ऊउ獅慣楰杮潂摩㸭敓䉴楯䱤捯瑡潩⡮敎䉷楯䱤捯瑡潩⥮਻उ੽उ⼯硥瑩摥爠杩瑨猠摩੥उ汥敳椠⁦䔨捳灡湩䉧楯ⵤ䜾瑥捁潴䱲捯瑡潩⡮⸩⁙‾桴獩㸭敇䅴瑣牯潌慣楴湯⤨央⬠䌠条䍥汯楬楳湯㸭敇却慣敬䉤硯硅整瑮⤨央਩उ੻उ⼉洯癯⁥潢摩琠⁯敬瑦猠摩੥उ三睥潂摩潌慣楴湯堮㴠䘠慍桴㨺汃浡⡰敎䉷楯䱤捯瑡潩⹮ⱘ琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁘‭慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩ⱘ琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁘‫慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩⥘਻उ三睥潂摩潌慣楴湯央㴠琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁙‭慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩㭙ऊउ敎䉷楯䱤捯瑡潩⹮⁚‽䵆瑡㩨䌺慬灭丨睥潂摩潌慣楴湯娮‬桴獩㸭敇䅴瑣牯潌慣楴湯⤨娮ⴠ䌠条䍥汯楬楳湯㸭敇却慣敬䉤硯硅整瑮⤨娮‬桴獩㸭敇䅴瑣牯潌慣楴湯⤨娮⬠䌠条䍥汯楬楳湯㸭敇却慣敬䉤硯硅整瑮⤨娮㬩ऊउ獅慣楰杮潂摩㸭敓䉴楯䱤捯瑡潩⡮敎䉷楯䱤捯瑡潩⥮਻उ੽उ⼯硥瑩摥氠晥⁴楳敤ऊ攉獬⁥晩⠠獅慣楰杮潂摩㸭敇䅴瑣牯潌慣楴湯⤨央㰠琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁙‭慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩⥙ऊ笉ऊउ⼯潭敶戠楯⁤潴爠杩瑨猠摩੥उ三睥潂摩潌慣楴湯堮㴠䘠慍桴㨺汃浡⡰敎䉷楯䱤捯瑡潩⹮ⱘ琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁘‭慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩ⱘ琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁘‫慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩⥘਻उ三睥潂摩潌慣楴湯央㴠琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁙‫慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩㭙ऊउ敎䉷楯䱤捯瑡潩⹮⁚‽䵆瑡㩨䌺慬灭丨睥潂摩潌慣楴湯娮‬桴獩㸭敇䅴瑣牯潌慣楴湯⤨娮ⴠ䌠条䍥汯楬楳湯㸭敇却慣敬䉤硯硅整瑮⤨娮‬桴獩㸭敇䅴瑣牯潌慣楴湯⤨娮⬠䌠条䍥汯楬楳湯㸭敇却慣敬䉤硯硅整瑮⤨娮㬩ऊउ獅慣楰杮潂摩㸭敓䉴楯䱤捯瑡潩⡮敎䉷楯䱤捯瑡潩⥮਻उ੽उ⼯硥瑩摥琠灯猠摩੥उ汥敳椠⁦䔨捳灡湩䉧楯ⵤ䜾瑥捁潴䱲捯瑡潩⡮⸩⁚‾桴獩㸭敇䅴瑣牯潌慣楴湯⤨娮⬠䌠条䍥汯楬楳湯㸭敇却慣敬䉤硯硅整瑮⤨娮਩उ੻उ⼉洯癯⁥潢摩琠⁯潢瑴浯猠摩੥उ三睥潂摩潌慣楴湯堮㴠䘠慍桴㨺汃浡⡰敎䉷楯䱤捯瑡潩⹮ⱘ琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁘‭慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩ⱘ琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁘‫慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩⥘਻उ三睥潂摩潌慣楴湯央㴠䘠慍桴㨺汃浡⡰敎䉷楯䱤捯瑡潩⹮ⱙ琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁙‭慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩ⱙ琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁙‫慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩⥙਻उ三睥潂摩潌慣楴湯娮㴠琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁚‭慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩㭚ऊउ獅慣楰杮潂摩㸭敓䉴楯䱤捯瑡潩⡮敎䉷楯䱤捯瑡潩⥮਻उ੽उ⼯硥瑩摥戠瑯潴⁭楳敤ऊ攉獬⁥晩⠠獅慣楰杮潂摩㸭敇䅴瑣牯潌慣楴湯⤨娮㰠琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁚‭慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩⥚ऊ笉ऊउ⼯潭敶戠楯⁤潴琠灯猠摩੥उ三睥潂摩潌慣楴湯堮㴠䘠慍桴㨺汃浡⡰敎䉷楯䱤捯瑡潩⹮ⱘ琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁘‭慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩ⱘ琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁘‫慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩⥘਻उ三睥潂摩潌慣楴湯央㴠䘠慍桴㨺汃浡⡰敎䉷楯䱤捯瑡潩⹮ⱙ琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁙‭慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩ⱙ琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁙‫慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩⥙਻उ三睥潂摩潌慣楴湯娮㴠琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮⸩⁚‫慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩㭚ऊउ獅慣楰杮潂摩㸭敓䉴楯䱤捯瑡潩⡮敎䉷楯䱤捯瑡潩⥮਻उ੽उ⼯湵硥数瑣摥攠楸⁴捯畣牲摥‬敲潭敶戠楯⁤牦浯映潬正‬敤瑳潲⁹瑩‬湡⁤灳睡⁮敮⁷湯੥उ汥敳ऊ笉ऊउ獅慣楰杮潂摩㸭敇䙴潬正慍慮敧⡲⴩刾浥癯䉥楯䙤潲䙭潬正䔨捳灡湩䉧楯⥤਻उ䜉瑥潗汲⡤⴩䐾獥牴祯捁潴⡲獅慣楰杮潂摩㬩ऊउ灓睡䉮楯獤ㄨ㬩ऊ紉ऊ੽੽瘊楯⁤䉁楯䍤条卥慰湷牥㨺灓睡䉮楯獤椨瑮㈳丠浵潂摩⥳笊ऊ⼯档捥⁫潦⁲獡楳湧摥映潬正洠湡条牥ऊ晩⠠獁楳湧摥汆捯䵫湡条牥㴠‽畮汬瑰⥲ऊ੻उ⼯潬⁧慷湲湩⁧潴挠湯潳敬ऊ唉彅佌⡇潌呧浥Ɒ圠牡楮杮‬䕔员∨潎䘠潬正慍慮敧⁲潦湵⁤潦⁲潂摩猠慰湷牥›猥∮Ⱙ⨠敇乴浡⡥⤩਻उ敲畴湲਻紉ਊ⼉振敨正䈠楯呤灹⁥獩猠瑥椠⁮偂ऊ晩⠠潂摩祔数㴠‽畮汬瑰⥲ऊ੻उ⼯潬⁧慷湲湩⁧潴挠湯潳敬ऊ唉彅佌⡇潌呧浥Ɒ圠牡楮杮‬䕔员∨潂摩祔数渠瑯猠瑥映牯匠慰湷牥›猥⤢‬䜪瑥慎敭⤨㬩ऊ爉瑥牵㭮ऊ੽ऊ⼯畱略⁥潢摩⁳潴戠⁥灳睡敮⁤祢映潬正洠湡条牥ऊ噆捥潴⁲灓睡䱮捯瑡潩⁮‽噆捥潴㩲娺牥噯捥潴㭲ऊ剆瑯瑡牯匠慰湷潒慴楴湯㴠䘠潒慴潴㩲娺牥副瑯瑡牯਻ऊ潦⁲椨瑮椠㴠〠※⁩‼畎䉭楯獤※⬫⥩ऊ੻उ⼯灳睡⁮潢摩⁳慲摮浯祬眠瑩楨⁮慣敧ऊ匉慰湷潌慣楴湯堮㴠䘠慍桴㨺剆湡剤湡敧⴨慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩ⱘ䌠条䍥汯楬楳湯㸭敇却慣敬䉤硯硅整瑮⤨堮㬩ऊ匉慰湷潌慣楴湯央㴠䘠慍桴㨺剆湡剤湡敧⴨慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩ⱙ䌠条䍥汯楬楳湯㸭敇却慣敬䉤硯硅整瑮⤨央㬩ऊ匉慰湷潌慣楴湯娮㴠䘠慍桴㨺剆湡剤湡敧⴨慃敧潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩ⱚ䌠条䍥汯楬楳湯㸭敇却慣敬䉤硯硅整瑮⤨娮㬩ऊ匉慰湷潌慣楴湯⬠‽桴獩㸭敇䅴瑣牯潌慣楴湯⤨਻उ灓睡剮瑯瑡潩⁮‽䵆瑡㩨嘺慒摮⤨吮佯楲湥慴楴湯潒慴潴⡲㬩ऊ䄉獳杩敮䙤潬正慍慮敧⵲儾敵敵潂摩灓睡⡮潂摩祔数‬呆慲獮潦浲匨慰湷潒慴楴湯‬灓睡䱮捯瑡潩⥮㬩ऊ੽੽
\ No newline at end of file
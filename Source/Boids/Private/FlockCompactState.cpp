@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠汆捯䍫浯慰瑣瑓瑡⹥≨ਊ慮敭灳捡੥੻椉瑮㘱儠慵瑮穩卥潮浲㘱昨潬瑡嘠污敵਩笉ऊ爉瑥牵⁮湩ㅴ⠶䵆瑡㩨刺畯摮潔湉⡴䵆瑡㩨䌺慬灭嘨污敵‬ㄭ〮ⱦㄠ〮⥦⨠㌠㜲㜶〮⥦㬩ऊ੽੽瘊楯⁤䙆潬正潃灭捡却慴整㨺浅瑰⡹਩੻䈉楯獤䔮灭祴⤨਻੽瘊楯⁤䙆潬正潃灭捡却慴整㨺慐正挨湯瑳吠牁慲㱹噆捥潴㹲…潐楳楴湯ⱳ挠湯瑳吠牁慲㱹噆捥潴㹲…敖潬楣楴獥‬汦慯⁴慍卸数摥਩੻按湯瑳椠瑮㈳丠浵潂摩⁳‽潐楳楴湯⹳畎⡭㬩ऊ潂摩⹳敓乴浵湕湩瑩慩楬敺⡤畎䉭楯獤㬩ऊ晩⠠畎䉭楯獤㴠‽⤰笠爠瑥牵㭮素ਊ⼉瀯獯瑩潩獮愠敲猠潴敲⁤敲慬楴敶琠⁯桴⁥散瑮牥漠⁦桴⁥汦捯❫⁳潢湵獤猠⁯桴⁥㘱戭瑩爠湡敧挠癯牥⁳桴⁥桷汯⁥汦捯੫䘉潂⁸汆捯䉫畯摮⡳潐楳楴湯⹳敇䑴瑡⡡Ⱙ丠浵潂摩⥳਻䘉敖瑣牯䔠瑸湥⁴‽汆捯䉫畯摮⹳敇䕴瑸湥⡴㬩ऊ牏杩湩㴠䘠潬正潂湵獤䜮瑥敃瑮牥⤨਻倉獯瑩潩卮慣敬㴠䘠慍桴㨺慍⡸䵆瑡㩨䴺硡⠳硅整瑮堮‬硅整瑮央‬硅整瑮娮  ㈳㘷⸷昰‬䥋䑎彁䵓䱁彌啎䉍剅㬩ऊ灓敥卤慣敬㴠䘠慍桴㨺慍⡸慍卸数摥⼠㘠㔵㔳〮ⱦ䬠义䅄卟䅍䱌也䵕䕂⥒਻按湯瑳映潬瑡䤠癮潐楳楴湯捓污⁥‽⸱昰⼠倠獯瑩潩卮慣敬਻按湯瑳映潬瑡䤠癮灓敥卤慣敬㴠ㄠ〮⁦ 灓敥卤慣敬਻ऊ潦⁲椨瑮㈳椠㴠〠※⁩‼畎䉭楯獤※⬫⥩ऊ੻उ䍆浯慰瑣潂摩…潂摩㴠䈠楯獤楛㭝ਊउ噆捥潴⁲晏獦瑥㴠⠠潐楳楴湯孳嵩ⴠ传楲楧⥮⨠䤠癮潐楳楴湯捓污㭥ऊ䈉楯⹤潐楳楴湯せ⁝‽湩ㅴ⠶䵆瑡㩨䌺慬灭䘨慍桴㨺潒湵呤䥯瑮伨晦敳⹴⥘‬㌭㜲㜶‬㈳㘷⤷㬩ऊ䈉楯⹤潐楳楴湯ㅛ⁝‽湩ㅴ⠶䵆瑡㩨䌺慬灭䘨慍桴㨺潒湵呤䥯瑮伨晦敳⹴⥙‬㌭㜲㜶‬㈳㘷⤷㬩ऊ䈉楯⹤潐楳楴湯㉛⁝‽湩ㅴ⠶䵆瑡㩨䌺慬灭䘨慍桴㨺潒湵呤䥯瑮伨晦敳⹴⥚‬㌭㜲㜶‬㈳㘷⤷㬩ਊउ⼯捯慴敨牤污攠据摯湩⁧慭獰琠敨栠慥楤杮漠瑮⁯⁡煳慵敲‬潬敷⁲敨業灳敨敲椠⁳潦摬摥漠敶⁲桴⁥楤条湯污ੳउ潣獮⁴噆捥潴♲嘠汥捯瑩⁹‽敖潬楣楴獥楛㭝ऊ昉潬瑡匠数摥㴠嘠汥捯瑩⹹楓敺⤨਻उ汦慯⁴畓⁭‽䵆瑡㩨䄺獢嘨汥捯瑩⹹⥘⬠䘠慍桴㨺扁⡳敖潬楣祴央 ‫䵆瑡㩨䄺獢嘨汥捯瑩⹹⥚਻उ汦慯⁴⁕‽畓⁭‾䥋䑎彁䵓䱁彌啎䉍剅㼠嘠汥捯瑩⹹⁘ 畓⁭›⸱昰਻उ汦慯⁴⁖‽畓⁭‾䥋䑎彁䵓䱁彌啎䉍剅㼠嘠汥捯瑩⹹⁙ 畓⁭›⸰昰਻उ晩⠠敖潬楣祴娮㰠〠〮⥦ऊ笉ऊउ汦慯⁴潆摬摥⁕‽ㄨ〮⁦‭䵆瑡㩨䄺獢嘨⤩⨠⠠⁕㴾〠〮⁦‿⸱昰㨠ⴠ⸱昰㬩ऊउ汦慯⁴潆摬摥⁖‽ㄨ〮⁦‭䵆瑡㩨䄺獢唨⤩⨠⠠⁖㴾〠〮⁦‿⸱昰㨠ⴠ⸱昰㬩ऊउ⁕‽潆摬摥㭕ऊउ⁖‽潆摬摥㭖ऊ紉ऊ䈉楯⹤效摡湩孧崰㴠儠慵瑮穩卥潮浲㘱唨㬩ऊ䈉楯⹤效摡湩孧崱㴠儠慵瑮穩卥潮浲㘱嘨㬩ऊ䈉楯⹤灓敥⁤‽極瑮㘱䘨慍桴㨺汃浡⡰䵆瑡㩨刺畯摮潔湉⡴灓敥⁤‪湉卶数摥捓污⥥‬ⰰ㘠㔵㔳⤩਻紉紊
\ No newline at end of file
@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠汆捯䙫潬䙷敩摬栮ਢ瘊楯⁤䙆潬正汆睯楆汥㩤刺獥瑥⤨笊ऊ楄敲瑣潩獮䔮灭祴⤨਻䐉浩湥楳湯⁳‽䥆瑮敖瑣牯㨺敚潲慖畬㭥ऊ畎䉭潬正摥敃汬⁳‽㬰ऊ畎啭牮慥档扡敬敃汬⁳‽㬰紊ਊ潶摩䘠汆捯䙫潬䙷敩摬㨺畂汩⡤潣獮⁴䉆硯…潂湵獤‬汦慯⁴湉敃汬楓敺‬潣獮⁴噆捥潴♲䜠慯ⱬ吠畆据楴湯敒㱦潢汯挨湯瑳䘠敖瑣牯Ⱖ映潬瑡㸩䤠䉳潬正摥‬湩㍴′慍䍸汥獬਩੻刉獥瑥⤨਻ऊ⼯档捥⁫潦⁲慶楬⁤湩異ੴ椉⁦ℨ潂湵獤䤮噳污摩簠⁼湉敃汬楓敺㰠‽⸰昰 ⁻敲畴湲※੽ऊ⼯牧睯挠汥獬甠瑮汩琠敨朠楲⁤楦獴椠⁮桴⁥散汬戠摵敧⁴搨畯汢湩⁧桴⁥散汬瘠汯浵⁥慥档猠整⥰ऊ潣獮⁴噆捥潴⁲楓敺㴠䈠畯摮⹳敇却穩⡥㬩ऊ敃汬楓敺㴠䤠䍮汥卬穩㭥ऊ潤ऊ੻उ楄敭獮潩獮堮㴠䘠慍桴㨺慍⡸䵆瑡㩨䌺楥呬䥯瑮匨穩⹥⁘ 敃汬楓敺Ⱙㄠ㬩ऊ䐉浩湥楳湯⹳⁙‽䵆瑡㩨䴺硡䘨慍桴㨺敃汩潔湉⡴楓敺央⼠䌠汥卬穩⥥‬⤱਻उ楄敭獮潩獮娮㴠䘠慍桴㨺慍⡸䵆瑡㩨䌺楥呬䥯瑮匨穩⹥⁚ 敃汬楓敺Ⱙㄠ㬩ऊ䌉汥卬穩⁥㴪ㄠ㈮昶਻紉眠楨敬⠠湩㙴⠴楄敭獮潩獮堮 ‪楄敭獮潩獮央⨠䐠浩湥楳湯⹳⁚‾慍䍸汥獬㬩ऊ敃汬楓敺⼠‽⸱㘲㭦ਊ⼉振湥整⁲牧摩漠⁮潢湵獤猠⁯⁡楳杮敬氠祡牥猠瑩⁳湯琠敨戠畯摮❳栠楥桧ੴ伉楲楧⁮‽潂湵獤䜮瑥敃瑮牥⤨ⴠ䘠敖瑣牯䐨浩湥楳湯⥳⨠䌠汥卬穩⁥‪⸰昵਻按湯瑳椠瑮㈳丠浵敃汬⁳‽楄敭獮潩獮堮⨠䐠浩湥楳湯⹳⁙‪楄敭獮潩獮娮਻ऊ⼯楦摮挠汥獬漠敶汲灡楰杮漠獢慴汣獥ऊ䉔瑩牁慲㱹‾求捯敫⡤慦獬ⱥ丠浵敃汬⥳਻昉牯⠠湩㍴′⁚‽㬰娠㰠䐠浩湥楳湯⹳㭚⬠娫਩笉ऊ昉牯⠠湩㍴′⁙‽㬰夠㰠䐠浩湥楳湯⹳㭙⬠夫਩उ੻उ昉牯⠠湩㍴′⁘‽㬰堠㰠䐠浩湥楳湯⹳㭘⬠堫਩उ笉ऊउ椉⁦䤨䉳潬正摥䜨瑥敃汬敃瑮牥堨‬ⱙ娠Ⱙ䌠汥卬穩⁥‪⸰昵⤩ऊउ笉ऊउउ求捯敫孤敇䍴汥䥬摮硥堨‬ⱙ娠崩㴠琠畲㭥ऊउउ畎䉭潬正摥敃汬⭳㬫ऊउ紉ऊउ੽उ੽紉ਊ⼉术慯⁬散汬‬潧污⁳畯獴摩⁥景琠敨映敩摬愠敲爠慥档摥琠牨畯桧琠敨挠潬敳瑳戠牯敤⁲散汬ऊ潣獮⁴噆捥潴⁲潇污敃汬潌慣楴湯㴠⠠潇污ⴠ传楲楧⥮⼠䌠汥卬穩㭥ऊ潣獮⁴䥆瑮敖瑣牯䜠慯䍬汥⡬ऊ䘉慍桴㨺汃浡⡰䵆瑡㩨䘺潬牯潔湉⡴潇污敃汬潌慣楴湯堮Ⱙ〠‬楄敭獮潩獮堮ⴠㄠⰩऊ䘉慍桴㨺汃浡⡰䵆瑡㩨䘺潬牯潔湉⡴潇污敃汬潌慣楴湯央Ⱙ〠‬楄敭獮潩獮央ⴠㄠⰩऊ䘉慍桴㨺汃浡⡰䵆瑡㩨䘺潬牯潔湉⡴潇污敃汬潌慣楴湯娮Ⱙ〠‬楄敭獮潩獮娮ⴠㄠ⤩਻ऊ⼯潲瑵⁥楤瑳湡散漠⁦癥牥⁹牦敥挠汥⁬潴琠敨朠慯⁬搨橩獫牴⁡癯牥琠敨㈠‶敮杩扨畯獲漠⁦慥档挠汥⥬ऊ䅔牲祡昼潬瑡‾楄瑳湡散㭳ऊ楄瑳湡散⹳湉瑩䴨塁晟瑬‬畎䍭汥獬㬩ऊ䅔牲祡吼慐物昼潬瑡‬湩㍴㸲‾牆湯楴牥਻愉瑵⁯牆湯楴牥牐摥捩瑡⁥‽嵛挨湯瑳吠慐物昼潬瑡‬湩㍴㸲…ⱁ挠湯瑳吠慐物昼潬瑡‬湩㍴㸲…⥂笠爠瑥牵⁮⹁敋⁹‼⹂敋㭹素਻按湯瑳椠瑮㈳䜠慯䥬摮硥㴠䜠瑥敃汬湉敤⡸潇污敃汬堮‬潇污敃汬央‬潇污敃汬娮㬩ऊ楄瑳湡散孳潇污湉敤嵸㴠〠〮㭦ऊ牆湯楴牥䠮慥偰獵⡨偔楡㱲汦慯ⱴ椠瑮㈳⠾⸰昰‬潇污湉敤⥸‬牆湯楴牥牐摥捩瑡⥥਻ऊ桷汩⁥䘨潲瑮敩⹲畎⡭ ‾⤰ऊ੻उ偔楡㱲汦慯ⱴ椠瑮㈳‾畃牲湥㭴ऊ䘉潲瑮敩⹲效灡潐⡰畃牲湥ⱴ䘠潲瑮敩偲敲楤慣整‬慦獬⥥਻उ潣獮⁴湩㍴′敃汬湉敤⁸‽畃牲湥⹴慖畬㭥ऊ椉⁦䌨牵敲瑮䬮祥㸠䐠獩慴据獥䍛汥䥬摮硥⥝笠挠湯楴畮㭥素⼉振汥⁬慷⁳污敲摡⁹敲捡敨⁤祢愠猠潨瑲牥爠畯整ਊउ潣獮⁴湩㍴′⁘‽敃汬湉敤⁸‥楄敭獮潩獮堮਻उ潣獮⁴湩㍴′⁙‽䌨汥䥬摮硥⼠䐠浩湥楳湯⹳⥘┠䐠浩湥楳湯⹳㭙ऊ按湯瑳椠瑮㈳娠㴠䌠汥䥬摮硥⼠⠠楄敭獮潩獮堮⨠䐠浩湥楳湯⹳⥙਻उ潦⁲椨瑮㈳䐠⁚‽ㄭ※婄㰠‽㬱⬠䐫⥚ऊ笉ऊउ潦⁲椨瑮㈳䐠⁙‽ㄭ※奄㰠‽㬱⬠䐫⥙ऊउ੻उउ潦⁲椨瑮㈳䐠⁘‽ㄭ※塄㰠‽㬱⬠䐫⥘ऊउ笉ऊउउ潣獮⁴湩㍴′塎㴠堠⬠䐠ⱘ丠⁙‽⁙‫奄‬婎㴠娠⬠䐠㭚ऊउउ晩⠠塎㰠〠簠⁼奎㰠〠簠⁼婎㰠〠簠⁼塎㸠‽楄敭獮潩獮堮簠⁼奎㸠‽楄敭獮潩獮央簠⁼婎㸠‽楄敭獮潩獮娮 ⁻潣瑮湩敵※੽ऊउउ潣獮⁴湩㍴′敎杩扨畯䥲摮硥㴠䜠瑥敃汬湉敤⡸塎‬奎‬婎㬩ऊउउ晩⠠求捯敫孤敎杩扨畯䥲摮硥⥝笠挠湯楴畮㭥素ਊउउ⼉猯整⁰潣瑳椠⁳桴⁥楤瑳湡散戠瑥敷湥挠汥⁬散瑮牥⁳ㄨ‬煳瑲㈠漠⁲煳瑲㌠挠汥獬਩उउ按湯瑳映潬瑡䐠獩慴据⁥‽畃牲湥⹴敋⁹‫䵆瑡㩨区牱⡴汦慯⡴塄⨠䐠⁘‫奄⨠䐠⁙‫婄⨠䐠⥚㬩ऊउउ晩⠠楄瑳湡散㰠䐠獩慴据獥乛楥桧潢牵湉敤嵸਩उउ笉ऊउउ䐉獩慴据獥乛楥桧潢牵湉敤嵸㴠䐠獩慴据㭥ऊउउ䘉潲瑮敩⹲效灡畐桳吨慐物昼潬瑡‬湩㍴㸲䐨獩慴据ⱥ丠楥桧潢牵湉敤⥸‬牆湯楴牥牐摥捩瑡⥥਻उउ紉ऊउ紉ऊउ੽उ੽紉ਊ⼉瀯楯瑮攠敶祲挠汥⁬瑡椠獴挠潬敳瑳渠楥桧潢牵琠⁯桴⁥潧污‬汢捯敫⁤散汬⁳潰湩⁴瑡愠祮爠慥档扡敬渠楥桧潢牵琠⁯異桳戠楯獤漠瑵ऊ楄敲瑣潩獮䤮楮⡴噆捥潴㩲娺牥噯捥潴Ⱳ丠浵敃汬⥳਻昉牯⠠湩㍴′⁚‽㬰娠㰠䐠浩湥楳湯⹳㭚⬠娫਩笉ऊ昉牯⠠湩㍴′⁙‽㬰夠㰠䐠浩湥楳湯⹳㭙⬠夫਩उ੻उ昉牯⠠湩㍴′⁘‽㬰堠㰠䐠浩湥楳湯⹳㭘⬠堫਩उ笉ऊउ按湯瑳椠瑮㈳䌠汥䥬摮硥㴠䜠瑥敃汬湉敤⡸ⱘ夠‬⥚਻उउ潣獮⁴噆捥潴⁲敃汬敃瑮牥㴠䜠瑥敃汬敃瑮牥堨‬ⱙ娠㬩ऊउ椉⁦䌨汥䥬摮硥㴠‽潇污湉敤⥸ऊउ笉ऊउउ楄敲瑣潩獮䍛汥䥬摮硥⁝‽䜨慯⁬‭敃汬敃瑮牥⸩敇却晡乥牯慭⡬㬩ऊउउ潣瑮湩敵਻उउ੽ऊउ昉潬瑡䈠獥䑴獩慴据⁥‽求捯敫孤敃汬湉敤嵸㼠䴠塁晟瑬㨠䐠獩慴据獥䍛汥䥬摮硥㭝ऊउ䘉敖瑣牯䈠獥䑴物捥楴湯㴠䘠敖瑣牯㨺敚潲敖瑣牯਻उउ潦⁲椨瑮㈳䐠⁚‽ㄭ※婄㰠‽㬱⬠䐫⥚ऊउ笉ऊउउ潦⁲椨瑮㈳䐠⁙‽ㄭ※奄㰠‽㬱⬠䐫⥙ऊउउ੻उउउ潦⁲椨瑮㈳䐠⁘‽ㄭ※塄㰠‽㬱⬠䐫⥘ऊउउ笉ऊउउउ潣獮⁴湩㍴′塎㴠堠⬠䐠ⱘ丠⁙‽⁙‫奄‬婎㴠娠⬠䐠㭚ऊउउउ晩⠠塎㰠〠簠⁼奎㰠〠簠⁼婎㰠〠簠⁼塎㸠‽楄敭獮潩獮堮簠⁼奎㸠‽楄敭獮潩獮央簠⁼婎㸠‽楄敭獮潩獮娮 ⁻潣瑮湩敵※੽ऊउउउ潣獮⁴汦慯⁴敎杩扨畯䑲獩慴据⁥‽楄瑳湡散孳敇䍴汥䥬摮硥丨ⱘ丠ⱙ丠⥚㭝ऊउउउ晩⠠敎杩扨畯䑲獩慴据⁥‼敂瑳楄瑳湡散਩उउउ笉ऊउउउ䈉獥䑴獩慴据⁥‽敎杩扨畯䑲獩慴据㭥ऊउउउ䈉獥䑴物捥楴湯㴠䘠敖瑣牯䐨ⱘ䐠ⱙ䐠⥚䜮瑥慓敦潎浲污⤨਻उउउ紉ऊउउ紉ऊउउ੽उउ੽ऊउ䐉物捥楴湯孳敃汬湉敤嵸㴠䈠獥䑴物捥楴湯਻उउ晩⠠䈡潬正摥䍛汥䥬摮硥⁝☦䐠獩慴据獥䍛汥䥬摮硥⁝㴽䴠塁晟瑬਩उउ੻उउ三浵湕敲捡慨汢䍥汥獬⬫਻उउ੽उ紉ऊ紉ऊ੽੽䘊敖瑣牯䘠汆捯䙫潬䙷敩摬㨺慓灭敬挨湯瑳䘠敖瑣牯…潌慣楴湯 潣獮ੴ੻⼉振敨正映敩摬栠獡戠敥⁮畢汩ੴ椉⁦䐨物捥楴湯⹳畎⡭ 㴽〠 ⁻敲畴湲䘠敖瑣牯㨺敚潲敖瑣牯※੽ऊ潣獮⁴噆捥潴⁲敃汬潌慣楴湯㴠⠠潌慣楴湯ⴠ传楲楧⥮⼠䌠汥卬穩㭥ऊ潣獮⁴湩㍴′⁘‽䵆瑡㩨䘺潬牯潔湉⡴敃汬潌慣楴湯堮㬩ऊ潣獮⁴湩㍴′⁙‽䵆瑡㩨䘺潬牯潔湉⡴敃汬潌慣楴湯央㬩ऊ潣獮⁴湩㍴′⁚‽楄敭獮潩獮娮㸠ㄠ㼠䘠慍桴㨺汆潯呲䥯瑮䌨汥䱬捯瑡潩⹮⥚㨠〠਻椉⁦堨㰠〠簠⁼⁙‼‰籼娠㰠〠簠⁼⁘㴾䐠浩湥楳湯⹳⁘籼夠㸠‽楄敭獮潩獮央簠⁼⁚㴾䐠浩湥楳湯⹳⥚ऊ੻उ敲畴湲䘠敖瑣牯㨺敚潲敖瑣牯਻紉ਊ爉瑥牵⁮楄敲瑣潩獮䝛瑥敃汬湉敤⡸ⱘ夠‬⥚㭝紊
\ No newline at end of file
@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠汆捯䙫牯散畂晦牥栮ਢ椣据畬敤∠䅈⽌汐瑡潦浲䱔⹓≨ਊ䙆潬正潆捲䉥晵敦㩲縺䙆潬正潆捲䉥晵敦⡲਩੻昉牯⠠䱆湡♥䰠湡⁥›慌敮⥳ऊ੻उ敤敬整䰠湡⹥慂捴㭨ऊ੽眉楨敬⠠䉆瑡档‪慂捴⁨‽畆汬慂捴敨⹳潐⡰⤩ऊ੻उ敤敬整䈠瑡档਻紉ऊ桷汩⁥䘨慂捴⩨䈠瑡档㴠䘠敲䉥瑡档獥倮灯⤨਩笉ऊ搉汥瑥⁥慂捴㭨ऊ੽੽瘊楯⁤䙆潬正潆捲䉥晵敦㩲䄺摤挨湯瑳䘠汆捯䙫牯散…潆捲⥥笊ऊ䱆湡♥䰠湡⁥‽慌敮孳偆慬晴牯呭卌㨺敇䍴牵敲瑮桔敲摡摉⤨┠丠浵慌敮嵳਻ऊ⼯慴敫琠敨氠湡❥⁳灯湥戠瑡档‬牯漠数⁮⁡敲祣汣摥漠敮椠⁦湡瑯敨⁲桴敲摡漠⁲桴⁥牤楡⁮潨摬⁳瑩⠠⁡敮⁷湯⁥獩漠汮⁹污潬慣整⁤湵楴⁬桴⁥畢晦牥栠獡眠牡敭⁤灵਩䘉慂捴⩨䈠瑡档㴠⠠䉆瑡档⤪偆慬晴牯䅭潴業獣㨺湉整汲捯敫䕤捸慨杮健牴⠨潶摩⨪☩慌敮䈮瑡档‬畮汬瑰⥲਻椉⁦ℨ慂捴⥨ऊ੻उ慂捴⁨‽牆敥慂捴敨⹳潐⡰㬩ऊ椉⁦ℨ慂捴⥨ऊ笉ऊउ慂捴⁨‽敮⁷䉆瑡档⤨਻उ੽紉ਊ䈉瑡档㸭潆捲獥䉛瑡档㸭畎⭭崫㴠䘠牯散਻椉⁦䈨瑡档㸭畎⁭㴽䘠慂捴㩨䌺灡捡瑩⥹ऊ੻उ畆汬慂捴敨⹳畐桳䈨瑡档㬩ऊ爉瑥牵㭮ऊ੽ऊ⼯異⁴桴⁥慢捴⁨慢正‬⁡慢捴⁨湡瑯敨⁲桴敲摡氠晥⁴湩琠敨氠湡⁥敭湡桷汩⁥獩栠湡敤⁤潴琠敨搠慲湩愠⁳瑩椠ੳ䘉慂捴⩨䐠獩汰捡摥慂捴⁨‽䘨慂捴⩨䘩汐瑡潦浲瑁浯捩㩳䤺瑮牥潬正摥硅档湡敧瑐⡲瘨楯⩤⤪䰦湡⹥慂捴ⱨ䈠瑡档㬩ऊ晩⠠楄灳慬散䉤瑡档਩笉ऊ䘉汵䉬瑡档獥倮獵⡨楄灳慬散䉤瑡档㬩ऊ੽੽瘊楯⁤䙆潬正潆捲䉥晵敦㩲䐺慲湩吨畆据楴湯敒㱦潶摩挨湯瑳䘠汆捯䙫牯散⤦‾楖楳潴⥲笊ऊ⼯慴敫映汵⁬慢捴敨⁳湡⁤癥牥⁹慬敮猧漠数⁮慢捴੨䐉慲湩摥慂捴敨⹳敒敳⡴㬩ऊ畆汬慂捴敨⹳潐䅰汬䐨慲湩摥慂捴敨⥳਻昉牯⠠䱆湡♥䰠湡⁥›慌敮⥳ऊ੻उ⼯慢捴敨⁳敨摬戠⁹⁡桴敲摡爠杩瑨渠睯愠敲瀠瑵戠捡⁫晡整睲牡獤愠摮搠慲湩摥渠硥⁴楴敭ऊ䘉慂捴⩨䈠瑡档㴠⠠䉆瑡档⤪偆慬晴牯䅭潴業獣㨺湉整汲捯敫䕤捸慨杮健牴⠨潶摩⨪☩慌敮䈮瑡档‬畮汬瑰⥲਻उ晩⠠慂捴⥨ऊ笉ऊउ牄楡敮䉤瑡档獥䄮摤䈨瑡档㬩ऊ紉ऊ੽ऊ潦⁲䘨慂捴⩨䈠瑡档㨠䐠慲湩摥慂捴敨⥳ऊ੻उ潦⁲椨瑮㈳椠㴠〠※⁩‼慂捴⵨举浵※⬫⥩ऊ笉ऊउ楖楳潴⡲慂捴⵨䘾牯散孳嵩㬩ऊ紉ऊ䈉瑡档㸭畎⁭‽㬰ऊ䘉敲䉥瑡档獥倮獵⡨慂捴⥨਻紉紊ਊ潶摩䘠汆捯䙫牯散畂晦牥㨺浅瑰⡹਩੻䐉慲湩嬨⡝潣獮⁴䙆潬正潆捲♥ 絻㬩紊
\ No newline at end of file
@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠汆捯䝫潲灵⹳≨⌊湩汣摵⁥䘢潬正瑓瑡⹥≨⌊湩汣摵⁥䘢潬正捏牴敥栮ਢ戊潯⁬䙆潬正片畯獰㨺灕慤整挨湯瑳䘠汆捯卫慴整…汆捯卫慴整‬潣獮⁴䙆潬正捏牴敥…捏牴敥‬汦慯⁴楌歮慒楤獵‬湩㍴′敒畢汩䥤瑮牥慶⥬笊ऊ晩⠠灕慤整即湩散敒畢汩⁤㴡䤠䑎塅也乏⁅☦⬠唫摰瑡獥楓据剥扥極摬㰠删扥極摬湉整癲污਩笉ऊ䴉牥敧䘨潬正瑓瑡ⱥ传瑣敲ⱥ䰠湩剫摡畩⥳਻उ灕慤整杁牧来瑡獥䘨潬正瑓瑡⥥਻उ敲畴湲映污敳਻紉ਊ刉扥極摬䘨潬正瑓瑡ⱥ传瑣敲ⱥ䰠湩剫摡畩⥳਻唉摰瑡獥楓据剥扥極摬㴠〠਻三浵敒畢汩獤⬫਻爉瑥牵⁮牴敵਻੽瘊楯⁤䙆潬正片畯獰㨺敒畢汩⡤潣獮⁴䙆潬正瑓瑡♥䘠潬正瑓瑡ⱥ挠湯瑳䘠汆捯佫瑣敲♥传瑣敲ⱥ映潬瑡䰠湩剫摡畩⥳笊ऊ⼯瑳牡⁴⁡敮⁷潦敲瑳眠瑩⁨癥牥⁹潢摩椠⁮瑩⁳睯⁮敳ੴ按湯瑳椠瑮㈳丠浵潂摩⁳‽汆捯卫慴整丮浵⤨਻倉牡湥獴匮瑥畎啭楮楮楴污穩摥丨浵潂摩⥳਻匉穩獥䤮楮⡴ⰱ丠浵潂摩⥳਻昉牯⠠湩㍴′湉敤⁸‽㬰䤠摮硥㰠丠浵潂摩㭳⬠䤫摮硥਩笉ऊ倉牡湥獴䥛摮硥⁝‽湉敤㭸ऊ੽ऊ⼯楬歮攠捡⁨潢摩琠⁯癥牥⁹潢摩椠⁮慲杮⁥景椠獴挠牵敲瑮瀠獯瑩潩Ɱ氠湩獫朠⁯潢桴眠祡⁳潳攠捡⁨慰物椠⁳湯祬氠湩敫⁤湯散ऊ潦⁲椨瑮㈳䤠摮硥㴠〠※湉敤⁸‼畎䉭楯獤※⬫湉敤⥸ऊ੻उ捏牴敥䜮瑡敨乲楥桧潢牵⡳汆捯卫慴整倮獯瑩潩獮䥛摮硥ⱝ䰠湩剫摡畩ⱳ䤠摮硥‬敎杩扨畯獲㬩ऊ昉牯⠠湩㍴′敎杩扨畯䥲摮硥㨠丠楥桧潢牵⥳ऊ笉ऊउ晩⠠敎杩扨畯䥲摮硥㸠䤠摮硥਩उ笉ऊउ䰉湩⡫湉敤ⱸ丠楥桧潢牵湉敤⥸਻उ紉ऊ紉ऊ੽ऊ⼯潣汬捥⁴潢摩⁳景攠捡⁨潲瑯椠瑮⁯⁡敮⁷牧畯ੰ吉牁慲㱹䙆潬正片畯㹰丠睥片畯獰਻刉潯䝴潲灵⹳湉瑩䤨䑎塅也乏ⱅ丠浵潂摩⥳਻昉牯⠠湩㍴′湉敤⁸‽㬰䤠摮硥㰠丠浵潂摩㭳⬠䤫摮硥਩笉ऊ按湯瑳椠瑮㈳删潯⁴‽楆摮潒瑯䤨摮硥㬩ऊ椉⁦刨潯䝴潲灵孳潒瑯⁝㴽䤠䑎塅也乏⥅ऊ笉ऊउ潒瑯片畯獰剛潯嵴㴠丠睥片畯獰䄮摤敄慦汵整⡤㬩ऊ紉ऊ三睥片畯獰剛潯䝴潲灵孳潒瑯嵝䠮湡汤獥䄮摤䘨潬正瑓瑡⹥慈摮敬孳湉敤嵸㬩ऊ੽ऊ⼯楦摮琠敨瀠敲楶畯⁳牧畯⁰潭瑳戠楯獤漠⁦慥档渠睥朠潲灵挠浡⁥牦浯ऊ䅔牲祡吼慐物椼瑮㈳‬湩㍴㸲‾汃楡獭਻䌉慬浩⹳敓乴浵湕湩瑩慩楬敺⡤敎䝷潲灵⹳畎⡭⤩਻吉慍㱰湩㍴ⰲ椠瑮㈳‾潖整㭳ऊ潦⁲椨瑮㈳䜠潲灵湉敤⁸‽㬰䜠潲灵湉敤⁸‼敎䝷潲灵⹳畎⡭㬩⬠䜫潲灵湉敤⥸ऊ੻उ潖整⹳敒敳⡴㬩ऊ吉慐物椼瑮㈳‬湩㍴㸲…汃楡⁭‽汃楡獭䝛潲灵湉敤嵸਻उ汃楡⁭‽偔楡㱲湩㍴ⰲ椠瑮㈳⠾义䕄彘低䕎‬⤰਻उ潦⁲椨瑮㈳䠠湡汤⁥›敎䝷潲灵孳片畯䥰摮硥⹝慈摮敬⥳ऊ笉ऊउ潣獮⁴湩㍴′牐癥潩獵片畯⁰‽敇䝴潲灵湉敤⡸慈摮敬㬩ऊउ晩⠠牐癥潩獵片畯⁰㴽䤠䑎塅也乏⥅笠挠湯楴畮㭥素ਊउ椉瑮㈳…潃湵⁴‽潖整⹳楆摮牏摁⡤片畯獰偛敲楶畯䝳潲灵⹝摉㬩ऊउ潃湵⭴㬫ऊउ晩⠠潃湵⁴‾汃楡⹭慖畬⥥ऊउ੻उउ汃楡⁭‽偔楡㱲湩㍴ⰲ椠瑮㈳⠾片畯獰偛敲楶畯䝳潲灵⹝摉‬潃湵⥴਻उ紉ऊ紉ऊ੽ऊ⼯慨摮瀠敲楶畯⁳摩⁳潴琠敨渠睥朠潲灵⁳潨摬湩⁧潭瑳漠⁦桴楥⁲潢摩ⱳ朠潲灵⁳楷桴畯⁴⁡汣楡⁭渨睥漠⁲灳楬⁴景⥦朠瑥愠渠睥椠੤吉牁慲㱹湩㍴㸲䌠慬浩牏敤㭲ऊ汃楡佭摲牥匮瑥畎啭楮楮楴污穩摥丨睥片畯獰丮浵⤨㬩ऊ潦⁲椨瑮㈳䜠潲灵湉敤⁸‽㬰䜠潲灵湉敤⁸‼敎䝷潲灵⹳畎⡭㬩⬠䜫潲灵湉敤⥸ऊ੻उ汃楡佭摲牥䝛潲灵湉敤嵸㴠䜠潲灵湉敤㭸ऊ੽䌉慬浩牏敤⹲潓瑲嬨䌦慬浩嵳椨瑮㈳䄠‬湩㍴′⥂笠爠瑥牵⁮汃楡獭䅛⹝慖畬⁥‾汃楡獭䉛⹝慖畬㭥素㬩ऊ協瑥椼瑮㈳‾汃楡敭䥤獤਻昉牯⠠湩㍴′片畯䥰摮硥㨠䌠慬浩牏敤⥲ऊ੻उ潣獮⁴湩㍴′汃楡敭䥤⁤‽汃楡獭䝛潲灵湉敤嵸䬮祥਻उ潢汯戠汁敲摡䍹慬浩摥㴠琠畲㭥ऊ椉⁦䌨慬浩摥摉℠‽义䕄彘低䕎਩उ੻उ䌉慬浩摥摉⹳摁⡤汃楡敭䥤Ɽ☠䅢牬慥祤汃楡敭⥤਻उ੽उ敎䝷潲灵孳片畯䥰摮硥⹝摉㴠戠汁敲摡䍹慬浩摥㼠丠硥䝴潲灵摉⬫㨠䌠慬浩摥摉਻紉ਊ⼉爯灥慬散瀠敲楶畯⁳牧畯獰愠摮挠浯異整愠杧敲慧整ੳ䜉潲灵⁳‽潍敶敔灭丨睥片畯獰㬩ऊ汓瑯片畯獰䤮楮⡴义䕄彘低䕎‬汆捯卫慴整䜮瑥畎卭潬獴⤨㬩ऊ片畯数䡤湡汤獥䤮楮⡴义䕄彘低䕎‬汆捯卫慴整䜮瑥畎卭潬獴⤨㬩ऊ潦⁲椨瑮㈳䜠潲灵湉敤⁸‽㬰䜠潲灵湉敤⁸‼片畯獰丮浵⤨※⬫片畯䥰摮硥਩笉ऊ昉牯⠠湩㍴′慈摮敬㨠䜠潲灵孳片畯䥰摮硥⹝慈摮敬⥳ऊ笉ऊउ潣獮⁴湩㍴′汓瑯㴠䘠汆捯卫慴整㨺敇䡴湡汤卥潬⡴慈摮敬㬩ऊउ汓瑯片畯獰卛潬嵴㴠䜠潲灵湉敤㭸ऊउ片畯数䡤湡汤獥卛潬嵴㴠䠠湡汤㭥ऊ紉ऊ੽唉摰瑡䅥杧敲慧整⡳汆捯卫慴整㬩紊ਊ潶摩䘠汆捯䝫潲灵㩳䴺牥敧挨湯瑳䘠汆捯卫慴整…汆捯卫慴整‬潣獮⁴䙆潬正捏牴敥…捏牴敥‬汦慯⁴楌歮慒楤獵਩੻⼉戯楯獤愠摤摥猠湩散琠敨氠獡⁴敲畢汩⁤瑳牡⁴湩愠朠潲灵漠⁦桴楥⁲睯੮按湯瑳椠瑮㈳丠浵汓瑯⁳‽汆捯卫慴整䜮瑥畎卭潬獴⤨਻眉楨敬⠠汓瑯片畯獰丮浵⤨㰠丠浵汓瑯⥳ऊ੻उ汓瑯片畯獰䄮摤䤨䑎塅也乏⥅਻उ片畯数䡤湡汤獥䄮摤䤨䑎塅也乏⥅਻紉ऊ潣獮⁴湩㍴′畎䉭楯獤㴠䘠潬正瑓瑡⹥畎⡭㬩ऊ潦⁲椨瑮㈳䤠摮硥㴠〠※湉敤⁸‼畎䉭楯獤※⬫湉敤⥸ऊ੻उ潣獮⁴湩㍴′慈摮敬㴠䘠潬正瑓瑡⹥慈摮敬孳湉敤嵸਻उ晩⠠敇䝴潲灵湉敤⡸慈摮敬 㴡䤠䑎塅也乏⥅笠挠湯楴畮㭥素ਊउ潣獮⁴湩㍴′片畯䥰摮硥㴠䜠潲灵⹳摁䑤晥畡瑬摥⤨਻उ片畯獰䝛潲灵湉敤嵸䤮⁤‽敎瑸片畯䥰⭤㬫ऊ䜉潲灵孳片畯䥰摮硥⹝慈摮敬⹳摁⡤慈摮敬㬩ऊ匉潬䝴潲灵孳䙆潬正瑓瑡㩥䜺瑥慈摮敬汓瑯䠨湡汤⥥⁝‽片畯䥰摮硥਻उ片畯数䡤湡汤獥䙛汆捯卫慴整㨺敇䡴湡汤卥潬⡴慈摮敬崩㴠䠠湡汤㭥ऊ੽ऊ⼯瑳牡⁴⁡潦敲瑳眠瑩⁨癥牥⁹牧畯⁰湩椠獴漠湷猠瑥ऊ潣獮⁴湩㍴′畎䝭潲灵⁳‽片畯獰丮浵⤨਻倉牡湥獴匮瑥畎啭楮楮楴污穩摥丨浵片畯獰㬩ऊ楓敺⹳敓乴浵湕湩瑩慩楬敺⡤畎䝭潲灵⥳਻昉牯⠠湩㍴′片畯䥰摮硥㴠〠※片畯䥰摮硥㰠丠浵片畯獰※⬫片畯䥰摮硥਩笉ऊ倉牡湥獴䝛潲灵湉敤嵸㴠䜠潲灵湉敤㭸ऊ匉穩獥䝛潲灵湉敤嵸㴠䜠潲灵孳片畯䥰摮硥⹝畎⡭㬩ऊ੽ऊ⼯楬歮琠敨朠潲灵⁳景攠捡⁨潢摩愠摮攠敶祲戠楯⁤湩爠湡敧漠⁦瑩⁳畣牲湥⁴潰楳楴湯ऊ潢汯戠敍杲摥㴠映污敳਻昉牯⠠湩㍴′湉敤⁸‽㬰䤠摮硥㰠丠浵潂摩㭳⬠䤫摮硥਩笉ऊ按湯瑳椠瑮㈳䜠潲灵湉敤⁸‽汓瑯片畯獰䙛汆捯卫慴整㨺敇䡴湡汤卥潬⡴汆捯卫慴整䠮湡汤獥䥛摮硥⥝㭝ऊ伉瑣敲⹥慇桴牥敎杩扨畯獲䘨潬正瑓瑡⹥潐楳楴湯孳湉敤嵸‬楌歮慒楤獵‬湉敤ⱸ丠楥桧潢牵⥳਻उ潦⁲椨瑮㈳丠楥桧潢牵湉敤⁸›敎杩扨畯獲਩उ੻उ按湯瑳椠瑮㈳丠楥桧潢牵片畯⁰‽汓瑯片畯獰䙛汆捯卫慴整㨺敇䡴湡汤卥潬⡴汆捯卫慴整䠮湡汤獥乛楥桧潢牵湉敤嵸崩਻उ椉⁦丨楥桧潢牵湉敤⁸‾湉敤⁸☦丠楥桧潢牵片畯⁰㴡䜠潲灵湉敤⁸☦䘠湩剤潯⡴片畯䥰摮硥 㴡䘠湩剤潯⡴敎杩扨畯䝲潲灵⤩ऊउ੻उउ楌歮䜨潲灵湉敤ⱸ丠楥桧潢牵片畯⥰਻उउ䵢牥敧⁤‽牴敵਻उ紉ऊ紉ऊ੽椉⁦ℨ䵢牥敧⥤笠爠瑥牵㭮素ਊ⼉洯癯⁥潢摩⁳景洠牥敧⁤牧畯獰椠瑮⁯桴⁥牧畯⁰瑡琠敨爠潯⁴景琠敨物猠瑥⠠桴⁥慬杲獥ⱴ眠楨档欠敥獰椠獴椠⥤‬浥瑰敩⁤牧畯獰愠敲搠潲灰摥戠⁹灕慤整杁牧来瑡獥ऊ潦⁲椨瑮㈳䜠潲灵湉敤⁸‽㬰䜠潲灵湉敤⁸‼畎䝭潲灵㭳⬠䜫潲灵湉敤⥸ऊ੻उ潣獮⁴湩㍴′潒瑯㴠䘠湩剤潯⡴片畯䥰摮硥㬩ऊ椉⁦刨潯⁴㴽䜠潲灵湉敤⥸笠挠湯楴畮㭥素ਊउ潦⁲椨瑮㈳䠠湡汤⁥›片畯獰䝛潲灵湉敤嵸䠮湡汤獥਩उ੻उ按湯瑳椠瑮㈳匠潬⁴‽䙆潬正瑓瑡㩥䜺瑥慈摮敬汓瑯䠨湡汤⥥਻उ椉⁦䜨潲灵摥慈摮敬孳汓瑯⁝㴽䠠湡汤⥥ऊउ੻उउ汓瑯片畯獰卛潬嵴㴠删潯㭴ऊउ੽उ੽उ片畯獰剛潯嵴䠮湡汤獥䄮灰湥⡤片畯獰䝛潲灵湉敤嵸䠮湡汤獥㬩ऊ䜉潲灵孳片畯䥰摮硥⹝慈摮敬⹳敒敳⡴㬩ऊ੽੽瘊楯⁤䙆潬正片畯獰㨺灕慤整杁牧来瑡獥挨湯瑳䘠汆捯卫慴整…汆捯卫慴整਩੻⼉术潲灵⁳敬瑦攠灭祴戠⁹敲潭敶⁤潢摩⁳牡⁥牤灯数Ɽ欠灥⁴牧畯獰愠敲挠浯慰瑣摥琠⁯桴⁥牦湯ੴ椉瑮㈳丠浵片畯獰㴠〠਻昉牯⠠湩㍴′片畯䥰摮硥㴠〠※片畯䥰摮硥㰠䜠潲灵⹳畎⡭㬩⬠䜫潲灵湉敤⥸ऊ੻उ䙆潬正片畯♰䜠潲灵㴠䜠潲灵孳片畯䥰摮硥㭝ऊ䜉潲灵䌮湥牴楯⁤‽噆捥潴㩲娺牥噯捥潴㭲ऊ䜉潲灵䴮慥噮汥捯瑩⁹‽噆捥潴㩲娺牥噯捥潴㭲ऊ䜉潲灵䈮畯摮⁳‽䉆硯䘨牯散湉瑩㬩ऊ昉牯⠠湩㍴′敍扭牥㴠〠※敍扭牥㰠䜠潲灵䠮湡汤獥丮浵⤨※⬫敍扭牥਩उ੻उ按湯瑳椠瑮㈳䠠湡汤⁥‽片畯⹰慈摮敬孳敍扭牥㭝ऊउ潣獮⁴湩㍴′湉敤⁸‽汆捯卫慴整䜮瑥湉敤⡸慈摮敬㬩ऊउ晩⠠湉敤⁸㴽䤠䑎塅也乏⥅ऊउ੻उउ⼯桴⁥汳瑯洠祡愠牬慥祤栠汯⁤⁡敮⁷潢摩朠潲灵摥戠⁹⁡敭杲ⱥ眠楨档欠敥獰椠獴朠潲灵ऊउ按湯瑳椠瑮㈳匠潬⁴‽䙆潬正瑓瑡㩥䜺瑥慈摮敬汓瑯䠨湡汤⥥਻उउ晩⠠片畯数䡤湡汤獥卛潬嵴㴠‽慈摮敬਩उउ੻उउ匉潬䝴潲灵孳汓瑯⁝‽义䕄彘低䕎਻उउ䜉潲灵摥慈摮敬孳汓瑯⁝‽义䕄彘低䕎਻उउ੽उउ片畯⹰慈摮敬⹳敒潭敶瑁睓灡䴨浥敢⵲Ⱝㄠ‬慦獬⥥਻उउ潣瑮湩敵਻उ紉ਊउ䜉潲灵䌮湥牴楯⁤㴫䘠潬正瑓瑡⹥潐楳楴湯孳湉敤嵸਻उ䜉潲灵䴮慥噮汥捯瑩⁹㴫䘠潬正瑓瑡⹥敖潬楣楴獥䥛摮硥㭝ऊउ片畯⹰潂湵獤⬠‽汆捯卫慴整倮獯瑩潩獮䥛摮硥㭝ऊ紉ऊ椉⁦䜨潲灵䠮湡汤獥丮浵⤨㴠‽⤰笠挠湯楴畮㭥素ਊउ片畯⹰敃瑮潲摩⼠‽片畯⹰慈摮敬⹳畎⡭㬩ऊ䜉潲灵䴮慥噮汥捯瑩⁹㴯䜠潲灵䠮湡汤獥丮浵⤨਻उ晩⠠片畯䥰摮硥℠‽畎䝭潲灵⥳ऊ笉ऊउ睓灡䜨潲灵孳畎䝭潲灵嵳‬片畯獰䝛潲灵湉敤嵸㬩ऊउ潦⁲椨瑮㈳䠠湡汤⁥›片畯獰乛浵片畯獰⹝慈摮敬⥳ऊउ੻उउ汓瑯片畯獰䙛汆捯卫慴整㨺敇䡴湡汤卥潬⡴慈摮敬崩㴠丠浵片畯獰਻उ紉ऊ紉ऊ三浵片畯獰⬫਻紉ऊ片畯獰匮瑥畎⡭畎䝭潲灵ⱳ映污敳㬩紊ਊ湩㍴′䙆潬正片畯獰㨺敇䝴潲灵湉敤⡸湩㍴′慈摮敬 潣獮ੴ੻⼉猯慴敬栠湡汤獥搠湯琧洠瑡档琠敨栠湡汤⁥牧畯数⁤湩琠敨物猠潬ੴ按湯瑳椠瑮㈳匠潬⁴‽䙆潬正瑓瑡㩥䜺瑥慈摮敬汓瑯䠨湡汤⥥਻爉瑥牵⁮汓瑯片畯獰䤮噳污摩湉敤⡸汓瑯 ☦䜠潲灵摥慈摮敬孳汓瑯⁝㴽䠠湡汤⁥‿汓瑯片畯獰卛潬嵴㨠䤠䑎塅也乏㭅紊ਊ潶摩䘠汆捯䝫潲灵㩳刺獥瑥⤨笊ऊ灕慤整即湩散敒畢汩⁤‽义䕄彘低䕎਻䜉潲灵⹳浅瑰⡹㬩ऊ汓瑯片畯獰䔮灭祴⤨਻䜉潲灵摥慈摮敬⹳浅瑰⡹㬩ऊ慐敲瑮⹳浅瑰⡹㬩ऊ楓敺⹳浅瑰⡹㬩紊ਊ湩㍴′䙆潬正片畯獰㨺楆摮潒瑯椨瑮㈳䤠摮硥਩੻眉楨敬⠠慐敲瑮孳湉敤嵸℠‽湉敤⥸ऊ੻उ慐敲瑮孳湉敤嵸㴠倠牡湥獴偛牡湥獴䥛摮硥嵝਻उ湉敤⁸‽慐敲瑮孳湉敤嵸਻紉ऊ敲畴湲䤠摮硥਻੽瘊楯⁤䙆潬正片畯獰㨺楌歮椨瑮㈳䤠摮硥ⱁ椠瑮㈳䤠摮硥⥂笊ऊ湩㍴′潒瑯⁁‽楆摮潒瑯䤨摮硥⥁਻椉瑮㈳删潯䉴㴠䘠湩剤潯⡴湉敤䉸㬩ऊ晩⠠潒瑯⁁㴽删潯䉴 ⁻敲畴湲※੽ऊ晩⠠楓敺孳潒瑯嵁㰠匠穩獥剛潯䉴⥝ऊ੻उ睓灡刨潯䅴‬潒瑯⥂਻紉ऊ慐敲瑮孳潒瑯嵂㴠删潯䅴਻匉穩獥剛潯䅴⁝㴫匠穩獥剛潯䉴㭝紊
\ No newline at end of file
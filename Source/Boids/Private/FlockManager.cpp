@@ -1,148 +1 @@
-// Copyright ©2020 Samuel Harrison
-
-//includes
-#include "FlockManager.h"
-#include "Components/BillboardComponent.h"
-#include "Boid.h"
-#include "Kismet/KismetMathLibrary.h"
-
-AFlockManager::AFlockManager()
-{
-	//disable ticking
-	PrimaryActorTick.bCanEverTick = false;
-
-	//setup billboard visual component
-	FlockManagerBillboard = CreateDefaultSubobject<UBillboardComponent>(TEXT("FlockManager Billboard Component"));
-	RootComponent = FlockManagerBillboard;
-
-	//TODO: set to "general" preset settings that are a good starting default
-	//set speed settings
-	MaxSpeed = 700.0f;
-	MinSpeed = 300.0f;
-
-	//default behavioral steering strengths
-	AlignmentStrength = 200.0f;
-	SeparationStrength = 30.0f;
-	CohesionStrength = 5.0f;
-	AvoidanceStrength = 10000.0f;
-
-	//default perception angles
-	SeparationFOV = -1.0f;
-	AlignmentFOV = 0.5f;
-	CohesionFOV = -0.5f;
-
-	//default avoidance properties
-	NumSensors = 100;
-	SensorRadius = 300.0f;
-	BuildAvoidanceSensors();
-}
-
-void AFlockManager::BeginPlay()
-{
-	Super::BeginPlay();
-}
-
-void AFlockManager::AddBoidToFlock(ABoid* Boid)
-{
-	if (Boid)
-	{
-		//add new boid to flock
-		BoidsInFlock.AddUnique(Boid);
-	}
-}
-
-void AFlockManager::RemoveBoidFromFlock(ABoid* Boid)
-{
-	if (Boid)
-	{
-		//remove despawned boid from flock
-		BoidsInFlock.Remove(Boid);
-	}
-}
-
-void AFlockManager::SetMaxSpeed(float NewMaxSpeed)
-{
-	if (NewMaxSpeed < 0)
-	{
-		//log warning to console
-		UE_LOG(LogTemp, Warning, TEXT("Request to change Boid Max Speed to negative value ignored in FlockManager: %s."), *GetName());
-		return;
-	}
-
-	//update max speed to new setting
-	MaxSpeed = NewMaxSpeed;
-
-	//check if new Max is lower than Min, lower Min to new speed to avoid Min > Max error behavior
-	if (MaxSpeed < MinSpeed)
-	{
-		MinSpeed = MaxSpeed;
-	}
-}
-
-void AFlockManager::SetMinSpeed(float NewMinSpeed)
-{
-	if (NewMinSpeed < 0)
-	{
-		//log warning to console
-		UE_LOG(LogTemp, Warning, TEXT("Request to change Boid Max Speed to negative value ignored in FlockManager: %s."), *GetName());
-		return;
-	}
-
-	//update min speed to new setting
-	MinSpeed = NewMinSpeed;
-
-	//check if new Min is higher than Max, raise Max to new speed to avoid Min > Max error behavior
-	if (MinSpeed > MaxSpeed)
-	{
-		MaxSpeed = MinSpeed;
-	}
-}
-
-void AFlockManager::SetAlignmentStrength(float NewAlignmentStrength)
-{
-	AlignmentStrength = NewAlignmentStrength;
-}
-
-void AFlockManager::SetSeparationStrength(float NewSeparationStrength)
-{
-	SeparationStrength = NewSeparationStrength;
-}
-
-void AFlockManager::SetCohesionStrength(float NewCohesionStrength)
-{
-	CohesionStrength = NewCohesionStrength;
-}
-
-void AFlockManager::SetAvoidanceStrength(float NewAvoidanceStrength)
-{
-	AvoidanceStrength = NewAvoidanceStrength;
-}
-
-void AFlockManager::BuildAvoidanceSensors()
-{
-	//empty sensor array
-	AvoidanceSensors.Empty();
-
-	//theta angle of rotation on xy plane around z axis (yaw) around sphere
-	float theta;
-	//phi angle of rotation (~pitch) around sphere
-	float phi;
-	//assuming unit sphere (radius = 1) to simplify calculations
-	//direction vector pointing from the center to point on sphere surface
-	FVector SensorDirection;
-
-	for (int32 i = 0; i < NumSensors; ++i)
-	{
-		//calculate the spherical coordinates of the direction vectors endpoint
-		theta = 2 * UKismetMathLibrary::GetPI() * GoldenRatio * i;
-		phi = FMath::Acos(1 - (2 * float(i) / NumSensors));
-
-		//convert point on sphere to cartesian coordinates xyz
-		SensorDirection.X = FMath::Cos(theta)*FMath::Sin(phi);
-		SensorDirection.Y = FMath::Sin(theta)*FMath::Sin(phi);
-		SensorDirection.Z = FMath::Cos(phi);
-		//add direction to list of sensors for avoidance
-		AvoidanceSensors.Emplace(SensorDirection);
-	}
-}
-
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠汆捯䵫湡条牥栮ਢ椣据畬敤∠潃灭湯湥獴䈯汩扬慯摲潃灭湯湥⹴≨⌊湩汣摵⁥䈢楯⹤≨⌊湩汣摵⁥䬢獩敭⽴楋浳瑥慍桴楌牢牡⹹≨⌊湩汣摵⁥䐢慲䑷扥杵效灬牥⹳≨⌊湩汣摵⁥䜢浡䙥慲敭潷歲倯慬敹䍲湯牴汯敬⹲≨⌊湩汣摵⁥䘢潬正湓灡桳瑯栮ਢ椣据畬敤∠楔敭䵲湡条牥栮ਢ椣据畬敤∠楍捳倯瑡獨栮ਢ椣据畬敤∠楍捳䌯浯慭摮楌敮栮ਢ椣据畬敤∠敎⽴湕敲污敎睴牯⹫≨⌊湩汣摵⁥䔢杮湩⽥敎䍴湯敮瑣潩⹮≨⌊湩汣摵⁥䌢浡牥⽡汐祡牥慃敭慲慍慮敧⹲≨⌊湩汣摵⁥䘢潬正敒慬䍹浯潰敮瑮栮ਢ椣据畬敤∠獁湹⽣慔歳片灡䥨瑮牥慦散⹳≨⌊湩汣摵⁥䠢䱁䤯潃獮汯䵥湡条牥栮ਢ椣据畬敤∠潃灭湯湥獴䰯湩䉥瑡档潃灭湯湥⹴≨⌊湩汣摵⁥䬢獩敭⽴慇敭汰祡瑓瑡捩⹳≨⌊湩汣摵⁥䔢杮湩⽥敌敶卬牴慥業杮栮ਢ椣据畬敤∠湅楧敮瑕汩⹳≨⌊湩汣摵⁥匢牥慩楬慺楴湯䄯捲楨敶潃湵䵴浥栮ਢ椣据畬敤∠潖畬敭敄灳睡敮⹲≨⌊湩汣摵⁥䈢楯䍤条卥慰湷牥栮ਢ椣据畬敤∠汆捯卫档摥汵牥栮ਢ椣据畬敤∠潂摩⽳潂摩⹳≨उउउ⼯獵摥映牯瀠潲敪瑣朠潬慢⁬潣汬獩潩⁮牰獥瑥∠佃䱌卉佉彎噁䥏䅄䍎≅ਊ䕄䱃剁彅奃䱃彅呓呁吨塅⡔䘢潬正匠浩汵瑡潩≮Ⱙ匠䅔彔汆捯卫浩汵瑡潩Ɱ匠䅔䝔佒偕䉟楯獤㬩ਊ慮敭灳捡੥੻⼉支瑳浩瑡摥瀠捡敫⁴楳敺漠⁦⁡潢摩愠摮漠⁦⁡汣獵整Ⱳ甠敳⁤潴映瑩猠慮獰潨獴椠瑮⁯⁡汣敩瑮猧戠摵敧ੴ按湯瑳椠瑮㈳䔠瑳浩瑡摥祂整偳牥潂摩㴠㠠਻按湯瑳椠瑮㈳䔠瑳浩瑡摥祂整偳牥汃獵整⁲‽㈱਻⼉猯慨敲漠⁦⁡汣敩瑮猧戠摵敧⁴敲敳癲摥映牯挠畬瑳牥猠浵慭楲獥ऊ潣獮⁴汦慯⁴汃獵整䉲摵敧䙴慲瑣潩⁮‽⸰㔲㭦ਊ⼉振慯獲⁥汣獵整獲琠牵⁮潴慷摲琠敨映潬正猧洠慥⁮敨摡湩⁧湡⁤散瑮潲摩戠⁹桴獥⁥敷杩瑨⁳慥档猠整ੰ按湯瑳映潬瑡䌠慯獲䅥楬湧敭瑮敗杩瑨㴠〠㔮㭦ऊ潣獮⁴汦慯⁴潃牡敳潃敨楳湯敗杩瑨㴠〠㈮昵਻⼉欯洭慥獮椠整慲楴湯⁳桷湥爠摥捵湩⁧汦捯⁫潴挠畬瑳牥ੳ按湯瑳椠瑮㈳䌠慯獲䍥畬瑳牥瑉牥瑡潩獮㴠㐠਻⼉愯杮敬戠楯⁤敨摡湩獧愠敲猠牰慥⁤牡畯摮琠敨物挠畬瑳牥猧栠慥楤杮眠敨⁮敲票牤瑡摥ऊ潣獮⁴汦慯⁴潃牡敳效摡湩卧牰慥䑤来敲獥㴠ㄠ⸵昰਻ऊ⼯牦浡獥愠眠湡敤楲杮戠楯⁤敫灥⁳瑩⁳慲摮浯搠物捥楴湯ऊ潣獮⁴極瑮㈳圠湡敤䥲瑮牥慶⁬‽〳਻ऊ⼯牧癡瑩⁹獵摥琠⁯慢歮戠楯獤椠瑮⁯畴湲ⱳ愠摮栠睯映獡⁴汦灡攠晦牯⁴湡⁤慢歮映汯潬⁷桴楥⁲慴杲瑥ੳ按湯瑳映潬瑡䘠楬桧䝴慲楶祴㴠㤠〸〮㭦ऊ潣獮⁴汦慯⁴汆杩瑨浓潯桴湩⁧‽⸴昰਻ऊ⼯敤畢⁧楶畳污穩瑡潩⁮汦条ⱳ挠浯楢敮⁤湩䈠楯獤䐮扥杵ऊ潣獮⁴湩㍴′汆捯䑫扥杵敐捲灥楴湯㴠ㄠ਻按湯瑳椠瑮㈳䘠潬正敄畢噧汥捯瑩⁹‽㬲ऊ潣獮⁴湩㍴′汆捯䑫扥杵癁楯慤据⁥‽㬴ऊ潣獮⁴湩㍴′汆捯䑫扥杵敎杩扨畯獲㴠㠠਻按湯瑳椠瑮㈳䘠潬正敄畢䍧汥獬㴠ㄠ㬶ऊ潣獮⁴湩㍴′汆捯䑫扥杵汆睯楆汥⁤‽㈳਻੽猊慴楴⁣䅔瑵䍯湯潳敬慖楲扡敬椼瑮㈳‾噃牡汆捯䑫扥杵ਨ吉塅⡔䈢楯獤䐮扥杵⤢ਬ〉ਬ吉塅⡔䐢慲⁷汦捯⁫敤畢⁧楶畳污穩瑡潩Ɱ猠浵漠㩦ㄠ瀠牥散瑰潩⁮慲楤獵‬′敶潬楣祴‬‴癡楯慤据⁥慲獹‬‸敮杩扨畯⁲楬歮ⱳㄠ‶捯牴敥挠汥獬‬㈳映潬⁷楦汥⁤楤敲瑣潩⁮〨㴠漠晦⸩⤢ਬ䔉噃彆桃慥⥴਻瑳瑡捩吠畁潴潃獮汯噥牡慩汢㱥湩㍴㸲䌠慖䙲潬正敄畢卧浡汰䕥敶祲ਨ吉塅⡔䈢楯獤䐮扥杵匮浡汰䕥敶祲⤢ਬㄉ〰ਬ吉塅⡔䐢慲⁷癥牥⁹瑎⁨潢摩漠⁦慥档映潬正∮Ⱙऊ䍅䙖䍟敨瑡㬩猊慴楴⁣䅔瑵䍯湯潳敬慖楲扡敬昼潬瑡‾噃牡汆捯䑫扥杵畃獲牯慒楤獵ਨ吉塅⡔䈢楯獤䐮扥杵䌮牵潳割摡畩≳Ⱙऊ⸰昰ਬ吉塅⡔䐢慲⁷湯祬戠楯獤眠瑩楨⁮桴獩搠獩慴据⁥景琠敨氠湩⁥湵敤⁲桴⁥楦獲⁴汰祡牥猧挠牵潳⁲漨⁲楶睥挠湥整⥲‬湩瑳慥⁤景攠敶祲丠桴戠楯⁤〨㴠漠晦⸩⤢ਬ䔉噃彆桃慥⥴਻瑳瑡捩吠畁潴潃獮汯噥牡慩汢㱥湩㍴㸲䌠慖䙲潬正敄畢䵧硡潂摩⡳ऊ䕔员∨潂摩⹳敄畢⹧慍䉸楯獤⤢ਬ㔉〰ਬ吉塅⡔䴢硡浩浵渠浵敢⁲景戠楯獤搠慲湷瀠牥映潬正∮Ⱙऊ䍅䙖䍟敨瑡㬩ਊ䙁潬正慍慮敧㩲䄺汆捯䵫湡条牥⤨笊ऊ⼯湥扡敬琠捩楫杮‬汦捯⁫慭慮敧⁲楳畭慬整⁳污⁬景椠獴戠楯獤ऊ牐浩牡䅹瑣牯楔正戮慃䕮敶呲捩⁫‽牴敵਻倉楲慭祲捁潴呲捩⹫楔正片畯⁰‽䝔偟敲桐獹捩㭳ਊ⼉振浯業⁴楴正樠楯獮琠敨猠浩汵瑡潩⁮瑳牡整⁤祢琠敨洠湡条牥猧琠捩Ⱬ瀠票楳獣樠楯⁮楴正樠楯獮椠⁴慥汲⁹桷湥椠⁴牴捡獥琠敨瀠票楳獣猠散敮ऊ潃浭瑩楔正戮慃䕮敶呲捩⁫‽牴敵਻䌉浯業呴捩⹫卢慴瑲楗桴楔正湅扡敬⁤‽牴敵਻倉票楳獣潊湩楔正戮慃䕮敶呲捩⁫‽牴敵਻倉票楳獣潊湩楔正戮瑓牡坴瑩周捩䕫慮汢摥㴠琠畲㭥ऊ桐獹捩䩳楯呮捩⹫偢票楳獣潊湩㴠琠畲㭥ਊ⼉爯灥楬慣整映潬正洠湡条牥琠⁯癥牥⁹汣敩瑮‬潢摩⁳牡⁥敲汰捩瑡摥琠牨畯桧椠⁴獡映潬正猠慮獰潨獴ऊ剢灥楬慣整⁳‽牴敵਻戉汁慷獹敒敬慶瑮㴠琠畲㭥ਊ⼉猯瑥灵戠汩扬慯摲瘠獩慵⁬潣灭湯湥ੴ䘉潬正慍慮敧䉲汩扬慯摲㴠䌠敲瑡䑥晥畡瑬畓潢橢捥㱴䉕汩扬慯摲潃灭湯湥㹴吨塅⡔䘢潬正慍慮敧⁲楂汬潢牡⁤潃灭湯湥≴⤩਻刉潯䍴浯潰敮瑮㴠䘠潬正慍慮敧䉲汩扬慯摲਻ऊ⼯佔佄›敳⁴潴∠敧敮慲≬瀠敲敳⁴敳瑴湩獧琠慨⁴牡⁥⁡潧摯猠慴瑲湩⁧敤慦汵ੴ⼉猯瑥猠数摥猠瑥楴杮ੳ䴉硡灓敥⁤‽〷⸰昰਻䴉湩灓敥⁤‽〳⸰昰਻ऊ⼯敤慦汵⁴敢慨楶牯污猠整牥湩⁧瑳敲杮桴ੳ䄉楬湧敭瑮瑓敲杮桴㴠㈠〰〮㭦ऊ敓慰慲楴湯瑓敲杮桴㴠㌠⸰昰਻䌉桯獥潩卮牴湥瑧⁨‽⸵昰਻䄉潶摩湡散瑓敲杮桴㴠ㄠ〰〰〮㭦ਊ⼉搯晥畡瑬瀠牥散瑰潩⁮湡汧獥ऊ敓慰慲楴湯但⁖‽ㄭ〮㭦ऊ汁杩浮湥䙴噏㴠〠㔮㭦ऊ潃敨楳湯但⁖‽〭㔮㭦ਊ⼉搯晥畡瑬洠癯浥湥⁴灳捡੥戉汐湡牡潍敶敭瑮㴠映污敳਻匉浩汐湡䡥楥桧⁴‽⸰昰਻ऊ⼯敤慦汵⁴敢慨楶牯猠瑥楴杮ੳ䈉桥癡潩⁲‽䙅潬正敂慨楶牯㨺汆捯㭫ऊ慗摮牥瑓敲杮桴㴠㌠〰〮㭦ऊ汆敥慒楤獵㴠㈠〰⸰昰਻䘉敬卥牴湥瑧⁨‽〲〰〮㭦ऊ楓䉭桥癡潩⁲‽䙅潬正敂慨楶牯㨺汆捯㭫ऊ楓剭汵獥㴠〠਻匉浩慗摮牥瑓敲杮桴㴠〠〮㭦ऊ楓䙭敬剥摡畩⁳‽⸰昰਻匉浩汆敥瑓敲杮桴㴠〠〮㭦ਊ⼉搯晥畡瑬映潬⁷楦汥⁤敳瑴湩獧ऊ啢敳汆睯楆汥⁤‽慦獬㭥ऊ汆睯楆汥䝤慯⁬‽畮汬瑰㭲ऊ汆睯楆汥䕤瑸湥⁴‽噆捥潴⡲〱〰⸰昰‬〱〰⸰昰‬㔲〰〮⥦਻䘉潬䙷敩摬敃汬楓敺㴠㔠〰〮㭦ऊ汆睯楆汥卤牴湥瑧⁨‽〵⸰昰਻匉浩汆睯楆汥卤牴湥瑧⁨‽⸰昰਻ऊ⼯敤慦汵⁴敮杩扨畯⁲楬瑳猠瑥楴杮ੳ戉獕乥楥桧潢牵楌瑳⁳‽慦獬㭥ऊ敎杩扨畯卲楫⁮‽〲⸰昰਻匉浩敎杩扨畯卲楫⁮‽⸰昰਻三楥桧潢牵楌瑳慒楤獵㴠〠〮㭦ऊ敎杩扨畯䱲獩䱴祡畯⁴‽㬰ऊ卢浩獕乥楥桧潢牵楌瑳⁳‽慦獬㭥ऊ剢扥極摬敎杩扨畯䱲獩獴㴠映污敳਻三楥桧潢牵楌瑳牆浡獥㴠〠਻三楥桧潢牵楌瑳畂汩獤㴠〠਻ऊ⼯敤慦汵⁴条牧来瑡⁥数捲灥楴湯猠瑥楴杮ੳ戉獕䅥杧敲慧整敐捲灥楴湯㴠映污敳਻䄉杧敲慧整敐捲灥楴湯慒楤獵㴠ㄠ〵⸰昰਻伉数楮杮湁汧⁥‽⸰昵਻倉牥散瑰潩剮摡畩⁳‽⸰昰਻ऊ⼯敤慦汵⁴数捲灥楴湯爠湩⁧敳瑴湩獧‬癥牥⁹畲敬甠敳⁳桴⁥潢摩猧瀠牥散瑰潩⁮慲楤獵ऊ敓慰慲楴湯慒楤獵㴠〠〮㭦ऊ汁杩浮湥剴摡畩⁳‽⸰昰਻䌉桯獥潩剮摡畩⁳‽⸰昰਻匉浩敓慰慲楴湯慒楤獵㴠〠〮㭦ऊ楓䅭楬湧敭瑮慒楤獵㴠〠〮㭦ऊ楓䍭桯獥潩剮摡畩⁳‽⸰昰਻匉浩畑牥剹摡畩⁳‽⸰昰਻戉楓乭獥整剤湩獧㴠映污敳਻ऊ⼯敤慦汵⁴汦捯⁫瑳瑡⁥敳瑴湩獧ऊ潍瑲湯潓瑲湉整癲污㴠㌠㬰ऊ牆浡獥楓据䵥牯潴卮牯⁴‽㬰ऊ䥢䍳浯業瑴湩呧慲獮潦浲⁳‽慦獬㭥ऊ兢慵瑮穩䙥潬正慭整⁳‽慦獬㭥ਊ⼉搯晥畡瑬猠慰湷戠摵敧ੴ䴉硡灓睡獮敐䙲慲敭㴠ㄠ〰਻匉慰湷畂杤瑥獍㴠㈠〮㭦ਊ⼉搯晥畡瑬栠慥汤獥⁳敳瑴湩獧ऊ䅢汬睯效摡敬獳㴠映污敳਻戉獉效摡敬獳㴠映污敳਻ऊ⼯潮映潬正瘠敩⁷異汢獩敨⁤敹ੴ䘉潬正楖睥敖獲潩⁮‽㬰ਊ⼉搯晥畡瑬朠癯牥潮⁲敳瑴湩獧‬畱污瑩⁹敬敶獬朠⁯牦浯映汵⁬畱污瑩⁹潴挠敨灡獥ੴ戉湅扡敬潇敶湲牯㴠映污敳਻吉牡敧却浩楔敭獍㴠㐠〮㭦ऊ灕牧摡呥牨獥潨摬㴠〠㘮㭦ऊ潇敶湲牯敓瑴敬牆浡獥㴠㌠㬰ऊ䙆潬正畑污瑩䱹癥汥儠慵楬祴਻儉慵楬祴敌敶獬䄮摤儨慵楬祴㬩ऊ畑污瑩⹹敓獮牯牆捡楴湯㴠〠㔮㭦ऊ畑污瑩⹹慍乸楥桧潢牵⁳‽㈳਻儉慵楬祴䰮䑏楄瑳湡散㴠㔠〰⸰昰਻儉慵楬祴敌敶獬䄮摤儨慵楬祴㬩ऊ畑污瑩⹹敓獮牯牆捡楴湯㴠〠㈮昵਻儉慵楬祴䴮硡敎杩扨畯獲㴠ㄠ㬶ऊ畑污瑩⹹瑓敥楲杮瑓楲敤㴠㈠਻儉慵楬祴䰮䑏楄瑳湡散㴠㌠〰⸰昰਻儉慵楬祴敌敶獬䄮摤儨慵楬祴㬩ऊ畑污瑩⹹敓獮牯牆捡楴湯㴠〠ㄮ㭦ऊ畑污瑩⹹慍乸楥桧潢牵⁳‽㬸ऊ畑污瑩⹹瑓敥楲杮瑓楲敤㴠㌠਻儉慵楬祴䰮䑏楄瑳湡散㴠ㄠ〵⸰昰਻儉慵楬祴敌敶獬䄮摤儨慵楬祴㬩ऊ畑污瑩䱹癥汥㴠〠਻匉浩楔敭獍㴠〠〮㭦ऊ牆浡獥癏牥畂杤瑥㴠〠਻䘉慲敭啳摮牥畂杤瑥㴠〠਻匉浩汵瑡潩䙮慲敭㴠〠਻ऊ⼯敤畢⁧楶畳污穩瑡潩⁮獩漠晦甠瑮汩攠慮汢摥戠⁹潣獮汯⁥慶楲扡敬ऊ䑢扥杵慃瑰牵⁥‽慦獬㭥ऊ敄畢䙧慬獧㴠〠਻ऊ⼯敤慦汵⁴潣牡敳猠浩汵瑡潩⁮敳瑴湩獧ऊ瑓敲浡湩䱧癥汥慎敭㴠丠䵁彅潎敮਻䌉慯獲䑥獩慴据⁥‽⸰昰਻䌉慯獲啥摰瑡䥥瑮牥慶⁬‽⸱昰਻䴉硡潃牡敳汃獵整獲㴠㠠਻䌉慯獲䡥浯剥摡畩⁳‽⸰昰਻戉獉潃牡敳㴠映污敳਻三浵潃牡敳潂摩⁳‽㬰ऊ潃牡敳瑓灥楔敭㴠〠〮㭦ऊ潃牡敳瑓灥⁳‽㬰ਊ⼉搯晥畡瑬琠汥浥瑥祲猠瑥楴杮ੳ戉敒潣摲敔敬敭牴⁹‽慦獬㭥ऊ敔敬敭牴卹浡汰䥥瑮牥慶⁬‽⸱昰਻吉汥浥瑥祲敃汬楓敺㴠㈠〰⸰昰਻吉汥浥瑥祲硅潰瑲湉整癲污㴠〠〮㭦ऊ敔敬敭牴䙹牯慭⁴‽䙅潬正敔敬敭牴䙹牯慭㩴䌺噓਻戉桓睯敄獮瑩䡹慥浴灡㴠映污敳਻戉敔敬敭牴䍹灡畴敲㴠映污敳਻吉汥浥瑥祲慓灭敬楔敭㴠〠〮㭦ऊ敔敬敭牴䕹灸牯呴浩⁥‽⸰昰਻ऊ⼯敤慦汵⁴潣浳瑥捩甠摰瑡⁥敳瑴湩獧ऊ卢楫䡰摩敤䍮獯敭楴獣㴠琠畲㭥ऊ楖楳楢楬祴潔敬慲据⁥‽⸰昲਻三浵楈摤湥潂摩⁳‽㬰ਊ⼉搯晥畡瑬映楬桧⁴湡浩瑡潩⁮敳瑴湩獧‬景⁦湵楴⁬桴⁥潢摩洠獥❨⁳慭整楲污爠慥獤琠敨映楬桧⁴慤慴ऊ䅢楮慭整汆杩瑨㴠映污敳਻䘉楬桧䑴瑡䥡摮硥㴠〠਻䘉楬桧䑴瑡呡汯牥湡散㴠〠〮昲਻䴉湩汆灡慒整㴠ㄠ〮㭦ऊ慍䙸慬剰瑡⁥‽⸵昰਻䴉硡慂歮湁汧⁥‽〵〮㭦ऊ卢浩湁浩瑡䙥楬桧⁴‽慦獬㭥ऊ楓䵭湩汆灡慒整㴠〠〮㭦ऊ楓䵭硡汆灡慒整㴠〠〮㭦ऊ楓䵭硡慂歮湁汧⁥‽⸰昰਻匉浩汆杩瑨楍卮数摥㴠〠〮㭦ऊ楓䙭楬桧䵴硡灓敥⁤‽⸰昰਻ऊ⼯敤慦汵⁴牧畯⁰牴捡楫杮猠瑥楴杮ੳ戉牔捡䝫潲灵⁳‽慦獬㭥ऊ片畯䱰湩剫摡畩⁳‽⸰昰਻䜉潲灵敒畢汩䥤瑮牥慶⁬‽〱਻戉楓呭慲正片畯獰㴠映污敳਻匉浩片畯䱰湩剫摡畩⁳‽⸰昰਻匉浩片畯剰扥極摬湉整癲污㴠ㄠ਻ऊ⼯敤慦汵⁴獡湹⁣楳畭慬楴湯猠瑥楴杮ੳ戉獁湹卣浩汵瑡潩⁮‽慦獬㭥ऊ楓畭慬楴湯潊湩楔正片畯⁰‽䝔偟獯側票楳獣਻戉獕卥慨敲卤档摥汵牥㴠琠畲㭥ऊ䱢杯楓畭慬楴湯瑓瑡⁳‽慦獬㭥ऊ卢浩汵瑡潩偮湥楤杮㴠映污敳਻戉敐摮湩䅧祳据㴠映污敳਻倉湥楤杮敄瑬呡浩⁥‽⸰昰਻戉敐摮湩呧慲散⁳‽慦獬㭥ऊ桐獹捩䩳楯坮楡䵴⁳‽⸰昰਻匉浩敓獮牯慒楤獵㴠〠〮㭦ऊ卢浩杁牧来瑡健牥散瑰潩⁮‽慦獬㭥ऊ楓䅭杧敲慧整敐捲灥楴湯慒楤獵㴠〠〮㭦ऊ楓佭数楮杮湁汧⁥‽⸰昰਻䰉獡却浩楔敭獍㴠〠〮㭦ऊ慌瑳楓卭慰䵮⁳‽⸰昰਻匉浩瑓牡呴浩⁥‽⸰㬰ऊ牐灥牡䵥⁳‽⸰昰਻匉浩癏牥慬䵰⁳‽⸰昰਻䨉楯坮楡䵴⁳‽⸰昰਻匉浩汵瑡潩卮慴獴楔敭㴠〠〮㭦ਊ⼉搯晥畡瑬猠慮獰潨⁴敳瑴湩獧ऊ汆捯卫慮獰潨⁴‽畮汬瑰㭲ऊ坢牡卭慴瑲牆浯湓灡桳瑯㴠映污敳਻䄉瑵䍯灡畴敲敄慬⁹‽⸰昰਻圉牡卭慴瑲湓灡桳瑯㴠渠汵灬牴਻戉慗浲瑓牡䱴慯敤⁤‽慦獬㭥ਊ⼉搯晥畡瑬爠灥楬慣楴湯猠瑥楴杮ੳ戉敒汰捩瑡䙥潬正㴠琠畲㭥ऊ湓灡桳瑯慒整㴠ㄠ⸰昰਻䬉祥牦浡䥥瑮牥慶⁬‽〲਻倉獯瑩潩偮敲楣楳湯㴠㈠〮㭦ऊ慍䉸楯獤敐偲捡敫⁴‽〱㬰ऊ䱢杯敒汰捩瑡潩卮慴獴㴠映污敳਻刉灥楬慣整䉤楯呤灹⁥‽畮汬瑰㭲ऊ湓灡桳瑯捁畣畭慬潴⁲‽⸰昰਻刉灥楬慣楴湯祂整⁳‽㬰ऊ敒汰捩瑡潩卮慴獴楔敭㴠〠〮㭦ऊ敒汰捩瑡潩䉮瑹獥敐卲捥湯⁤‽⸰昰਻ऊ⼯敤慦汵⁴湩整敲瑳洠湡条浥湥⁴敳瑴湩獧ऊ畆汬慒整楄瑳湡散㴠㔠〰⸰昰਻刉摥捵摥慒整楄瑳湡散㴠㈠〰〰〮㭦ऊ敒畤散剤瑡䑥癩獩牯㴠㐠਻䌉畬瑳牥敃汬楓敺㴠㔠〰⸰昰਻䴉硡潂摩偳牥汃獵整⁲‽㘱਻䴉硡祂整偳牥敓潣摮㴠㌠㜲㠶਻䴉硡敎却数摥牆捡楴湯㴠〠㈮昵਻ऊ⼯敤慦汵⁴癡楯慤据⁥牰灯牥楴獥ऊ畎卭湥潳獲㴠ㄠ〰਻三浵汐湡牡敓獮牯⁳‽㈱਻匉湥潳割摡畩⁳‽〳⸰昰਻䈉極摬癁楯慤据卥湥潳獲⤨਻䄉灰祬畑污瑩䱹癥汥⤨਻੽瘊楯⁤䙁潬正慍慮敧㩲䈺来湩汐祡⤨笊ऊ畓数㩲䈺来湩汐祡⤨਻ऊ⼯敲畢汩⁤敳獮牯⁳牦浯攠楤潴⁲敳瑴湩獧⠠潣獮牴捵潴⁲畢汩獤琠敨⁭敢潦敲瀠慬散⁤湩瑳湡散猠瑥楴杮⁳牡⁥潬摡摥 湡⁤灡汰⁹畱污瑩⁹敬敶⁬潴琠敨੭䈉極摬癁楯慤据卥湥潳獲⤨਻䄉灰祬畑污瑩䱹癥汥⤨਻ऊ⼯汣敩瑮⁳敧⁴桴楥⁲汦捯⁫牦浯琠敨猠牥敶ੲ椉⁦䜨瑥敎䵴摯⡥ 㴽丠彍汃敩瑮 ⁻敲畴湲※੽ऊ⼯敤楤慣整⁤敳癲牥⁳湡⁤敨摡敬獳爠湵⁳湯祬渠敥⁤潢摩瀠獯瑩潩獮‬楳畭慬整戠楯獤眠瑩潨瑵愠瑣牯ੳ戉獉效摡敬獳㴠匠潨汵剤湵效摡敬獳⤨਻椉⁦戨獉效摡敬獳਩笉ऊ䜉瑡敨䡲慥汤獥噳汯浵獥⤨਻उ䕕䱟䝏䰨杯敔灭‬潌Ⱨ吠塅⡔匢浩汵瑡湩⁧潢摩⁳楷桴畯⁴捡潴獲⠠搥搠獥慰湷牥ⱳ┠⁤慣敧⥳椠⁮汆捯䵫湡条牥›猥∮Ⱙ䠠慥汤獥䑳獥慰湷潂湵獤丮浵⤨‬效摡敬獳慃敧潂湵獤丮浵⤨‬䜪瑥慎敭⤨㬩ऊ੽ऊ⼯慢敫爠畯整琠⁯桴⁥汦睯映敩摬朠慯⁬敢潦敲戠楯獤猠慴瑲映汯潬楷杮椠ੴ椉⁦戨獕䙥潬䙷敩摬਩笉ऊ䈉歡䙥潬䙷敩摬⤨਻紉ਊ⼉爯獥潴敲猠瑥汴摥映潬正映潲⁭湳灡桳瑯⠠灳睡敮獲猠慰湷琠敨映潬正椠獮整摡椠⁦瑩挠畯摬❮⁴敢氠慯敤⥤ऊ晩⠠䙕潬正湓灡桳瑯獁敳⩴匠慮獰潨⁴‽潌摡慗浲瑓牡却慮獰潨⡴⤩ऊ੻उ敒瑳牯䙥潬正湓灡桳瑯匨慮獰潨⥴਻紉ਊ⼉振灡畴敲猠慮獰潨⁴湯散映潬正栠獡猠瑥汴摥⠠潣浭湡⁤楬敮猠瑥楴杮椠⁳獵摥戠⁹敨摡敬獳爠湵⥳ऊ汦慯⁴慃瑰牵䑥汥祡㴠䄠瑵䍯灡畴敲敄慬㭹ऊ偆牡敳㨺慖畬⡥䍆浯慭摮楌敮㨺敇⡴Ⱙ吠塅⡔䘢潬正湓灡桳瑯慃瑰牵㵥⤢‬慃瑰牵䑥汥祡㬩ऊ晩⠠慃瑰牵䑥汥祡㸠〠〮⥦ऊ੻उ敇坴牯摬楔敭䵲湡条牥⤨匮瑥楔敭⡲慃瑰牵呥浩牥慈摮敬‬桴獩‬䄦汆捯䵫湡条牥㨺慃瑰牵䙥潬正湓灡桳瑯‬慃瑰牵䑥汥祡‬慦獬⥥਻紉紊ਊ潶摩䄠汆捯䵫湡条牥㨺楔正昨潬瑡䐠汥慴楔敭਩੻匉灵牥㨺楔正䐨汥慴楔敭㬩ਊ⼉是潬正⁳湩甠汮慯敤⁤牯搠獩慴瑮爠来潩獮愠敲猠浩汵瑡摥愠⁳⁡敦⁷汣獵整獲椠獮整摡漠⁦潢摩⁳昨牯散⁳湯戠楯獤琠慨⁴牡湥琧猠浩汵瑡摥愠敲搠潲灰摥਩椉⁦䜨瑥敎䵴摯⡥ 㴡丠彍汃敩瑮☠…灕慤整潃牡敳楓畭慬楴湯䐨汥慴楔敭⤩ऊ੻उ潆捲䉥晵敦⹲浅瑰⡹㬩ਊउ⼯汣敩瑮⁳潦汬睯琠敨挠慯獲⁥汣獵整獲甠瑮汩琠敨映潬正椠⁳敲票牤瑡摥ऊ椉⁦戨敒汰捩瑡䙥潬正☠…䜨瑥敎䵴摯⡥ 㴽丠彍楌瑳湥敓癲牥簠⁼敇乴瑥潍敤⤨㴠‽䵎䑟摥捩瑡摥敓癲牥⤩ऊ笉ऊउ湓灡桳瑯捁畣畭慬潴⁲㴫䐠汥慴楔敭਻उ椉⁦匨慮獰潨䅴捣浵汵瑡牯㸠‽⸱昰⼠匠慮獰潨剴瑡⥥ऊउ੻उउ湓灡桳瑯捁畣畭慬潴⁲‽䵆瑡㩨䘺潭⡤湓灡桳瑯捁畣畭慬潴Ⱳㄠ〮⁦ 湓灡桳瑯慒整㬩ऊउ匉湥䍤慯獲卥慮獰潨⡴㬩ऊउ੽उ੽उ敲畴湲਻紉ਊ⼉猯慰湷戠楯獤爠煥敵瑳摥戠⁹灳睡敮獲ऊ牐捯獥即慰湷畑略⡥㬩ਊ⼉振楬湥獴搠湯琧猠浩汵瑡ⱥ琠敨⁹潦汬睯琠敨猠牥敶❲⁳湳灡桳瑯ੳ椉⁦䜨瑥敎䵴摯⡥ 㴽丠彍汃敩瑮਩笉ऊ䘉牯散畂晦牥䔮灭祴⤨਻उ硅牴灡汯瑡䙥潬正䐨汥慴楔敭㬩ऊ倉扵楬桳汆捯噫敩⡷㬩ऊ爉瑥牵㭮ऊ੽ऊ⼯瑳牡⁴楳畭慬楴杮映潬正‬楦楮桳摥戠⁹桴⁥潣浭瑩琠捩⁫慬整⁲湩琠敨映慲敭⠠楲桧⁴睡祡眠敨⁮潮⁴獡湹档潲潮獵਩匉慴瑲楓畭慬楴湯䐨汥慴楔敭㬩ऊ晩⠠戡獁湹卣浩汵瑡潩⥮ऊ੻उ楆楮桳楓畭慬楴湯⤨਻紉紊ਊ潶摩䄠汆捯䵫湡条牥㨺湅偤慬⡹潣獮⁴䕅摮汐祡敒獡湯㨺祔数䔠摮汐祡敒獡湯਩੻⼉猯浩汵瑡潩⁮慴歳爠慥獤琠敨洠湡条牥猧猠慴整‬瑩栠獡琠⁯楦楮桳戠晥牯⁥桴⁥慭慮敧⁲獩搠獥牴祯摥ऊ慗瑩潆卲浩汵瑡潩⡮㬩ऊ卢浩汵瑡潩偮湥楤杮㴠映污敳਻ऊ⼯敫灥琠汥浥瑥祲漠⁦桴⁥敳獳潩⁮桷湥椠❴⁳硥潰瑲摥瀠牥潩楤慣汬੹椉⁦戨敒潣摲敔敬敭牴⁹☦吠汥浥瑥祲硅潰瑲湉整癲污㸠〠〮⁦☦吠汥浥瑥祲䜮瑥慓灭敬⡳⸩畎⡭ ‾⤰ऊ੻उ硅潰瑲汆捯呫汥浥瑥祲⤨਻紉ਊ匉灵牥㨺湅偤慬⡹湅偤慬剹慥潳⥮਻੽瘊楯⁤䙁潬正慍慮敧㩲刺来獩整䅲瑣牯楔正畆据楴湯⡳潢汯戠敒楧瑳牥਩੻匉灵牥㨺敒楧瑳牥捁潴呲捩䙫湵瑣潩獮戨敒楧瑳牥㬩ਊ椉⁦戨敒楧瑳牥਩笉ऊ⼉振浯業⁴楴正爠湵⁳晡整⁲桴⁥慭慮敧❲⁳楴正椠⁮桴⁥潪湩琠捩⁫牧畯ੰउ晩⠠潃浭瑩楔正戮慃䕮敶呲捩⥫ऊ笉ऊउ潃浭瑩楔正吮牡敧⁴‽桴獩਻उ䌉浯業呴捩⹫楔正片畯⁰‽楓畭慬楴湯潊湩楔正片畯㭰ऊउ潃浭瑩楔正䔮摮楔正片畯⁰‽楓畭慬楴湯潊湩楔正片畯㭰ऊउ潃浭瑩楔正匮瑥楔正畆据楴湯湅扡敬䌨浯業呴捩⹫卢慴瑲楗桴楔正湅扡敬⥤਻उ䌉浯業呴捩⹫敒楧瑳牥楔正畆据楴湯䜨瑥敌敶⡬⤩਻उ䌉浯業呴捩⹫摁偤敲敲畱獩瑩⡥桴獩‬牐浩牡䅹瑣牯楔正㬩ऊ紉ਊउ⼯桰獹捩⁳潪湩琠捩⁫畲獮愠瑦牥琠敨洠湡条牥猧琠捩⁫湩琠敨氠獡⁴牧畯⁰敢潦敲瀠票楳獣猠慴瑲ੳउ晩⠠桐獹捩䩳楯呮捩⹫䍢湡癅牥楔正਩उ੻उ倉票楳獣潊湩楔正吮牡敧⁴‽桴獩਻उ倉票楳獣潊湩楔正吮捩䝫潲灵㴠吠彇牐健票楳獣਻उ倉票楳獣潊湩楔正䔮摮楔正片畯⁰‽䝔偟敲桐獹捩㭳ऊउ桐獹捩䩳楯呮捩⹫敓呴捩䙫湵瑣潩䕮慮汢⡥桐獹捩䩳楯呮捩⹫卢慴瑲楗桴楔正湅扡敬⥤਻उ倉票楳獣潊湩楔正刮来獩整呲捩䙫湵瑣潩⡮敇䱴癥汥⤨㬩ऊउ桐獹捩䩳楯呮捩⹫摁偤敲敲畱獩瑩⡥桴獩‬牐浩牡䅹瑣牯楔正㬩ऊ紉ऊ੽攉獬੥笉ऊ椉⁦䌨浯業呴捩⹫獉楔正畆据楴湯敒楧瑳牥摥⤨਩उ੻उ䌉浯業呴捩⹫湕敒楧瑳牥楔正畆据楴湯⤨਻उ੽उ晩⠠桐獹捩䩳楯呮捩⹫獉楔正畆据楴湯敒楧瑳牥摥⤨਩उ੻उ倉票楳獣潊湩楔正售剮来獩整呲捩䙫湵瑣潩⡮㬩ऊ紉ऊ੽੽瘊楯⁤䙆潬正潃浭瑩楔正畆据楴湯㨺硅捥瑵呥捩⡫汦慯⁴敄瑬呡浩ⱥ䔠敌敶呬捩⁫楔正祔数‬久浡摥桔敲摡㩳吺灹⁥畃牲湥呴牨慥Ɽ挠湯瑳䘠片灡䕨敶瑮敒♦䴠䍹浯汰瑥潩䝮慲桰癅湥⥴笊ऊ晩⠠慔杲瑥☠…吡牡敧⵴䤾偳湥楤杮楋汬牏湕敲捡慨汢⡥⤩ऊ੻उ晩⠠偢票楳獣潊湩਩उ੻उ吉牡敧⵴䨾楯䉮晥牯健票楳獣⤨਻उ੽उ汥敳ऊ笉ऊउ慔杲瑥㸭楆楮桳楓畭慬楴湯⤨਻उ੽紉紊ਊ卆牴湩⁧䙆潬正潃浭瑩楔正畆据楴湯㨺楄条潮瑳捩敍獳条⡥਩੻爉瑥牵⁮慔杲瑥㼠吠牡敧⵴䜾瑥畆汬慎敭⤨⬠⠠偢票楳獣潊湩㼠吠塅⡔嬢桐獹捩䩳楯呮捩嵫⤢㨠吠塅⡔嬢潃浭瑩楔正≝⤩㨠吠塅⡔䘢汆捯䍫浯業呴捩䙫湵瑣潩≮㬩紊ਊ潶摩䄠汆捯䵫湡条牥㨺畑略䉥楯卤慰湷吨畓换慬獳晏䄼潂摩‾潂摩祔数‬潣獮⁴呆慲獮潦浲…灓睡呮慲獮潦浲਩੻⼉振楬湥獴猠慰湷戠楯獤映牯琠敨猠牥敶❲⁳汦捯⁫湯祬ऊ晩⠠敇乴瑥潍敤⤨㴠‽䵎䍟楬湥⥴笠爠瑥牵㭮素ਊ⼉振慯獲⁥汦捯⁫慨⁳潮戠楯獤琠⁯灳睡Ɱ愠摤椠⁴潴琠敨挠慯獲⁥瑳瑡⁥湩瑳慥੤椉⁦戨獉潃牡敳਩笉ऊ䄉摤潃牡敳潂摩䈨楯呤灹ⱥ匠慰湷牔湡晳牯⥭਻उ敲畴湲਻紉ਊ䘉潂摩灓睡剮煥敵瑳匠慰湷敒畱獥㭴ऊ灓睡剮煥敵瑳䈮楯呤灹⁥‽潂摩祔数਻匉慰湷敒畱獥⹴灓睡呮慲獮潦浲㴠匠慰湷牔湡晳牯㭭ऊ灓睡兮敵敵䄮摤匨慰湷敒畱獥⥴਻੽瘊楯⁤䙁潬正慍慮敧㩲债潲散獳灓睡兮敵敵⤨笊ऊ晩⠠灓睡兮敵敵丮浵⤨㴠‽⤰笠爠瑥牵㭮素ਊ按湯瑳搠畯汢⁥瑓牡呴浩⁥‽偆慬晴牯呭浩㩥区捥湯獤⤨਻椉瑮㈳丠浵灓睡敮⁤‽㬰ਊ眉楨敬⠠畎卭慰湷摥㰠匠慰湷畑略⹥畎⡭⤩ऊ੻उ⼯档捥⁫灳睡⁮畢杤瑥映牯琠楨⁳牦浡੥उ晩⠠慍卸慰湷偳牥牆浡⁥‾‰☦丠浵灓睡敮⁤㴾䴠硡灓睡獮敐䙲慲敭 ⁻牢慥㭫素ऊ椉⁦匨慰湷畂杤瑥獍㸠〠〮⁦☦丠浵灓睡敮⁤‾‰☦⠠偆慬晴牯呭浩㩥区捥湯獤⤨ⴠ匠慴瑲楔敭 ‪〱〰〮㸠‽灓睡䉮摵敧䵴⥳笠戠敲歡※੽ऊ⼉猯慰湷搠晥牥敲⁤潳琠敨戠楯⁤獩漠湷摥戠⁹桴獩映潬正洠湡条牥戠晥牯⁥瑩戠来湩⁳汰祡ऊ⼉⠯敲畱獥⁴獩挠灯敩Ɽ猠慰湷湩⁧慣⁮牴杩敧⁲癯牥慬⁰癥湥獴琠慨⁴畱略⁥潭敲戠楯獤਩उ潣獮⁴䉆楯卤慰湷敒畱獥⁴灓睡剮煥敵瑳㴠匠慰湷畑略孥畎卭慰湷摥㭝ऊ三浵灓睡敮⭤㬫ਊउ⼯敨摡敬獳戠楯獤漠汮⁹敮摥映潬正猠慴整ऊ椉⁦戨獉效摡敬獳਩उ੻उ䄉摤效摡敬獳潂摩匨慰湷敒畱獥⥴਻उ按湯楴畮㭥ऊ紉ਊउ⼯潢摩⁳敲瑳牯摥映潲⁭⁡湳灡桳瑯猠慰湷眠敨敲敶⁲桴楥⁲瑳瑡⁥慨⁳潭敶⁤潴猠湩散ऊ䘉牔湡晳牯⁭灓睡呮慲獮潦浲㴠匠慰湷敒畱獥⹴灓睡呮慲獮潦浲਻उ晩⠠灓睡剮煥敵瑳䘮潬正慈摮敬℠‽义䕄彘低䕎਩उ੻उ椉瑮㈳䤠摮硥㴠䘠潬正瑓瑡⹥敇䥴摮硥匨慰湷敒畱獥⹴汆捯䡫湡汤⥥਻उ椉⁦䤨摮硥㴠‽义䕄彘低䕎簠⁼汆捯卫慴整䈮楯獤䥛摮硥⁝㴡渠汵灬牴 ⁻潣瑮湩敵※੽उ匉慰湷牔湡晳牯⁭‽呆慲獮潦浲䘨潬正瑓瑡⹥敖潬楣楴獥䥛摮硥⹝潔牏敩瑮瑡潩剮瑯瑡牯⤨‬汆捯卫慴整倮獯瑩潩獮䥛摮硥⥝਻उ੽ऊ䄉潂摩‪潂摩㴠䜠瑥潗汲⡤⴩匾慰湷捁潴䑲晥牥敲㱤䉁楯㹤匨慰湷敒畱獥⹴潂摩祔数‬灓睡呮慲獮潦浲‬桴獩‬畮汬瑰Ⱳ䔠灓睡䅮瑣牯潃汬獩潩䡮湡汤湩䵧瑥潨㩤䄺睬祡即慰湷㬩ऊ椉⁦䈨楯⥤ऊ笉ऊउ潂摩㸭楆楮桳灓睡楮杮匨慰湷牔湡晳牯⥭਻उ椉⁦䈨楯ⵤ䤾偳湥楤杮楋汬⤨ ⁻潣瑮湩敵※੽ऊउ⼯瑡慴档爠獥潴敲⁤潢摩琠⁯瑩⁳硥獩楴杮猠慴整‬瑯敨睲獩⁥摡⁤瑩愠⁳⁡敮⁷潢摩ऊउ湩㍴′湉敤⁸‽汆捯卫慴整䜮瑥湉敤⡸灓睡剮煥敵瑳䘮潬正慈摮敬㬩ऊउ晩⠠湉敤⁸㴡䤠䑎塅也乏⁅☦䘠潬正瑓瑡⹥潂摩孳湉敤嵸㴠‽畮汬瑰⥲ऊउ੻उउ汆捯卫慴整䈮楯獤䥛摮硥⁝‽潂摩਻उउ潂摩㸭敓䙴潬正慈摮敬匨慰湷敒畱獥⹴汆捯䡫湡汤⥥਻उउ敐捲灥楴湯慒楤獵㴠䘠慍桴㨺慍⡸敐捲灥楴湯慒楤獵‬潂摩㸭敇側牥散瑰潩剮摡畩⡳⤩਻उ紉ऊउ汥敳ऊउ੻उउ摁䉤楯呤䙯潬正䈨楯⥤਻उ紉ऊ紉ऊ੽ऊ⼯敲潭敶猠慰湷摥爠煥敵瑳⁳牦浯焠敵敵ऊ灓睡兮敵敵刮浥癯䅥⡴ⰰ丠浵灓睡敮Ɽ映污敳㬩紊ਊ潢汯䄠汆捯䵫湡条牥㨺桓畯摬畒䡮慥汤獥⡳ 潣獮ੴ੻椉⁦ℨ䅢汬睯效摡敬獳簠⁼敇乴瑥潍敤⤨㴠‽䵎䍟楬湥⥴笠爠瑥牵⁮慦獬㭥素ਊ⼉漯汮⁹灯整⁤湩瀠潲散獳獥‬渭汵牬楨愠潬敮椠⁳污潳甠敳⁤祢愠瑵浯瑡潩⁮湡⁤潣浭湡汤瑥⁳桴瑡攠灸捥⁴潢摩愠瑣牯ੳ爉瑥牵⁮獉畒湮湩䑧摥捩瑡摥敓癲牥⤨簠⁼偆牡敳㨺慐慲⡭䍆浯慭摮楌敮㨺敇⡴Ⱙ吠塅⡔䘢潬正效摡敬獳⤢㬩紊ਊ潶摩䄠汆捯䵫湡条牥㨺摁䡤慥汤獥䉳楯⡤潣獮⁴䉆楯卤慰湷敒畱獥♴匠慰湷敒畱獥⥴笊ऊ⼯潢摩⁳敲瑳牯摥映潲⁭⁡湳灡桳瑯漠⁲敲票牤瑡摥映潲⁭汣獵整獲愠牬慥祤栠癡⁥汦捯⁫瑳瑡੥椉⁦匨慰湷敒畱獥⹴汆捯䡫湡汤⁥㴡䤠䑎塅也乏⁅籼匠慰湷敒畱獥⹴潂摩祔数㴠‽畮汬瑰⥲笠爠瑥牵㭮素ਊ⼉是潬正猠慴整挠湡琧朠潲⁷桷汩⁥瑩猧戠楥杮猠浩汵瑡摥ऊ慗瑩潆卲浩汵瑡潩⡮㬩ਊ⼉猯瑥瘠汥捯瑩⁹慢敳⁤湯猠慰湷爠瑯瑡潩⁮湡⁤汦捯⁫灳敥⁤敳瑴湩獧ऊ潣獮⁴剆瑯瑡牯匠慰湷潒慴楴湯㴠匠慰湷敒畱獥⹴灓睡呮慲獮潦浲刮瑯瑡牯⤨਻䘉敖瑣牯嘠汥捯瑩⁹‽灓睡剮瑯瑡潩⹮敖瑣牯⤨⨠䘠慍桴㨺剆湡剤湡敧䴨湩灓敥Ɽ䴠硡灓敥⥤਻䘉潬正瑓瑡⹥摁⡤畮汬瑰Ⱳ匠慰湷敒畱獥⹴灓睡呮慲獮潦浲䜮瑥潌慣楴湯⤨‬敖潬楣祴‬灓睡剮瑯瑡潩⥮਻ऊ⼯数捲灥楴湯爠摡畩⁳潣敭⁳牦浯琠敨戠楯⁤祴数猧搠晥畡瑬⁳楳据⁥桴牥❥⁳潮愠瑣牯ऊ䉁楯⩤䐠晥畡瑬潂摩㴠匠慰湷敒畱獥⹴潂摩祔数䜮瑥敄慦汵佴橢捥⡴㬩ऊ敐捲灥楴湯慒楤獵㴠䘠慍桴㨺慍⡸敐捲灥楴湯慒楤獵‬敄慦汵䉴楯ⵤ䜾瑥敐捲灥楴湯慒楤獵⤨㬩ਊ⼉振楬湥獴猠慰湷愠瑣牯⁳景琠敨映物瑳戠楯⁤祴数ऊ晩⠠敒汰捩瑡摥潂摩祔数㴠‽畮汬瑰⥲ऊ੻उ敒汰捩瑡摥潂摩祔数㴠匠慰湷敒畱獥⹴潂摩祔数਻紉紊ਊ潶摩䄠汆捯䵫湡条牥㨺慇桴牥效摡敬獳潖畬敭⡳਩੻䠉慥汤獥䑳獥慰湷潂湵獤刮獥瑥⤨਻䠉慥汤獥䍳条䉥畯摮⹳敒敳⡴㬩ਊ昉牯⠠䅔瑣牯瑉牥瑡牯䄼潖畬敭敄灳睡敮㹲䤠⡴敇坴牯摬⤨㬩䤠㭴⬠䤫⥴ऊ੻उ效摡敬獳敄灳睡䉮畯摮⹳摁⡤瑉㸭敇䍴浯潰敮瑮䉳畯摮湩䉧硯⤨㬩ऊ੽昉牯⠠䅔瑣牯瑉牥瑡牯䄼潂摩慃敧灓睡敮㹲䤠⡴敇坴牯摬⤨㬩䤠㭴⬠䤫⥴ऊ੻उ晩⠠瑉㸭獁楳湧摥汆捯䵫湡条牥㴠‽桴獩਩उ੻उ䠉慥汤獥䍳条䉥畯摮⹳摁⡤瑉㸭敇䍴浯潰敮瑮䉳畯摮湩䉧硯⤨㬩ऊ紉ऊ੽੽瘊楯⁤䙁潬正慍慮敧㩲䄺灰祬效摡敬獳潖畬敭⡳਩੻椉⁦䠨慥汤獥䑳獥慰湷潂湵獤丮浵⤨㴠‽‰☦䠠慥汤獥䍳条䉥畯摮⹳畎⡭ 㴽〠 ⁻敲畴湲※੽ऊ潦⁲椨瑮㈳椠㴠〠※⁩‼汆捯卫慴整丮浵⤨※⬫⥩ऊ੻उ噆捥潴♲倠獯瑩潩⁮‽汆捯卫慴整倮獯瑩潩獮楛㭝ਊउ⼯敤灳睡⁮潢摩⁳桴瑡攠瑮牥摥愠搠獥慰湷牥⠠敲潭慶⁬睳灡⁳桴⁥慬瑳戠楯⁤湩潴琠楨⁳汳瑯਩उ潢汯戠敄灳睡敮⁤‽慦獬㭥ऊ昉牯⠠潣獮⁴䉆硯…敄灳睡䉮畯摮⁳›效摡敬獳敄灳睡䉮畯摮⥳ऊ笉ऊउ晩⠠敄灳睡䉮畯摮⹳獉湉楳敤倨獯瑩潩⥮਩उ笉ऊउ䘉潬正瑓瑡⹥敒潭敶䘨潬正瑓瑡⹥慈摮敬孳嵩㬩ऊउ戉敄灳睡敮⁤‽牴敵਻उउ牢慥㭫ऊउ੽उ੽उ晩⠠䑢獥慰湷摥਩उ੻उⴉ椭਻उ按湯楴畮㭥ऊ紉ਊउ⼯潭敶戠楯獤琠慨⁴敬瑦琠敨挠潬敳瑳挠条⁥潴椠獴漠桴牥猠摩ⱥ猠浩汩牡琠⁯桴⁥慧敭䄠瑳牥楯獤ऊ按湯瑳䘠潂⩸䌠条⁥‽畮汬瑰㭲ऊ昉潬瑡䌠条䑥獩慴据卥畱牡摥㴠䴠塁晟瑬਻उ潦⁲挨湯瑳䘠潂♸䌠条䉥畯摮⁳›效摡敬獳慃敧潂湵獤਩उ੻उ昉潬瑡䐠獩慴据卥畱牡摥㴠䌠条䉥畯摮⹳潃灭瑵卥畱牡摥楄瑳湡散潔潐湩⡴潐楳楴湯㬩ऊउ晩⠠楄瑳湡散煓慵敲⁤‼慃敧楄瑳湡散煓慵敲⥤ऊउ੻उउ慃敧㴠☠慃敧潂湵獤਻उउ慃敧楄瑳湡散煓慵敲⁤‽楄瑳湡散煓慵敲㭤ऊउ੽उ੽उ晩⠠慃敧☠…慃敧楄瑳湡散煓慵敲⁤‾⸰昰਩उ੻उ昉牯⠠湩㍴′硁獩㴠〠※硁獩㰠㌠※⬫硁獩਩उ笉ऊउ椉⁦倨獯瑩潩孮硁獩⁝‾慃敧㸭慍學硁獩⥝ऊउ笉ऊउउ潐楳楴湯䅛楸嵳㴠䌠条ⵥ䴾湩䅛楸嵳਻उउ੽उउ汥敳椠⁦倨獯瑩潩孮硁獩⁝‼慃敧㸭楍孮硁獩⥝ऊउ笉ऊउउ潐楳楴湯䅛楸嵳㴠䌠条ⵥ䴾硡䅛楸嵳਻उउ੽उ紉ऊ紉ऊ੽੽椊瑮㈳䄠汆捯䵫湡条牥㨺獅楴慭整捁潴䉲瑹獥敐䉲楯⡤਩੻椉⁦刨灥楬慣整䉤楯呤灹⁥㴽渠汵灬牴 ⁻敲畴湲〠※੽ऊ⼯敭潭祲漠⁦桴⁥敤慦汵⁴潢摩愠瑣牯愠摮椠獴搠晥畡瑬挠浯潰敮瑮ⱳ猠慰湷摥戠楯獤愠獬⁯污潬慣整瀠票楳獣戠摯敩ⱳ爠湥敤⁲瑳瑡⁥湡੤⼉眯慨整敶⁲桴楥⁲汢敵牰湩獴愠摤愠⁴畲瑮浩⁥潳琠楨⁳獩愠氠睯牥戠畯摮ऊ䉁楯⩤䐠晥畡瑬潂摩㴠删灥楬慣整䉤楯呤灹⹥敇䑴晥畡瑬扏敪瑣⤨਻椉瑮㈳䈠瑹獥㴠椠瑮㈳䘨牁档癩䍥畯瑮敍⡭敄慦汵䉴楯⥤䜮瑥慍⡸⤩਻吉湉楬敮潃灭湯湥䅴牲祡唼捁潴䍲浯潰敮瑮㸪䌠浯潰敮瑮㭳ऊ敄慦汵䉴楯ⵤ䜾瑥潃灭湯湥獴䌨浯潰敮瑮⥳਻昉牯⠠䅕瑣牯潃灭湯湥⩴䌠浯潰敮瑮㨠䌠浯潰敮瑮⥳ऊ੻उ祂整⁳㴫椠瑮㈳䘨牁档癩䍥畯瑮敍⡭潃灭湯湥⥴䜮瑥慍⡸⤩਻紉ਊ爉瑥牵⁮祂整㭳紊ਊ潶摩䄠汆捯䵫湡条牥㨺摁䉤楯呤䙯潬正䄨潂摩‪潂摩਩੻椉⁦䈨楯⥤ऊ੻उ⼯汦捯⁫瑳瑡⁥慣❮⁴牧睯眠楨敬椠❴⁳敢湩⁧楳畭慬整੤उ慗瑩潆卲浩汵瑡潩⡮㬩ਊउ⼯档捥⁫潢摩椠湳琧愠牬慥祤椠⁮汦捯੫उ湩㍴′湉敤⁸‽汆捯卫慴整䜮瑥湉敤⡸潂摩㸭敇䙴潬正慈摮敬⤨㬩ऊ椉⁦䤨摮硥℠‽义䕄彘低䕎☠…汆捯卫慴整䈮楯獤䥛摮硥⁝㴽䈠楯⥤笠爠瑥牵㭮素ਊउ⼯敳⁴敶潬楣祴戠獡摥漠⁮灳睡⁮潲慴楴湯愠摮映潬正猠数摥猠瑥楴杮ੳउ噆捥潴⁲敖潬楣祴㴠䈠楯ⵤ䜾瑥捁潴䙲牯慷摲敖瑣牯⤨⨠䘠慍桴㨺剆湡剤湡敧䴨湩灓敥Ɽ䴠硡灓敥⥤਻ऊ⼉愯摤渠睥戠楯⁤潴映潬正ऊ䈉楯ⵤ匾瑥汆捯䡫湡汤⡥汆捯卫慴整䄮摤䈨楯Ɽ䈠楯ⵤ䜾瑥捁潴䱲捯瑡潩⡮Ⱙ嘠汥捯瑩ⱹ䈠楯ⵤ䜾瑥捁潴割瑯瑡潩⡮⤩㬩ਊउ⼯汦捯浫瑡獥愠敲瀠牥散癩摥椠獮摩⁥桴⁥潢摩猧瀠牥散瑰潩⁮敳獮牯爠摡畩ੳउ敐捲灥楴湯慒楤獵㴠䘠慍桴㨺慍⡸敐捲灥楴湯慒楤獵‬潂摩㸭敇側牥散瑰潩剮摡畩⡳⤩਻ऊ⼉振楬湥獴猠慰湷琠敨琠灹⁥景琠敨映物瑳戠楯⁤潦⁲敲汰捩瑡摥戠楯獤ऊ椉⁦刨灥楬慣整䉤楯呤灹⁥㴽渠汵灬牴਩उ੻उ刉灥楬慣整䉤楯呤灹⁥‽潂摩㸭敇䍴慬獳⤨਻उ੽紉紊ਊ潶摩䄠汆捯䵫湡条牥㨺敒潭敶潂摩牆浯汆捯⡫䉁楯⩤䈠楯⥤笊ऊ晩⠠潂摩਩笉ऊ⼉振敨正戠楯⁤獩椠⁮桴獩映潬正ऊ椉瑮㈳䠠湡汤⁥‽潂摩㸭敇䙴潬正慈摮敬⤨਻उ湩㍴′湉敤⁸‽汆捯卫慴整䜮瑥湉敤⡸慈摮敬㬩ऊ椉⁦䤨摮硥㴠‽义䕄彘低䕎簠⁼汆捯卫慴整䈮楯獤䥛摮硥⁝㴡䈠楯⥤笠爠瑥牵㭮素ਊउ⼯敲潭敶搠獥慰湷摥戠楯⁤牦浯映潬正ऊ䈉楯ⵤ匾瑥汆捯䡫湡汤⡥义䕄彘低䕎㬩ऊ椉⁦戨楓畭慬楴湯敐摮湩⥧ऊ笉ऊउ⼯汦捯⁫獩戠楥杮猠浩汵瑡摥‬瑩⁳瑳瑡⁥獩❮⁴潴捵敨⁤湵楴⁬桴⁥楳畭慬楴湯椠⁳潪湩摥⠠桴⁥捡潴⁲獩搠瑥捡敨⁤桴湥਩उ倉湥楤杮敒潭慶獬䄮摤䠨湡汤⥥਻उ੽उ汥敳椠⁦戨獉潃浭瑩楴杮牔湡晳牯獭਩उ੻उ⼉是潬正椠⁳敢湩⁧瑩牥瑡摥‬敤慴档琠敨愠瑣牯渠睯愠摮爠浥癯⁥瑩⁳瑳瑡⁥湯散琠敨挠浯業⁴獩搠湯੥उ䘉潬正瑓瑡⹥潂摩孳湉敤嵸㴠渠汵灬牴਻उ倉湥楤杮敒潭慶獬䄮摤䠨湡汤⥥਻उ੽उ汥敳ऊ笉ऊउ汆捯卫慴整刮浥癯⡥慈摮敬㬩ऊ紉ऊ੽੽䘊敖瑣牯䄠汆捯䵫湡条牥㨺敇䉴楯噤汥捯瑩⡹湩㍴′潂摩慈摮敬਩੻⼉爯慥⁤桴⁥潣浭瑩整⁤敶潬楣祴映潲⁭桴⁥異汢獩敨⁤楶睥‬桴⁥汦捯❫⁳睯⁮瑳瑡⁥慭⁹敢眠楲瑴湥戠⁹桴⁥楳畭慬楴湯爠杩瑨渠睯ऊ䙆潬正楖睥瑐⁲楖睥㴠䜠瑥汆捯噫敩⡷㬩ऊ潣獮⁴湩㍴′湉敤⁸‽楖睥䤮噳污摩⤨㼠嘠敩⵷䜾瑥湉敤⡸潂摩慈摮敬 ›义䕄彘低䕎਻爉瑥牵⁮湉敤⁸㴡䤠䑎塅也乏⁅‿楖睥㸭敖潬楣楴獥䥛摮硥⁝›噆捥潴㩲娺牥噯捥潴㭲紊ਊ潶摩䄠汆捯䵫湡条牥㨺敓䉴楯䱤捯瑡潩⡮湩㍴′潂摩慈摮敬‬潣獮⁴噆捥潴♲丠睥潌慣楴湯਩੻圉楡䙴牯楓畭慬楴湯⤨਻ऊ湩㍴′湉敤⁸‽汆捯卫慴整䜮瑥湉敤⡸潂摩慈摮敬㬩ऊ晩⠠湉敤⁸㴡䤠䑎塅也乏⥅ऊ੻उ汆捯卫慴整倮獯瑩潩獮䥛摮硥⁝‽敎䱷捯瑡潩㭮ऊ੽੽瘊楯⁤䙁潬正慍慮敧㩲区瑥汆捯浫瑡入慵瑮穩瑡潩䕮慮汢摥戨潯⁬䕢慮汢摥਩੻圉楡䙴牯楓畭慬楴湯⤨਻ऊ兢慵瑮穩䙥潬正慭整⁳‽䕢慮汢摥਻椉⁦ℨ兢慵瑮穩䙥潬正慭整⥳ऊ੻उ潃灭捡却慴整䔮灭祴⤨਻紉紊ਊ湩㍴′䙁潬正慍慮敧㩲䜺瑥瑓瑡䉥瑹獥敐䉲楯⡤਩੻⼉瀯獯瑩潩Ɱ瘠汥捯瑩ⱹ栠慥楤杮‬汦灡瀠慨敳‬晥潦瑲愠摮戠湡Ⱬ愠瑣牯‬慨摮敬愠摮栠湡汤⁥湩敤੸椉瑮㈳䈠瑹獥㴠猠穩潥⡦噆捥潴⥲⨠㌠⬠猠穩潥⡦汦慯⥴⨠㌠⬠猠穩潥⡦䉁楯⩤ ‫楳敺景椨瑮㈳ ‪㬲ऊ⼯敭桳爠瑯瑡潩੮䈉瑹獥⬠‽楳敺景䘨潒慴潴⥲਻⼉焯慵瑮穩摥映潬正慭整挠灯⁹獩欠灥⁴敮瑸琠⁯桴⁥畦汬瀠敲楣楳湯猠慴整ऊ敲畴湲䈠瑹獥⬠䜠瑥畑湡楴敺䉤瑹獥敐䉲楯⡤㬩紊ਊ湩㍴′䙁潬正慍慮敧㩲䜺瑥畑湡楴敺䉤瑹獥敐䉲楯⡤਩੻爉瑥牵⁮兢慵瑮穩䙥潬正慭整⁳‿䙆潬正潃灭捡却慴整㨺敇䉴瑹獥敐䉲楯⡤ ›㬰紊ਊ湩㍴′䙁潬正慍慮敧㩲䜺瑥敋湲汥祂整偳牥潂摩⤨笊ऊ⼯潰楳楴湯愠摮栠慥楤杮漠⁦慥档映潬正慭整ऊ敲畴湲戠畑湡楴敺汆捯浫瑡獥㼠䘠汆捯䍫浯慰瑣瑓瑡㩥䜺瑥祂整偳牥潂摩⤨㨠猠穩潥⡦噆捥潴⥲⨠㈠਻੽瘊楯⁤䙁潬正慍慮敧㩲䰺杯汆捯卫潴慲敧瑓瑡⡳਩੻按湯瑳椠瑮㈳丠浵潂摩⁳‽汆捯卫慴整丮浵⤨਻按湯瑳映潬瑡䴠来扡瑹⁥‽〱㐲〮⁦‪〱㐲〮㭦ऊ潣獮⁴汦慯⁴潂摩偳牥獍㴠匠浩楔敭獍㸠〠〮⁦‿畎䉭楯獤⼠匠浩楔敭獍㨠〠〮㭦ਊ唉彅佌⡇潌呧浥Ɒ䰠杯‬䕔员∨汆捯⁫瑳牯条⁥┨⥳›搥戠楯獤‬搥戠瑹獥猠慴整瀠牥戠楯⁤湩汣摵湩⁧搥攠瑸慲戠瑹獥映牯琠敨焠慵瑮穩摥挠灯⁹┨㈮⁦䉍Ⱙ┠⁤祢整⁳敲摡瀠牥映潬正慭整‬⸥昲洠⁳楳畭慬楴湯⠠⸥昰戠楯獤洯⥳椠⁮汆捯䵫湡条牥›猥∮Ⱙऊ戉畑湡楴敺汆捯浫瑡獥㼠吠塅⡔焢慵瑮穩摥⤢㨠吠塅⡔昢汵≬Ⱙ丠浵潂摩ⱳ䜠瑥瑓瑡䉥瑹獥敐䉲楯⡤Ⱙ䜠瑥畑湡楴敺䉤瑹獥敐䉲楯⡤Ⱙ丠浵潂摩⁳‪敇却慴整祂整偳牥潂摩⤨⼠䴠来扡瑹ⱥऊ䜉瑥敋湲汥祂整偳牥潂摩⤨‬楓呭浩䵥ⱳ䈠楯獤敐䵲ⱳ⨠敇乴浡⡥⤩਻唉彅佌⡇潌呧浥Ɒ䰠杯‬䕔员∨汆捯⁫瑳牯条⁥┨⥳愠⁴〱欰戠楯獤›⸥昲䴠⁂瑳瑡ⱥ┠㈮⁦䉍映潬正慭整眠牯楫杮猠瑥椠⁮汆捯䵫湡条牥›猥∮Ⱙऊ戉畑湡楴敺汆捯浫瑡獥㼠吠塅⡔焢慵瑮穩摥⤢㨠吠塅⡔昢汵≬Ⱙㄠ〰〰‰‪敇却慴整祂整偳牥潂摩⤨⼠䴠来扡瑹ⱥㄠ〰〰‰‪敇䭴牥敮䉬瑹獥敐䉲楯⡤  敍慧祢整‬䜪瑥慎敭⤨㬩ਊ⼉戯楯⁤捡潴獲挠獯⁴潭敲琠慨⁮桴楥⁲汦捯⁫瑳瑡ⱥ栠慥汤獥⁳汦捯獫搠湯琧猠慰湷琠敨੭按湯瑳椠瑮㈳䄠瑣牯祂整偳牥潂摩㴠䔠瑳浩瑡䅥瑣牯祂整偳牥潂摩⤨਻唉彅佌⡇潌呧浥Ɒ䰠杯‬䕔员∨汆捯⁫捡潴獲⠠猥㨩愠⁮獥楴慭整⁤搥戠瑹獥漠⁦捡潴⁲湡⁤潣灭湯湥獴瀠牥戠楯⁤猥⠠⸥昲䴠⁂潦⁲搥戠楯獤‬潮⁴潣湵楴杮瀠票楳獣戠摯敩⁳湡⁤敲摮牥猠慴整 湩䘠潬正慍慮敧㩲┠⹳⤢ਬउ䥢䡳慥汤獥⁳‿䕔员∨敨摡敬獳⤢㨠吠塅⡔猢慰湷摥⤢‬捁潴䉲瑹獥敐䉲楯Ɽ戠獉效摡敬獳㼠吠塅⡔猢癡摥⤢㨠吠塅⡔產敳≤Ⱙ丠浵潂摩⁳‪捁潴䉲瑹獥敐䉲楯⁤ 敍慧祢整‬畎䉭楯獤‬䜪瑥慎敭⤨㬩紊ਊ潶摩䄠汆捯䵫湡条牥㨺敓䵴硡灓敥⡤汦慯⁴敎䵷硡灓敥⥤笊ऊ晩⠠敎䵷硡灓敥⁤‼⤰ऊ੻उ⼯潬⁧慷湲湩⁧潴挠湯潳敬ऊ唉彅佌⡇潌呧浥Ɒ圠牡楮杮‬䕔员∨敒畱獥⁴潴挠慨杮⁥潂摩䴠硡匠数摥琠⁯敮慧楴敶瘠污敵椠湧牯摥椠⁮汆捯䵫湡条牥›猥∮Ⱙ⨠敇乴浡⡥⤩਻उ敲畴湲਻紉ਊ⼉甯摰瑡⁥慭⁸灳敥⁤潴渠睥猠瑥楴杮ऊ慍卸数摥㴠丠睥慍卸数摥਻ऊ⼯档捥⁫晩渠睥䴠硡椠⁳潬敷⁲桴湡䴠湩‬潬敷⁲楍⁮潴渠睥猠数摥琠⁯癡楯⁤楍⁮‾慍⁸牥潲⁲敢慨楶牯ऊ晩⠠慍卸数摥㰠䴠湩灓敥⥤ऊ੻उ楍卮数摥㴠䴠硡灓敥㭤ऊ੽੽瘊楯⁤䙁潬正慍慮敧㩲区瑥楍卮数摥昨潬瑡丠睥楍卮数摥਩੻椉⁦丨睥楍卮数摥㰠〠਩笉ऊ⼉氯杯眠牡楮杮琠⁯潣獮汯੥उ䕕䱟䝏䰨杯敔灭‬慗湲湩Ⱨ吠塅⡔刢煥敵瑳琠⁯档湡敧䈠楯⁤慍⁸灓敥⁤潴渠来瑡癩⁥慶畬⁥杩潮敲⁤湩䘠潬正慍慮敧㩲┠⹳⤢‬䜪瑥慎敭⤨㬩ऊ爉瑥牵㭮ऊ੽ऊ⼯灵慤整洠湩猠数摥琠⁯敮⁷敳瑴湩੧䴉湩灓敥⁤‽敎䵷湩灓敥㭤ਊ⼉振敨正椠⁦敮⁷楍⁮獩栠杩敨⁲桴湡䴠硡‬慲獩⁥慍⁸潴渠睥猠数摥琠⁯癡楯⁤楍⁮‾慍⁸牥潲⁲敢慨楶牯ऊ晩⠠楍卮数摥㸠䴠硡灓敥⥤ऊ੻उ慍卸数摥㴠䴠湩灓敥㭤ऊ੽੽瘊楯⁤䙁潬正慍慮敧㩲区瑥汁杩浮湥却牴湥瑧⡨汦慯⁴敎䅷楬湧敭瑮瑓敲杮桴਩੻䄉楬湧敭瑮瑓敲杮桴㴠丠睥汁杩浮湥却牴湥瑧㭨紊ਊ潶摩䄠汆捯䵫湡条牥㨺敓却灥牡瑡潩卮牴湥瑧⡨汦慯⁴敎卷灥牡瑡潩卮牴湥瑧⥨笊ऊ敓慰慲楴湯瑓敲杮桴㴠丠睥敓慰慲楴湯瑓敲杮桴਻੽瘊楯⁤䙁潬正慍慮敧㩲区瑥潃敨楳湯瑓敲杮桴昨潬瑡丠睥潃敨楳湯瑓敲杮桴਩੻䌉桯獥潩卮牴湥瑧⁨‽敎䍷桯獥潩卮牴湥瑧㭨紊ਊ潶摩䄠汆捯䵫湡条牥㨺敓䅴潶摩湡散瑓敲杮桴昨潬瑡丠睥癁楯慤据卥牴湥瑧⥨笊ऊ癁楯慤据卥牴湥瑧⁨‽敎䅷潶摩湡散瑓敲杮桴਻੽瘊楯⁤䙁潬正慍慮敧㩲区瑥敂慨楶牯䔨汆捯䉫桥癡潩⁲敎䉷桥癡潩⥲笊ऊ敂慨楶牯㴠丠睥敂慨楶牯਻੽甊湩㍴′䙁潬正慍慮敧㩲䜺瑥畒敬敓⡴ 潣獮ੴ੻甉湩㍴′畒敬⁳‽㬰ऊ晩⠠敓慰慲楴湯瑓敲杮桴℠‽⸰昰਩笉ऊ刉汵獥簠‽䙅潬正畒敬㨺敓慰慲楴湯਻紉ਊ⼉眯湡敤楲杮戠楯獤椠湧牯⁥汦捯浫瑡⁥敨摡湩獧愠摮瀠獯瑩潩獮ऊ晩⠠敂慨楶牯℠‽䙅潬正敂慨楶牯㨺慗摮牥਩笉ऊ椉⁦䄨楬湧敭瑮瑓敲杮桴℠‽⸰昰਩उ੻उ刉汵獥簠‽䙅潬正畒敬㨺汁杩浮湥㭴ऊ紉ऊ椉⁦䌨桯獥潩卮牴湥瑧⁨㴡〠〮⥦ऊ笉ऊउ畒敬⁳㵼䔠汆捯剫汵㩥䌺桯獥潩㭮ऊ紉ऊ੽ऊ⼯⁡但⁖景ⴠ‱敳獥愠汬愠潲湵⁤桴⁥潢摩‬桴⁥档捥⁫獩漠汮⁹敮摥摥椠⁦⁡但⁖獩渠牡潲敷ੲ椉⁦匨灥牡瑡潩䙮噏㸠ⴠ⸱昰簠⁼汁杩浮湥䙴噏㸠ⴠ⸱昰簠⁼潃敨楳湯但⁖‾ㄭ〮⥦ऊ੻उ畒敬⁳㵼䔠汆捯剫汵㩥䘺敩摬晏楖睥਻紉ਊ椉⁦䄨潶摩湡散瑓敲杮桴℠‽⸰昰☠…癁楯慤据卥湥潳獲丮浵⤨㸠〠਩笉ऊ刉汵獥簠‽䙅潬正畒敬㨺癁楯慤据㭥ऊ੽ऊ晩⠠偢慬慮䵲癯浥湥⥴ऊ੻उ畒敬⁳㵼䔠汆捯剫汵㩥债慬慮㭲ऊ੽ऊ敲畴湲删汵獥਻੽瘊楯⁤䙁潬正慍慮敧㩲区瑥敎杩扨畯䱲獩獴湅扡敬⡤潢汯戠湅扡敬⥤笊ऊ⼯楬瑳⁳牡⁥敲摡戠⁹桴⁥楳畭慬楴湯ऊ慗瑩潆卲浩汵瑡潩⡮㬩ਊ戉獕乥楥桧潢牵楌瑳⁳‽䕢慮汢摥਻三楥桧潢牵楌瑳湁档牯⹳浅瑰⡹㬩紊ਊ潶摩䄠汆捯䵫湡条牥㨺慇桴牥敎杩扨畯䱲獩䍴畨歮椨瑮㈳䌠畨歮湉敤⥸笊ऊ晩⠠戡敒畢汩乤楥桧潢牵楌瑳⥳笠爠瑥牵㭮素ਊ䘉汆捯卫整牥湩䍧畨歮…桃湵⁫‽瑓敥楲杮桃湵獫䍛畨歮湉敤嵸਻按湯瑳搠畯汢⁥桃湵卫慴瑲楔敭㴠䘠汐瑡潦浲楔敭㨺敓潣摮⡳㬩ਊ⼉术瑡敨⁲汦捯浫瑡獥漠⁦慥档戠楯⁤景琠敨挠畨歮眠瑩楨⁮桴⁥硥整摮摥爠摡畩⁳湩潴琠敨挠畨歮猧漠湷氠獩獴ऊ潣獮⁴汦慯⁴楌瑳慒楤獵㴠匠浩畑牥剹摡畩⁳‫楓乭楥桧潢牵歓湩਻䌉畨歮丮楥桧潢牵楌瑳瑓牡獴匮瑥畎啭楮楮楴污穩摥䌨畨歮䔮摮潂摩ⴠ䌠畨歮䘮物瑳潂摩㬩ऊ桃湵⹫敎杩扨畯䱲獩䥴摮捩獥刮獥瑥⤨਻昉牯⠠湩㍴′⁩‽桃湵⹫楆獲䉴楯㭤椠㰠䌠畨歮䔮摮潂摩※⬫⥩ऊ੻उ桃湵⹫敎杩扨畯䱲獩却慴瑲孳⁩‭桃湵⹫楆獲䉴楯嵤㴠䌠畨歮丮楥桧潢牵楌瑳湉楤散⹳畎⡭㬩ऊ䘉潬正捏牴敥䜮瑡敨乲楥桧潢牵⡳汆捯卫慴整倮獯瑩潩獮楛ⱝ䰠獩剴摡畩ⱳ椠‬桃湵⹫汆捯浫瑡獥㬩ऊ䌉畨歮丮楥桧潢牵楌瑳湉楤散⹳灁数摮䌨畨歮䘮潬正慭整⥳਻紉ਊ䌉畨歮圮牯䵫⁳㴫映潬瑡⠨偆慬晴牯呭浩㩥区捥湯獤⤨ⴠ䌠畨歮瑓牡呴浩⥥⨠ㄠ〰⸰⤰਻੽瘊楯⁤䙁潬正慍慮敧㩲区楴捴乨楥桧潢牵楌瑳⡳਩੻椉⁦ℨ剢扥極摬敎杩扨畯䱲獩獴 ⁻敲畴湲※੽按湯瑳搠畯汢⁥瑓瑩档瑓牡呴浩⁥‽偆慬晴牯呭浩㩥区捥湯獤⤨਻ऊ⼯灡数摮琠敨氠獩獴漠⁦癥牥⁹档湵⁫湩戠楯⁤牯敤ੲ按湯瑳椠瑮㈳丠浵潂摩⁳‽汆捯卫慴整丮浵⤨਻三楥桧潢牵楌瑳瑓牡獴匮瑥畎啭楮楮楴污穩摥丨浵潂摩⁳‫⤱਻三楥桧潢牵楌瑳湉楤散⹳敒敳⡴㬩ऊ潦⁲挨湯瑳䘠汆捯卫整牥湩䍧畨歮…桃湵⁫›瑓敥楲杮桃湵獫਩笉ऊ按湯瑳椠瑮㈳传晦敳⁴‽敎杩扨畯䱲獩䥴摮捩獥丮浵⤨਻उ潦⁲椨瑮㈳椠㴠䌠畨歮䘮物瑳潂摩※⁩‼桃湵⹫湅䉤楯㭤⬠椫਩उ੻उ三楥桧潢牵楌瑳瑓牡獴楛⁝‽晏獦瑥⬠䌠畨歮丮楥桧潢牵楌瑳瑓牡獴楛ⴠ䌠畨歮䘮物瑳潂摩㭝ऊ紉ऊ三楥桧潢牵楌瑳湉楤散⹳灁数摮䌨畨歮丮楥桧潢牵楌瑳湉楤散⥳਻紉ऊ敎杩扨畯䱲獩却慴瑲孳畎䉭楯獤⁝‽敎杩扨畯䱲獩䥴摮捩獥丮浵⤨਻ऊ敎杩扨畯䱲獩䅴据潨獲㴠䘠潬正瑓瑡⹥潐楳楴湯㭳ऊ敎杩扨畯䱲獩剴摡畩⁳‽楓六敵祲慒楤獵⬠匠浩敎杩扨畯卲楫㭮ऊ敎杩扨畯䱲獩䱴祡畯⁴‽汆捯卫慴整䜮瑥慌潹瑵敖獲潩⡮㬩ਊ倉敲慰敲獍⬠‽汦慯⡴䘨汐瑡潦浲楔敭㨺敓潣摮⡳ ‭瑓瑩档瑓牡呴浩⥥⨠ㄠ〰⸰⤰਻੽瘊楯⁤䙁潬正慍慮敧㩲刺浥灡敎杩扨畯䱲獩獴挨湯瑳吠牁慲㱹湩㍴㸲…潓瑲牏敤⥲笊ऊ潣獮⁴湩㍴′畎䉭楯獤㴠匠牯佴摲牥丮浵⤨਻ऊ⼯敮⁷湩敤⁸景攠敶祲漠摬椠摮硥ऊ䅔牲祡椼瑮㈳‾敎䥷摮捩獥਻三睥湉楤散⹳敓乴浵湕湩瑩慩楬敺⡤畎䉭楯獤㬩ऊ潦⁲椨瑮㈳椠㴠〠※⁩‼畎䉭楯獤※⬫⥩ऊ੻उ敎䥷摮捩獥卛牯佴摲牥楛嵝㴠椠਻紉ਊ⼉洯癯⁥慥档氠獩⁴湡⁤湡档牯琠⁯瑩⁳潢摩猧渠睥椠摮硥愠摮爠湥浡⁥楬瑳摥映潬正慭整⁳潴琠敨物渠睥椠摮捩獥ऊ䅔牲祡椼瑮㈳‾潓瑲摥瑓牡獴਻吉牁慲㱹湩㍴㸲匠牯整䥤摮捩獥਻吉牁慲㱹噆捥潴㹲匠牯整䅤据潨獲਻匉牯整卤慴瑲⹳敓乴浵湕湩瑩慩楬敺⡤畎䉭楯獤⬠ㄠ㬩ऊ潓瑲摥湉楤散⹳敒敳癲⡥敎杩扨畯䱲獩䥴摮捩獥丮浵⤨㬩ऊ潓瑲摥湁档牯⹳敓乴浵湕湩瑩慩楬敺⡤畎䉭楯獤㬩ऊ潦⁲椨瑮㈳椠㴠〠※⁩‼畎䉭楯獤※⬫⥩ऊ੻उ潣獮⁴湩㍴′汏䥤摮硥㴠匠牯佴摲牥楛㭝ऊ匉牯整卤慴瑲孳嵩㴠匠牯整䥤摮捩獥丮浵⤨਻उ潦⁲椨瑮㈳樠㴠丠楥桧潢牵楌瑳瑓牡獴佛摬湉敤嵸※⁪‼敎杩扨畯䱲獩却慴瑲孳汏䥤摮硥⬠ㄠ㭝⬠樫਩उ੻उ匉牯整䥤摮捩獥䄮摤丨睥湉楤散孳敎杩扨畯䱲獩䥴摮捩獥橛嵝㬩ऊ紉ऊ匉牯整䅤据潨獲楛⁝‽敎杩扨畯䱲獩䅴据潨獲佛摬湉敤嵸਻紉ऊ潓瑲摥瑓牡獴乛浵潂摩嵳㴠匠牯整䥤摮捩獥丮浵⤨਻ऊ敎杩扨畯䱲獩却慴瑲⁳‽潍敶敔灭匨牯整卤慴瑲⥳਻三楥桧潢牵楌瑳湉楤散⁳‽潍敶敔灭匨牯整䥤摮捩獥㬩ऊ敎杩扨畯䱲獩䅴据潨獲㴠䴠癯呥浥⡰潓瑲摥湁档牯⥳਻三楥桧潢牵楌瑳慌潹瑵㴠䘠潬正瑓瑡⹥敇䱴祡畯噴牥楳湯⤨਻੽瘊楯⁤䙁潬正慍慮敧㩲䜺瑡敨䱲獩整乤楥桧潢牵⡳湩㍴′潂摩湉敤ⱸ映潬瑡删摡畩ⱳ吠牁慲㱹湩㍴㸲…畏乴楥桧潢牵ⱳ椠瑮㈳䴠硡敎杩扨畯獲 潣獮ੴ੻伉瑵敎杩扨畯獲刮獥瑥⤨਻ऊ⼯档捥⁫楬瑳摥映潬正慭整⁳硥捡汴੹按湯瑳映潬瑡删摡畩即畱牡摥㴠删摡畩⁳‪慒楤獵਻按湯瑳䘠敖瑣牯…潌慣楴湯㴠䘠潬正瑓瑡⹥潐楳楴湯孳潂摩湉敤嵸਻昉牯⠠湩㍴′⁩‽敎杩扨畯䱲獩却慴瑲孳潂摩湉敤嵸※⁩‼敎杩扨畯䱲獩却慴瑲孳潂摩湉敤⁸‫崱※⬫⥩ऊ੻उ潣獮⁴湩㍴′汆捯浫瑡䥥摮硥㴠丠楥桧潢牵楌瑳湉楤散孳嵩਻उ晩⠠噆捥潴㩲䐺獩却畱牡摥䘨潬正瑓瑡⹥潐楳楴湯孳汆捯浫瑡䥥摮硥ⱝ䰠捯瑡潩⥮㰠‽慒楤獵煓慵敲⥤ऊ笉ऊउ畏乴楥桧潢牵⹳摁⡤汆捯浫瑡䥥摮硥㬩ऊउ晩⠠畏乴楥桧潢牵⹳畎⡭ 㴽䴠硡敎杩扨畯獲 ⁻敲畴湲※੽उ੽紉紊ਊ潶摩䄠汆捯䵫湡条牥㨺敓䅴杧敲慧整敐捲灥楴湯湅扡敬⡤潢汯戠湅扡敬⥤笊ऊ啢敳杁牧来瑡健牥散瑰潩⁮‽䕢慮汢摥਻੽瘊楯⁤䙁潬正慍慮敧㩲区瑥杁牧来瑡健牥散瑰潩剮摡畩⡳汦慯⁴敎䅷杧敲慧整敐捲灥楴湯慒楤獵਩੻椉⁦丨睥杁牧来瑡健牥散瑰潩剮摡畩⁳‼⤰ऊ੻उ⼯潬⁧慷湲湩⁧潴挠湯潳敬ऊ唉彅佌⡇潌呧浥Ɒ圠牡楮杮‬䕔员∨敒畱獥⁴潴挠慨杮⁥潂摩䄠杧敲慧整倠牥散瑰潩⁮慒楤獵琠⁯敮慧楴敶瘠污敵椠湧牯摥椠⁮汆捯䵫湡条牥›猥∮Ⱙ⨠敇乴浡⡥⤩਻उ敲畴湲਻紉ਊ䄉杧敲慧整敐捲灥楴湯慒楤獵㴠丠睥杁牧来瑡健牥散瑰潩剮摡畩㭳紊ਊ潶摩䄠汆捯䵫湡条牥㨺敓却灥牡瑡潩剮摡畩⡳汦慯⁴敎卷灥牡瑡潩剮摡畩⥳笊ऊ晩⠠敎卷灥牡瑡潩剮摡畩⁳‼⤰ऊ੻उ⼯潬⁧慷湲湩⁧潴挠湯潳敬ऊ唉彅佌⡇潌呧浥Ɒ圠牡楮杮‬䕔员∨敒畱獥⁴潴挠慨杮⁥潂摩匠灥牡瑡潩⁮慒楤獵琠⁯敮慧楴敶瘠污敵椠湧牯摥椠⁮汆捯䵫湡条牥›猥∮Ⱙ⨠敇乴浡⡥⤩਻उ敲畴湲਻紉ਊ匉灥牡瑡潩剮摡畩⁳‽敎卷灥牡瑡潩剮摡畩㭳紊ਊ潶摩䄠汆捯䵫湡条牥㨺敓䅴楬湧敭瑮慒楤獵昨潬瑡丠睥汁杩浮湥剴摡畩⥳笊ऊ晩⠠敎䅷楬湧敭瑮慒楤獵㰠〠਩笉ऊ⼉氯杯眠牡楮杮琠⁯潣獮汯੥उ䕕䱟䝏䰨杯敔灭‬慗湲湩Ⱨ吠塅⡔刢煥敵瑳琠⁯档湡敧䈠楯⁤汁杩浮湥⁴慒楤獵琠⁯敮慧楴敶瘠污敵椠湧牯摥椠⁮汆捯䵫湡条牥›猥∮Ⱙ⨠敇乴浡⡥⤩਻उ敲畴湲਻紉ਊ䄉楬湧敭瑮慒楤獵㴠丠睥汁杩浮湥剴摡畩㭳紊ਊ潶摩䄠汆捯䵫湡条牥㨺敓䍴桯獥潩剮摡畩⡳汦慯⁴敎䍷桯獥潩剮摡畩⥳笊ऊ晩⠠敎䍷桯獥潩剮摡畩⁳‼⤰ऊ੻उ⼯潬⁧慷湲湩⁧潴挠湯潳敬ऊ唉彅佌⡇潌呧浥Ɒ圠牡楮杮‬䕔员∨敒畱獥⁴潴挠慨杮⁥潂摩䌠桯獥潩⁮慒楤獵琠⁯敮慧楴敶瘠污敵椠湧牯摥椠⁮汆捯䵫湡条牥›猥∮Ⱙ⨠敇乴浡⡥⤩਻उ敲畴湲਻紉ਊ䌉桯獥潩剮摡畩⁳‽敎䍷桯獥潩剮摡畩㭳紊ਊ潶摩䄠汆捯䵫湡条牥㨺灕慤整敐捲灥楴湯楒杮⡳਩੻匉浩敓慰慲楴湯慒楤獵㴠匠灥牡瑡潩剮摡畩⁳‾⸰昰㼠匠灥牡瑡潩剮摡畩⁳›敐捲灥楴湯慒楤獵਻匉浩汁杩浮湥剴摡畩⁳‽汁杩浮湥剴摡畩⁳‾⸰昰㼠䄠楬湧敭瑮慒楤獵㨠倠牥散瑰潩剮摡畩㭳ऊ楓䍭桯獥潩剮摡畩⁳‽潃敨楳湯慒楤獵㸠〠〮⁦‿潃敨楳湯慒楤獵㨠倠牥散瑰潩剮摡畩㭳ਊ⼉愯楬湧敭瑮愠摮挠桯獥潩⁮潤❮⁴敲摡映潬正慭整⁳桷湥琠敨⁹獵⁥条牧来瑡⁥数捲灥楴湯ऊ晩⠠啢敳杁牧来瑡健牥散瑰潩⥮ऊ੻उ楓䅭楬湧敭瑮慒楤獵㴠匠浩敓慰慲楴湯慒楤獵਻उ楓䍭桯獥潩剮摡畩⁳‽楓卭灥牡瑡潩剮摡畩㭳ऊ੽ऊ⼯潳瑲爠汵⁥慲楤⁩湩潴爠湩獧‬畲敬⁳楷桴琠敨猠浡⁥慲楤獵猠慨敲愠爠湩੧按湯瑳映潬瑡删汵剥摡楩㍛⁝‽⁻楓卭灥牡瑡潩剮摡畩ⱳ匠浩汁杩浮湥剴摡畩ⱳ匠浩潃敨楳湯慒楤獵素਻昉潬瑡删湩剧摡楩㍛⁝‽⁻畒敬慒楤孩崰‬畒敬慒楤孩崱‬畒敬慒楤孩崲素਻匉牯⡴楒杮慒楤Ⱪ㌠㬩ऊ潦⁲椨瑮㈳删湩⁧‽㬰删湩⁧‼㬳⬠别湩⥧ऊ੻उ楓剭湩剧摡楩煓慵敲孤楒杮⁝‽楒杮慒楤孩楒杮⁝‪楒杮慒楤孩楒杮㭝ऊ੽昉牯⠠湩㍴′畒敬㴠〠※畒敬㰠㌠※⬫畒敬਩笉ऊ匉浩畒敬楒杮孳畒敬⁝‽楒杮慒楤孩崱㴠‽畒敬慒楤孩畒敬⁝‿‱›刨湩剧摡楩せ⁝㴽删汵剥摡楩剛汵嵥㼠〠㨠㈠㬩ऊ੽ऊ楓六敵祲慒楤獵㴠删湩剧摡楩㉛㭝ऊ卢浩敎瑳摥楒杮⁳‽楒杮慒楤孩崰㰠删湩剧摡楩㉛㭝紊ਊ䙆潬正慭整楒杮⁳䙁潬正慍慮敧㩲区汰瑩汆捯浫瑡獥椨瑮㈳䈠楯䥤摮硥‬䙆潬正瑓敥楲杮桃湵♫䌠畨歮਩੻䘉汆捯浫瑡剥湩獧删湩獧਻按湯瑳吠牁慲㱹湩㍴㸲…汆捯浫瑡獥㴠䌠畨歮䘮潬正慭整㭳ऊ潣獮⁴湩㍴′畎䙭潬正慭整⁳‽汆捯浫瑡獥丮浵⤨਻ऊ⼯癥牥⁹畲敬爠慥獤愠汬映潬正慭整⁳桷湥爠摡楩洠瑡档ऊ晩⠠戡楓乭獥整剤湩獧਩笉ऊ刉湩獧匮灥牡瑡潩⁮‽汆捯浫瑡獥਻उ楒杮⹳汁杩浮湥⁴‽汆捯浫瑡獥਻उ楒杮⹳潃敨楳湯㴠䘠潬正慭整㭳ऊ爉瑥牵⁮楒杮㭳ऊ੽ऊ⼯楦摮椠湮牥潭瑳爠湩⁧景攠捡⁨汦捯浫瑡⁥祢猠畱牡摥搠獩慴据⁥湡⁤潣湵⁴汦捯浫瑡獥瀠牥爠湩੧椉瑮㈳删湩䕧摮孳崳㴠笠〠‬ⰰ〠素਻䌉畨歮刮湩䥧摮捩獥匮瑥畎啭楮楮楴污穩摥丨浵汆捯浫瑡獥‬慦獬⥥਻按湯瑳䘠敖瑣牯…潌慣楴湯㴠䘠潬正瑓瑡⹥潐楳楴湯孳潂摩湉敤嵸਻昉牯⠠湩㍴′⁩‽㬰椠㰠丠浵汆捯浫瑡獥※⬫⥩ऊ੻उ潣獮⁴汦慯⁴楄瑳湡散煓慵敲⁤‽噆捥潴㩲䐺獩却畱牡摥䜨瑥汆捯浫瑡健獯瑩潩⡮汆捯浫瑡獥楛⥝‬潌慣楴湯㬩ऊ按湯瑳甠湩㡴删湩⁧‽楄瑳湡散煓慵敲⁤㴼匠浩楒杮慒楤卩畱牡摥せ⁝‿‰›䐨獩慴据卥畱牡摥㰠‽楓剭湩剧摡楩煓慵敲孤崱㼠ㄠ㨠㈠㬩ऊ䌉畨歮刮湩䥧摮捩獥楛⁝‽楒杮਻उ楒杮湅獤剛湩嵧⬫਻紉ऊ楒杮湅獤ㅛ⁝㴫删湩䕧摮孳崰਻刉湩䕧摮孳崲⬠‽楒杮湅獤ㅛ㭝ਊ⼉瀯慬散映潬正慭整⁳湩敮浲獯⁴楲杮映物瑳猠⁯慥档爠汵⁥敲摡⁳⁡牰晥硩ऊ湩㍴′楒杮瑓牡獴㍛⁝‽⁻ⰰ删湩䕧摮孳崰‬楒杮湅獤ㅛ⁝㭽ऊ桃湵⹫楒杮⹳敓乴浵湕湩瑩慩楬敺⡤畎䙭潬正慭整ⱳ映污敳㬩ऊ潦⁲椨瑮㈳椠㴠〠※⁩‼畎䙭潬正慭整㭳⬠椫਩笉ऊ䌉畨歮刮湩獧剛湩卧慴瑲孳桃湵⹫楒杮湉楤散孳嵩⭝崫㴠䘠潬正慭整孳嵩਻紉ਊ刉湩獧匮灥牡瑡潩⁮‽䅔牲祡楖睥挼湯瑳椠瑮㈳⠾桃湵⹫楒杮⹳敇䑴瑡⡡Ⱙ删湩䕧摮孳楓剭汵剥湩獧せ嵝㬩ऊ楒杮⹳汁杩浮湥⁴‽䅔牲祡楖睥挼湯瑳椠瑮㈳⠾桃湵⹫楒杮⹳敇䑴瑡⡡Ⱙ删湩䕧摮孳楓剭汵剥湩獧ㅛ嵝㬩ऊ楒杮⹳潃敨楳湯㴠吠牁慲噹敩㱷潣獮⁴湩㍴㸲䌨畨歮刮湩獧䜮瑥慄慴⤨‬楒杮湅獤卛浩畒敬楒杮孳崲⥝਻爉瑥牵⁮楒杮㭳紊ਊ潶摩䄠汆捯䵫湡条牥㨺敓側慬慮䵲癯浥湥⡴潢汯戠湅扡敬⥤笊ऊ晩⠠䕢慮汢摥㴠‽偢慬慮䵲癯浥湥⥴笠爠瑥牵㭮素ਊ⼉猯湥潳獲愠敲爠慥⁤祢琠敨猠浩汵瑡潩੮圉楡䙴牯楓畭慬楴湯⤨਻ऊ偢慬慮䵲癯浥湥⁴‽䕢慮汢摥਻䈉極摬癁楯慤据卥湥潳獲⤨਻䄉灰祬畑污瑩䱹癥汥⤨਻ऊ⼯汦睯映敩摬栠獡琠⁯敢爠扥歡摥漠⁮牯漠晦琠敨瀠慬敮ऊ晩⠠汆睯楆汥⹤獉畂汩⡴⤩ऊ੻उ慂敫汆睯楆汥⡤㬩ऊ੽੽瘊楯⁤䙁潬正慍慮敧㩲䈺極摬癁楯慤据卥湥潳獲⤨笊ऊ⼯浥瑰⁹敳獮牯愠牲祡ऊ癁楯慤据卥湥潳獲䔮灭祴⤨਻ऊ晩⠠偢慬慮䵲癯浥湥⥴ऊ੻उ⼯楲杮漠⁦敳獮牯⁳湯琠敨砠⁹汰湡ⱥ猠湥潳⁲‰潰湩獴映牯慷摲⠠堫 湡⁤桴⁥敲瑳愠瑬牥慮整氠晥⁴湡⁤楲桧⁴潴慷摲⁳桴⁥慢正ऊ按湯瑳映潬瑡匠湥潳䅲杮敬㴠㈠⨠唠楋浳瑥慍桴楌牢牡㩹䜺瑥䥐⤨⼠䘠慍桴㨺慍⡸畎偭慬慮卲湥潳獲‬⤱਻उ潦⁲椨瑮㈳椠㴠〠※⁩‼畎偭慬慮卲湥潳獲※⬫⥩ऊ笉ऊउ汦慯⁴湁汧⁥‽敓獮牯湁汧⁥‪⠨⁩‫⤱⼠㈠ ‪⠨⁩‥⤲㼠ㄠ〮⁦›ㄭ〮⥦਻उ䄉潶摩湡散敓獮牯⹳浅汰捡⡥䵆瑡㩨䌺獯䄨杮敬Ⱙ䘠慍桴㨺楓⡮湁汧⥥‬⸰昰㬩ऊ紉ऊ爉瑥牵㭮ऊ੽ऊ⼯桴瑥⁡湡汧⁥景爠瑯瑡潩⁮湯砠⁹汰湡⁥牡畯摮稠愠楸⁳礨睡 牡畯摮猠桰牥੥昉潬瑡琠敨慴਻⼉瀯楨愠杮敬漠⁦潲慴楴湯⠠灾瑩档 牡畯摮猠桰牥੥昉潬瑡瀠楨਻⼉愯獳浵湩⁧湵瑩猠桰牥⁥爨摡畩⁳‽⤱琠⁯楳灭楬祦挠污畣慬楴湯ੳ⼉搯物捥楴湯瘠捥潴⁲潰湩楴杮映潲⁭桴⁥散瑮牥琠⁯潰湩⁴湯猠桰牥⁥畳晲捡੥䘉敖瑣牯匠湥潳䑲物捥楴湯਻ऊ潦⁲椨瑮㈳椠㴠〠※⁩‼畎卭湥潳獲※⬫⥩ऊ੻उ⼯慣捬汵瑡⁥桴⁥灳敨楲慣⁬潣牯楤慮整⁳景琠敨搠物捥楴湯瘠捥潴獲攠摮潰湩ੴउ桴瑥⁡‽′‪䭕獩敭䵴瑡䱨扩慲祲㨺敇側⡉ ‪潇摬湥慒楴⁯‪㭩ऊ瀉楨㴠䘠慍桴㨺捁獯ㄨⴠ⠠′‪汦慯⡴⥩⼠丠浵敓獮牯⥳㬩ਊउ⼯潣癮牥⁴潰湩⁴湯猠桰牥⁥潴挠牡整楳湡挠潯摲湩瑡獥砠穹ऊ匉湥潳䑲物捥楴湯堮㴠䘠慍桴㨺潃⡳桴瑥⥡䘪慍桴㨺楓⡮桰⥩਻उ敓獮牯楄敲瑣潩⹮⁙‽䵆瑡㩨区湩琨敨慴⨩䵆瑡㩨区湩瀨楨㬩ऊ匉湥潳䑲物捥楴湯娮㴠䘠慍桴㨺潃⡳桰⥩਻उ⼯摡⁤楤敲瑣潩⁮潴氠獩⁴景猠湥潳獲映牯愠潶摩湡散ऊ䄉潶摩湡散敓獮牯⹳浅汰捡⡥敓獮牯楄敲瑣潩⥮਻紉紊ਊ瘊楯⁤䙁潬正慍慮敧㩲区慴瑲楓畭慬楴湯昨潬瑡䐠汥慴楔敭਩੻⼉振浯業⁴慬瑳猠浩汵瑡潩⁮晩椠獴挠浯業⁴楴正搠摩❮⁴畲੮䘉湩獩卨浩汵瑡潩⡮㬩ਊ按湯瑳椠瑮㈳丠浵潂摩⁳‽汆捯卫慴整丮浵⤨਻ऊ⼯数楲摯捩污祬爠ⵥ潳瑲映潬正猠慴整猠⁯潢摩⁳桴瑡愠敲挠潬敳椠⁮桴⁥潷汲⁤牡⁥污潳挠潬敳椠⁮敭潭祲ऊ晩⠠畎䉭楯獤㸠〠☠…潍瑲湯潓瑲湉整癲污㸠〠☠…⬫牆浡獥楓据䵥牯潴卮牯⁴㴾䴠牯潴卮牯䥴瑮牥慶⥬ऊ੻उ⼯楬瑳⁳桴瑡眠牥⁥灵琠⁯慤整戠晥牯⁥桴⁥潳瑲洠癯⁥楷桴琠敨物戠楯獤椠獮整摡漠⁦敢湩⁧敲畢汩ੴउ潣獮⁴潢汯戠楌瑳噳污摩㴠丠楥桧潢牵楌瑳慌潹瑵㴠‽汆捯卫慴整䜮瑥慌潹瑵敖獲潩⡮ ☦丠楥桧潢牵楌瑳湁档牯⹳畎⡭ 㴽丠浵潂摩㭳ऊ椉⁦䘨潬正瑓瑡⹥潓瑲祂潍瑲湯潃敤⤨☠…䱢獩獴慖楬⥤ऊ笉ऊउ敒慭买楥桧潢牵楌瑳⡳汆捯卫慴整䜮瑥潓瑲牏敤⡲⤩਻उ੽उ牆浡獥楓据䵥牯潴卮牯⁴‽㬰ऊ੽ऊ⼯敧⁴汰祡牥瘠敩獷映牯猠整牥湩⁧佌⁄湡⁤汦敥湩੧匉浩汵瑡潩䙮慲敭⬫਻嘉敩䱷捯瑡潩獮刮獥瑥⤨਻椉⁦䄨瑣癩入慵楬祴䰮䑏楄瑳湡散㸠〠〮⁦籼䈠桥癡潩⁲㴽䔠汆捯䉫桥癡潩㩲䘺敬⥥ऊ੻उ潦⁲䘨潃獮側慬敹䍲湯牴汯敬䥲整慲潴⁲瑉牥瑡牯㴠䜠瑥潗汲⡤⴩䜾瑥汐祡牥潃瑮潲汬牥瑉牥瑡牯⤨※瑉牥瑡牯※⬫瑉牥瑡牯਩उ੻उ䄉汐祡牥潃瑮潲汬牥‪汐祡牥潃瑮潲汬牥㴠䤠整慲潴⵲䜾瑥⤨਻उ椉⁦倨慬敹䍲湯牴汯敬⥲ऊउ੻उउ噆捥潴⁲楖睥潌慣楴湯਻उउ剆瑯瑡牯嘠敩剷瑯瑡潩㭮ऊउ倉慬敹䍲湯牴汯敬⵲䜾瑥汐祡牥楖睥潐湩⡴楖睥潌慣楴湯‬楖睥潒慴楴湯㬩ऊउ嘉敩䱷捯瑡潩獮䄮摤嘨敩䱷捯瑡潩⥮਻उ紉ऊ紉ऊ੽ऊ⼯档潯敳戠楯獤琠敨猠浩汵瑡潩⁮敲潣摲⁳敤畢⁧楬敮⁳潦ੲ匉浡汰䑥扥杵潂摩⡳㬩ऊ呢汥浥瑥祲慃瑰牵⁥‽剢捥牯呤汥浥瑥祲਻ऊ⼯湳灡桳瑯猠瑥楴杮⁳湡⁤慴杲瑥映牯散ⱳ琠敨猠浩汵瑡潩⁮潤獥❮⁴潴捵⁨桴⁥慭慮敧❲⁳牰灯牥楴獥漠⁲潢摩愠瑣牯ੳ匉浩慐慲敭整獲䴮硡灓敥⁤‽慍卸数摥਻匉浩慐慲敭整獲䴮湩灓敥⁤‽楍卮数摥਻匉浩慐慲敭整獲䄮楬湧敭瑮瑓敲杮桴㴠䄠楬湧敭瑮瑓敲杮桴਻匉浩慐慲敭整獲匮灥牡瑡潩卮牴湥瑧⁨‽敓慰慲楴湯瑓敲杮桴਻匉浩慐慲敭整獲䌮桯獥潩卮牴湥瑧⁨‽潃敨楳湯瑓敲杮桴਻匉浩慐慲敭整獲䄮潶摩湡散瑓敲杮桴㴠䄠潶摩湡散瑓敲杮桴਻匉浩慐慲敭整獲匮灥牡瑡潩䙮噏㴠匠灥牡瑡潩䙮噏਻匉浩慐慲敭整獲䄮楬湧敭瑮但⁖‽汁杩浮湥䙴噏਻匉浩慐慲敭整獲䌮桯獥潩䙮噏㴠䌠桯獥潩䙮噏਻匉浩敂慨楶牯㴠䈠桥癡潩㭲ऊ楓剭汵獥㴠䜠瑥畒敬敓⡴㬩ऊ楓坭湡敤卲牴湥瑧⁨‽慗摮牥瑓敲杮桴਻匉浩汆敥慒楤獵㴠䘠敬剥摡畩㭳ऊ楓䙭敬卥牴湥瑧⁨‽汆敥瑓敲杮桴਻匉浩汆睯楆汥卤牴湥瑧⁨‽啢敳汆睯楆汥⁤☦䘠潬䙷敩摬䤮䉳極瑬⤨㼠䘠潬䙷敩摬瑓敲杮桴㨠〠〮㭦ऊ楓乭楥桧潢牵歓湩㴠戠獕乥楥桧潢牵楌瑳⁳‿敎杩扨畯卲楫⁮›⸰昰਻匉浩畑污瑩⁹‽捁楴敶畑污瑩㭹ऊ楓䅭潶摩湡散敓獮牯⹳敒敳⡴㬩ऊ楓䅭潶摩湡散敓獮牯⹳灁数摮䄨潶摩湡散敓獮牯⹳敇䑴瑡⡡Ⱙ䘠慍桴㨺楍⡮捁楴敶敓獮牯潃湵ⱴ䄠潶摩湡散敓獮牯⹳畎⡭⤩㬩ऊ楓卭湥潳割摡畩⁳‽敓獮牯慒楤獵਻戉楓䅭杧敲慧整敐捲灥楴湯㴠戠獕䅥杧敲慧整敐捲灥楴湯਻匉浩杁牧来瑡健牥散瑰潩剮摡畩⁳‽杁牧来瑡健牥散瑰潩剮摡畩㭳ऊ楓佭数楮杮湁汧⁥‽灏湥湩䅧杮敬਻唉摰瑡健牥散瑰潩剮湩獧⤨਻䌉灡畴敲汆杩瑨湁浩瑡潩⡮㬩ऊ慃瑰牵䝥潲灵牔捡楫杮⤨਻匉浩汐湡䡥楥桧⁴‽敇䅴瑣牯潌慣楴湯⤨娮਻䐉慲湩潆捲䉥晵敦⡲畎䉭楯獤㬩ਊ戉楓畭慬楴湯敐摮湩⁧‽牴敵਻戉敐摮湩䅧祳据㴠戠獁湹卣浩汵瑡潩⁮☦丠浵潂摩⁳‾㬰ऊ偢湥楤杮牔捡獥㴠戠敐摮湩䅧祳据☠…匨浩畒敬⁳…䙅潬正畒敬㨺癁楯慤据⥥℠‽㬰ऊ敐摮湩䑧汥慴楔敭㴠䐠汥慴楔敭਻ऊ⼯灳楬⁴瑳敥楲杮椠瑮⁯档湵獫琠敨映潬正猠档摥汵牥爠湵⁳湩瀠牡污敬⁬楷桴攠敶祲漠桴牥映潬正‬⁡楳杮敬挠畨歮漠桴牥楷敳ऊ䙕潬正捓敨畤敬卲扵祳瑳浥‪捓敨畤敬⁲‽偢湥楤杮獁湹⁣☦戠獕卥慨敲卤档摥汵牥㼠䜠瑥潗汲⡤⴩䜾瑥畓獢獹整㱭䙕潬正捓敨畤敬卲扵祳瑳浥⠾ ›畮汬瑰㭲ऊ畂汩卤整牥湩䍧畨歮⡳畎䉭楯獤‬捓敨畤敬⁲‿捓敨畤敬⵲䜾瑥桃湵卫穩⡥ ›畎䉭楯獤㬩ਊ椉⁦匨档摥汵牥਩笉ऊ⼉振浯汰瑥潩⁮癥湥⁴景琠敨映潬正猧琠獡獫椠⁳潪湩摥戠⁹桴⁥潣浭瑩琠捩੫उ楓畭慬楴湯慔歳㴠匠档摥汵牥㸭捓敨畤敬汆捯⡫桴獩‬敄瑬呡浩⥥਻紉ऊ汥敳椠⁦戨敐摮湩䅧祳据਩笉ऊ⼉欯捩⁫楳畭慬楴湯琠⁯⁡潷歲牥琠牨慥Ɽ椠❴⁳潪湩摥戠⁹桴⁥潣浭瑩琠捩੫उ楓畭慬楴湯慔歳㴠䘠畆据楴湯片灡周獡㩫䌺敲瑡䅥摮楄灳瑡档桗湥敒摡⡹瑛楨ⱳ䐠汥慴楔敭⡝਩उ੻उ匉浩汵瑡䙥潬正䐨汥慴楔敭㬩ऊ紉‬䕇彔呓呁䑉匨䅔彔汆捯卫浩汵瑡潩⥮‬畮汬瑰Ⱳ䔠慎敭呤牨慥獤㨺湁䡹偩楲桔敲摡楈牐呩獡⥫਻紉ऊ汥敳ऊ੻उ楓畭慬整汆捯⡫敄瑬呡浩⥥਻紉紊ਊ潶摩䄠汆捯䵫湡条牥㨺摁䉤楯䙤牯散椨瑮㈳䠠湡汤ⱥ䘠敖瑣牯䘠牯散਩੻䘉牯散畂晦牥䄮摤䘨汆捯䙫牯散⁻慈摮敬‬潆捲ⱥ映污敳素㬩紊ਊ潶摩䄠汆捯䵫湡条牥㨺摁䉤楯䥤灭汵敳椨瑮㈳䠠湡汤ⱥ䘠敖瑣牯䤠灭汵敳਩੻䘉牯散畂晦牥䄮摤䘨汆捯䙫牯散⁻慈摮敬‬浉異獬ⱥ琠畲⁥⥽਻੽瘊楯⁤䙁潬正慍慮敧㩲䐺慲湩潆捲䉥晵敦⡲湩㍴′畎䉭楯獤਩੻吉牡敧䙴牯散⹳湉瑩䘨敖瑣牯㨺敚潲敖瑣牯‬畎䉭楯獤㬩ऊ慔杲瑥浉異獬獥䤮楮⡴噆捥潴㩲娺牥噯捥潴Ⱳ丠浵潂摩⥳਻ऊ⼯潦捲獥猠扵業瑴摥眠楨敬搠慲湩湩⁧牡⁥楰正摥甠⁰敮瑸映慲敭‬潦捲獥漠⁦敲潭敶⁤潢摩⁳牡⁥牤灯数੤䘉牯散畂晦牥䐮慲湩嬨桴獩⡝潣獮⁴䙆潬正潆捲♥儠敵敵䙤牯散਩笉ऊ椉瑮㈳䤠摮硥㴠䘠潬正瑓瑡⹥敇䥴摮硥儨敵敵䙤牯散䠮湡汤⥥਻उ晩⠠湉敤⁸㴽䤠䑎塅也乏⥅笠爠瑥牵㭮素ਊउ晩⠠畑略摥潆捲⹥䥢灭汵敳਩उ੻उ吉牡敧䥴灭汵敳孳湉敤嵸⬠‽畑略摥潆捲⹥潆捲㭥ऊ紉ऊ攉獬੥उ੻उ吉牡敧䙴牯散孳湉敤嵸⬠‽畑略摥潆捲⹥潆捲㭥ऊ紉ऊ⥽਻੽瘊楯⁤䙁潬正慍慮敧㩲债扵楬桳汆捯噫敩⡷਩੻⼉爯略敳琠敨瀠敲楶畯⁳楶睥椠⁦潮爠慥敤⁲潨摬⁳瑩愠祮潭敲⠠瑩椠湳琧瀠扵楬桳摥猠⁯潮潢祤渠睥挠湡朠瑥椠⥴‬瑯敨睲獩⁥敲摡牥⁳敫灥椠ੴ吉桓牡摥瑐㱲䙆潬正楖睥‬卅䵐摯㩥吺牨慥卤晡㹥嘠敩⁷‽灓牡噥敩⹷獉慖楬⡤ ☦匠慰敲楖睥䤮啳楮畱⡥ ‿灓牡噥敩⁷›慍敫桓牡摥䘼汆捯噫敩ⱷ䔠偓潍敤㨺桔敲摡慓敦⠾㬩ऊ楖睥㸭畂汩⡤汆捯卫慴整‬卢浩牔捡䝫潲灵⁳‿䘦潬正片畯獰㨠渠汵灬牴‬⬫汆捯噫敩噷牥楳湯‬敇坴牯摬⤨㸭敇呴浩卥捥湯獤⤨㬩ਊ䘉捓灯䱥捯⁫潌正☨汆捯噫敩䱷捯⥫਻匉慰敲楖睥㴠䰠瑡獥噴敩㭷ऊ慌整瑳楖睥㴠嘠敩㭷紊ਊ䙆潬正楖睥瑐⁲䙁潬正慍慮敧㩲䜺瑥汆捯噫敩⡷ 潣獮ੴ੻䘉捓灯䱥捯⁫潌正☨汆捯噫敩䱷捯⥫਻爉瑥牵⁮慌整瑳楖睥਻੽䘊敖瑣牯䄠汆捯䵫湡条牥㨺敇䙴潬正敃瑮潲摩⤨挠湯瑳笊ऊ䙆潬正楖睥瑐⁲楖睥㴠䜠瑥汆捯噫敩⡷㬩ऊ敲畴湲嘠敩⹷獉慖楬⡤ ‿楖睥㸭敃瑮潲摩㨠䜠瑥捁潴䱲捯瑡潩⡮㬩紊ਊ噆捥潴⁲䙁潬正慍慮敧㩲䜺瑥汆捯䵫慥噮汥捯瑩⡹ 潣獮ੴ੻䘉汆捯噫敩偷牴嘠敩⁷‽敇䙴潬正楖睥⤨਻爉瑥牵⁮楖睥䤮噳污摩⤨㼠嘠敩⵷䴾慥噮汥捯瑩⁹›噆捥潴㩲娺牥噯捥潴㭲紊ਊ䉆硯䄠汆捯䵫湡条牥㨺敇䙴潬正潂湵獤⤨挠湯瑳笊ऊ䙆潬正楖睥瑐⁲楖睥㴠䜠瑥汆捯噫敩⡷㬩ऊ敲畴湲嘠敩⹷獉慖楬⡤ ‿楖睥㸭潂湵獤㨠䘠潂⡸潆捲䥥楮⥴਻੽瘊楯⁤䙁潬正慍慮敧㩲区浩汵瑡䙥潬正昨潬瑡䐠汥慴楔敭਩੻椉⁦䘨潬正瑓瑡⹥畎⡭ 㴽〠਩笉ऊ䰉獡却浩楔敭獍㴠〠〮㭦ऊ䰉獡却浩灓湡獍㴠〠〮㭦ऊ䘉潬正片畯獰刮獥瑥⤨਻उ敲畴湲਻紉ਊ䈉来湩楓畭慬楴湯⤨਻昉牯⠠湩㍴′桃湵䥫摮硥㴠〠※桃湵䥫摮硥㰠匠整牥湩䍧畨歮⹳畎⡭㬩⬠䌫畨歮湉敤⥸ऊ੻उ湉整牧瑡䍥畨歮䌨畨歮湉敤ⱸ䐠汥慴楔敭㬩ऊ੽䈉極摬灓瑡慩䥬摮硥⤨਻昉牯⠠湩㍴′桃湵䥫摮硥㴠〠※桃湵䥫摮硥㰠匠整牥湩䍧畨歮⹳畎⡭㬩⬠䌫畨歮湉敤⥸ऊ੻उ慇桴牥敎杩扨畯䱲獩䍴畨歮䌨畨歮湉敤⥸਻紉ऊ瑓瑩档敎杩扨畯䱲獩獴⤨਻昉牯⠠湩㍴′桃湵䥫摮硥㴠〠※桃湵䥫摮硥㰠匠整牥湩䍧畨歮⹳畎⡭㬩⬠䌫畨歮湉敤⥸ऊ੻उ瑓敥䍲畨歮䌨畨歮湉敤ⱸ䐠汥慴楔敭㬩ऊ੽䌉浯汰瑥卥浩汵瑡潩⡮㬩紊ਊ潶摩䄠汆捯䵫湡条牥㨺敂楧卮浩汵瑡潩⡮਩੻按湯瑳椠瑮㈳丠浵潂摩⁳‽汆捯卫慴整丮浵⤨਻匉浩瑓牡呴浩⁥‽偆慬晴牯呭浩㩥区捥湯獤⤨਻倉敲慰敲獍㴠〠〮㭦ਊ⼉猯穩⁥畢晦牥⁳牷瑩整⁮祢攠敶祲挠畨歮眠楨敬洠癯湩⁧潢摩ੳ䈉楯䡤慥楤杮⹳敓乴浵湕湩瑩慩楬敺⡤畎䉭楯獤㬩ऊ晩⠠卢浩湁浩瑡䙥楬桧⥴ऊ੻उ潂摩灓敥獤匮瑥畎啭楮楮楴污穩摥丨浵潂摩⥳਻紉ਊ⼉振捡敨⁤汦捯浫瑡獥愠敲渠敥敤⁤祢猠灥牡瑡潩Ɱ愠摮戠⁹污杩浮湥⁴湡⁤潣敨楳湯甠汮獥⁳桴祥甠敳愠杧敲慧整瀠牥散瑰潩⹮ऊ⼯楬瑳⁳牡⁥敲畢汩⁴晩戠楯獤眠牥⁥摡敤⁤牯爠浥癯摥漠⁲桴⁥慲楤獵挠慨杮摥‬牯氠瑡牥椠⁦⁡档湵⁫楦摮⁳⁡潢摩琠慨⁴潭敶⁤潴⁯慦ੲ按湯瑳戠潯⁬乢敥獤汆捯浫瑡獥㴠⠠楓剭汵獥☠䔠汆捯剫汵㩥区灥牡瑡潩⥮℠‽‰籼⠠匨浩畒敬⁳…䔨汆捯剫汵㩥䄺楬湧敭瑮簠䔠汆捯剫汵㩥䌺桯獥潩⥮ 㴡〠☠…戡楓䅭杧敲慧整敐捲灥楴湯㬩ऊ卢浩獕乥楥桧潢牵楌瑳⁳‽乢敥獤汆捯浫瑡獥☠…楓乭楥桧潢牵歓湩㸠〠〮㭦ऊ剢扥極摬敎杩扨畯䱲獩獴㴠戠楓啭敳敎杩扨畯䱲獩獴☠…丨楥桧潢牵楌瑳慌潹瑵℠‽汆捯卫慴整䜮瑥慌潹瑵敖獲潩⡮ 籼丠楥桧潢牵楌瑳湁档牯⹳畎⡭ 㴡丠浵潂摩⁳籼丠楥桧潢牵楌瑳慒楤獵℠‽楓六敵祲慒楤獵⬠匠浩敎杩扨畯卲楫⥮਻椉⁦戨楓啭敳敎杩扨畯䱲獩獴਩笉ऊ三楥桧潢牵楌瑳牆浡獥⬫਻紉紊ਊ潶摩䄠汆捯䵫湡条牥㨺湉整牧瑡䍥畨歮椨瑮㈳䌠畨歮湉敤ⱸ映潬瑡䐠汥慴楔敭਩੻䘉汆捯卫整牥湩䍧畨歮…桃湵⁫‽瑓敥楲杮桃湵獫䍛畨歮湉敤嵸਻按湯瑳搠畯汢⁥桃湵卫慴瑲楔敭㴠䘠汐瑡潦浲楔敭㨺敓潣摮⡳㬩ਊ⼉甯摰瑡⁥潰楳楴湯⁳湡⁤瑳牯⁥敨摡湩獧⠠湡⁤灳敥獤映牯映楬桧⁴湡浩瑡潩⥮ऊ潣獮⁴潢汯戠汐湡牡㴠⠠楓剭汵獥☠䔠汆捯剫汵㩥债慬慮⥲℠‽㬰ऊ潦⁲椨瑮㈳椠㴠䌠畨歮䘮物瑳潂摩※⁩‼桃湵⹫湅䉤楯㭤⬠椫਩笉ऊ䘉潬正瑓瑡⹥潐楳楴湯孳嵩⬠‽汆捯卫慴整嘮汥捯瑩敩孳嵩⨠䐠汥慴楔敭਻उ晩⠠偢慬慮⥲ऊ笉ऊउ⼯敫灥戠楯獤漠⁮桴⁥汰湡⁥戨楯獤猠慰湷摥漠⁲睳瑩档摥映潲⁭䐳洠癯浥湥⁴牡⁥潭敶⁤湯潴椠⥴ऊउ汆捯卫慴整倮獯瑩潩獮楛⹝⁚‽楓偭慬敮效杩瑨਻उ䘉潬正瑓瑡⹥敖潬楣楴獥楛⹝⁚‽⸰昰਻उ੽उ潂摩效摡湩獧楛⁝‽汆捯卫慴整嘮汥捯瑩敩孳嵩䜮瑥慓敦潎浲污⤨਻उ晩⠠卢浩湁浩瑡䙥楬桧⥴ऊ笉ऊउ潂摩灓敥獤楛⁝‽汆捯卫慴整嘮汥捯瑩敩孳嵩匮穩⡥㬩ऊ紉ऊ੽ऊ⼯楬瑳⁳潨摬攠敶祲映潬正慭整琠慨⁴慣⁮潣敭椠瑮⁯数捲灥楴湯爠摡畩⁳湵楴⁬睴⁯潢摩⁳慨敶攠捡⁨潭敶⁤慨晬琠敨猠楫⁮潴慷摲⁳慥档漠桴牥ऊ桃湵⹫乢楥桧潢牵楌瑳即慴敬㴠映污敳਻椉⁦戨楓啭敳敎杩扨畯䱲獩獴☠…戡敒畢汩乤楥桧潢牵楌瑳⥳ऊ੻उ潣獮⁴汦慯⁴慈晬歓湩煓慵敲⁤‽䵆瑡㩨区畱牡⡥楓乭楥桧潢牵歓湩⨠〠㔮⥦਻उ潦⁲椨瑮㈳椠㴠䌠畨歮䘮物瑳潂摩※⁩‼桃湵⹫湅䉤楯⁤☦℠桃湵⹫乢楥桧潢牵楌瑳即慴敬※⬫⥩ऊ笉ऊउ桃湵⹫乢楥桧潢牵楌瑳即慴敬㴠䘠敖瑣牯㨺楄瑳煓慵敲⡤汆捯卫慴整倮獯瑩潩獮楛ⱝ丠楥桧潢牵楌瑳湁档牯孳嵩 ‾慈晬歓湩煓慵敲㭤ऊ紉ऊ੽ऊ桃湵⹫潗歲獍⬠‽汦慯⡴䘨汐瑡潦浲楔敭㨺敓潣摮⡳ ‭桃湵卫慴瑲楔敭 ‪〱〰〮㬩紊ਊ潶摩䄠汆捯䵫湡条牥㨺畂汩卤慰楴污湉敤⡸਩੻按湯瑳搠畯汢⁥湉敤卸慴瑲楔敭㴠䘠汐瑡潦浲楔敭㨺敓潣摮⡳㬩ਊ⼉爯扥極摬猠慰楴污椠摮硥甠敳⁤潦⁲数捲灥楴湯ऊ汆捯佫瑣敲⹥偢慬慮⁲‽匨浩畒敬⁳…䙅潬正畒敬㨺汐湡牡 㴡〠਻䘉潬正捏牴敥䈮極摬䘨潬正瑓瑡⹥潐楳楴湯ⱳ䈠楯䡤慥楤杮⥳਻ऊ⼯慰正映潬正慭整猠慴整爠慥⁤祢猠整牥湩੧椉⁦戨畑湡楴敺汆捯浫瑡獥਩笉ऊ䌉浯慰瑣瑓瑡⹥慐正䘨潬正瑓瑡⹥潐楳楴湯ⱳ䘠潬正瑓瑡⹥敖潬楣楴獥‬楓偭牡浡瑥牥⹳慍卸数摥㬩ऊ੽ऊ⼯敲畢汩⁤癥牥⁹楬瑳椠⁦湡⁹潢摩洠癯摥琠潯映牡映潲⁭瑩⁳湡档牯ऊ潦⁲挨湯瑳䘠汆捯卫整牥湩䍧畨歮…桃湵⁫›瑓敥楲杮桃湵獫਩笉ऊ戉敒畢汩乤楥桧潢牵楌瑳⁳㵼䌠畨歮戮敎杩扨畯䱲獩獴瑓污㭥ऊ੽椉⁦戨敒畢汩乤楥桧潢牵楌瑳⥳ऊ੻उ敎杩扨畯䱲獩䉴極摬⭳㬫ऊ੽ऊ牐灥牡䵥⁳㴫映潬瑡⠨偆慬晴牯呭浩㩥区捥湯獤⤨ⴠ䤠摮硥瑓牡呴浩⥥⨠ㄠ〰⸰⤰਻੽瘊楯⁤䙁潬正慍慮敧㩲区整牥桃湵⡫湩㍴′桃湵䥫摮硥‬汦慯⁴敄瑬呡浩⥥笊ऊ䙆潬正瑓敥楲杮桃湵♫䌠畨歮㴠匠整牥湩䍧畨歮孳桃湵䥫摮硥㭝ऊ潣獮⁴潤扵敬䌠畨歮瑓牡呴浩⁥‽偆慬晴牯呭浩㩥区捥湯獤⤨਻ऊ⼯楦摮映潬正慭整⁳湩朠湥牥污愠敲⁡潴映祬眠瑩⁨湡⁤灡汰⁹瑳敥楲杮映牯散ੳ匉整牥汆捯⡫桃湵Ⱬ䐠汥慴楔敭㬩ਊ䌉畨歮圮牯䵫⁳㴫映潬瑡⠨偆慬晴牯呭浩㩥区捥湯獤⤨ⴠ䌠畨歮瑓牡呴浩⥥⨠ㄠ〰⸰⤰਻੽瘊楯⁤䙁潬正慍慮敧㩲䌺浯汰瑥卥浩汵瑡潩⡮਩੻⼉洯牥敧爠獥汵獴爠捥牯敤⁤祢攠捡⁨档湵੫昉潬瑡圠牯䵫⁳‽牐灥牡䵥㭳ऊ潦⁲䘨汆捯卫整牥湩䍧畨歮…桃湵⁫›瑓敥楲杮桃湵獫਩笉ऊ圉牯䵫⁳㴫䌠畨歮圮牯䵫㭳ऊ䐉扥杵楌敮⹳灁数摮䌨畨歮䐮扥杵楌敮⥳਻उ晩⠠呢汥浥瑥祲慃瑰牵⥥ऊ笉ऊउ敔敬敭牴⹹摁䍤畯瑮⡳桃湵⹫敔敬敭牴⥹਻उ੽紉ਊ⼉漯瑣敲⁥瑳汩⁬慭捴敨⁳潢摩瀠獯瑩潩獮‬瑳敥楲杮漠汮⁹档湡敧⁤敶潬楣楴獥ऊ灕慤整片畯獰⤨਻ऊ慌瑳楓呭浩䵥⁳‽潗歲獍਻䰉獡却浩灓湡獍㴠映潬瑡⠨偆慬晴牯呭浩㩥区捥湯獤⤨ⴠ匠浩瑓牡呴浩⥥⨠ㄠ〰⸰⤰਻੽瘊楯⁤䙁潬正慍慮敧㩲䈺極摬瑓敥楲杮桃湵獫椨瑮㈳丠浵潂摩ⱳ椠瑮㈳䌠畨歮楓敺਩੻䌉畨歮楓敺㴠䘠慍桴㨺慍⡸桃湵卫穩ⱥㄠ㬩ऊ潣獮⁴湩㍴′畎䍭畨歮⁳‽䵆瑡㩨䴺硡䘨慍桴㨺楄楶敤湁剤畯摮灕丨浵潂摩ⱳ䌠畨歮楓敺Ⱙㄠ㬩ऊ瑓敥楲杮桃湵獫匮瑥畎⡭畎䍭畨歮⥳਻昉牯⠠湩㍴′桃湵䥫摮硥㴠〠※桃湵䥫摮硥㰠丠浵桃湵獫※⬫桃湵䥫摮硥਩笉ऊ⼉振畨歮⁳敫灥琠敨物猠牣瑡档愠汬捯瑡潩獮戠瑥敷湥映慲敭ੳउ䙆潬正瑓敥楲杮桃湵♫䌠畨歮㴠匠整牥湩䍧畨歮孳桃湵䥫摮硥㭝ऊ䌉畨歮䘮物瑳潂摩㴠䌠畨歮湉敤⁸‪桃湵卫穩㭥ऊ䌉畨歮䔮摮潂摩㴠䘠慍桴㨺楍⡮桃湵⹫楆獲䉴楯⁤‫桃湵卫穩ⱥ丠浵潂摩⥳਻उ桃湵⹫敄畢䱧湩獥刮獥瑥⤨਻उ桃湵⹫敔敬敭牴⁹‽䙆潬正敔敬敭牴䍹畯瑮⡳㬩ऊ䌉畨歮圮牯䵫⁳‽⸰昰਻紉紊ਊ潶摩䄠汆捯䵫湡条牥㨺瑓敥䙲潬正䘨汆捯卫整牥湩䍧畨歮…桃湵Ⱬ映潬瑡䐠汥慴楔敭਩੻猉楷捴⁨匨浩敂慨楶牯਩笉ऊ慣敳䔠汆捯䉫桥癡潩㩲场湡敤㩲ऊ䐉獩慰捴卨整牥湩䭧牥敮㱬䙅潬正敂慨楶牯㨺慗摮牥⠾楓剭汵獥‬桃湵Ⱬ䐠汥慴楔敭‬䵔歡䥥瑮来牥敓畱湥散甼湩㍴ⰲ䔠汆捯剫汵㩥为浵畒敬敓獴⠾⤩਻उ牢慥㭫ऊ慣敳䔠汆捯䉫桥癡潩㩲䘺敬㩥ऊ䐉獩慰捴卨整牥湩䭧牥敮㱬䙅潬正敂慨楶牯㨺汆敥⠾楓剭汵獥‬桃湵Ⱬ䐠汥慴楔敭‬䵔歡䥥瑮来牥敓畱湥散甼湩㍴ⰲ䔠汆捯剫汵㩥为浵畒敬敓獴⠾⤩਻उ牢慥㭫ऊ敤慦汵㩴ऊ䐉獩慰捴卨整牥湩䭧牥敮㱬䙅潬正敂慨楶牯㨺汆捯㹫匨浩畒敬ⱳ䌠畨歮‬敄瑬呡浩ⱥ吠慍敫湉整敧卲煥敵据㱥極瑮㈳‬䙅潬正畒敬㨺畎剭汵卥瑥㹳⤨㬩ऊ戉敲歡਻紉紊ਊ整灭慬整䔼汆捯䉫桥癡潩⁲湉敂慨楶牯‬極瑮㈳⸮‮畒敬敓獴ਾ潶摩䄠汆捯䵫湡条牥㨺楄灳瑡档瑓敥楲杮敋湲汥用湩㍴′畒敬敓ⱴ䘠汆捯卫整牥湩䍧畨歮…桃湵Ⱬ映潬瑡䐠汥慴楔敭‬䥔瑮来牥敓畱湥散甼湩㍴ⰲ删汵卥瑥⹳⸮⤾笊ऊ⼯湯⁥敫湲汥瀠牥爠汵⁥敳ⱴ椠摮硥摥戠⁹桴⁥畲敬映慬獧ऊ祴数敤⁦潶摩⠠䙁潬正慍慮敧㩲⨺卆整牥湩䭧牥敮⥬䘨汆捯卫整牥湩䍧畨歮Ⱖ映潬瑡㬩ऊ瑳瑡捩挠湯瑳䘠瑓敥楲杮敋湲汥䬠牥敮獬嵛㴠笠☠䙁潬正慍慮敧㩲刺湵瑓敥楲杮敋湲汥刼汵卥瑥ⱳ䤠䉮桥癡潩㹲⸮‮㭽ऊ琨楨⵳⨾敋湲汥孳畒敬敓⁴‥䙅潬正畒敬㨺畎剭汵卥瑥嵳⠩桃湵Ⱬ䐠汥慴楔敭㬩紊ਊ整灭慬整甼湩㍴′畒敬ⱳ䔠汆捯䉫桥癡潩⁲湉敂慨楶牯ਾ潶摩䄠汆捯䵫湡条牥㨺畒卮整牥湩䭧牥敮⡬䙆潬正瑓敥楲杮桃湵♫䌠畨歮‬汦慯⁴敄瑬呡浩⥥笊ऊ潣獮⁴潢汯戠獕䱥䑏㴠匠浩畑污瑩⹹佌䑄獩慴据⁥‾⸰昰☠…楖睥潌慣楴湯⹳畎⡭ ‾㬰ऊ潣獮⁴汦慯⁴佌䑄獩慴据卥畱牡摥㴠匠浩畑污瑩⹹佌䑄獩慴据⁥‪楓六慵楬祴䰮䑏楄瑳湡散਻ऊ⼯汦捯浫瑡⁥楬瑳⁳牡⁥敮摥摥戠⁹敳慰慲楴湯‬湡⁤祢愠楬湧敭瑮愠摮挠桯獥潩⁮湵敬獳琠敨⁹獵⁥条牧来瑡⁥数捲灥楴湯ऊ潣獮⁴潢汯戠敎摥䙳潬正慭整⁳‽刨汵獥☠䔠汆捯剫汵㩥区灥牡瑡潩⥮℠‽‰籼⠠刨汵獥☠⠠䙅潬正畒敬㨺汁杩浮湥⁴⁼䙅潬正畒敬㨺潃敨楳湯⤩℠‽‰☦℠卢浩杁牧来瑡健牥散瑰潩⥮਻按湯瑳戠潯⁬啢敳楌瑳⁳‽乢敥獤汆捯浫瑡獥☠…楓乭楥桧潢牵歓湩㸠〠〮㭦ऊ䅔牲祡椼瑮㈳☾䘠潬正慭整⁳‽桃湵⹫汆捯浫瑡獥਻䘉潬正慭整⹳敒敳⡴㬩ਊ昉牯⠠湩㍴′⁩‽桃湵⹫楆獲䉴楯㭤椠㰠䌠畨歮䔮摮潂摩※⬫⥩ऊ੻उ⼯潢摩⁳慦⁲睡祡映潲⁭癥牥⁹汰祡牥瘠敩⁷瑳敥⁲敬獳漠瑦湥ऊ椉瑮㈳匠整牥湩卧牴摩⁥‽楓六慵楬祴匮整牥湩卧牴摩㭥ऊ椉⁦戨獕䱥䑏਩उ੻उ戉潯⁬䥢䙳牡㴠琠畲㭥ऊउ潦⁲挨湯瑳䘠敖瑣牯…楖睥潌慣楴湯㨠嘠敩䱷捯瑡潩獮਩उ笉ऊउ戉獉慆⁲㴦䘠敖瑣牯㨺楄瑳煓慵敲⡤楖睥潌慣楴湯‬汆捯卫慴整倮獯瑩潩獮楛⥝㸠䰠䑏楄瑳湡散煓慵敲㭤ऊउ੽उ匉整牥湩卧牴摩⁥㴪戠獉慆⁲‿′›㬱ऊ紉ਊउ⼯瑳条敧⁲瑳楲敤⁤潢摩⁳祢栠湡汤⁥潳攠捡⁨牦浡⁥瑳敥獲愠⁮癥湥猠慨敲漠⁦桴⁥汦捯੫उ晩⠠瑓敥楲杮瑓楲敤㸠ㄠ☠…用湩㍴⠲汆捯卫慴整䠮湡汤獥楛⥝⬠匠浩汵瑡潩䙮慲敭 ‥瑓敥楲杮瑓楲敤℠‽⤰ऊ笉ऊउ⼯潢摩⁳桴瑡搠湯琧猠整牥琠楨⁳牦浡⁥瑳汩⁬敧⁴桴楥⁲慴杲瑥映牯散⁳湡⁤浩異獬獥ऊउ噆捥潴♲嘠汥捯瑩⁹‽汆捯卫慴整嘮汥捯瑩敩孳嵩਻उ嘉汥捯瑩⁹㴫吠牡敧䙴牯散孳嵩⨠䐠汥慴楔敭⬠吠牡敧䥴灭汵敳孳嵩਻उ椉⁦刨汵獥☠䔠汆捯剫汵㩥债慬慮⥲ऊउ੻उउ敖潬楣祴娮㴠〠〮㭦ऊउ੽उ嘉汥捯瑩⁹‽敖潬楣祴䜮瑥汃浡数呤卯穩⡥楓偭牡浡瑥牥⹳楍卮数摥‬楓偭牡浡瑥牥⹳慍卸数摥㬩ऊउ晩⠠卢浩湁浩瑡䙥楬桧⥴ऊउ੻उउ湁浩瑡䙥楬桧⡴Ⱪ䐠汥慴楔敭‬敄瑬呡浩⥥਻उ紉ऊउ潣瑮湩敵਻उ੽ऊ椉⁦戨敎摥䙳潬正慭整⥳ऊ笉ऊउ晩⠠啢敳楌瑳⥳ऊउ੻उउ慇桴牥楌瑳摥敎杩扨畯獲椨‬楓六敵祲慒楤獵‬汆捯浫瑡獥‬楓六慵楬祴䴮硡敎杩扨畯獲㬩ऊउ੽उ攉獬੥उ笉ऊउ䘉潬正捏牴敥䜮瑡敨乲楥桧潢牵⡳汆捯卫慴整倮獯瑩潩獮楛ⱝ匠浩畑牥剹摡畩ⱳ椠‬汆捯浫瑡獥‬楓六慵楬祴䴮硡敎杩扨畯獲㬩ऊउ੽उ椉⁦戨敔敬敭牴䍹灡畴敲਩उ笉ऊउ䌉畨歮吮汥浥瑥祲刮捥牯乤楥桧潢牵⡳汆捯浫瑡獥丮浵⤨㬩ऊउ੽उ੽उ瑓敥䉲楯㱤畒敬ⱳ䤠䉮桥癡潩㹲椨‬灓楬䙴潬正慭整⡳Ⱪ䌠畨歮Ⱙ䌠畨歮‬敄瑬呡浩ⱥ䐠汥慴楔敭⨠匠整牥湩卧牴摩⥥਻उ晩⠠卢浩湁浩瑡䙥楬桧⥴ऊ笉ऊउ湁浩瑡䙥楬桧⡴Ⱪ䐠汥慴楔敭‬敄瑬呡浩⁥‪瑓敥楲杮瑓楲敤㬩ऊ紉ਊउ⼯敲潣摲氠湩獫琠⁯汦捯浫瑡獥映牯搠扥杵瘠獩慵楬慺楴湯ऊ椉⁦匨潨汵䍤灡畴敲敄畢⡧Ⱪ䘠潬正敄畢乧楥桧潢牵⥳਩उ੻उ昉牯⠠湩㍴′汆捯浫瑡䥥摮硥㨠䘠潬正慭整⥳ऊउ੻उउ桃湵⹫敄畢䱧湩獥䄮摤笨䘠潬正瑓瑡⹥潐楳楴湯孳嵩‬汆捯卫慴整倮獯瑩潩獮䙛潬正慭整湉敤嵸‬䍆汯牯㨺祃湡素㬩ऊउ੽उ੽紉紊ਊ潶摩䄠汆捯䵫湡条牥㨺慗瑩潆卲浩汵瑡潩⡮਩੻椉⁦匨浩汵瑡潩呮獡⹫獉慖楬⡤⤩ऊ੻उ呆獡䝫慲桰湉整晲捡㩥䜺瑥⤨圮楡啴瑮汩慔歳潃灭敬整⡳楓畭慬楴湯慔歳‬久浡摥桔敲摡㩳䜺浡呥牨慥彤潌慣⥬਻उ楓畭慬楴湯慔歳㴠渠汵灬牴਻紉紊ਊ潶摩䄠汆捯䵫湡条牥㨺潊湩敂潦敲桐獹捩⡳਩੻椉⁦ℨ卢浩汵瑡潩偮湥楤杮簠⁼戡敐摮湩呧慲散⥳笠爠瑥牵㭮素ਊ⼉愯潶摩湡散琠慲散⁳敲摡琠敨瀠票楳獣猠散敮‬桴祥栠癡⁥潴戠⁥潤敮戠晥牯⁥瑩猠慴瑲⁳灵慤楴杮ऊ潣獮⁴潤扵敬䨠楯卮慴瑲楔敭㴠䘠汐瑡潦浲楔敭㨺敓潣摮⡳㬩ऊ慗瑩潆卲浩汵瑡潩⡮㬩ऊ桐獹捩䩳楯坮楡䵴⁳‽汦慯⡴䘨汐瑡潦浲楔敭㨺敓潣摮⡳ ‭潊湩瑓牡呴浩⥥⨠ㄠ〰⸰⤰਻੽瘊楯⁤䙁潬正慍慮敧㩲䘺湩獩卨浩汵瑡潩⡮਩੻椉⁦ℨ卢浩汵瑡潩偮湥楤杮 ⁻敲畴湲※੽ऊ⼯潪湩猠浩汵瑡潩Ɱ洠慥畳楲杮栠睯氠湯⁧桴⁥慧敭琠牨慥⁤獩戠潬正摥愠摮栠睯洠捵⁨景琠敨猠浩汵瑡潩⁮慲⁮污湯獧摩⁥瑯敨⁲潷歲ऊ潣獮⁴潤扵敬䨠楯卮慴瑲楔敭㴠䘠汐瑡潦浲楔敭㨺敓潣摮⡳㬩ऊ慗瑩潆卲浩汵瑡潩⡮㬩ऊ卢浩汵瑡潩偮湥楤杮㴠映污敳਻按湯瑳映潬瑡䘠慲敭潊湩慗瑩獍㴠戠敐摮湩䅧祳据㼠映潬瑡⠨偆慬晴牯呭浩㩥区捥湯獤⤨ⴠ䨠楯卮慴瑲楔敭 ‪〱〰〮 ‫桐獹捩䩳楯坮楡䵴⁳›慌瑳楓卭慰䵮㭳ऊ桐獹捩䩳楯坮楡䵴⁳‽⸰昰਻ऊ⼯敤慴档戠楯獤搠獥慰湷摥眠楨敬琠敨猠浩汵瑡潩⁮慲Ɱ琠敨物猠慴整椠⁳敲潭敶⁤晡整⁲桴⁥潣浭瑩ऊ潦⁲椨瑮㈳䠠湡汤⁥›敐摮湩剧浥癯污⥳ऊ੻उ潣獮⁴湩㍴′湉敤⁸‽汆捯卫慴整䜮瑥湉敤⡸慈摮敬㬩ऊ椉⁦䤨摮硥℠‽义䕄彘低䕎਩उ੻उ䘉潬正瑓瑡⹥潂摩孳湉敤嵸㴠渠汵灬牴਻उ੽紉ऊ潊湩慗瑩獍㴠䘠慍桴㨺敌灲䨨楯坮楡䵴ⱳ䘠慲敭潊湩慗瑩獍‬⸰昱㬩ऊ楓佭敶汲灡獍㴠䘠慍桴㨺敌灲匨浩癏牥慬䵰ⱳ䘠慍桴㨺慍⡸慌瑳楓卭慰䵮⁳‭牆浡䩥楯坮楡䵴ⱳ〠〮⥦‬⸰昱㬩ਊ按湯瑳映潬瑡䐠汥慴楔敭㴠倠湥楤杮敄瑬呡浩㭥ਊ⼉洯癯⁥潢摩愠瑣牯⁳潴琠敨物渠睥琠慲獮潦浲ੳ按湯瑳搠畯汢⁥潃浭瑩瑓牡呴浩⁥‽偆慬晴牯呭浩㩥区捥湯獤⤨਻䌉浯業䉴楯呤慲獮潦浲⡳敄瑬呡浩⥥਻椉⁦戨獉效摡敬獳਩笉ऊ䄉灰祬效摡敬獳潖畬敭⡳㬩ऊ੽倉扵楬桳汆捯噫敩⡷㬩ऊ灕慤整潇敶湲牯䰨獡却浩楔敭獍⬠映潬瑡⠨偆慬晴牯呭浩㩥区捥湯獤⤨ⴠ䌠浯業却慴瑲楔敭 ‪〱〰〮⤩਻ऊ⼯牤睡搠扥杵瘠獩慵楬慺楴湯漠⁦慳灭敬⁤潢摩ੳ䐉慲䙷潬正敄畢⡧㬩ਊ⼉爯捥牯⁤汦捯⁫潴潰潬祧愠摮琠浩湩獧ऊ灕慤整敔敬敭牴⡹敄瑬呡浩⥥਻ऊ⼯潬⁧楳畭慬楴湯琠浩湩獧ऊ楓畭慬楴湯瑓瑡味浩⁥㴫䐠汥慴楔敭਻椉⁦匨浩汵瑡潩卮慴獴楔敭㸠‽⸵昰਩笉ऊ椉⁦戨潌卧浩汵瑡潩卮慴獴਩उ੻उ唉彅佌⡇潌呧浥Ɒ䰠杯‬䕔员∨汆捯⁫楳畭慬楴湯⠠猥㨩┠㈮⁦獭猠浩汵瑡潩Ɱ┠㈮⁦獭漠敶汲灡数Ɽ┠㈮⁦獭樠楯⁮慷瑩映牯┠⁤潢摩⁳┨⁤楨摤湥 湩䘠潬正慍慮敧㩲┠⹳⤢ਬउउ䅢祳据楓畭慬楴湯㼠⠠啢敳桓牡摥捓敨畤敬⁲‿䕔员∨桳牡摥猠档摥汵牥⤢㨠吠塅⡔愢祳据⤢ ›䕔员∨慧敭琠牨慥≤Ⱙ匠浩楔敭獍‬楓佭敶汲灡獍‬潊湩慗瑩獍‬汆捯卫慴整丮浵⤨‬畎䡭摩敤䉮楯獤‬䜪瑥慎敭⤨㬩ऊउ晩⠠敎杩扨畯䱲獩䙴慲敭⁳‾⤰ऊउ੻उउ䕕䱟䝏䰨杯敔灭‬潌Ⱨ吠塅⡔丢楥桧潢牵氠獩獴爠扥極瑬┠⁤楴敭⁳湩┠⁤牦浡獥⠠⸥昰┥爠略敳⥤椠⁮汆捯䵫湡条牥›猥∮Ⱙऊउउ敎杩扨畯䱲獩䉴極摬ⱳ丠楥桧潢牵楌瑳牆浡獥‬〱⸰昰⨠⠠敎杩扨畯䱲獩䙴慲敭⁳‭敎杩扨畯䱲獩䉴極摬⥳⼠丠楥桧潢牵楌瑳牆浡獥‬䜪瑥慎敭⤨㬩ऊउ੽उ੽उ敎杩扨畯䱲獩䙴慲敭⁳‽㬰ऊ三楥桧潢牵楌瑳畂汩獤㴠〠਻उ楓畭慬楴湯瑓瑡味浩⁥‽⸰昰਻紉ਊ⼉猯湥⁤汦捯⁫潴挠楬湥獴ऊ晩⠠剢灥楬慣整汆捯⁫☦⠠敇乴瑥潍敤⤨㴠‽䵎䱟獩整卮牥敶⁲籼䜠瑥敎䵴摯⡥ 㴽丠彍敄楤慣整卤牥敶⥲਩笉ऊ匉慮獰潨䅴捣浵汵瑡牯⬠‽敄瑬呡浩㭥ऊ椉⁦匨慮獰潨䅴捣浵汵瑡牯㸠‽⸱昰⼠匠慮獰潨剴瑡⥥ऊ笉ऊउ湓灡桳瑯捁畣畭慬潴⁲‽䵆瑡㩨䘺潭⡤湓灡桳瑯捁畣畭慬潴Ⱳㄠ〮⁦ 湓灡桳瑯慒整㬩ऊउ敓摮汆捯卫慮獰潨⡴㬩ऊ紉ਊउ⼯敭獡牵⁥慢摮楷瑤⁨獵摥戠⁹湳灡桳瑯ੳउ敒汰捩瑡潩卮慴獴楔敭⬠‽敄瑬呡浩㭥ऊ椉⁦刨灥楬慣楴湯瑓瑡味浩⁥㴾㔠〮⥦ऊ笉ऊउ敒汰捩瑡潩䉮瑹獥敐卲捥湯⁤‽敒汰捩瑡潩䉮瑹獥⼠删灥楬慣楴湯瑓瑡味浩⁥ 䵆瑡㩨䴺硡䘨潬正敒慬獹丮浵⤨‬⤱਻उ椉⁦戨潌剧灥楬慣楴湯瑓瑡⥳ऊउ੻उउ汦慯⁴楋潬祢整偳牥桔畯慳摮潂摩⁳‽汆捯卫慴整丮浵⤨㸠〠㼠⠠敒汰捩瑡潩䉮瑹獥敐卲捥湯⁤ 〱㐲〮⥦⨠⠠〱〰〮⁦ 汆捯卫慴整丮浵⤨ ›⸰昰਻उउ䕕䱟䝏䰨杯敔灭‬潌Ⱨ吠塅⡔䘢潬正爠灥楬慣楴湯›⸥昱䬠⽂⁳数⁲汣敩瑮映牯┠⁤潢摩⁳┨ㄮ⁦䉋猯瀠牥ㄠ⁫潢摩⥳椠⁮汆捯䵫湡条牥›猥∮Ⱙ删灥楬慣楴湯祂整偳牥敓潣摮⼠ㄠ㈰⸴昰‬汆捯卫慴整丮浵⤨‬楋潬祢整偳牥桔畯慳摮潂摩ⱳ⨠敇乴浡⡥⤩਻उ紉ऊउ敒汰捩瑡潩䉮瑹獥㴠〠਻उ刉灥楬慣楴湯瑓瑡味浩⁥‽⸰昰਻उ੽紉紊ਊ整灭慬整甼湩㍴′畒敬ⱳ䔠汆捯䉫桥癡潩⁲湉敂慨楶牯ਾ潶摩䄠汆捯䵫湡条牥㨺瑓敥䉲楯⡤湩㍴′潂摩湉敤ⱸ挠湯瑳䘠汆捯浫瑡剥湩獧…汆捯浫瑡獥‬䙆潬正瑓敥楲杮桃湵♫䌠畨歮‬汦慯⁴敄瑬呡浩ⱥ映潬瑡匠整牥湩䑧汥慴楔敭਩੻按湯瑳戠潯⁬啢敳但⁖‽刨汵獥☠䔠汆捯剫汵㩥䘺敩摬晏楖睥 㴡〠਻䘉敖瑣牯䄠捣汥牥瑡潩⁮‽噆捥潴㩲娺牥噯捥潴㭲ਊ⼉愯灰祬猠整牥湩⁧潦捲獥琠⁯潢摩愠捣汥牥瑡潩੮椉⁦刨汵獥☠䔠汆捯剫汵㩥区灥牡瑡潩⥮ऊ੻उ捁散敬慲楴湯⬠‽敓慰慲整戼獕䙥噏⠾潂摩湉敤ⱸ䘠潬正慭整⹳敓慰慲楴湯㬩ऊ੽椉⁦刨汵獥☠⠠䙅潬正畒敬㨺汁杩浮湥⁴⁼䙅潬正畒敬㨺潃敨楳湯⤩ऊ੻उ晩⠠卢浩杁牧来瑡健牥散瑰潩⥮ऊ笉ऊउ⼯獵⁥汦捯⁫捯牴敥映牯氠牡敧爠摡畩⁳污杩浮湥⁴湡⁤潣敨楳湯‬敳慰慲楴湯猠慴獹攠慸瑣眠瑩⁨潬慣⁬汦捯浫瑡獥ऊउ䙆潬正杁牧来瑡⁥杁牧来瑡⁥‽汆捯佫瑣敲⹥畑牥䅹杧敲慧整䘨潬正瑓瑡⹥潐楳楴湯孳潂摩湉敤嵸‬潂摩效摡湩獧䉛楯䥤摮硥ⱝ匠浩杁牧来瑡健牥散瑰潩剮摡畩ⱳ匠浩慐慲敭整獲䌮桯獥潩䙮噏‬楓偭牡浡瑥牥⹳汁杩浮湥䙴噏‬楓佭数楮杮湁汧ⱥ䈠楯䥤摮硥㬩ऊउ晩⠠畒敬⁳…䙅潬正畒敬㨺汁杩浮湥⥴ऊउ੻उउ捁散敬慲楴湯⬠‽汁杩⡮潂摩湉敤ⱸ䄠杧敲慧整㬩ऊउ੽उ椉⁦刨汵獥☠䔠汆捯剫汵㩥䌺桯獥潩⥮ऊउ੻उउ捁散敬慲楴湯⬠‽片畯啰⡰潂摩湉敤ⱸ䄠杧敲慧整㬩ऊउ੽उ੽उ汥敳ऊ笉ऊउ晩⠠畒敬⁳…䙅潬正畒敬㨺汁杩浮湥⥴ऊउ੻उउ捁散敬慲楴湯⬠‽汁杩㱮啢敳但㹖䈨楯䥤摮硥‬汆捯浫瑡獥䄮楬湧敭瑮㬩ऊउ੽उ椉⁦刨汵獥☠䔠汆捯剫汵㩥䌺桯獥潩⥮ऊउ੻उउ捁散敬慲楴湯⬠‽片畯啰㱰啢敳但㹖䈨楯䥤摮硥‬汆捯浫瑡獥䌮桯獥潩⥮਻उ紉ऊ紉ऊ੽ऊ⼯灡汰⁹敢慨楶牯猠整牥湩੧椉⁦䤨䉮桥癡潩⁲㴽䔠汆捯䉫桥癡潩㩲场湡敤⥲ऊ੻उ捁散敬慲楴湯⬠‽慗摮牥䈨楯䥤摮硥㬩ऊ੽攉獬⁥晩⠠湉敂慨楶牯㴠‽䙅潬正敂慨楶牯㨺汆敥਩笉ऊ䄉捣汥牥瑡潩⁮㴫䘠敬⡥潂摩湉敤⥸਻紉ਊ⼉猯整牥愠潬杮琠敨戠歡摥爠畯整琠⁯桴⁥汦睯映敩摬朠慯੬椉⁦匨浩汆睯楆汥卤牴湥瑧⁨㴡〠〮⥦ऊ੻उ捁散敬慲楴湯⬠‽潆汬睯汆睯楆汥⡤潂摩湉敤ⱸ䌠畨歮㬩ऊ੽ऊ⼯佔佄›摡⁤潬楧⁣潴搠獩敲慧摲漠桴牥猠整牥湩⁧潦捲獥椠⁦潣汬獩潩⁮獩映畯摮‮牐潩楲楴敺愠潶摩湡散愠摮爠摥捵⁥档湡散琠敨⁹瑳敥⁲湩潴漠獢慴汣⁥畤⁥潴猠慷浲映牯散⹳ऊ⼯档捥⁫晩栠慥楤杮映牯挠汯楬楳湯ऊ晩⠠刨汵獥☠䔠汆捯剫汵㩥䄺潶摩湡散 ☦䤠佳獢慴汣䅥敨摡䈨楯䥤摮硥‬桃湵⥫਩笉ऊ⼉愯灰祬漠獢慴汣⁥癡楯慤据⁥潦捲੥उ捁散敬慲楴湯⬠‽癁楯佤獢慴汣⡥潂摩湉敤ⱸ䌠畨歮㬩ऊ椉⁦戨敔敬敭牴䍹灡畴敲਩उ੻उ䌉畨歮吮汥浥瑥祲刮捥牯䅤潶摩湡散睓敥⡰㬩ऊ紉ऊ੽ऊ⼯灵慤整瘠汥捯瑩੹䘉敖瑣牯…敖潬楣祴㴠䘠潬正瑓瑡⹥敖潬楣楴獥䉛楯䥤摮硥㭝ऊ敖潬楣祴⬠‽䄨捣汥牥瑡潩⁮‪瑓敥楲杮敄瑬呡浩⥥਻ऊ⼯灡汰⁹慴杲瑥映牯散⁳湡⁤浩異獬獥⠠慴杲瑥映牯散⁳牡⁥摡敤⁤癥牥⁹牦浡⁥潳琠敨⁹湯祬渠敥⁤桴獩映慲敭猧琠浩⁥瑳灥਩嘉汥捯瑩⁹㴫吠牡敧䙴牯散孳潂摩湉敤嵸⨠䐠汥慴楔敭⬠吠牡敧䥴灭汵敳孳潂摩湉敤嵸਻ऊ⼯汰湡牡戠楯獤漠汮⁹瑳敥⁲湩㈠ⱄ搠潲⁰敶瑲捩污映牯散⁳椨攮‮慷摮牥‬慴杲瑥漠橢捥獴愠潢敶漠⁲敢潬⁷桴⁥汰湡⥥ऊ晩⠠畒敬⁳…䙅潬正畒敬㨺汐湡牡਩笉ऊ嘉汥捯瑩⹹⁚‽⸰昰਻紉ਊ嘉汥捯瑩⁹‽敖潬楣祴䜮瑥汃浡数呤卯穩⡥楓偭牡浡瑥牥⹳楍卮数摥‬楓偭牡浡瑥牥⹳慍卸数摥㬩紊ਊ潶摩䄠汆捯䵫湡条牥㨺潃浭瑩潂摩牔湡晳牯獭昨潬瑡䐠汥慴楔敭਩੻戉獉潃浭瑩楴杮牔湡晳牯獭㴠琠畲㭥ਊ按湯瑳椠瑮㈳丠浵潂摩⁳‽汆捯卫慴整丮浵⤨਻三浵楈摤湥潂摩⁳‽㬰ऊ潦⁲椨瑮㈳椠㴠〠※⁩‼畎䉭楯獤※⬫⥩ऊ੻उ䉁楯⩤䈠楯⁤‽汆捯卫慴整䈮楯獤楛㭝ऊ椉⁦䈨楯⁤㴽渠汵灬牴 ⁻潣瑮湩敵※੽ऊ⼉甯摰瑡⁥潰楳楴湯愠摮爠瑯瑡潩⁮挨湡琠楲杧牥漠敶汲灡攠敶瑮⁳桴瑡琠汥灥牯⁴牯搠獥慰湷琠敨戠楯⥤ऊ䘉潒慴潴⁲潂摩潒慴楴湯㴠䘠潬正瑓瑡⹥敖潬楣楴獥楛⹝潔牏敩瑮瑡潩剮瑯瑡牯⤨਻उ潂摩㸭敓䅴瑣牯潌慣楴湯湁剤瑯瑡潩⡮汆捯卫慴整倮獯瑩潩獮楛ⱝ䈠楯剤瑯瑡潩⥮਻उ晩⠠汆捯卫慴整䈮楯獤楛⁝㴽渠汵灬牴 ⁻潣瑮湩敵※੽ऊ⼉猯楫⁰潣浳瑥捩甠摰瑡獥漠⁦潢摩⁳潮潢祤栠獡猠敥⁮敲散瑮祬‬桴楥⁲敭桳映汯潬獷琠敨愠瑣牯猧爠瑯瑡潩⁮湵楴⁬桴祥爧⁥楶楳汢⁥条楡੮उ晩⠠卢楫䡰摩敤䍮獯敭楴獣☠…䈡楯ⵤ圾獡敍桳敒散瑮祬敒摮牥摥嘨獩扩汩瑩呹汯牥湡散⤩ऊ笉ऊउ⼯敫灥猠潭瑯楨杮猠慴整愠⁴桴⁥畣牲湥⁴敨摡湩⁧潳琠敨戠楯⁤獩甠⁰潴搠瑡⁥湯琠敨映慲敭椠⁴敢潣敭⁳楶楳汢੥उ䘉潬正瑓瑡⹥敍桳潒慴楴湯孳嵩㴠䈠楯剤瑯瑡潩㭮ऊउ畎䡭摩敤䉮楯獤⬫਻उ按湯楴畮㭥ऊ紉ਊउ⼯潲慴整洠獥⁨潴慷摲挠牵敲瑮戠楯⁤敨摡湩⁧浳潯桴祬ऊ䘉潒慴潴⁲敍桳潒慴楴湯㴠䘠慍桴㨺䥒瑮牥呰⡯汆捯卫慴整䴮獥剨瑯瑡潩獮楛ⱝ䈠楯剤瑯瑡潩Ɱ䐠汥慴楔敭‬⸷昰㬩ऊ䘉潬正瑓瑡⹥敍桳潒慴楴湯孳嵩㴠䴠獥剨瑯瑡潩㭮ऊ䈉楯ⵤ唾摰瑡䵥獥剨瑯瑡潩⡮敍桳潒慴楴湯㬩ਊउ⼯慨摮眠湩⁧敢瑡愠摮戠湡⁫潴琠敨洠獥❨⁳慭整楲污ऊ椉⁦戨楓䅭楮慭整汆杩瑨਩उ੻उ按湯瑳映潬瑡䘠慬剰瑡⁥‽䵆瑡㩨䰺牥⡰楓䵭湩汆灡慒整‬楓䵭硡汆灡慒整‬汆捯卫慴整䘮慬䕰晦牯獴楛⥝਻उ䈉楯ⵤ唾摰瑡䙥楬桧䅴楮慭楴湯䘨楬桧䑴瑡䥡摮硥‬汆捯卫慴整䘮慬偰慨敳孳嵩‬汆灡慒整‬汆捯卫慴整䘮慬䕰晦牯獴楛ⱝ䘠潬正瑓瑡⹥慂歮湁汧獥楛ⱝ䜠瑥潗汲⡤⴩䜾瑥楔敭敓潣摮⡳Ⱙ䘠楬桧䑴瑡呡汯牥湡散㬩ऊ紉ऊ੽ऊ䥢䍳浯業瑴湩呧慲獮潦浲⁳‽慦獬㭥ਊ⼉爯浥癯⁥潢摩⁳桴瑡眠牥⁥敤灳睡敮⁤畤楲杮挠浯業ੴ昉牯⠠湩㍴′慈摮敬㨠倠湥楤杮敒潭慶獬਩笉ऊ䘉潬正瑓瑡⹥敒潭敶䠨湡汤⥥਻紉ऊ敐摮湩剧浥癯污⹳敒敳⡴㬩紊ਊ整灭慬整戼潯⁬啢敳但㹖䘊敖瑣牯䄠汆捯䵫湡条牥㨺敓慰慲整椨瑮㈳䈠楯䥤摮硥‬䅔牲祡楖睥挼湯瑳椠瑮㈳‾汆捯浫瑡獥਩੻䘉敖瑣牯匠整牥湩⁧‽噆捥潴㩲娺牥噯捥潴㭲ऊ湩㍴′汆捯䍫畯瑮㴠〠਻䘉敖瑣牯匠灥牡瑡潩䑮物捥楴湯㴠䘠敖瑣牯㨺敚潲敖瑣牯਻昉潬瑡匠灥牡瑡潩䑮獩慴据⁥‽⸰昰਻昉潬瑡倠潲楸業祴慆瑣牯㴠〠〮㭦ऊ潣獮⁴噆捥潴♲䰠捯瑡潩⁮‽汆捯卫慴整倮獯瑩潩獮䉛楯䥤摮硥㭝ऊ潣獮⁴噆捥潴♲䘠牯慷摲㴠䈠楯䡤慥楤杮孳潂摩湉敤嵸਻ऊ⼯敧⁴敳慰慲楴湯猠整牥湩⁧潦捲⁥潦⁲慥档漠⁦桴⁥潢摩猧映潬正慭整ੳ昉牯⠠湩㍴′汆捯浫瑡䥥摮硥㨠䘠潬正慭整⥳ऊ੻उ潣獮⁴噆捥潴⁲汆捯浫瑡䱥捯瑡潩⁮‽敇䙴潬正慭整潐楳楴湯䘨潬正慭整湉敤⥸਻ऊ⼉振敨正椠⁦汦捯浫瑡⁥獩漠瑵楳敤瀠牥散瑰潩⁮潦੶उ晩⠠啢敳但⁖☦䘠敖瑣牯㨺潄側潲畤瑣䘨牯慷摲‬䘨潬正慭整潌慣楴湯ⴠ䰠捯瑡潩⥮䜮瑥慓敦潎浲污⤨ 㴼匠浩慐慲敭整獲匮灥牡瑡潩䙮噏਩उ੻उ按湯楴畮㭥⼉是潬正慭整椠⁳畯獴摩⁥数捲灥楴湯愠杮敬‬楤牳来牡⁤瑩愠摮挠湯楴畮⁥桴⁥潬灯ऊ紉ਊउ⼯敧⁴楤瑳湡散愠摮渠牯慭楬敺⁤楤敲瑣潩⁮睡祡映潲⁭敮牡祢戠楯੤उ敓慰慲楴湯楄敲瑣潩⁮‽潌慣楴湯ⴠ䘠潬正慭整潌慣楴湯਻उ敓慰慲楴湯楄瑳湡散㴠匠灥牡瑡潩䑮物捥楴湯匮穩⡥㬩ऊ匉灥牡瑡潩䑮物捥楴湯㴠匠灥牡瑡潩䑮物捥楴湯䜮瑥慓敦潎浲污⤨਻ऊ⼉振敨正椠⁦汦捯浫瑡❥⁳散瑮牥漠⁦慭獳椠⁳畯獴摩⁥敳慰慲楴湯爠摡畩⁳椨攮‮潣汬摩湩⁧畢⁴潮⁴楷桴湩爠摡畩⥳ऊ椉⁦匨灥牡瑡潩䑮獩慴据⁥㴾匠浩敓慰慲楴湯慒楤獵਩उ੻उ按湯楴畮㭥⼉是潬正慭整椠⁳畯獴摩⁥景猠灥牡瑡潩⁮慲楤獵‬楤牳来牡⁤湡⁤潣瑮湩敵氠潯ੰउ੽ऊ⼉术瑥猠慣楬杮映捡潴⁲慢敳⁤景⁦瑯敨⁲潢摩猧瀠潲楸業祴‮‰‽敶祲映牡愠慷⁹渨⁯敳慰慲楴湯映牯散 …‱‽敶祲挠潬敳⠠畦汬猠灥牡瑡潩⁮潦捲⥥ऊ倉潲楸業祴慆瑣牯㴠ㄠ〮⁦‭匨灥牡瑡潩䑮獩慴据⁥ 楓卭灥牡瑡潩剮摡畩⥳਻ऊ⼉愯摤猠整牥湩⁧潦捲⁥景映潬正慭整愠摮椠据敲獡⁥汦捯⁫潣湵ੴउ瑓敥楲杮⬠‽倨潲楸業祴慆瑣牯⨠匠灥牡瑡潩䑮物捥楴湯㬩ऊ䘉潬正潃湵⭴㬫ऊ੽ऊ晩⠠汆捯䍫畯瑮㸠〠਩笉ऊ⼉术瑥映潬正愠敶慲敧猠灥牡瑡潩⁮瑳敥楲杮映牯散‬灡汰⁹敳慰慲楴湯猠整牥湩⁧瑳敲杮桴映捡潴⁲湡⁤敲畴湲映牯散ऊ匉整牥湩⁧㴯䘠潬正潃湵㭴ऊ匉整牥湩⁧㴪匠浩慐慲敭整獲匮灥牡瑡潩卮牴湥瑧㭨ऊ爉瑥牵⁮瑓敥楲杮਻紉ऊ汥敳ऊ੻उ敲畴湲䘠敖瑣牯㨺敚潲敖瑣牯਻紉紊ਊ整灭慬整戼潯⁬啢敳但㹖䘊敖瑣牯䄠汆捯䵫湡条牥㨺汁杩⡮湩㍴′潂摩湉敤ⱸ吠牁慲噹敩㱷潣獮⁴湩㍴㸲䘠潬正慭整⥳笊ऊ噆捥潴⁲瑓敥楲杮㴠䘠敖瑣牯㨺敚潲敖瑣牯਻椉瑮㈳䘠潬正潃湵⁴‽㬰ऊ潣獮⁴噆捥潴♲䰠捯瑡潩⁮‽汆捯卫慴整倮獯瑩潩獮䉛楯䥤摮硥㭝ऊ潣獮⁴噆捥潴♲䘠牯慷摲㴠䈠楯䡤慥楤杮孳潂摩湉敤嵸਻ऊ⼯敧⁴污杩浮湥⁴瑳敥楲杮映牯散映牯攠捡⁨景琠敨戠楯❤⁳汦捯浫瑡獥ऊ潦⁲椨瑮㈳䘠潬正慭整湉敤⁸›汆捯浫瑡獥਩笉ऊ⼉振敨正椠⁦汦捯浫瑡⁥獩漠瑵楳敤愠楬湧敭瑮瀠牥散瑰潩⁮潦੶उ晩⠠啢敳但⁖☦䘠敖瑣牯㨺潄側潲畤瑣䘨牯慷摲‬䜨瑥汆捯浫瑡健獯瑩潩⡮汆捯浫瑡䥥摮硥 ‭潌慣楴湯⸩敇却晡乥牯慭⡬⤩㰠‽楓偭牡浡瑥牥⹳汁杩浮湥䙴噏਩उ੻उ按湯楴畮㭥⼉是潬正慭整椠⁳畯獴摩⁥楶睥湩⁧湡汧ⱥ搠獩敲慧摲椠⁴湡⁤潣瑮湩敵琠敨氠潯ੰउ੽ऊ⼉愯摤映潬正慭整猧愠楬湧敭瑮映牯散ऊ匉整牥湩⁧㴫䜠瑥汆捯浫瑡䡥慥楤杮䘨潬正慭整湉敤⥸਻उ汆捯䍫畯瑮⬫਻紉ਊ椉⁦䘨潬正潃湵⁴‾⤰ऊ੻उ⼯敧⁴污杩浮湥⁴潦捲⁥潴愠敶慲敧映潬正搠物捥楴湯ऊ匉整牥湩⁧㴯䘠潬正潃湵㭴ऊ匉整牥湩⁧㴪匠浩慐慲敭整獲䄮楬湧敭瑮瑓敲杮桴਻उ敲畴湲匠整牥湩㭧ऊ੽攉獬੥笉ऊ爉瑥牵⁮噆捥潴㩲娺牥噯捥潴㭲ऊ੽੽琊浥汰瑡㱥潢汯戠獕䙥噏ਾ噆捥潴⁲䙁潬正慍慮敧㩲䜺潲灵灕椨瑮㈳䈠楯䥤摮硥‬䅔牲祡楖睥挼湯瑳椠瑮㈳‾汆捯浫瑡獥਩੻䘉敖瑣牯匠整牥湩⁧‽噆捥潴㩲娺牥噯捥潴㭲ऊ湩㍴′汆捯䍫畯瑮㴠〠਻䘉敖瑣牯䄠敶慲敧潐楳楴湯㴠䘠敖瑣牯㨺敚潲敖瑣牯਻按湯瑳䘠敖瑣牯…潌慣楴湯㴠䘠潬正瑓瑡⹥潐楳楴湯孳潂摩湉敤嵸਻按湯瑳䘠敖瑣牯…潆睲牡⁤‽潂摩效摡湩獧䉛楯䥤摮硥㭝ਊ⼉术瑥猠浵漠⁦汦捯浫瑡⁥潰楳楴湯ੳ昉牯⠠湩㍴′汆捯浫瑡䥥摮硥㨠䘠潬正慭整⥳ऊ੻उ潣獮⁴噆捥潴⁲汆捯浫瑡䱥捯瑡潩⁮‽敇䙴潬正慭整潐楳楴湯䘨潬正慭整湉敤⥸਻ऊ⼉振敨正椠⁦汦捯浫瑡⁥獩漠瑵楳敤挠桯獥潩⁮数捲灥楴湯愠杮敬ऊ椉⁦戨獕䙥噏☠…噆捥潴㩲䐺瑯牐摯捵⡴潆睲牡Ɽ⠠汆捯浫瑡䱥捯瑡潩⁮‭潌慣楴湯⸩敇却晡乥牯慭⡬⤩㰠‽楓偭牡浡瑥牥⹳潃敨楳湯但⥖ऊ笉ऊउ潣瑮湩敵ऻ⼯汦捯浫瑡⁥獩漠瑵楳敤瘠敩楷杮愠杮敬‬楤牳来牡⁤桴獩映潬正慭整愠摮挠湯楴畮⁥桴⁥潬灯ऊ紉ਊउ⼯敧⁴潣敨楳敶映牯散琠⁯牧畯⁰楷桴映潬正慭整ऊ䄉敶慲敧潐楳楴湯⬠‽汆捯浫瑡䱥捯瑡潩㭮ऊ䘉潬正潃湵⭴㬫ऊ੽ऊ晩⠠汆捯䍫畯瑮㸠〠਩笉ऊ⼉愯敶慲敧挠桯獥潩⁮潦捲⁥景映潬正ऊ䄉敶慲敧潐楳楴湯⼠‽汆捯䍫畯瑮਻उ瑓敥楲杮㴠䄠敶慲敧潐楳楴湯ⴠ䰠捯瑡潩㭮ऊ匉整牥湩⁧㴪匠浩慐慲敭整獲䌮桯獥潩卮牴湥瑧㭨ऊ爉瑥牵⁮瑓敥楲杮਻紉ऊ汥敳ऊ੻उ敲畴湲䘠敖瑣牯㨺敚潲敖瑣牯਻紉紊ਊ噆捥潴⁲䙁潬正慍慮敧㩲䄺楬湧椨瑮㈳䈠楯䥤摮硥‬潣獮⁴䙆潬正杁牧来瑡♥䄠杧敲慧整਩੻椉⁦䄨杧敲慧整䄮楬湧敭瑮潃湵⁴‾⤰ऊ੻उ⼯敧⁴污杩浮湥⁴潦捲⁥潴愠敶慲敧映潬正搠物捥楴湯ऊ䘉敖瑣牯匠整牥湩⁧‽杁牧来瑡⹥效摡湩卧浵⼠䄠杧敲慧整䄮楬湧敭瑮潃湵㭴ऊ匉整牥湩⁧㴪匠浩慐慲敭整獲䄮楬湧敭瑮瑓敲杮桴਻उ敲畴湲匠整牥湩㭧ऊ੽攉獬੥笉ऊ爉瑥牵⁮噆捥潴㩲娺牥噯捥潴㭲ऊ੽੽䘊敖瑣牯䄠汆捯䵫湡条牥㨺片畯啰⡰湩㍴′潂摩湉敤ⱸ挠湯瑳䘠汆捯䅫杧敲慧整…杁牧来瑡⥥笊ऊ晩⠠杁牧来瑡⹥潃敨楳湯潃湵⁴‾⤰ऊ੻उ⼯癡牥条⁥潣敨楳湯映牯散漠⁦汦捯੫उ噆捥潴⁲癁牥条健獯瑩潩⁮‽杁牧来瑡⹥潐楳楴湯畓⁭ 杁牧来瑡⹥潃敨楳湯潃湵㭴ऊ䘉敖瑣牯匠整牥湩⁧‽癁牥条健獯瑩潩⁮‭汆捯卫慴整倮獯瑩潩獮䉛楯䥤摮硥㭝ऊ匉整牥湩⁧㴪匠浩慐慲敭整獲䌮桯獥潩卮牴湥瑧㭨ऊ爉瑥牵⁮瑓敥楲杮਻紉ऊ汥敳ऊ੻उ敲畴湲䘠敖瑣牯㨺敚潲敖瑣牯਻紉紊ਊ潢汯䄠汆捯䵫湡条牥㨺獉扏瑳捡敬桁慥⡤湩㍴′潂摩湉敤ⱸ䘠汆捯卫整牥湩䍧畨歮…桃湵⥫笊ऊ晩⠠楓䅭潶摩湡散敓獮牯⹳畎⡭ ‾⤰ऊ੻उ⼯档捥⁫潦睲牡⁤敳獮牯映牯挠汯楬楳湯⠠潦睲牡⁤敳獮牯愠睬祡⁳潰湩獴愠潬杮琠敨戠楯❤⁳敨摡湩⥧ऊ按湯瑳䘠敖瑣牯…潌慣楴湯㴠䘠潬正瑓瑡⹥潐楳楴湯孳潂摩湉敤嵸਻उ噆捥潴⁲敓獮牯湅⁤‽潌慣楴湯⬠䈠楯䡤慥楤杮孳潂摩湉敤嵸⨠匠浩敓獮牯慒楤獵਻उ⼯敳⁴潣汬獩潩⁮牰灯牥楴獥愠摮瀠牡浡瑥牥⁳潦⁲潣汬獩潩⁮牴捡੥उ䍆汯楬楳湯畑牥偹牡浡⁳牔捡健牡浡瑥牥㭳ऊ䘉楈剴獥汵⁴楈㭴ऊ⼉爯湵氠湩⁥牴捡⁥潦⁲潣汬獩潩⁮档捥⁫湯映牯慷摲猠湥潳ੲउ敇坴牯摬⤨㸭楌敮牔捡卥湩汧䉥䍹慨湮汥䠨瑩‬潌慣楴湯‬敓獮牯湅Ɽ䌠䱏䥌䥓乏䅟佖䑉乁䕃‬牔捡健牡浡瑥牥⥳਻उ晩⠠呢汥浥瑥祲慃瑰牵⥥ऊ笉ऊउ桃湵⹫敔敬敭牴⹹敒潣摲牔捡獥ㄨ㬩ऊ紉ਊउ⼯敲潣摲挠汯楬楳湯瀠潲敢猠慴畴⁳潦⁲敤畢⁧楶畳污穩瑡潩੮उ晩⠠桓畯摬慃瑰牵䑥扥杵䈨楯䥤摮硥‬汆捯䑫扥杵癁楯慤据⥥਩उ੻उ䌉畨歮䐮扥杵楌敮⹳摁⡤⁻潌慣楴湯‬楈⹴䉢潬正湩䡧瑩㼠䠠瑩䤮灭捡側楯瑮㨠匠湥潳䕲摮‬楈⹴䉢潬正湩䡧瑩㼠䘠潃潬㩲刺摥㨠䘠潃潬㩲䜺敲湥素㬩ऊ紉ਊउ⼯档捥⁫晩戠楯⁤獩椠獮摩⁥扯敪瑣⠠⹩⹥渠⁯敮摥琠⁯癡楯⽤浩潰獳扩敬琠⥯ऊ⼉戯楯⁤癯牥慬獰挠湡漠汮⁹敢爠慥⁤湯琠敨朠浡⁥桴敲摡‬獡湹档潲潮獵猠浩汵瑡潩⁮敲楬獥漠⁮桴⁥牴捡⁥瑳牡楴杮椠獮摩⁥桴⁥扯敪瑣ऊ椉⁦䠨瑩戮求捯楫杮楈⥴ऊ笉ऊउ晩⠠楈⹴卢慴瑲敐敮牴瑡湩⥧ऊउ੻उउ敲畴湲映污敳਻उ紉ऊउ䉁楯⩤䈠楯⁤‽偢湥楤杮獁湹⁣‿畮汬瑰⁲›汆捯卫慴整䈮楯獤䉛楯䥤摮硥㭝ऊउ晩⠠潂摩☠…潂摩㸭獉湉楳敤扏瑳捡敬䠨瑩䜮瑥捁潴⡲⤩਩उ笉ऊउ爉瑥牵⁮慦獬㭥ऊउ੽उ੽ऊ爉瑥牵⁮楈⹴䉢潬正湩䡧瑩਻紉ਊ⼉琯敨敲愠敲渠⁯敳獮牯⁳潴挠敨正ऊ敲畴湲映污敳਻੽䘊敖瑣牯䄠汆捯䵫湡条牥㨺癁楯佤獢慴汣⡥湩㍴′潂摩湉敤ⱸ䘠汆捯卫整牥湩䍧畨歮…桃湵⥫笊ऊ噆捥潴⁲瑓敥楲杮㴠䘠敖瑣牯㨺敚潲敖瑣牯਻按湯瑳䘠敖瑣牯…潌慣楴湯㴠䘠潬正瑓瑡⹥潐楳楴湯孳潂摩湉敤嵸਻按湯瑳䘠敖瑣牯…潆睲牡⁤‽潂摩效摡湩獧䉛楯䥤摮硥㭝ऊ⼯⁡敳獮牯爠湩⁧湯祬琠牵獮愠潲湵⁤桴⁥灵愠楸ⱳ欠敥楰杮猠湥潳獲漠⁮桴⁥汰湡⁥癥湥眠敨⁮桴⁥潢摩栠慥獤愠潬杮ⴠ੘䘉畑瑡匠湥潳割瑯瑡潩⁮‽匨浩畒敬⁳…䙅潬正畒敬㨺汐湡牡 ‿兆慵⡴噆捥潴㩲唺噰捥潴Ⱳ䘠慍桴㨺瑁湡⠲潆睲牡⹤ⱙ䘠牯慷摲堮⤩㨠䘠畑瑡㨺楆摮敂睴敥噮捥潴獲匨浩癁楯慤据卥湥潳獲せⱝ䘠牯慷摲㬩ऊ噆捥潴⁲敎卷湥潳䑲物捥楴湯㴠䘠敖瑣牯㨺敚潲敖瑣牯਻䘉潃汬獩潩兮敵祲慐慲獭吠慲散慐慲敭整獲਻䘉楈剴獥汵⁴楈㭴ਊ⼉猯湥潳獲愠敲漠摲牥摥映潲⁭桴⁥潢摩猧栠慥楤杮琠睯牡獤椠獴戠捡Ⱬ氠睯牥焠慵楬祴氠癥汥⁳湯祬琠慲散琠敨映潲瑮洭獯⁴敳獮牯ੳ昉牯⠠湩㍴′敓獮牯湉敤⁸‽㬰匠湥潳䥲摮硥㰠匠浩癁楯慤据卥湥潳獲丮浵⤨※⬫敓獮牯湉敤⥸ऊ੻उ潣獮⁴噆捥潴♲䄠潶摩湡散敓獮牯㴠匠浩癁楯慤据卥湥潳獲卛湥潳䥲摮硥㭝ऊ⼉爯瑯瑡⁥癡楯慤据⁥敳獮牯琠⁯污杩⁮楷桴戠楯⁤牯敩瑮瑡潩⁮湡⁤牴捡⁥潦⁲潣汬獩潩੮उ敎卷湥潳䑲物捥楴湯㴠匠湥潳割瑯瑡潩⹮潒慴整敖瑣牯䄨潶摩湡散敓獮牯㬩ऊ䜉瑥潗汲⡤⴩䰾湩呥慲散楓杮敬祂桃湡敮⡬楈ⱴ䰠捯瑡潩Ɱ䰠捯瑡潩⁮‫敎卷湥潳䑲物捥楴湯⨠匠浩敓獮牯慒楤獵‬佃䱌卉佉彎噁䥏䅄䍎ⱅ吠慲散慐慲敭整獲㬩ऊ椉⁦戨敔敬敭牴䍹灡畴敲਩उ੻उ䌉畨歮吮汥浥瑥祲刮捥牯呤慲散⡳⤱਻उ੽ऊ⼉爯捥牯⁤癡楯慤据⁥敳獮牯猠慴畴⁳潦⁲敤畢⁧楶畳污穩瑡潩੮उ晩⠠桓畯摬慃瑰牵䑥扥杵䈨楯䥤摮硥‬汆捯䑫扥杵癁楯慤据⥥਩उ੻उ䌉畨歮䐮扥杵楌敮⹳摁⡤⁻潌慣楴湯‬楈⹴䉢潬正湩䡧瑩㼠䠠瑩䤮灭捡側楯瑮㨠䰠捯瑡潩⁮‫敎卷湥潳䑲物捥楴湯⨠匠浩敓獮牯慒楤獵‬楈⹴䉢潬正湩䡧瑩㼠䘠潃潬㩲刺摥㨠䘠潃潬㩲䜺敲湥素㬩ऊ紉ਊउ晩⠠䠡瑩戮求捯楫杮楈⥴ऊ笉ऊउ⼯佔佄愠摤瀠潲楸業祴映捡潴⁲潴愠潶摩湡散‮桔⁥汣獯牥琠⁯潣汬獩潩⁮桴⁥瑳潲杮牥琠敨映牯散ਮउ匉整牥湩⁧‽敎卷湥潳䑲物捥楴湯䜮瑥慓敦潎浲污⤨ⴠ䘠牯慷摲਻उ匉整牥湩⁧㴪匠浩慐慲敭整獲䄮潶摩湡散瑓敲杮桴਻उ爉瑥牵⁮瑓敥楲杮਻उ੽紉ਊ爉瑥牵⁮噆捥潴㩲娺牥噯捥潴㭲紊ਊ噆捥潴⁲䙁潬正慍慮敧㩲场湡敤⡲湩㍴′潂摩湉敤⥸笊ऊ⼯慲摮浯搠物捥楴湯猠敥敤⁤祢栠湡汤⁥湡⁤慷摮牥瀠牥潩Ɽ猠慴杧牥摥戠⁹慨摮敬猠⁯潢摩⁳潤❮⁴污⁬畴湲漠⁮桴⁥慳敭映慲敭ऊ潣獮⁴極瑮㈳䠠湡汤⁥‽極瑮㈳䘨潬正瑓瑡⹥慈摮敬孳潂摩湉敤嵸㬩ऊ剆湡潤卭牴慥⁭慗摮牥瑓敲浡椨瑮㈳䠨獡䍨浯楢敮䠨湡汤ⱥ⠠楓畭慬楴湯牆浡⁥‫慈摮敬  慗摮牥湉整癲污⤩㬩ऊ敲畴湲圠湡敤卲牴慥⹭敇啴楮噴捥潴⡲ ‪楓坭湡敤卲牴湥瑧㭨紊ਊ噆捥潴⁲䙁潬正慍慮敧㩲䘺敬⡥湩㍴′潂摩湉敤⥸笊ऊ噆捥潴⁲瑓敥楲杮㴠䘠敖瑣牯㨺敚潲敖瑣牯਻按湯瑳䘠敖瑣牯…潌慣楴湯㴠䘠潬正瑓瑡⹥潐楳楴湯孳潂摩湉敤嵸਻ऊ潦⁲挨湯瑳䘠敖瑣牯…楖睥潌慣楴湯㨠嘠敩䱷捯瑡潩獮਩笉ऊ䘉敖瑣牯䘠敬䑥物捥楴湯㴠䰠捯瑡潩⁮‭楖睥潌慣楴湯਻उ潣獮⁴汦慯⁴楄瑳湡散㴠䘠敬䑥物捥楴湯匮穩⡥㬩ऊ椉⁦䐨獩慴据⁥㴾匠浩汆敥慒楤獵簠⁼楄瑳湡散㰠䬠义䅄卟䅍䱌也䵕䕂⥒ऊ笉ऊउ潣瑮湩敵ऻ⼯楶睥椠⁳畯⁴景爠湡敧‬楤牳来牡⁤瑩愠摮挠湯楴畮⁥桴⁥潬灯ऊ紉ਊउ⼯汦敥栠牡敤⁲桴⁥汣獯牥琠敨瘠敩⁷獩ऊ匉整牥湩⁧㴫⠠汆敥楄敲瑣潩⁮ 楄瑳湡散 ‪ㄨ〮⁦‭楄瑳湡散⼠匠浩汆敥慒楤獵㬩ऊ੽ऊ敲畴湲匠整牥湩⁧‪楓䙭敬卥牴湥瑧㭨紊ਊ噆捥潴⁲䙁潬正慍慮敧㩲䘺汯潬䙷潬䙷敩摬椨瑮㈳䈠楯䥤摮硥‬䙆潬正瑓敥楲杮桃湵♫䌠畨歮਩੻按湯瑳䘠敖瑣牯…潌慣楴湯㴠䘠潬正瑓瑡⹥潐楳楴湯孳潂摩湉敤嵸਻按湯瑳䘠敖瑣牯䘠潬䑷物捥楴湯㴠䘠潬䙷敩摬匮浡汰⡥潌慣楴湯㬩ਊ⼉爯捥牯⁤汦睯搠物捥楴湯映牯搠扥杵瘠獩慵楬慺楴湯ऊ晩⠠桓畯摬慃瑰牵䑥扥杵䈨楯䥤摮硥‬汆捯䑫扥杵汆睯楆汥⥤਩笉ऊ䌉畨歮䐮扥杵楌敮⹳摁⡤⁻潌慣楴湯‬潌慣楴湯⬠䘠潬䑷物捥楴湯⨠䘠潬䙷敩摬䜮瑥敃汬楓敺⤨‬䍆汯牯㨺慍敧瑮⁡⥽਻紉ਊ⼉戯楯獤漠瑵楳敤漠⁦桴⁥楦汥⁤牯椠⁮散汬⁳楷桴渠⁯潲瑵⁥敫灥映潬正湩੧椉⁦䘨潬䑷物捥楴湯䤮婳牥⡯⤩ऊ੻उ敲畴湲䘠敖瑣牯㨺敚潲敖瑣牯਻紉ਊ⼉猯整牥映潲⁭畣牲湥⁴敨摡湩⁧潴慷摲⁳桴⁥汦睯搠物捥楴湯ऊ敲畴湲⠠汆睯楄敲瑣潩⁮‭潂摩效摡湩獧䉛楯䥤摮硥⥝⨠匠浩汆睯楆汥卤牴湥瑧㭨紊ਊ潶摩䄠汆捯䵫湡条牥㨺敓䙴楬桧䅴楮慭整⡤潢汯戠湅扡敬⥤笊ऊ䅢楮慭整汆杩瑨㴠戠湅扡敬㭤紊ਊ潶摩䄠汆捯䵫湡条牥㨺敓呴慲正片畯獰戨潯⁬䕢慮汢摥਩੻戉牔捡䝫潲灵⁳‽䕢慮汢摥਻੽瘊楯⁤䙁潬正慍慮敧㩲䌺灡畴敲片畯呰慲正湩⡧਩੻⼉是牯敧⁴牧畯獰眠敨⁮牴捡楫杮椠⁳畴湲摥漠晦猠⁯桴祥猠慴瑲漠敶⁲牦浯愠映敲桳爠扥極摬眠敨⁮瑩猧琠牵敮⁤慢正漠੮椉⁦ℨ呢慲正片畯獰☠…卢浩牔捡䝫潲灵⥳ऊ੻उ汆捯䝫潲灵⹳敒敳⡴㬩ऊ੽戉楓呭慲正片畯獰㴠戠牔捡䝫潲灵㭳ऊ楓䝭潲灵楌歮慒楤獵㴠䜠潲灵楌歮慒楤獵㸠〠〮⁦‿片畯䱰湩剫摡畩⁳›敐捲灥楴湯慒楤獵਻匉浩片畯剰扥極摬湉整癲污㴠䘠慍桴㨺慍⡸片畯剰扥極摬湉整癲污‬⤱਻੽瘊楯⁤䙁潬正慍慮敧㩲唺摰瑡䝥潲灵⡳਩੻椉⁦ℨ卢浩牔捡䝫潲灵⥳笠爠瑥牵㭮素ਊ䘉潬正片畯獰售摰瑡⡥汆捯卫慴整‬汆捯佫瑣敲ⱥ匠浩片畯䱰湩剫摡畩ⱳ匠浩片畯剰扥極摬湉整癲污㬩紊ਊ䅔牲祡䘼汆捯䝫潲灵‾䙁潬正慍慮敧㩲䜺瑥汆捯䝫潲灵⡳ 潣獮ੴ੻䘉汆捯噫敩偷牴嘠敩⁷‽敇䙴潬正楖睥⤨਻爉瑥牵⁮楖睥䤮噳污摩⤨㼠嘠敩⵷䜾潲灵⁳›䅔牲祡䘼汆捯䝫潲灵⠾㬩紊ਊ潢汯䄠汆捯䵫湡条牥㨺敇䱴牡敧瑳汆捯䝫潲灵䘨汆捯䝫潲灵…畏䝴潲灵 潣獮ੴ੻䘉汆捯噫敩偷牴嘠敩⁷‽敇䙴潬正楖睥⤨਻椉⁦ℨ楖睥䤮噳污摩⤨簠⁼楖睥㸭片畯獰丮浵⤨㴠‽⤰笠爠瑥牵⁮慦獬㭥素ਊ按湯瑳䘠汆捯䝫潲灵‪慌杲獥⁴‽嘦敩⵷䜾潲灵孳崰਻昉牯⠠潣獮⁴䙆潬正片畯♰䜠潲灵㨠嘠敩⵷䜾潲灵⥳ऊ੻उ慌杲獥⁴‽片畯⹰畎⡭ ‾慌杲獥⵴举浵⤨㼠☠片畯⁰›慌杲獥㭴ऊ੽伉瑵片畯⁰‽䰪牡敧瑳਻爉瑥牵⁮牴敵਻੽椊瑮㈳䄠汆捯䵫湡条牥㨺敇䉴楯䝤潲灵摉椨瑮㈳䠠湡汤⥥挠湯瑳笊ऊ䙆潬正楖睥瑐⁲楖睥㴠䜠瑥汆捯噫敩⡷㬩ऊ晩⠠嘡敩⹷獉慖楬⡤⤩笠爠瑥牵⁮义䕄彘低䕎※੽ऊ潣獮⁴湩㍴′湉敤⁸‽楖睥㸭敇䥴摮硥䠨湡汤⥥਻按湯瑳椠瑮㈳䜠潲灵湉敤⁸‽湉敤⁸㴡䤠䑎塅也乏⁅☦嘠敩⵷䜾潲灵湉楤散⹳獉慖楬䥤摮硥䤨摮硥 ‿楖睥㸭片畯䥰摮捩獥䥛摮硥⁝›义䕄彘低䕎਻爉瑥牵⁮片畯䥰摮硥℠‽义䕄彘低䕎㼠嘠敩⵷䜾潲灵孳片畯䥰摮硥⹝摉㨠䤠䑎塅也乏㭅紊ਊ潶摩䄠汆捯䵫湡条牥㨺慃瑰牵䙥楬桧䅴楮慭楴湯⤨笊ऊ⼯敨摡敬獳映潬正⁳慨敶渠⁯敭桳獥琠⁯湡浩瑡੥戉楓䅭楮慭整汆杩瑨㴠戠湁浩瑡䙥楬桧⁴☦℠䥢䡳慥汤獥㭳ऊ楓䵭湩汆灡慒整㴠䴠湩汆灡慒整਻匉浩慍䙸慬剰瑡⁥‽䵆瑡㩨䴺硡䴨硡汆灡慒整‬楍䙮慬剰瑡⥥਻匉浩慍䉸湡䅫杮敬㴠䘠慍桴㨺敄牧敥味副摡慩獮䴨硡慂歮湁汧⥥਻匉浩汆杩瑨楍卮数摥㴠䴠湩灓敥㭤ऊ楓䙭楬桧䵴硡灓敥⁤‽䵆瑡㩨䴺硡䴨硡灓敥Ɽ䴠湩灓敥⥤਻੽瘊楯⁤䙁潬正慍慮敧㩲䄺楮慭整汆杩瑨椨瑮㈳䈠楯䥤摮硥‬汦慯⁴敄瑬呡浩ⱥ映潬瑡䌠慨杮䑥汥慴楔敭਩੻按湯瑳䘠敖瑣牯…敖潬楣祴㴠䘠潬正瑓瑡⹥敖潬楣楴獥䉛楯䥤摮硥㭝ऊ潣獮⁴噆捥潴♲䰠獡䡴慥楤杮㴠䈠楯䡤慥楤杮孳潂摩湉敤嵸਻按湯瑳映潬瑡匠数摥㴠嘠汥捯瑩⹹楓敺⤨਻䌉慨杮䑥汥慴楔敭㴠䘠慍桴㨺慍⡸桃湡敧敄瑬呡浩ⱥ䬠义䅄卟䅍䱌也䵕䕂⥒਻按湯瑳䘠敖瑣牯䠠慥楤杮㴠匠数摥㸠䬠义䅄卟䅍䱌也䵕䕂⁒‿敖潬楣祴⼠匠数摥㨠䰠獡䡴慥楤杮਻按湯瑳映潬瑡匠数摥慒杮⁥‽䵆瑡㩨䴺硡匨浩汆杩瑨慍卸数摥ⴠ匠浩汆杩瑨楍卮数摥‬⸱昰㬩ਊ⼉猯潬⁷潢摩⁳湡⁤潢摩⁳灳敥楤杮甠⁰牯挠楬扭湩⁧汦灡栠牡敤Ⱳ映獡⁴潢摩⁳湡⁤潢摩⁳汳睯湩⁧潤湷漠⁲楤楶杮朠楬敤ऊ潣獮⁴汦慯⁴汓睯敮獳㴠ㄠ〮⁦‭䵆瑡㩨䌺慬灭⠨灓敥⁤‭楓䙭楬桧䵴湩灓敥⥤⼠匠数摥慒杮ⱥ〠〮ⱦㄠ〮⥦਻按湯瑳映潬瑡匠数摥桃湡敧㴠⠠灓敥⁤‭潂摩灓敥獤䉛楯䥤摮硥⥝⼠⠠桃湡敧敄瑬呡浩⁥‪灓敥剤湡敧㬩ऊ潣獮⁴汦慯⁴慔杲瑥晅潦瑲㴠䘠慍桴㨺汃浡⡰⸰昵⨠匠潬湷獥⁳‫灓敥䍤慨杮⁥‫效摡湩⹧ⱚ〠〮ⱦㄠ〮⥦਻昉潬瑡…汆灡晅潦瑲㴠䘠潬正瑓瑡⹥汆灡晅潦瑲孳潂摩湉敤嵸਻䘉慬䕰晦牯⁴‽䵆瑡㩨䘺湉整灲潔䘨慬䕰晦牯ⱴ吠牡敧䕴晦牯ⱴ䐠汥慴楔敭‬汆杩瑨浓潯桴湩⥧਻ऊ⼯摡慶据⁥楷杮戠慥⁴瑡琠敨映慬⁰慲整漠⁦桴⁥潢摩猧攠晦牯ੴ昉潬瑡…汆灡桐獡⁥‽汆捯卫慴整䘮慬偰慨敳孳潂摩湉敤嵸਻䘉慬偰慨敳㴠䘠慍桴㨺牆捡䘨慬偰慨敳⬠䘠慍桴㨺敌灲匨浩楍䙮慬剰瑡ⱥ匠浩慍䙸慬剰瑡ⱥ䘠慬䕰晦牯⥴⨠䐠汥慴楔敭㬩ਊ⼉戯湡⁫湩潴琠牵獮‬畴湲湩⁧楲桧⁴栨慥楤杮爠瑯瑡湩⁧汣捯睫獩⁥牡畯摮甠⥰戠湡獫爠杩瑨ऊ潣獮⁴汦慯⁴畔湲慒整㴠䘠慍桴㨺捁獯䘨慍桴㨺汃浡⡰噆捥潴㩲䐺瑯牐摯捵⡴慌瑳效摡湩Ⱨ䠠慥楤杮Ⱙⴠ⸱昰‬⸱昰⤩⼠䌠慨杮䑥汥慴楔敭਻按湯瑳映潬瑡吠牵卮杩⁮‽噆捥潴㩲䌺潲獳牐摯捵⡴慌瑳效摡湩Ⱨ䠠慥楤杮⸩⁚㴾〠〮⁦‿⸱昰㨠ⴠ⸱昰਻按湯瑳映潬瑡吠牡敧䉴湡⁫‽畔湲楓湧⨠䘠慍桴㨺楍⡮䵆瑡㩨䄺慴⡮灓敥⁤‪畔湲慒整⼠䘠楬桧䝴慲楶祴Ⱙ匠浩慍䉸湡䅫杮敬㬩ऊ汦慯♴䈠湡䅫杮敬㴠䘠潬正瑓瑡⹥慂歮湁汧獥䉛楯䥤摮硥㭝ऊ慂歮湁汧⁥‽䵆瑡㩨䘺湉整灲潔䈨湡䅫杮敬‬慔杲瑥慂歮‬敄瑬呡浩ⱥ䘠楬桧却潭瑯楨杮㬩紊ਊ潶摩䄠汆捯䵫湡条牥㨺慂敫汆睯楆汥⡤਩੻⼉是潬⁷楦汥⁤獩爠慥⁤祢琠敨猠浩汵瑡潩੮圉楡䙴牯楓畭慬楴湯⤨਻䘉潬䙷敩摬刮獥瑥⤨਻ऊ晩⠠汆睯楆汥䝤慯⁬㴽渠汵灬牴਩笉ऊ⼉氯杯眠牡楮杮琠⁯潣獮汯੥उ䕕䱟䝏䰨杯敔灭‬慗湲湩Ⱨ吠塅⡔丢⁯汦睯映敩摬朠慯⁬敳⁴湩䘠潬正慍慮敧㩲┠⹳⤢‬䜪瑥慎敭⤨㬩ऊ爉瑥牵㭮ऊ੽ऊ⼯汰湡牡映潬正⁳湯祬渠敥⁤⁡楳杮敬氠祡牥漠⁦散汬⁳湯琠敨物瀠慬敮ऊ噆捥潴⁲硅整瑮㴠䘠潬䙷敩摬硅整瑮਻椉⁦戨汐湡牡潍敶敭瑮਩笉ऊ䔉瑸湥⹴⁚‽⸰昰਻紉ਊ⼉振汥獬漠敶汲灡楰杮愠潶摩湡散朠潥敭牴⁹牡⁥汢捯敫Ɽ琠敨朠慯⁬瑩敳晬⠠⹩⹥愠搠獥慰湷牥瘠汯浵⥥渠癥牥戠潬正⁳桴⁥潲瑵⁥潴椠ੴ唉潗汲⩤圠牯摬㴠䜠瑥潗汲⡤㬩ऊ䍆汯楬楳湯畑牥偹牡浡⁳畑牥偹牡浡瑥牥⡳䍓久彅啑剅彙呓呁䘨潬正汆睯楆汥⥤‬慦獬ⱥ䘠潬䙷敩摬潇污㬩ऊ潣獮⁴潤扵敬䈠歡卥慴瑲楔敭㴠䘠汐瑡潦浲楔敭㨺敓潣摮⡳㬩ऊ汆睯楆汥⹤畂汩⡤䉆硯㨺畂汩䅤䉁⡂敇䅴瑣牯潌慣楴湯⤨‬硅整瑮Ⱙ䘠潬䙷敩摬敃汬楓敺‬汆睯楆汥䝤慯⵬䜾瑥捁潴䱲捯瑡潩⡮Ⱙ嬠潗汲Ɽ☠畑牥偹牡浡瑥牥嵳挨湯瑳䘠敖瑣牯…敃汬敃瑮牥‬汦慯⁴敃汬慈晬楓敺਩笉ऊ爉瑥牵⁮潗汲ⵤ伾敶汲灡求捯楫杮敔瑳祂桃湡敮⡬敃汬敃瑮牥‬兆慵㩴䤺敤瑮瑩ⱹ䌠䱏䥌䥓乏䅟佖䑉乁䕃‬䍆汯楬楳湯桓灡㩥䴺歡䉥硯䘨敖瑣牯䌨汥䡬污卦穩⥥Ⱙ儠敵祲慐慲敭整獲㬩ऊ⥽਻ऊ潣獮⁴䥆瑮敖瑣牯…楄敭獮潩獮㴠䘠潬䙷敩摬䜮瑥楄敭獮潩獮⤨਻唉彅佌⡇潌呧浥Ɒ䰠杯‬䕔员∨慂敫⁤搥╸硤搥映潬⁷楦汥⁤┨〮⁦湵瑩挠汥獬‬搥戠潬正摥‬搥甠牮慥档扡敬 湩┠ㄮ⁦獭椠⁮汆捯䵫湡条牥›猥∮Ⱙऊ䐉浩湥楳湯⹳ⱘ䐠浩湥楳湯⹳ⱙ䐠浩湥楳湯⹳ⱚ䘠潬䙷敩摬䜮瑥敃汬楓敺⤨‬汆睯楆汥⹤敇乴浵求捯敫䍤汥獬⤨‬汆睯楆汥⹤敇乴浵湕敲捡慨汢䍥汥獬⤨ਬउ䘨汐瑡潦浲楔敭㨺敓潣摮⡳ ‭慂敫瑓牡呴浩⥥⨠ㄠ〰⸰ⰰ⨠敇乴浡⡥⤩਻੽瘊楯⁤䙁潬正慍慮敧㩲区瑥汆睯楆汥䝤慯⡬䅁瑣牯‪敎䙷潬䙷敩摬潇污਩੻䘉潬䙷敩摬潇污㴠丠睥汆睯楆汥䝤慯㭬ਊ椉⁦戨獕䙥潬䙷敩摬਩笉ऊ䈉歡䙥潬䙷敩摬⤨਻紉紊ਊ⼯摡⁤桴⁥㈱攠杤獥漠⁦湡愠楸⁳污杩敮⁤潢⁸潴愠氠湩⁥慢捴੨瑳瑡捩瘠楯⁤摁䑤扥杵潂⡸䅔牲祡䘼慂捴敨䱤湩㹥…楌敮ⱳ挠湯瑳䘠敖瑣牯…敃瑮牥‬潣獮⁴噆捥潴♲䔠瑸湥ⱴ挠湯瑳䘠潃潬♲䌠汯牯਩੻昉牯⠠湩㍴′摅敧㴠〠※摅敧㰠ㄠ㬲⬠䔫杤⥥ऊ੻उ⼯慥档攠杤⁥畲獮愠潬杮漠敮愠楸ⱳ琠敨漠桴牥琠潷愠數⁳楰正漠敮漠⁦桴⁥潢❸⁳‴摥敧⁳湯琠慨⁴硡獩ऊ按湯瑳椠瑮㈳䄠楸⁳‽摅敧⼠㐠਻उ潣獮⁴汦慯⁴楓湧⁁‽䔨杤⁥…⤱㼠ㄠ〮⁦›ㄭ〮㭦ऊ按湯瑳映潬瑡匠杩䉮㴠⠠摅敧☠㈠ ‿⸱昰㨠ⴠ⸱昰਻उ噆捥潴⁲瑓牡ⱴ䔠摮਻उ瑓牡孴硁獩⁝‽ㄭ〮㭦ऊ䔉摮䅛楸嵳㴠ㄠ〮㭦ऊ匉慴瑲⡛硁獩⬠ㄠ ‥崳㴠䔠摮⡛硁獩⬠ㄠ ‥崳㴠匠杩䅮਻उ瑓牡孴䄨楸⁳‫⤲┠㌠⁝‽湅孤䄨楸⁳‫⤲┠㌠⁝‽楓湧㭂ऊ䰉湩獥䄮摤䘨慂捴敨䱤湩⡥敃瑮牥⬠匠慴瑲⨠䔠瑸湥ⱴ䌠湥整⁲‫湅⁤‪硅整瑮‬潃潬Ⱳ〠〮ⱦ〠〮ⱦ匠偄彇潗汲⥤㬩ऊ੽੽瘊楯⁤䙁潬正慍慮敧㩲区浡汰䑥扥杵潂摩⡳਩੻戉敄畢䍧灡畴敲㴠映污敳਻䐉扥杵楌敮⹳敒敳⡴㬩ਊ椣⁦久䉁䕌䑟䅒彗䕄啂ੇ䐉扥杵汆条⁳‽噃牡汆捯䑫扥杵䜮瑥慖畬佥䝮浡呥牨慥⡤㬩ऊ潣獮⁴湩㍴′畎䉭楯獤㴠䘠潬正瑓瑡⹥畎⡭㬩ऊ晩⠠敄畢䙧慬獧㴠‽‰籼丠浵潂摩⁳㴽〠 ⁻敲畴湲※੽ऊ敄畢卧浡汰摥䤮楮⡴慦獬ⱥ丠浵潂摩⥳਻按湯瑳椠瑮㈳䴠硡敄畢䉧楯獤㴠䘠慍桴㨺慍⡸噃牡汆捯䑫扥杵慍䉸楯獤䜮瑥慖畬佥䝮浡呥牨慥⡤Ⱙㄠ㬩ऊ湩㍴′畎卭浡汰摥㴠〠਻ऊ潣獮⁴汦慯⁴畃獲牯慒楤獵㴠䌠慖䙲潬正敄畢䍧牵潳割摡畩⹳敇噴污敵湏慇敭桔敲摡⤨਻椉⁦䌨牵潳割摡畩⁳‾⸰昰਩笉ऊ⼉猯浡汰⁥潢摩⁳污湯⁧桴⁥楬敮甠摮牥琠敨挠牵潳Ⱳ漠⁲桴潲杵⁨桴⁥楶睥挠湥整⁲桷湥琠敨敲椠⁳潮挠牵潳ੲउ偁慬敹䍲湯牴汯敬⩲倠慬敹䍲湯牴汯敬⁲‽敇坴牯摬⤨㸭敇䙴物瑳汐祡牥潃瑮潲汬牥⤨਻उ晩⠠汐祡牥潃瑮潲汬牥㴠‽畮汬瑰⥲笠爠瑥牵㭮素ऊ䘉敖瑣牯删祡牏杩湩਻उ噆捥潴⁲慒䑹物捥楴湯਻उ晩⠠倡慬敹䍲湯牴汯敬⵲䐾灥潲敪瑣潍獵健獯瑩潩呮坯牯摬刨祡牏杩湩‬慒䑹物捥楴湯⤩ऊ笉ऊउ剆瑯瑡牯嘠敩剷瑯瑡潩㭮ऊउ汐祡牥潃瑮潲汬牥㸭敇側慬敹噲敩偷楯瑮刨祡牏杩湩‬楖睥潒慴楴湯㬩ऊउ慒䑹物捥楴湯㴠嘠敩剷瑯瑡潩⹮敖瑣牯⤨਻उ੽ऊ昉牯⠠湩㍴′⁩‽㬰椠㰠丠浵潂摩⁳☦丠浵慓灭敬⁤‼慍䑸扥杵潂摩㭳⬠椫਩उ੻उ按湯瑳䘠敖瑣牯…潌慣楴湯㴠䘠潬正瑓瑡⹥潐楳楴湯孳嵩਻उ椉⁦䘨敖瑣牯㨺潄側潲畤瑣䰨捯瑡潩⁮‭慒佹楲楧Ɱ删祡楄敲瑣潩⥮㸠〠〮⁦☦䘠慍桴㨺潐湩䑴獩呴䱯湩⡥潌慣楴湯‬慒䑹物捥楴湯‬慒佹楲楧⥮㰠‽畃獲牯慒楤獵਩उ笉ऊउ䐉扥杵慓灭敬孤嵩㴠琠畲㭥ऊउ三浵慓灭敬⭤㬫ऊउ੽उ੽紉ऊ汥敳ऊ੻उ⼯慳灭敬戠⁹慨摮敬猠⁯桴⁥慳敭戠楯獤猠慴⁹敳敬瑣摥眠楨敬琠敨映潬正椠⁳敲猭牯整੤उ潣獮⁴湩㍴′慓灭敬癅牥⁹‽䵆瑡㩨䴺硡䌨慖䙲潬正敄畢卧浡汰䕥敶祲䜮瑥慖畬佥䝮浡呥牨慥⡤Ⱙㄠ㬩ऊ昉牯⠠湩㍴′⁩‽㬰椠㰠丠浵潂摩⁳☦丠浵慓灭敬⁤‼慍䑸扥杵潂摩㭳⬠椫਩उ੻उ椉⁦䘨潬正瑓瑡⹥慈摮敬孳嵩┠匠浡汰䕥敶祲㴠‽⤰ऊउ੻उउ敄畢卧浡汰摥楛⁝‽牴敵਻उउ畎卭浡汰摥⬫਻उ紉ऊ紉ऊ੽ऊ䑢扥杵慃瑰牵⁥‽畎卭浡汰摥㸠〠਻攣摮晩紊ਊ潶摩䄠汆捯䵫湡条牥㨺牄睡汆捯䑫扥杵⤨笊⌊晩䔠䅎䱂彅剄坁䑟䉅䝕ऊ晩⠠戡敄畢䍧灡畴敲 ⁻敲畴湲※੽ऊ䱕湩䉥瑡档潃灭湯湥⩴䰠湩䉥瑡档牥㴠䜠瑥潗汲⡤⴩䰾湩䉥瑡档牥਻椉⁦䰨湩䉥瑡档牥㴠‽畮汬瑰⥲笠爠瑥牵㭮素ਊ⼉术瑡敨⁲癥牥⁹楬敮漠⁦桴⁥楶畳污穩瑡潩⁮潳椠❴⁳畳浢瑩整⁤潴琠敨氠湩⁥慢捴敨⁲瑡漠据੥吉牁慲㱹䉆瑡档摥楌敮‾楌敮㭳ऊ楌敮⹳敒敳癲⡥敄畢䱧湩獥丮浵⤨㬩ऊ潦⁲挨湯瑳䘠汆捯䑫扥杵楌敮…敄畢䱧湩⁥›敄畢䱧湩獥਩笉ऊ䰉湩獥䄮摤䘨慂捴敨䱤湩⡥敄畢䱧湩⹥瑓牡ⱴ䐠扥杵楌敮䔮摮‬敄畢䱧湩⹥潃潬Ⱳ〠〮ⱦㄠ㔮ⱦ匠偄彇潗汲⥤㬩ऊ੽ऊ潣獮⁴湩㍴′畎䍭物汣卥来敭瑮⁳‽㘱਻吉敓㱴湩㍴㸲䐠慲湷敃汬㭳ऊ潦⁲吨潃獮却瑥楂䥴整慲潴㱲‾瑉䐨扥杵慓灭敬⥤※瑉※⬫瑉਩笉ऊ按湯瑳椠瑮㈳椠㴠䤠⹴敇䥴摮硥⤨਻उ晩⠠⁩㴾䘠潬正瑓瑡⹥畎⡭⤩笠戠敲歡※੽उ潣獮⁴噆捥潴♲䰠捯瑡潩⁮‽汆捯卫慴整倮獯瑩潩獮楛㭝ऊ按湯瑳䘠敖瑣牯…敖潬楣祴㴠䘠潬正瑓瑡⹥敖潬楣楴獥楛㭝ਊउ⼯数捲灥楴湯爠湩⁧景攠捡⁨畲敬愠⁳楣捲敬⁳牡畯摮琠敨戠楯❤⁳敨摡湩⁧猨灥牡瑡潩⁮敲Ɽ愠楬湧敭瑮朠敲湥‬潣敨楳湯戠畬⥥ऊ椉⁦䐨扥杵汆条⁳…汆捯䑫扥杵敐捲灥楴湯਩उ੻उ䘉敖瑣牯䄠楸塳‬硁獩ⱙ䄠楸婳਻उ嘉汥捯瑩⹹敇却晡乥牯慭⡬⸩楆摮敂瑳硁獩敖瑣牯⡳硁獩ⱙ䄠楸婳㬩ऊउ硁獩⁘‽敖潬楣祴䜮瑥慓敦潎浲污⤨਻उ按湯瑳䘠敖瑣牯䌠物汣䅥數孳崳㉛⁝‽⁻⁻硁獩ⱘ䄠楸女素‬⁻硁獩ⱘ䄠楸婳素‬⁻硁獩ⱙ䄠楸婳素素਻उ按湯瑳映潬瑡删湩剧摡楩㍛⁝‽੻उउ敓慰慲楴湯慒楤獵㸠〠〮⁦‿敓慰慲楴湯慒楤獵㨠倠牥散瑰潩剮摡畩ⱳऊउ䄉楬湧敭瑮慒楤獵㸠〠〮⁦‿汁杩浮湥剴摡畩⁳›敐捲灥楴湯慒楤獵ਬउउ潃敨楳湯慒楤獵㸠〠〮⁦‿潃敨楳湯慒楤獵㨠倠牥散瑰潩剮摡畩⁳㭽ऊउ潣獮⁴䍆汯牯删湩䍧汯牯孳崳㴠笠䘠潃潬㩲刺摥‬䍆汯牯㨺片敥Ɱ䘠潃潬㩲䈺畬⁥㭽ऊउ潦⁲椨瑮㈳删汵⁥‽㬰删汵⁥‼㬳⬠别汵⥥ऊउ੻उउ⼯畲敬⁳桳牡湩⁧⁡楲杮搠慲⁷瑩漠据੥उउ晩⠠刨汵⁥‾‰☦删湩剧摡楩剛汵嵥㴠‽楒杮慒楤孩崰 籼⠠畒敬㸠ㄠ☠…楒杮慒楤孩畒敬⁝㴽删湩剧摡楩ㅛ⥝ ⁻潣瑮湩敵※੽ऊउ昉牯⠠潣獮⁴噆捥潴⩲䄠數⁳›楃捲敬硁獥਩उउ੻उउ䘉敖瑣牯䰠獡側楯瑮㴠䰠捯瑡潩⁮‫硁獥せ⁝‪楒杮慒楤孩畒敬㭝ऊउउ潦⁲椨瑮㈳匠来敭瑮㴠ㄠ※敓浧湥⁴㴼丠浵楃捲敬敓浧湥獴※⬫敓浧湥⥴ऊउउ੻उउउ潣獮⁴汦慯⁴湁汧⁥‽⸲昰⨠倠⁉‪敓浧湥⁴ 畎䍭物汣卥来敭瑮㭳ऊउउ按湯瑳䘠敖瑣牯倠楯瑮㴠䰠捯瑡潩⁮‫䄨數孳崰⨠䘠慍桴㨺潃⡳湁汧⥥⬠䄠數孳崱⨠䘠慍桴㨺楓⡮湁汧⥥ ‪楒杮慒楤孩畒敬㭝ऊउउ䰉湩獥䄮摤䘨慂捴敨䱤湩⡥慌瑳潐湩ⱴ倠楯瑮‬楒杮潃潬獲剛汵嵥‬⸰昰‬⸰昰‬䑓䝐坟牯摬⤩਻उउउ慌瑳潐湩⁴‽潐湩㭴ऊउउ੽उउ੽उ紉ऊ紉ਊउ⼯敶潬楣祴愠⁳桴⁥楤瑳湡散琠慲敶汬摥椠⁮桴⁥敮瑸焠慵瑲牥猠捥湯੤उ晩⠠敄畢䙧慬獧☠䘠潬正敄畢噧汥捯瑩⥹ऊ笉ऊउ楌敮⹳摁⡤䉆瑡档摥楌敮䰨捯瑡潩Ɱ䰠捯瑡潩⁮‫敖潬楣祴⨠〠㈮昵‬䍆汯牯㨺教汬睯‬⸰昰‬⸲昰‬䑓䝐坟牯摬⤩਻उ੽ऊ⼉戯畯摮⁳景琠敨漠瑣敲⁥敬晡挠湯慴湩湩⁧桴⁥潢摩‬慥档氠慥⁦獩搠慲湷漠据੥उ晩⠠敄畢䙧慬獧☠䘠潬正敄畢䍧汥獬਩उ੻उ按湯瑳椠瑮㈳䰠慥䥦摮硥㴠䘠潬正捏牴敥䘮湩䱤慥⡦潌慣楴湯㬩ऊउ潢汯戠汁敲摡䑹慲湷㴠映污敳਻उ䐉慲湷敃汬⹳摁⡤敌晡湉敤ⱸ☠䅢牬慥祤牄睡⥮਻उ椉⁦䰨慥䥦摮硥℠‽义䕄彘低䕎☠…戡汁敲摡䑹慲湷਩उ笉ऊउ按湯瑳䘠汆捯佫瑣敲乥摯♥䰠慥⁦‽汆捯佫瑣敲⹥敇乴摯⡥敌晡湉敤⥸਻उउ摁䑤扥杵潂⡸楌敮ⱳ䰠慥⹦敃瑮牥‬噆捥潴⡲敌晡䠮污卦穩ⱥ䰠慥⹦慈晬楓敺‬汆捯佫瑣敲⹥偢慬慮⁲‿⸰昰㨠䰠慥⹦慈晬楓敺Ⱙ䘠潃潬⡲㈱ⰸㄠ㠲‬㈱⤸㬩ऊउ੽उ੽紉ਊ䰉湩䉥瑡档牥㸭牄睡楌敮⡳楌敮⥳਻攣摮晩紊ਊ潢汯䄠汆捯䵫湡条牥㨺灕慤整潃牡敳楓畭慬楴湯昨潬瑡䐠汥慴楔敭਩੻椉⁦ℨ䥢䍳慯獲⁥☦匠牴慥業杮敌敶乬浡⹥獉潎敮⤨☠…潃牡敳楄瑳湡散㰠‽⸰昰 ⁻敲畴湲映污敳※੽ऊ潣獮⁴潢汯戠桓畯摬敂潃牡敳㴠匠潨汵卤浩汵瑡䍥慯獲⡥㬩ऊ晩⠠卢潨汵䉤䍥慯獲⁥☦℠䥢䍳慯獲⁥☦䘠潬正瑓瑡⹥畎⡭ ‾⤰ऊ੻उ湅整䍲慯獲卥浩汵瑡潩⡮㬩ऊ੽攉獬⁥晩⠠戡桓畯摬敂潃牡敳☠…䥢䍳慯獲⥥ऊ੻उ硅瑩潃牡敳楓畭慬楴湯⤨਻紉ਊ椉⁦ℨ䥢䍳慯獲⥥笠爠瑥牵⁮慦獬㭥素ਊ⼉猯整⁰汣獵整獲愠⁴潬⁷牦煥敵据੹䌉慯獲卥整呰浩⁥㴫䐠汥慴楔敭਻椉⁦䌨慯獲卥整呰浩⁥㴾䌠慯獲啥摰瑡䥥瑮牥慶⥬ऊ੻उ瑓灥潃牡敳汆捯⡫潃牡敳瑓灥楔敭㬩ऊ䌉慯獲卥整呰浩⁥‽⸰昰਻紉ਊ爉瑥牵⁮牴敵਻੽戊潯⁬䙁潬正慍慮敧㩲区潨汵卤浩汵瑡䍥慯獲⡥਩੻⼉栯摩敤⁮瑳敲浡湩⁧敬敶੬椉⁦ℨ瑓敲浡湩䱧癥汥慎敭䤮乳湯⡥⤩ऊ੻उ䱕癥汥瑓敲浡湩⩧匠牴慥業杮敌敶⁬‽䝕浡灥慬卹慴楴獣㨺敇却牴慥業杮敌敶⡬桴獩‬瑓敲浡湩䱧癥汥慎敭㬩ऊ椉⁦匨牴慥業杮敌敶⁬☦℠瑓敲浡湩䱧癥汥㸭獉敌敶噬獩扩敬⤨ ⁻敲畴湲琠畲㭥素ऊ੽ऊ晩⠠潃牡敳楄瑳湡散㰠‽⸰昰 ⁻敲畴湲映污敳※੽ऊ⼯潢湵獤漠⁦潢摩⁳牯挠畬瑳牥ੳ䘉潂⁸汆捯䉫畯摮⡳潆捲䥥楮⥴਻椉⁦戨獉潃牡敳਩笉ऊ昉牯⠠潣獮⁴䙆潬正潃牡敳汃獵整♲䌠畬瑳牥㨠䌠慯獲䍥畬瑳牥⥳ऊ笉ऊउ汆捯䉫畯摮⁳㴫䘠潂⡸汃獵整⹲敃瑮潲摩ⴠ䌠畬瑳牥匮牰慥⁤‪⸲昰‬汃獵整⹲敃瑮潲摩⬠䌠畬瑳牥匮牰慥⁤‪⸲昰㬩ऊ紉ऊ੽攉獬੥笉ऊ昉牯⠠潣獮⁴噆捥潴♲倠獯瑩潩⁮›汆捯卫慴整倮獯瑩潩獮਩उ੻उ䘉潬正潂湵獤⬠‽潐楳楴湯਻उ੽紉ऊ晩⠠䘡潬正潂湵獤䤮噳污摩 ⁻敲畴湲映污敳※੽ऊ⼯潣牡敳映潬正椠⁳敲票牤瑡摥猠楬桧汴⁹汣獯牥琠慨⁮瑩戠捥浯獥挠慯獲⁥潳椠⁴潤獥❮⁴睳瑩档戠捡⁫湡⁤潦瑲⁨瑡琠敨戠畯摮牡੹按湯瑳映潬瑡䐠獩慴据⁥‽䥢䍳慯獲⁥‿潃牡敳楄瑳湡散⨠〠㤮⁦›潃牡敳楄瑳湡散਻戉潯⁬䡢獡楖睥㴠映污敳਻昉牯⠠䍆湯瑳汐祡牥潃瑮潲汬牥瑉牥瑡牯䤠整慲潴⁲‽敇坴牯摬⤨㸭敇側慬敹䍲湯牴汯敬䥲整慲潴⡲㬩䤠整慲潴㭲⬠䤫整慲潴⥲ऊ੻उ偁慬敹䍲湯牴汯敬⩲倠慬敹䍲湯牴汯敬⁲‽瑉牥瑡牯㸭敇⡴㬩ऊ椉⁦倨慬敹䍲湯牴汯敬⥲ऊ笉ऊउ噆捥潴⁲楖睥潌慣楴湯਻उ䘉潒慴潴⁲楖睥潒慴楴湯਻उ倉慬敹䍲湯牴汯敬⵲䜾瑥汐祡牥楖睥潐湩⡴楖睥潌慣楴湯‬楖睥潒慴楴湯㬩ऊउ晩⠠汆捯䉫畯摮⹳潃灭瑵卥畱牡摥楄瑳湡散潔潐湩⡴楖睥潌慣楴湯 ‼楄瑳湡散⨠䐠獩慴据⥥笠爠瑥牵⁮慦獬㭥素ऊउ䡢獡楖睥㴠琠畲㭥ऊ紉ऊ੽ऊ⼯楷桴畯⁴汰祡牥瘠敩獷琠敨敲椠⁳潮潢祤琠⁯敢映牡映潲੭爉瑥牵⁮䡢獡楖睥਻੽瘊楯⁤䙁潬正慍慮敧㩲䔺瑮牥潃牡敳楓畭慬楴湯⤨笊ऊ慗瑩潆卲浩汵瑡潩⡮㬩ਊ按湯瑳椠瑮㈳丠浵潂摩⁳‽汆捯卫慴整丮浵⤨਻按湯瑳椠瑮㈳丠浵汃獵整獲㴠䘠慍桴㨺汃浡⡰慍䍸慯獲䍥畬瑳牥ⱳㄠ‬畎䉭楯獤㬩ਊ⼉猯敥⁤汣獵整獲眠瑩⁨潢摩⁳灳敲摡攠敶汮⁹桴潲杵⁨桴⁥䴨牯潴⁮潳瑲摥 汦捯⁫湡⁤敲楦敮琠敨⁭楷桴欠洭慥獮ऊ䅔牲祡䘼敖瑣牯‾敃瑮潲摩㭳ऊ敃瑮潲摩⹳敓乴浵湕湩瑩慩楬敺⡤畎䍭畬瑳牥⥳਻昉牯⠠湩㍴′⁣‽㬰挠㰠丠浵汃獵整獲※⬫⥣ऊ੻उ敃瑮潲摩孳嵣㴠䘠潬正瑓瑡⹥潐楳楴湯孳挨⨠丠浵潂摩⥳⼠丠浵汃獵整獲㭝ऊ੽吉牁慲㱹湩㍴㸲䄠獳杩浮湥獴਻䄉獳杩浮湥獴匮瑥畎啭楮楮楴污穩摥丨浵潂摩⥳਻吉牁慲㱹噆捥潴㹲䌠湥牴楯卤浵㭳ऊ䅔牲祡椼瑮㈳‾敃瑮潲摩潃湵獴਻昉牯⠠湩㍴′瑉牥瑡潩⁮‽㬰䤠整慲楴湯㰠䌠慯獲䍥畬瑳牥瑉牥瑡潩獮※⬫瑉牥瑡潩⥮ऊ੻उ敃瑮潲摩畓獭䤮楮⡴噆捥潴㩲娺牥噯捥潴Ⱳ丠浵汃獵整獲㬩ऊ䌉湥牴楯䍤畯瑮⹳湉瑩〨‬畎䍭畬瑳牥⥳਻उ潦⁲椨瑮㈳椠㴠〠※⁩‼畎䉭楯獤※⬫⥩ऊ笉ऊउ湩㍴′敎牡獥⁴‽㬰ऊउ汦慯⁴敎牡獥䑴獩慴据卥畱牡摥㴠䴠塁䙟呌਻उ昉牯⠠湩㍴′⁣‽㬰挠㰠丠浵汃獵整獲※⬫⥣ऊउ੻उउ潣獮⁴汦慯⁴楄瑳湡散煓慵敲⁤‽噆捥潴㩲䐺獩却畱牡摥䘨潬正瑓瑡⹥潐楳楴湯孳嵩‬敃瑮潲摩孳嵣㬩ऊउ椉⁦䐨獩慴据卥畱牡摥㰠丠慥敲瑳楄瑳湡散煓慵敲⥤ऊउ笉ऊउउ敎牡獥䑴獩慴据卥畱牡摥㴠䐠獩慴据卥畱牡摥਻उउ三慥敲瑳㴠挠਻उउ੽उ紉ऊउ獁楳湧敭瑮孳嵩㴠丠慥敲瑳਻उ䌉湥牴楯卤浵孳敎牡獥嵴⬠‽汆捯卫慴整倮獯瑩潩獮楛㭝ऊउ敃瑮潲摩潃湵獴乛慥敲瑳⭝㬫ऊ紉ऊ昉牯⠠湩㍴′⁣‽㬰挠㰠丠浵汃獵整獲※⬫⥣ऊ笉ऊउ晩⠠敃瑮潲摩潃湵獴捛⁝‾⤰ऊउ੻उउ敃瑮潲摩孳嵣㴠䌠湥牴楯卤浵孳嵣⼠䌠湥牴楯䍤畯瑮孳嵣਻उ紉ऊ紉ऊ੽ऊ⼯畳浭牡獩⁥潢摩⁳景攠捡⁨汣獵整ੲ䌉慯獲䍥畬瑳牥⹳敒敳⡴㬩ऊ潃牡敳汃獵整獲匮瑥畎⡭畎䍭畬瑳牥⥳਻昉牯⠠湩㍴′⁩‽㬰椠㰠丠浵潂摩㭳⬠椫਩笉ऊ䘉汆捯䍫慯獲䍥畬瑳牥…汃獵整⁲‽潃牡敳汃獵整獲䅛獳杩浮湥獴楛嵝਻उ潣獮⁴噆捥潴⁲晏獦瑥㴠䘠潬正瑓瑡⹥潐楳楴湯孳嵩ⴠ䌠湥牴楯獤䅛獳杩浮湥獴楛嵝਻उ汃獵整⹲敃瑮潲摩㴠䌠湥牴楯獤䅛獳杩浮湥獴楛嵝਻उ汃獵整⹲灓敲摡⬠‽晏獦瑥⨠传晦敳㭴ऊ䌉畬瑳牥嘮汥捯瑩⁹㴫䘠潬正瑓瑡⹥敖潬楣楴獥楛㭝ऊ䌉畬瑳牥䌮畯瑮⬫਻उ晩⠠汃獵整⹲潂摩祔数㴠‽畮汬瑰⁲☦䘠潬正瑓瑡⹥潂摩孳嵩਩उ੻उ䌉畬瑳牥䈮楯呤灹⁥‽汆捯卫慴整䈮楯獤楛ⵝ䜾瑥汃獡⡳㬩ऊ紉ऊ੽三浵潃牡敳潂摩⁳‽㬰ऊ潦⁲椨瑮㈳挠㴠䌠慯獲䍥畬瑳牥⹳畎⡭ ‭㬱挠㸠‽㬰ⴠ挭਩笉ऊ䘉汆捯䍫慯獲䍥畬瑳牥…汃獵整⁲‽潃牡敳汃獵整獲捛㭝ऊ椉⁦䌨畬瑳牥䌮畯瑮㴠‽⤰ऊ笉ऊउ潃牡敳汃獵整獲刮浥癯䅥却慷⡰⥣਻उ按湯楴畮㭥ऊ紉ऊ䌉畬瑳牥匮牰慥⁤‽噆捥潴⡲䵆瑡㩨区牱⡴汃獵整⹲灓敲摡堮⼠䌠畬瑳牥䌮畯瑮Ⱙ䘠慍桴㨺煓瑲䌨畬瑳牥匮牰慥⹤⁙ 汃獵整⹲潃湵⥴‬䵆瑡㩨区牱⡴汃獵整⹲灓敲摡娮⼠䌠畬瑳牥䌮畯瑮⤩਻उ汃獵整⹲敖潬楣祴⼠‽汃獵整⹲潃湵㭴ऊ椉⁦䌨畬瑳牥䈮楯呤灹⁥㴽渠汵灬牴਩उ੻उ䌉畬瑳牥䈮楯呤灹⁥‽敒汰捩瑡摥潂摩祔数਻उ੽उ畎䍭慯獲䉥楯獤⬠‽汃獵整⹲潃湵㭴ऊ੽ऊ⼯潢摩⁳畱略摥映牯猠慰湷湩⁧潪湩琠敨挠畬瑳牥⁳焨敵敵⁤潢摩⁳楷桴映潬正猠慴整眠牥⁥畳浭牡獩摥眠瑩⁨桴⁥汦捯⁫扡癯⥥ऊ潦⁲挨湯瑳䘠潂摩灓睡剮煥敵瑳…灓睡剮煥敵瑳㨠匠慰湷畑略⥥ऊ੻उ晩⠠灓睡剮煥敵瑳䘮潬正慈摮敬㴠‽义䕄彘低䕎☠…灓睡剮煥敵瑳䈮楯呤灹⥥ऊ笉ऊउ摁䍤慯獲䉥楯⡤灓睡剮煥敵瑳䈮楯呤灹ⱥ匠慰湷敒畱獥⹴灓睡呮慲獮潦浲㬩ऊ紉ऊ੽ऊ⼯敤瑳潲⁹潢摩ⱳ猠慴整椠⁳浥瑰敩⁤楦獲⁴潳琠敨⁹潤❮⁴敲潭敶琠敨獭汥敶⁳湯⁥祢漠敮ऊ䅔牲祡䄼潂摩㸪䈠楯獤㴠䘠潬正瑓瑡⹥潂摩㭳ऊ汆捯卫慴整䔮灭祴⤨਻匉慰湷畑略⹥敒敳⡴㬩ऊ敐摮湩剧浥癯污⹳敒敳⡴㬩ऊ潦⁲䄨潂摩‪潂摩㨠䈠楯獤਩笉ऊ椉⁦䈨楯⥤ऊ笉ऊउ潂摩㸭敓䙴潬正慈摮敬䤨䑎塅也乏⥅਻उ䈉楯ⵤ䐾獥牴祯⤨਻उ੽紉ਊ戉獉潃牡敳㴠琠畲㭥ऊ潃牡敳瑓灥楔敭㴠〠〮㭦ऊ䕕䱟䝏䰨杯敔灭‬潌Ⱨ吠塅⡔䘢潬正爠摥捵摥琠⁯搥挠慯獲⁥汣獵整獲⠠搥戠楯獤 湩䘠潬正慍慮敧㩲┠⹳⤢‬潃牡敳汃獵整獲丮浵⤨‬畎䍭慯獲䉥楯獤‬䜪瑥慎敭⤨㬩紊ਊ潶摩䄠汆捯䵫湡条牥㨺硅瑩潃牡敳楓畭慬楴湯⤨笊ऊ⼯敲票牤瑡⁥潢摩⁳湩楳敤攠捡⁨汣獵整❲⁳灳敲摡⠠湵晩牯⁭景獦瑥⁳楷桴琠敨猠浡⁥敤楶瑡潩⥮栠慥楤杮愠潬杮椠獴瘠汥捯瑩੹按湯瑳戠潯⁬坢獡浅瑰⁹‽汆捯卫慴整丮浵⤨㴠‽㬰ऊ汦慯⁴敒票牤瑡摥敐捲灥楴湯慒楤獵㴠〠〮㭦ऊ汆捯卫慴整刮獥牥敶䘨潬正瑓瑡⹥畎⡭ ‫畎䍭慯獲䉥楯獤㬩ऊ灓睡兮敵敵刮獥牥敶匨慰湷畑略⹥畎⡭ ‫畎䍭慯獲䉥楯獤㬩ऊ潦⁲椨瑮㈳挠㴠〠※⁣‼潃牡敳汃獵整獲丮浵⤨※⬫⥣ऊ੻उ潣獮⁴䙆潬正潃牡敳汃獵整♲䌠畬瑳牥㴠䌠慯獲䍥畬瑳牥孳嵣਻उ晩⠠汃獵整⹲潂摩祔数㴠‽畮汬瑰⥲笠挠湯楴畮㭥素ਊउ⼯慳敭挠畬瑳牥⁳湡⁤瑳灥愠睬祡⁳敲票牤瑡⁥桴⁥慳敭戠楯獤ऊ䘉慒摮浯瑓敲浡匠牴慥⡭慈桳潃扭湩⡥敇呴灹䡥獡⡨⥣‬敇呴灹䡥獡⡨潃牡敳瑓灥⥳⤩਻उ潣獮⁴噆捥潴⁲效摡湩⁧‽汃獵整⹲敖潬楣祴䤮乳慥汲婹牥⡯ ‿敇䅴瑣牯潆睲牡噤捥潴⡲ ›汃獵整⹲敖潬楣祴䜮瑥慓敦潎浲污⤨਻उ潣獮⁴汦慯⁴灓敥⁤‽䵆瑡㩨䌺慬灭䌨畬瑳牥嘮汥捯瑩⹹楓敺⤨‬楍卮数摥‬慍卸数摥㬩ऊ按湯瑳䘠敖瑣牯䔠瑸湥⁴‽汃獵整⹲灓敲摡⨠䘠慍桴㨺煓瑲㌨〮⥦਻उ潦⁲椨瑮㈳椠㴠〠※⁩‼汃獵整⹲潃湵㭴⬠椫਩उ੻उ按湯瑳䘠敖瑣牯倠獯瑩潩⁮‽汃獵整⹲敃瑮潲摩⬠䘠敖瑣牯匨牴慥⹭剆湡剤湡敧⴨⸱昰‬⸱昰Ⱙ匠牴慥⹭剆湡剤湡敧⴨⸱昰‬⸱昰Ⱙ匠牴慥⹭剆湡剤湡敧⴨⸱昰‬⸱昰⤩⨠䔠瑸湥㭴ऊउ潣獮⁴噆捥潴⁲潂摩效摡湩⁧‽瑓敲浡嘮慒摮潃敮䠨慥楤杮‬䵆瑡㩨䐺来敲獥潔慒楤湡⡳潃牡敳效摡湩卧牰慥䑤来敲獥⤩਻ऊउ䉆楯卤慰湷敒畱獥⁴灓睡剮煥敵瑳਻उ匉慰湷敒畱獥⹴潂摩祔数㴠䌠畬瑳牥䈮楯呤灹㭥ऊउ灓睡剮煥敵瑳䘮潬正慈摮敬㴠䘠潬正瑓瑡⹥摁⡤畮汬瑰Ⱳ倠獯瑩潩Ɱ䈠楯䡤慥楤杮⨠匠数摥‬潂摩效摡湩⹧潒慴楴湯⤨㬩ऊउ灓睡兮敵敵䄮摤匨慰湷敒畱獥⥴਻उ੽ऊ刉桥摹慲整偤牥散瑰潩剮摡畩⁳‽䵆瑡㩨䴺硡刨桥摹慲整偤牥散瑰潩剮摡畩ⱳ䌠畬瑳牥䈮楯呤灹ⵥ䜾瑥敄慦汵佴橢捥㱴䉁楯㹤⤨㸭敇側牥散瑰潩剮摡畩⡳⤩਻紉ਊ⼉瀯牥散癩⁥汦捯浫瑡獥眠瑩⁨桴⁥敤慦汵⁴潢摩❳猠湥潳獲甠瑮汩愠瑣牯⁳牡⁥灳睡敮Ɽ琠敨爠摡畩⁳景戠楯獤搠獥牴祯摥眠敨⁮桴⁥汦捯⁫敷瑮挠慯獲੥⼉搯敯湳琧挠牡祲漠敶ੲ倉牥散瑰潩剮摡畩⁳‽坢獡浅瑰⁹‿敒票牤瑡摥敐捲灥楴湯慒楤獵㨠䘠慍桴㨺慍⡸敐捲灥楴湯慒楤獵‬敒票牤瑡摥敐捲灥楴湯慒楤獵㬩ਊ唉彅佌⡇潌呧浥Ɒ䰠杯‬䕔员∨汆捯⁫敲票牤瑡摥映潲⁭搥挠慯獲⁥汣獵整獲⠠搥戠楯獤 湩䘠潬正慍慮敧㩲┠⹳⤢‬潃牡敳汃獵整獲丮浵⤨‬汆捯卫慴整丮浵⤨‬䜪瑥慎敭⤨㬩ऊ潃牡敳汃獵整獲刮獥瑥⤨਻三浵潃牡敳潂摩⁳‽㬰ऊ䥢䍳慯獲⁥‽慦獬㭥紊ਊ潶摩䄠汆捯䵫湡条牥㨺瑓灥潃牡敳汆捯⡫汦慯⁴瑓灥楔敭਩੻椉⁦䌨慯獲䍥畬瑳牥⹳畎⡭ 㴽〠 ⁻敲畴湲※੽䌉慯獲卥整獰⬫਻ऊ⼯汦捯⁫楷敤挠湥牴楯⁤湡⁤敨摡湩੧䘉敖瑣牯䘠潬正敃瑮潲摩㴠䘠敖瑣牯㨺敚潲敖瑣牯਻䘉敖瑣牯䘠潬正敖潬楣祴㴠䘠敖瑣牯㨺敚潲敖瑣牯਻昉牯⠠潣獮⁴䙆潬正潃牡敳汃獵整♲䌠畬瑳牥㨠䌠慯獲䍥畬瑳牥⥳ऊ੻उ汆捯䍫湥牴楯⁤㴫䌠畬瑳牥䌮湥牴楯⁤‪汃獵整⹲潃湵㭴ऊ䘉潬正敖潬楣祴⬠‽汃獵整⹲敖潬楣祴⨠䌠畬瑳牥䌮畯瑮਻紉ऊ汆捯䍫湥牴楯⁤㴯䘠慍桴㨺慍⡸畎䍭慯獲䉥楯獤‬⤱਻按湯瑳䘠敖瑣牯䘠潬正效摡湩⁧‽汆捯噫汥捯瑩⹹敇却晡乥牯慭⡬㬩ਊ昉牯⠠䙆潬正潃牡敳汃獵整♲䌠畬瑳牥㨠䌠慯獲䍥畬瑳牥⥳ऊ੻उ⼯畴湲挠畬瑳牥琠睯牡⁤桴⁥汦捯❫⁳敨摡湩⁧湡⁤散瑮潲摩‬湡⁤慢正栠浯⁥湯散椠⁴瑳慲獹琠潯映牡ऊ䘉敖瑣牯䠠慥楤杮㴠䌠畬瑳牥嘮汥捯瑩⹹敇却晡乥牯慭⡬ ‫汆捯䡫慥楤杮⨠䌠慯獲䅥楬湧敭瑮敗杩瑨਻उ晩⠠噆捥潴㩲䐺獩却畱牡摥䌨畬瑳牥䌮湥牴楯Ɽ䘠潬正敃瑮潲摩 ‾汃獵整⹲灓敲摡匮穩卥畱牡摥⤨਩उ੻उ䠉慥楤杮⬠‽䘨潬正敃瑮潲摩ⴠ䌠畬瑳牥䌮湥牴楯⥤䜮瑥慓敦潎浲污⤨⨠䌠慯獲䍥桯獥潩坮楥桧㭴ऊ紉ऊ椉⁦䌨慯獲䡥浯剥摡畩⁳‾⸰昰☠…噆捥潴㩲䐺獩却畱牡摥䌨畬瑳牥䌮湥牴楯Ɽ䜠瑥捁潴䱲捯瑡潩⡮⤩㸠䌠慯獲䡥浯剥摡畩⁳‪潃牡敳潈敭慒楤獵਩उ੻उ䠉慥楤杮⬠‽䜨瑥捁潴䱲捯瑡潩⡮ ‭汃獵整⹲敃瑮潲摩⸩敇却晡乥牯慭⡬㬩ऊ紉ਊउ汃獵整⹲敖潬楣祴㴠䠠慥楤杮䜮瑥慓敦潎浲污⤨⨠䘠慍桴㨺汃浡⡰汃獵整⹲敖潬楣祴匮穩⡥Ⱙ䴠湩灓敥Ɽ䴠硡灓敥⥤਻उ汃獵整⹲敃瑮潲摩⬠‽汃獵整⹲敖潬楣祴⨠匠整呰浩㭥ऊ੽੽瘊楯⁤䙁潬正慍慮敧㩲䄺摤潃牡敳潂摩吨畓换慬獳晏䄼潂摩‾潂摩祔数‬潣獮⁴呆慲獮潦浲…灓睡呮慲獮潦浲਩੻按湯瑳䘠敖瑣牯䰠捯瑡潩⁮‽灓睡呮慲獮潦浲䜮瑥潌慣楴湯⤨਻按湯瑳䘠敖瑣牯嘠汥捯瑩⁹‽灓睡呮慲獮潦浲䜮瑥潒慴楴湯⤨䜮瑥潆睲牡噤捥潴⡲ ‪䵆瑡㩨䘺慒摮慒杮⡥楍卮数摥‬慍卸数摥㬩ਊ⼉是湩⁤敮牡獥⁴汣獵整⁲景琠敨猠浡⁥潢摩琠灹੥䘉汆捯䍫慯獲䍥畬瑳牥‪敎牡獥⁴‽畮汬瑰㭲ऊ汦慯⁴敎牡獥䑴獩慴据卥畱牡摥㴠䴠塁䙟呌਻昉牯⠠䙆潬正潃牡敳汃獵整♲䌠畬瑳牥㨠䌠慯獲䍥畬瑳牥⥳ऊ੻उ潣獮⁴汦慯⁴楄瑳湡散煓慵敲⁤‽噆捥潴㩲䐺獩却畱牡摥䌨畬瑳牥䌮湥牴楯Ɽ䰠捯瑡潩⥮਻उ晩⠠汃獵整⹲潂摩祔数㴠‽潂摩祔数☠…楄瑳湡散煓慵敲⁤‼敎牡獥䑴獩慴据卥畱牡摥਩उ੻उ三慥敲瑳楄瑳湡散煓慵敲⁤‽楄瑳湡散煓慵敲㭤ऊउ敎牡獥⁴‽䌦畬瑳牥਻उ੽紉ਊ椉⁦丨慥敲瑳㴠‽畮汬瑰⥲ऊ੻उ䙆潬正潃牡敳汃獵整♲䌠畬瑳牥㴠䌠慯獲䍥畬瑳牥⹳摁䑤晥畡瑬摥䝟瑥敒⡦㬩ऊ䌉畬瑳牥䌮湥牴楯⁤‽潌慣楴湯਻उ汃獵整⹲敖潬楣祴㴠嘠汥捯瑩㭹ऊ䌉畬瑳牥䌮畯瑮㴠ㄠ਻उ汃獵整⹲潂摩祔数㴠䈠楯呤灹㭥ऊ੽攉獬੥笉ऊ⼉是汯⁤潢摩椠瑮⁯汣獵整❲⁳畲湮湩⁧敭湡愠摮猠牰慥⁤在汥潦摲猧甠摰瑡⁥景琠敨猠浵敭⁤煳慵敲⁤敤楶瑡潩獮਩उ潣獮⁴噆捥潴⁲煓慵敲䑤癥慩楴湯畓⁭‽敎牡獥⵴匾牰慥⁤‪敎牡獥⵴匾牰慥⁤‪敎牡獥⵴䌾畯瑮਻उ潣獮⁴噆捥潴⁲敄楶瑡潩⁮‽潌慣楴湯ⴠ丠慥敲瑳㸭敃瑮潲摩਻उ敎牡獥⵴䌾畯瑮⬫਻उ敎牡獥⵴䌾湥牴楯⁤㴫䐠癥慩楴湯⼠丠慥敲瑳㸭潃湵㭴ऊ三慥敲瑳㸭敖潬楣祴⬠‽嘨汥捯瑩⁹‭敎牡獥⵴嘾汥捯瑩⥹⼠丠慥敲瑳㸭潃湵㭴ऊ按湯瑳䘠敖瑣牯丠睥煓慵敲䑤癥慩楴湯畓⁭‽煓慵敲䑤癥慩楴湯畓⁭‫敄楶瑡潩⁮‪䰨捯瑡潩⁮‭敎牡獥⵴䌾湥牴楯⥤਻उ敎牡獥⵴匾牰慥⁤‽噆捥潴⡲䵆瑡㩨区牱⡴敎卷畱牡摥敄楶瑡潩卮浵堮⼠丠慥敲瑳㸭潃湵⥴‬䵆瑡㩨区牱⡴敎卷畱牡摥敄楶瑡潩卮浵央⼠丠慥敲瑳㸭潃湵⥴‬䵆瑡㩨区牱⡴敎卷畱牡摥敄楶瑡潩卮浵娮⼠丠慥敲瑳㸭潃湵⥴㬩ऊ੽三浵潃牡敳潂摩⭳㬫紊ਊ潶摩䄠汆捯䵫湡条牥㨺灕慤整敔敬敭牴⡹汦慯⁴敄瑬呡浩⥥笊ऊ晩⠠戡敔敬敭牴䍹灡畴敲 ⁻敲畴湲※੽ऊ敔敬敭牴⹹敒潣摲牆浡⡥慌瑳楓呭浩䵥⥳਻ऊ⼯畳浭牡獩⁥牦浡獥椠瑮⁯⁡慳灭敬ऊ敔敬敭牴卹浡汰呥浩⁥㴫䐠汥慴楔敭਻椉⁦吨汥浥瑥祲慓灭敬楔敭㸠‽敔敬敭牴卹浡汰䥥瑮牥慶⥬ऊ੻उ敔敬敭牴⹹敃汬楓敺㴠吠汥浥瑥祲敃汬楓敺਻उ敔敬敭牴⹹慔敫慓灭敬䜨瑥潗汲⡤⴩䜾瑥楔敭敓潣摮⡳Ⱙ䘠潬正瑓瑡⹥潐楳楴湯⥳਻उ敔敬敭牴卹浡汰呥浩⁥‽⸰昰਻紉ਊ⼉眯楲整猠浡汰獥琠⁯楦敬ऊ晩⠠敔敬敭牴䕹灸牯䥴瑮牥慶⁬‾⸰昰਩笉ऊ吉汥浥瑥祲硅潰瑲楔敭⬠‽敄瑬呡浩㭥ऊ椉⁦吨汥浥瑥祲硅潰瑲楔敭㸠‽敔敬敭牴䕹灸牯䥴瑮牥慶⥬ऊ笉ऊउ硅潰瑲汆捯呫汥浥瑥祲⤨਻उ吉汥浥瑥祲硅潰瑲楔敭㴠〠〮㭦ऊ紉ऊ੽ऊ晩⠠卢潨䑷湥楳祴效瑡慭⥰ऊ੻उ牄睡敄獮瑩䡹慥浴灡⤨਻紉紊ਊ潶摩䄠汆捯䵫湡条牥㨺牄睡敄獮瑩䡹慥浴灡⤨笊ऊ䱕湩䉥瑡档潃灭湯湥⩴䰠湩䉥瑡档牥㴠䜠瑥潗汲⡤⴩䰾湩䉥瑡档牥਻按湯瑳吠慍㱰䥆瑮敖瑣牯‬湩㍴㸲…敄獮瑩䝹楲⁤‽敔敬敭牴⹹敇䑴湥楳祴片摩⤨਻椉⁦䰨湩䉥瑡档牥㴠‽畮汬瑰⁲籼䐠湥楳祴片摩丮浵⤨㴠‽⤰笠爠瑥牵㭮素ਊ⼉振汯牯挠汥獬映潲⁭灳牡敳琠⁯桴⁥潭瑳挠潲摷摥挠汥⁬景琠敨猠浡汰੥吉牁慲㱹䉆瑡档摥楌敮‾楌敮㭳ऊ楌敮⹳敒敳癲⡥敄獮瑩䝹楲⹤畎⡭ ‪㈱㬩ऊ潣獮⁴汦慯⁴慍䑸湥楳祴㴠䘠慍桴㨺慍⡸敔敬敭牴⹹敇䵴硡敃汬敄獮瑩⡹Ⱙㄠ㬩ऊ潣獮⁴噆捥潴⁲硅整瑮吨汥浥瑥祲䌮汥卬穩⁥‪⸰昵㬩ऊ潦⁲挨湯瑳吠慐物䘼湉噴捥潴Ⱳ椠瑮㈳☾䌠汥⁬›敄獮瑩䝹楲⥤ऊ੻उ潣獮⁴噆捥潴⁲敃瑮牥㴠⠠噆捥潴⡲敃汬䬮祥 ‫噆捥潴⡲⸰昵⤩⨠吠汥浥瑥祲䌮汥卬穩㭥ऊ按湯瑳䘠潃潬⁲潃潬⁲‽䱆湩慥䍲汯牯㨺敌灲獕湩䡧噓䘨楌敮牡潃潬㩲䈺畬ⱥ䘠楌敮牡潃潬㩲刺摥‬敃汬嘮污敵⼠䴠硡敄獮瑩⥹吮䙯潃潬⡲牴敵㬩ऊ䄉摤敄畢䉧硯䰨湩獥‬敃瑮牥‬硅整瑮‬潃潬⥲਻紉ਊ䰉湩䉥瑡档牥㸭牄睡楌敮⡳楌敮⥳਻੽䘊瑓楲杮䄠汆捯䵫湡条牥㨺敇呴汥浥瑥祲楆敬慐桴⤨挠湯瑳笊ऊ敲畴湲䘠慐桴㩳䌺浯楢敮䘨慐桴㩳债潲敪瑣慓敶䑤物⤨‬䕔员∨汆捯呫汥浥瑥祲⤢‬敇乴浡⡥ ‫吨汥浥瑥祲潆浲瑡㴠‽䙅潬正敔敬敭牴䙹牯慭㩴䨺体⁎‿䕔员∨樮潳≮ ›䕔员∨挮癳⤢⤩਻੽瘊楯⁤䙁潬正慍慮敧㩲䔺灸牯䙴潬正敔敬敭牴⡹਩੻椉⁦吨汥浥瑥祲䜮瑥慓灭敬⡳⸩畎⡭ 㴽〠਩笉ऊ⼉氯杯眠牡楮杮琠⁯潣獮汯੥उ䕕䱟䝏䰨杯敔灭‬慗湲湩Ⱨ吠塅⡔刢煥敵瑳琠⁯硥潰瑲映潬正琠汥浥瑥祲眠瑩潨瑵爠捥牯敤⁤慳灭敬⁳杩潮敲⁤湩䘠潬正慍慮敧㩲┠⹳⤢‬䜪瑥慎敭⤨㬩ऊ爉瑥牵㭮ऊ੽ऊ潣獮⁴卆牴湩⁧楆敬慐桴㴠䜠瑥敔敬敭牴䙹汩健瑡⡨㬩ऊ潣獮⁴潢汯戠慓敶⁤‽敔敬敭牴䙹牯慭⁴㴽䔠汆捯呫汥浥瑥祲潆浲瑡㨺半乏㼠吠汥浥瑥祲䔮灸牯䩴体⡎楆敬慐桴 ›敔敬敭牴⹹硅潰瑲千⡖楆敬慐桴㬩ऊ晩⠠卢癡摥਩笉ऊ唉彅佌⡇潌呧浥Ɒ䰠杯‬䕔员∨汆捯⁫整敬敭牴⁹┨⁤慳灭敬⥳眠楲瑴湥琠⁯猥椠⁮汆捯䵫湡条牥›猥∮Ⱙ吠汥浥瑥祲䜮瑥慓灭敬⡳⸩畎⡭Ⱙ⨠楆敬慐桴‬䜪瑥慎敭⤨㬩ऊ੽攉獬੥笉ऊ⼉氯杯眠牡楮杮琠⁯潣獮汯੥उ䕕䱟䝏䰨杯敔灭‬慗湲湩Ⱨ吠塅⡔䘢楡敬⁤潴眠楲整映潬正琠汥浥瑥祲映汩⁥猥椠⁮汆捯䵫湡条牥›猥∮Ⱙ⨠楆敬慐桴‬䜪瑥慎敭⤨㬩ऊ੽੽瘊楯⁤䙁潬正慍慮敧㩲区瑥敔敬敭牴䕹慮汢摥戨潯⁬䕢慮汢摥਩੻戉敒潣摲敔敬敭牴⁹‽䕢慮汢摥਻吉汥浥瑥祲慓灭敬楔敭㴠〠〮㭦ऊ敔敬敭牴䕹灸牯呴浩⁥‽⸰昰਻੽瘊楯⁤䙁潬正慍慮敧㩲唺摰瑡䝥癯牥潮⡲汦慯⁴牆浡卥浩楔敭獍਩੻⼉猯潭瑯⁨楳畭慬楴湯琠浩⁥潳猠湩汧⁥牦浡⁥灳歩獥搠湯琧挠慨杮⁥畱污瑩੹匉浩楔敭獍㴠䘠慍桴㨺敌灲匨浩楔敭獍‬牆浡卥浩楔敭獍‬⸰昱㬩ਊ椉⁦ℨ䕢慮汢䝥癯牥潮⁲籼儠慵楬祴敌敶獬丮浵⤨㴠‽⤰笠爠瑥牵㭮素ਊ椉⁦匨浩楔敭獍㸠吠牡敧却浩楔敭獍☠…畑污瑩䱹癥汥㰠儠慵楬祴敌敶獬丮浵⤨ⴠㄠ਩笉ऊ⼉漯敶⁲畢杤瑥‬潬敷⁲畱污瑩⁹湯散椠⁴慨⁳慬瑳摥氠湯⁧湥畯桧ऊ䘉慲敭啳摮牥畂杤瑥㴠〠਻उ晩⠠⬫牆浡獥癏牥畂杤瑥㸠‽潇敶湲牯敓瑴敬牆浡獥਩उ੻उ匉瑥畑污瑩䱹癥汥儨慵楬祴敌敶⁬‫⤱਻उ੽紉ऊ汥敳椠⁦匨浩楔敭獍㰠吠牡敧却浩楔敭獍⨠唠杰慲敤桔敲桳汯⁤☦儠慵楬祴敌敶⁬‾⤰ऊ੻उ⼯敷汬甠摮牥戠摵敧ⱴ爠楡敳焠慵楬祴猠潬汷⁹潳椠⁴潤獥❮⁴獯楣汬瑡⁥敢睴敥⁮敬敶獬ऊ䘉慲敭佳敶䉲摵敧⁴‽㬰ऊ椉⁦⬨䘫慲敭啳摮牥畂杤瑥㸠‽潇敶湲牯敓瑴敬牆浡獥⨠㐠਩उ੻उ匉瑥畑污瑩䱹癥汥儨慵楬祴敌敶⁬‭⤱਻उ੽紉ऊ汥敳ऊ੻उ⼯湩楳敤栠獹整敲楳⁳慢摮‬敫灥挠牵敲瑮焠慵楬祴ऊ䘉慲敭佳敶䉲摵敧⁴‽㬰ऊ䘉慲敭啳摮牥畂杤瑥㴠〠਻紉紊ਊ潶摩䄠汆捯䵫湡条牥㨺敓兴慵楬祴敌敶⡬湩㍴′敎具慵楬祴敌敶⥬笊ऊ慗瑩潆卲浩汵瑡潩⡮㬩ਊ儉慵楬祴敌敶⁬‽畑污瑩䱹癥汥⹳畎⡭ ‾‰‿䵆瑡㩨䌺慬灭丨睥畑污瑩䱹癥汥‬ⰰ儠慵楬祴敌敶獬丮浵⤨ⴠㄠ ›㬰ऊ牆浡獥癏牥畂杤瑥㴠〠਻䘉慲敭啳摮牥畂杤瑥㴠〠਻䄉灰祬畑污瑩䱹癥汥⤨਻੽瘊楯⁤䙁潬正慍慮敧㩲区瑥潇敶湲牯湅扡敬⡤潢汯戠湅扡敬⥤笊ऊ䕢慮汢䝥癯牥潮⁲‽䕢慮汢摥਻ऊ⼯敲畴湲琠⁯畦汬焠慵楬祴眠敨⁮桴⁥潧敶湲牯椠⁳畴湲摥漠晦ऊ晩⠠戡湅扡敬潇敶湲牯਩笉ऊ匉瑥畑污瑩䱹癥汥〨㬩ऊ੽੽瘊楯⁤䙁潬正慍慮敧㩲䄺灰祬畑污瑩䱹癥汥⤨笊ऊ捁楴敶畑污瑩⁹‽畑污瑩䱹癥汥⹳獉慖楬䥤摮硥儨慵楬祴敌敶⥬㼠儠慵楬祴敌敶獬兛慵楬祴敌敶嵬㨠䘠汆捯八慵楬祴敌敶⡬㬩ऊ捁楴敶畑污瑩⹹瑓敥楲杮瑓楲敤㴠䘠慍桴㨺慍⡸捁楴敶畑污瑩⹹瑓敥楲杮瑓楲敤‬⤱਻ऊ⼯污慷獹欠敥⁰瑡氠慥瑳漠敮猠湥潳⁲桷湥琠敨敲愠敲猠湥潳獲琠⁯獵੥䄉瑣癩卥湥潳䍲畯瑮㴠䘠慍桴㨺汃浡⡰䵆瑡㩨䌺楥呬䥯瑮䄨潶摩湡散敓獮牯⹳畎⡭ ‪捁楴敶畑污瑩⹹敓獮牯牆捡楴湯Ⱙ䘠慍桴㨺楍⡮癁楯慤据卥湥潳獲丮浵⤨‬⤱‬癁楯慤据卥湥潳獲丮浵⤨㬩紊ਊ潢汯䄠汆捯䵫湡条牥㨺獉慗浲瑓牡整⡤਩੻爉瑥牵⁮潌摡慗浲瑓牡却慮獰潨⡴ 㴡渠汵灬牴਻੽唊汆捯卫慮獰潨䅴獳瑥‪䙁潬正慍慮敧㩲䰺慯坤牡卭慴瑲湓灡桳瑯⤨笊ऊ晩⠠戡慗浲瑓牡䙴潲卭慮獰潨⥴笠爠瑥牵⁮畮汬瑰㭲素ਊ⼉猯慰湷牥⁳慣⁮獡⁫敢潦敲琠敨洠湡条牥戠来湩⁳汰祡‬桴⁥湳灡桳瑯椠⁳湯祬氠慯敤⁤湯散ऊ晩⠠坢牡卭慴瑲潌摡摥 ⁻敲畴湲圠牡卭慴瑲湓灡桳瑯※੽戉慗浲瑓牡䱴慯敤⁤‽牴敵਻ऊ⼯湳灡桳瑯愠獳瑥椠⁳獵摥戠晥牯⁥湳灡桳瑯映汩੥唉汆捯卫慮獰潨䅴獳瑥‪湓灡桳瑯㴠䘠潬正湓灡桳瑯਻椉⁦ℨ湓灡桳瑯਩笉ऊ匉慮獰潨⁴‽敎佷橢捥㱴䙕潬正湓灡桳瑯獁敳㹴琨楨⥳਻उ晩⠠匡慮獰潨⵴䰾慯䙤潲䙭汩⡥敇却慮獰潨䙴汩健瑡⡨⤩਩उ੻उ⼉氯杯眠牡楮杮琠⁯潣獮汯੥उ唉彅佌⡇潌呧浥Ɒ圠牡楮杮‬䕔员∨慆汩摥琠⁯潬摡映潬正猠慮獰潨⁴楦敬┠ⱳ猠慰湷湩⁧汦捯⁫湩瑳慥⁤湩䘠潬正慍慮敧㩲┠⹳⤢‬䜪瑥湓灡桳瑯楆敬慐桴⤨‬䜪瑥慎敭⤨㬩ऊउ敲畴湲渠汵灬牴਻उ੽紉ऊ晩⠠湓灡桳瑯㸭潂摩祔数㴠‽畮汬瑰⁲籼匠慮獰潨⵴䜾瑥畎䉭楯獤⤨㴠‽⤰ऊ੻उ⼯潬⁧慷湲湩⁧潴挠湯潳敬ऊ唉彅佌⡇潌呧浥Ɒ圠牡楮杮‬䕔员∨汆捯⁫湳灡桳瑯┠⁳慨⁳潮戠楯獤琠⁯敲瑳牯ⱥ猠慰湷湩⁧汦捯⁫湩瑳慥⁤湩䘠潬正慍慮敧㩲┠⹳⤢‬匪慮獰潨⵴䜾瑥慎敭⤨‬䜪瑥慎敭⤨㬩ऊ爉瑥牵⁮畮汬瑰㭲ऊ੽ऊ慗浲瑓牡却慮獰潨⁴‽湓灡桳瑯਻爉瑥牵⁮慗浲瑓牡却慮獰潨㭴紊ਊ卆牴湩⁧䙁潬正慍慮敧㩲䜺瑥湓灡桳瑯楆敬慐桴⤨挠湯瑳笊ऊ⼯敤慦汵⁴潴漠敮映汩⁥数⁲汦捯⁫慭慮敧ੲ䘉瑓楲杮䘠汩健瑡⁨‽湓灡桳瑯楆敬䤮䕳灭祴⤨㼠䜠瑥慎敭⤨⬠吠塅⡔⸢汦捯≫ ›湓灡桳瑯楆敬਻椉⁦䘨慐桴㩳䤺剳汥瑡癩⡥楆敬慐桴⤩ऊ੻उ楆敬慐桴㴠䘠慐桴㩳䌺浯楢敮䘨慐桴㩳债潲敪瑣慓敶䑤物⤨‬䕔员∨汆捯卫慮獰潨獴⤢‬楆敬慐桴㬩ऊ੽爉瑥牵⁮楆敬慐桴਻੽瘊楯⁤䙁潬正慍慮敧㩲䌺灡畴敲汆捯卫慮獰潨⡴਩੻⼉是潬正猠慴整漠汮⁹硥獩獴眠楨敬瀠慬楹杮ऊ晩⠠䠡獡捁潴䉲来湵汐祡⤨਩笉ऊ⼉氯杯眠牡楮杮琠⁯潣獮汯੥उ䕕䱟䝏䰨杯敔灭‬慗湲湩Ⱨ吠塅⡔刢煥敵瑳琠⁯慣瑰牵⁥汦捯⁫湳灡桳瑯漠瑵楳敤漠⁦汰祡椠湧牯摥椠⁮汆捯䵫湡条牥›猥∮Ⱙ⨠敇乴浡⡥⤩਻उ敲畴湲਻紉ਊ⼉振灡畴敲琠敨猠慴整漠⁦桴⁥慬瑳映湩獩敨⁤楳畭慬楴湯猠整ੰ圉楡䙴牯楓畭慬楴湯⤨਻ऊ⼯慣瑰牵⁥湩潴猠慮獰潨⁴獡敳⁴晩琠敨敲椠⁳湯ⱥ漠桴牥楷敳椠瑮⁯⁡整灭牯牡⁹湳灡桳瑯琠慨⁴獩漠汮⁹慳敶⁤潴映汩੥唉汆捯卫慮獰潨䅴獳瑥‪湓灡桳瑯㴠䘠潬正湓灡桳瑯㼠䘠潬正湓灡桳瑯㨠丠睥扏敪瑣唼汆捯卫慮獰潨䅴獳瑥⠾桴獩㬩ਊ⼉是潬正猠瑥楴杮ੳ匉慮獰潨⵴倾牡浡瑥牥⹳慍卸数摥㴠䴠硡灓敥㭤ऊ湓灡桳瑯㸭慐慲敭整獲䴮湩灓敥⁤‽楍卮数摥਻匉慮獰潨⵴倾牡浡瑥牥⹳汁杩浮湥却牴湥瑧⁨‽汁杩浮湥却牴湥瑧㭨ऊ湓灡桳瑯㸭慐慲敭整獲匮灥牡瑡潩卮牴湥瑧⁨‽敓慰慲楴湯瑓敲杮桴਻匉慮獰潨⵴倾牡浡瑥牥⹳潃敨楳湯瑓敲杮桴㴠䌠桯獥潩卮牴湥瑧㭨ऊ湓灡桳瑯㸭慐慲敭整獲䄮潶摩湡散瑓敲杮桴㴠䄠潶摩湡散瑓敲杮桴਻匉慮獰潨⵴倾牡浡瑥牥⹳敓慰慲楴湯但⁖‽敓慰慲楴湯但㭖ऊ湓灡桳瑯㸭慐慲敭整獲䄮楬湧敭瑮但⁖‽汁杩浮湥䙴噏਻匉慮獰潨⵴倾牡浡瑥牥⹳潃敨楳湯但⁖‽潃敨楳湯但㭖ਊ⼉戯楯⁤瑳瑡੥匉慮獰潨⵴倾獯瑩潩獮㴠䘠潬正瑓瑡⹥潐楳楴湯㭳ऊ湓灡桳瑯㸭敖潬楣楴獥㴠䘠潬正瑓瑡⹥敖潬楣楴獥਻匉慮獰潨⵴䴾獥剨瑯瑡潩獮匮瑥畎啭楮楮楴污穩摥䘨潬正瑓瑡⹥畎⡭⤩਻昉牯⠠湩㍴′⁩‽㬰椠㰠䘠潬正瑓瑡⹥畎⡭㬩⬠椫਩笉ऊ匉慮獰潨⵴䴾獥剨瑯瑡潩獮楛⁝‽汆捯卫慴整䴮獥剨瑯瑡潩獮楛㭝ऊ੽ऊ⼯敲瑳牯摥映潬正甠敳⁳桴⁥祴数漠⁦桴⁥楦獲⁴潢摩映畯摮ऊ潦⁲䄨潂摩‪潂摩㨠䘠潬正瑓瑡⹥潂摩⥳ऊ੻उ晩⠠潂摩਩उ੻उ匉慮獰潨⵴䈾楯呤灹⁥‽潂摩㸭敇䍴慬獳⤨਻उ戉敲歡਻उ੽紉ਊ⼉洯牡⁫獡敳⁴獡洠摯晩敩⁤潳椠⁴慣⁮敢猠癡摥映潲⁭桴⁥摥瑩牯漠据⁥汰祡攠摮ੳ椉⁦䘨潬正湓灡桳瑯਩笉ऊ䘉潬正湓灡桳瑯㸭慍歲慐正条䑥物祴⤨਻उ䕕䱟䝏䰨杯敔灭‬潌Ⱨ吠塅⡔䌢灡畴敲⁤搥戠楯獤椠瑮⁯汦捯⁫湳灡桳瑯┠⁳湩䘠潬正慍慮敧㩲┠⹳⤢‬湓灡桳瑯㸭敇乴浵潂摩⡳Ⱙ⨠汆捯卫慮獰潨⵴䜾瑥慎敭⤨‬䜪瑥慎敭⤨㬩ऊ੽ऊ⼯污慷獹眠楲整猠慮獰潨⁴楦敬‬敨摡敬獳爠湵⁳慨敶渠⁯摥瑩牯琠⁯慳敶琠敨愠獳瑥ऊ潣獮⁴卆牴湩⁧楆敬慐桴㴠䜠瑥湓灡桳瑯楆敬慐桴⤨਻椉⁦匨慮獰潨⵴匾癡呥䙯汩⡥楆敬慐桴⤩ऊ੻उ䕕䱟䝏䰨杯敔灭‬潌Ⱨ吠塅⡔䌢灡畴敲⁤搥戠楯獤椠瑮⁯汦捯⁫湳灡桳瑯映汩⁥猥椠⁮汆捯䵫湡条牥›猥∮Ⱙ匠慮獰潨⵴䜾瑥畎䉭楯獤⤨‬䘪汩健瑡ⱨ⨠敇乴浡⡥⤩਻紉ऊ汥敳ऊ੻उ⼯潬⁧慷湲湩⁧潴挠湯潳敬ऊ唉彅佌⡇潌呧浥Ɒ圠牡楮杮‬䕔员∨慆汩摥琠⁯牷瑩⁥汦捯⁫湳灡桳瑯映汩⁥猥椠⁮汆捯䵫湡条牥›猥∮Ⱙ⨠楆敬慐桴‬䜪瑥慎敭⤨㬩ऊ੽ऊ⼯敨摡敬獳挠灡畴敲爠湵⁳慣⁮硥瑩漠据⁥桴⁥湳灡桳瑯椠⁳牷瑩整੮椉⁦䘨慐獲㩥债牡浡䘨潃浭湡䱤湩㩥䜺瑥⤨‬䕔员∨汆捯卫慮獰潨䕴楸≴⤩਩笉ऊ䘉汐瑡潦浲楍捳㨺敒畱獥䕴楸⡴慦獬⥥਻紉紊ਊ潶摩䄠汆捯䵫湡条牥㨺敒瑳牯䙥潬正湓灡桳瑯唨汆捯卫慮獰潨䅴獳瑥‪湓灡桳瑯਩੻椉⁦匨慮獰潨⵴䈾楯呤灹⁥㴽渠汵灬牴簠⁼湓灡桳瑯㸭敇乴浵潂摩⡳ 㴽〠਩笉ऊ⼉氯杯眠牡楮杮琠⁯潣獮汯੥उ䕕䱟䝏䰨杯敔灭‬慗湲湩Ⱨ吠塅⡔䘢潬正猠慮獰潨⁴猥栠獡渠⁯潢摩⁳潴爠獥潴敲椠⁮汆捯䵫湡条牥›猥∮Ⱙ⨠湓灡桳瑯㸭敇乴浡⡥Ⱙ⨠敇乴浡⡥⤩਻उ敲畴湲਻紉ਊ⼉甯敳琠敨映潬正猠瑥楴杮⁳桴⁥湳灡桳瑯眠獡挠灡畴敲⁤楷桴ऊ慍卸数摥㴠匠慮獰潨⵴倾牡浡瑥牥⹳慍卸数摥਻䴉湩灓敥⁤‽湓灡桳瑯㸭慐慲敭整獲䴮湩灓敥㭤ऊ汁杩浮湥却牴湥瑧⁨‽湓灡桳瑯㸭慐慲敭整獲䄮楬湧敭瑮瑓敲杮桴਻匉灥牡瑡潩卮牴湥瑧⁨‽湓灡桳瑯㸭慐慲敭整獲匮灥牡瑡潩卮牴湥瑧㭨ऊ潃敨楳湯瑓敲杮桴㴠匠慮獰潨⵴倾牡浡瑥牥⹳潃敨楳湯瑓敲杮桴਻䄉潶摩湡散瑓敲杮桴㴠匠慮獰潨⵴倾牡浡瑥牥⹳癁楯慤据卥牴湥瑧㭨ऊ敓慰慲楴湯但⁖‽湓灡桳瑯㸭慐慲敭整獲匮灥牡瑡潩䙮噏਻䄉楬湧敭瑮但⁖‽湓灡桳瑯㸭慐慲敭整獲䄮楬湧敭瑮但㭖ऊ潃敨楳湯但⁖‽湓灡桳瑯㸭慐慲敭整獲䌮桯獥潩䙮噏਻ऊ⼯敲瑳牯⁥瑳瑡⁥景琠敨眠潨敬映潬正愠⁴湯散猠⁯瑩椠⁳楳畭慬整⁤牦浯琠敨映物瑳映慲敭ਬ⼉戯楯⁤捡潴獲愠敲愠瑴捡敨⁤潴椠⁴祢琠敨猠慰湷焠敵敵眠瑩楨⁮桴⁥灳睡⁮畢杤瑥ऊ潣獮⁴湩㍴′畎䉭楯獤㴠匠慮獰潨⵴䜾瑥畎䉭楯獤⤨਻䘉潬正瑓瑡⹥敒敳癲⡥汆捯卫慴整丮浵⤨⬠丠浵潂摩⥳਻匉慰湷畑略⹥敒敳癲⡥灓睡兮敵敵丮浵⤨⬠丠浵潂摩⥳਻昉牯⠠湩㍴′⁩‽㬰椠㰠丠浵潂摩㭳⬠椫਩笉ऊ䘉潂摩灓睡剮煥敵瑳匠慰湷敒畱獥㭴ऊ匉慰湷敒畱獥⹴潂摩祔数㴠匠慮獰潨⵴䈾楯呤灹㭥ऊ匉慰湷敒畱獥⹴汆捯䡫湡汤⁥‽汆捯卫慴整䄮摤渨汵灬牴‬湓灡桳瑯㸭潐楳楴湯孳嵩‬湓灡桳瑯㸭敖潬楣楴獥楛ⱝ匠慮獰潨⵴䴾獥剨瑯瑡潩獮楛⥝਻उ灓睡兮敵敵䄮摤匨慰湷敒畱獥⥴਻紉ਊ⼉瀯牥散癩⁥汦捯浫瑡獥眠瑩⁨桴⁥敤慦汵⁴潢摩猧猠湥潳⁲湵楴⁬捡潴獲愠敲猠慰湷摥ऊ敐捲灥楴湯慒楤獵㴠䘠慍桴㨺慍⡸敐捲灥楴湯慒楤獵‬湓灡桳瑯㸭潂摩祔数㸭敇䑴晥畡瑬扏敪瑣䄼潂摩⠾⴩䜾瑥敐捲灥楴湯慒楤獵⤨㬩紊ਊ潶摩䄠汆捯䵫湡条牥㨺敇䱴晩瑥浩剥灥楬慣整偤潲獰吨牁慲㱹䱆晩瑥浩健潲数瑲㹹…畏䱴晩瑥浩健潲獰 潣獮ੴ੻匉灵牥㨺敇䱴晩瑥浩剥灥楬慣整偤潲獰伨瑵楌敦楴敭牐灯⥳਻ऊ佄䕒䱐䙉呅䵉⡅䙁潬正慍慮敧Ⱳ删灥楬慣整䉤楯呤灹⥥਻੽瘊楯⁤䙁潬正慍慮敧㩲区湥䙤潬正湓灡桳瑯⤨笊ऊ⼯潦杲瑥爠汥祡⁳景瀠慬敹⁲潣瑮潲汬牥⁳桴瑡栠癡⁥敬瑦ऊ潦⁲愨瑵⁯瑉㴠䘠潬正敒慬獹䌮敲瑡䥥整慲潴⡲㬩䤠㭴⬠䤫⥴ऊ੻उ晩⠠䤡噳污摩䤨⹴敋⡹⤩簠⁼䤡噳污摩䤨⹴慖畬⡥⤩਩उ੻उ䤉⹴敒潭敶畃牲湥⡴㬩ऊ紉ऊ੽ऊ潣獮⁴湩㍴′畎䉭楯獤㴠䘠潬正瑓瑡⹥畎⡭㬩ऊ晩⠠畎䉭楯獤㴠‽⤰笠爠瑥牵㭮素ਊ⼉术瑡敨⁲潢摩⁳潳瑲摥戠⁹慨摮敬‬慥档挠楬湥❴⁳潢摩⁳牡⁥楰正摥映潲⁭桴獩椠⁮牯敤⁲潳琠敨⁹瑳祡猠牯整੤三瑥潂摩⹳敓乴浵湕湩瑩慩楬敺⡤畎䉭楯獤㬩ऊ潦⁲椨瑮㈳椠㴠〠※⁩‼畎䉭楯獤※⬫⥩ऊ੻उ敎䉴楯獤楛⹝慈摮敬㴠䘠潬正瑓瑡⹥慈摮敬孳嵩਻उ敎䉴楯獤楛⹝潐楳楴湯㴠䘠潬正瑓瑡⹥潐楳楴湯孳嵩਻उ敎䉴楯獤楛⹝敖潬楣祴㴠䘠潬正瑓瑡⹥敖潬楣楴獥楛㭝ऊ੽三瑥潂摩⹳潓瑲嬨⡝潣獮⁴䙆潬正敎䉴楯♤䄠‬潣獮⁴䙆潬正敎䉴楯♤䈠 ⁻敲畴湲䄠䠮湡汤⁥‼⹂慈摮敬※⥽਻ऊ⼯敳摮攠捡⁨敲潭整挠楬湥⁴桴⁥慰瑲漠⁦桴⁥汦捯⁫瑩渠敥獤⠠楬瑳湥猠牥敶❲⁳睯⁮汰祡牥猠敥⁳桴⁥敲污映潬正਩昉牯⠠䍆湯瑳汐祡牥潃瑮潲汬牥瑉牥瑡牯䤠整慲潴⁲‽敇坴牯摬⤨㸭敇側慬敹䍲湯牴汯敬䥲整慲潴⡲㬩䤠整慲潴㭲⬠䤫整慲潴⥲ऊ੻उ偁慬敹䍲湯牴汯敬⩲倠慬敹䍲湯牴汯敬⁲‽瑉牥瑡牯㸭敇⡴㬩ऊ椉⁦倨慬敹䍲湯牴汯敬⁲☦℠汐祡牥潃瑮潲汬牥㸭獉潌慣䍬湯牴汯敬⡲ ☦倠慬敹䍲湯牴汯敬⵲䜾瑥敎䍴湯敮瑣潩⡮⤩ऊ笉ऊउ敓摮湓灡桳瑯潔敒慬⡹敇䙴潬正敒慬⡹汐祡牥潃瑮潲汬牥Ⱙ倠慬敹䍲湯牴汯敬⥲਻उ੽紉紊ਊ䙕潬正敒慬䍹浯潰敮瑮‪䙁潬正慍慮敧㩲䜺瑥汆捯剫汥祡䄨汐祡牥潃瑮潲汬牥‪汐祡牥潃瑮潲汬牥਩੻椉⁦唨汆捯剫汥祡潃灭湯湥⩴‪敒慬⁹‽汆捯剫汥祡⹳楆摮倨慬敹䍲湯牴汯敬⥲਩笉ऊ爉瑥牵⁮刪汥祡਻紉ਊ⼉爯汥祡椠⁳睯敮⁤祢琠敨瀠慬敹⁲潣瑮潲汬牥猠⁯瑩⁳汣敩瑮删䍐⁳湯祬朠⁯潴琠慨⁴潣湮捥楴湯ऊ䙕潬正敒慬䍹浯潰敮瑮‪敎剷汥祡㴠丠睥扏敪瑣唼汆捯剫汥祡潃灭湯湥㹴倨慬敹䍲湯牴汯敬⥲਻三睥敒慬⵹䘾潬正慍慮敧⁲‽桴獩਻三睥敒慬⵹刾来獩整䍲浯潰敮瑮⤨਻䘉潬正敒慬獹䄮摤倨慬敹䍲湯牴汯敬Ⱳ丠睥敒慬⥹਻爉瑥牵⁮敎剷汥祡਻੽瘊楯⁤䙁潬正慍慮敧㩲区湥卤慮獰潨呴副汥祡唨汆捯剫汥祡潃灭湯湥⩴删汥祡‬偁慬敹䍲湯牴汯敬⩲倠慬敹䍲湯牴汯敬⥲笊ऊ⼯歳灩挠楬湥獴眠潨敳挠湯敮瑣潩⁮獩愠牬慥祤猠瑡牵瑡摥‬汦捯⁫湳灡桳瑯⁳敮敶⁲潨摬甠⁰慧敭汰祡琠慲晦捩ऊ乕瑥潃湮捥楴湯‪潃湮捥楴湯㴠倠慬敹䍲湯牴汯敬⵲䜾瑥敎䍴湯敮瑣潩⡮㬩ऊ晩⠠䌡湯敮瑣潩⵮䤾乳瑥敒摡⡹慦獬⥥ ⁻敲畴湲※੽ऊ⼯灳楬⁴桴獩猠慮獰潨❴⁳祢整戠摵敧⁴敢睴敥⁮湩楤楶畤污戠楯獤愠摮挠畬瑳牥猠浵慭楲獥ऊ汦慯⁴祂整偳牥敓潣摮㴠䌠湯敮瑣潩⵮䌾牵敲瑮敎却数摥⨠䴠硡敎却数摥牆捡楴湯਻椉⁦䴨硡祂整偳牥敓潣摮㸠〠਩笉ऊ䈉瑹獥敐卲捥湯⁤‽䵆瑡㩨䴺湩䈨瑹獥敐卲捥湯Ɽ映潬瑡䴨硡祂整偳牥敓潣摮⤩਻紉ऊ潣獮⁴汦慯⁴湓灡桳瑯畂杤瑥㴠䈠瑹獥敐卲捥湯⁤ 湓灡桳瑯慒整਻按湯瑳椠瑮㈳䴠硡湉楤楶畤污潂摩⁳‽䵆瑡㩨䘺潬牯潔湉⡴湓灡桳瑯畂杤瑥⨠⠠⸱昰ⴠ䌠畬瑳牥畂杤瑥牆捡楴湯⤩⼠䔠瑳浩瑡摥祂整偳牥潂摩਻按湯瑳椠瑮㈳䴠硡汃獵整獲㴠䘠慍桴㨺汆潯呲䥯瑮匨慮獰潨䉴摵敧⁴‪汃獵整䉲摵敧䙴慲瑣潩⥮⼠䔠瑳浩瑡摥祂整偳牥汃獵整㭲ਊ⼉术瑥挠楬湥❴⁳楶睥‬桴⁥楶睥挠湯⁥獩眠摩湥摥猠⁯瑩挠癯牥⁳桴⁥潣湲牥⁳景琠敨猠牣敥⁮湡⁤潢摩⁳潤❮⁴潰⁰湩愠⁴瑩⁳摥敧ੳ䘉敖瑣牯嘠敩䱷捯瑡潩㭮ऊ剆瑯瑡牯嘠敩剷瑯瑡潩㭮ऊ汐祡牥潃瑮潲汬牥㸭敇側慬敹噲敩偷楯瑮嘨敩䱷捯瑡潩Ɱ嘠敩剷瑯瑡潩⥮਻按湯瑳䘠敖瑣牯嘠敩䑷物捥楴湯㴠嘠敩剷瑯瑡潩⹮敖瑣牯⤨਻按湯瑳映潬瑡䠠污䙦噏㴠倠慬敹䍲湯牴汯敬⵲倾慬敹䍲浡牥䵡湡条牥㼠倠慬敹䍲湯牴汯敬⵲倾慬敹䍲浡牥䵡湡条牥㸭敇䙴噏湁汧⡥ ‪⸰昵㨠㐠⸵昰਻按湯瑳映潬瑡䌠獯慈晬但⁖‽䵆瑡㩨䌺獯䘨慍桴㨺敄牧敥味副摡慩獮䘨慍桴㨺楍⡮慈晬但⁖‪⸱昳⬠ㄠ⸰昰‬㠱⸰昰⤩㬩ਊ按湯瑳映潬瑡䘠汵剬瑡䑥獩慴据卥畱牡摥㴠䘠汵剬瑡䑥獩慴据⁥‪畆汬慒整楄瑳湡散਻按湯瑳映潬瑡删摥捵摥慒整楄瑳湡散煓慵敲⁤‽敒畤散剤瑡䑥獩慴据⁥‪敒畤散剤瑡䑥獩慴据㭥ऊ潣獮⁴極瑮㈳匠慮獰潨䍴畯瑮㴠删汥祡㸭湓灡桳瑯潃湵⭴㬫ਊ⼉猯牯⁴潢摩⁳湩潴映汵⁬慲整‬敲畤散⁤慲整愠摮挠畬瑳牥摥戠⁹楤瑳湡散愠摮瘠敩੷倉楲牯瑩穩摥潂摩⹳敒敳⡴㬩ऊ汃獵整敲䉤楯獤刮獥瑥⤨਻昉牯⠠湩㍴′⁩‽㬰椠㰠丠瑥潂摩⹳畎⡭㬩⬠椫਩笉ऊ按湯瑳䘠汆捯乫瑥潂摩…敎䉴楯⁤‽敎䉴楯獤楛㭝ऊ䘉敖瑣牯吠䉯楯⁤‽敎䉴楯⹤潐楳楴湯ⴠ嘠敩䱷捯瑡潩㭮ऊ昉潬瑡䐠獩慴据卥畱牡摥㴠吠䉯楯⹤楓敺煓慵敲⡤㬩ऊ椉⁦䐨獩慴据卥畱牡摥㰠‽畆汬慒整楄瑳湡散煓慵敲⥤ऊ笉ऊउ牐潩楲楴敺䉤楯獤䄮摤吨慐物昼潬瑡‬湩㍴㸲䐨獩慴据卥畱牡摥‬⥩㬩ऊ紉ऊ攉獬⁥晩⠠楄瑳湡散煓慵敲⁤㴼删摥捵摥慒整楄瑳湡散煓慵敲⁤☦䘠敖瑣牯㨺潄側潲畤瑣吨䉯楯Ɽ嘠敩䑷物捥楴湯 㴾䌠獯慈晬但⁖‪䵆瑡㩨区牱⡴楄瑳湡散煓慵敲⥤਩उ੻उ⼉猯慴杧牥爠摥捵摥爠瑡⁥潢摩⁳祢栠湡汤⁥潳攠捡⁨湳灡桳瑯猠湥獤愠⁮癥湥猠慨敲漠⁦桴浥ऊउ晩⠠用湩㍴⠲敎䉴楯⹤慈摮敬 ‫湓灡桳瑯潃湵⥴┠甠湩㍴⠲䵆瑡㩨䴺硡刨摥捵摥慒整楄楶潳Ⱳㄠ⤩㴠‽⤰ऊउ੻उउ牐潩楲楴敺䉤楯獤䄮摤吨慐物昼潬瑡‬湩㍴㸲䐨獩慴据卥畱牡摥‬⥩㬩ऊउ੽उ੽उ汥敳ऊ笉ऊउ汃獵整敲䉤楯獤䄮摤椨㬩ऊ紉ऊ੽ऊ⼯汣獯獥⁴潢摩⁳楷⁮桷湥琠敨敲愠敲洠牯⁥桴湡琠敨戠摵敧⁴污潬獷‬桴⁥敲瑳愠敲猠浵慭楲敳⁤湩挠畬瑳牥ੳ椉⁦倨楲牯瑩穩摥潂摩⹳畎⡭ ‾慍䥸摮癩摩慵䉬楯獤਩笉ऊ倉楲牯瑩穩摥潂摩⹳潓瑲嬨⡝潣獮⁴偔楡㱲汦慯ⱴ椠瑮㈳☾䄠‬潣獮⁴偔楡㱲汦慯ⱴ椠瑮㈳☾䈠 ⁻敲畴湲䄠䬮祥㰠䈠䬮祥※⥽਻उ潦⁲椨瑮㈳椠㴠䴠硡湉楤楶畤污潂摩㭳椠㰠倠楲牯瑩穩摥潂摩⹳畎⡭㬩⬠椫਩उ੻उ䌉畬瑳牥摥潂摩⹳摁⡤牐潩楲楴敺䉤楯獤楛⹝慖畬⥥਻उ੽उ牐潩楲楴敺䉤楯獤匮瑥畎⡭慍䥸摮癩摩慵䉬楯獤‬慦獬⥥਻ऊ⼉戯捡⁫湩潴栠湡汤⁥牯敤ੲउ牐潩楲楴敺䉤楯獤匮牯⡴嵛挨湯瑳吠慐物昼潬瑡‬湩㍴㸲…ⱁ挠湯瑳吠慐物昼潬瑡‬湩㍴㸲…⥂笠爠瑥牵⁮⹁慖畬⁥‼⹂慖畬㭥素㬩ऊ੽ऊ⼯敳摮椠摮癩摩慵⁬潢摩ੳ䌉湯敮瑣潩䉮楯獤刮獥瑥⤨਻昉牯⠠潣獮⁴偔楡㱲汦慯ⱴ椠瑮㈳☾倠楲牯瑩穩摥潂摩㨠倠楲牯瑩穩摥潂摩⥳ऊ੻उ潃湮捥楴湯潂摩⹳摁⡤敎䉴楯獤偛楲牯瑩穩摥潂摩嘮污敵⥝਻紉ऊ晩⠠潃湮捥楴湯潂摩⹳畎⡭ ‾⤰ऊ੻उ⼯瑳牡⁴⁡敮⁷敫晹慲敭攠敶祲䬠祥牦浡䥥瑮牥慶⁬湳灡桳瑯ⱳ挠湥整敲⁤湯琠敨瘠敩⁷桷牥⁥桴⁥潢摩⁳牡⁥敤獮獥ੴउ潣獮⁴潢汯戠敋晹慲敭㴠删汥祡㸭湓灡桳瑯即湩散敋晹慲敭㴠‽㬰ऊ椉⁦戨敋晹慲敭਩उ੻उ刉汥祡㸭敎䍴摯捥倮獯瑩潩偮敲楣楳湯㴠倠獯瑩潩偮敲楣楳湯਻उ刉汥祡㸭敎䍴摯捥䈮来湩敋晹慲敭嘨敩䱷捯瑡潩⥮਻उ੽उ敒慬⵹匾慮獰潨獴楓据䭥祥牦浡⁥‽刨汥祡㸭湓灡桳瑯即湩散敋晹慲敭⬠ㄠ ‥䵆瑡㩨䴺硡䬨祥牦浡䥥瑮牥慶ⱬㄠ㬩ਊउ⼯慰正瑥⁳牡⁥畣⁴祢攠据摯摥猠穩⁥獡眠汥⁬獡戠楯⁤潣湵ⱴ欠敥楰杮攠捡⁨湯⁥湵敤⁲桴⁥偒⁃牡慲⁹楬業ੴउ潣獮⁴湩㍴′潂摩偳牥慐正瑥㴠䘠慍桴㨺汃浡⡰慍䉸楯獤敐偲捡敫ⱴㄠ‬汆捯乫瑥慍偸捡敫䉴瑹獥⼠㜠㬩ऊ昉牯⠠湩㍴′楆獲䉴楯⁤‽㬰䘠物瑳潂摩㰠䌠湯敮瑣潩䉮楯獤丮浵⤨⤻ऊ笉ऊउ楆獲䉴楯⁤㴫删汥祡㸭敎䍴摯捥䔮据摯健捡敫⡴潃湮捥楴湯潂摩ⱳ䘠物瑳潂摩‬潂摩偳牥慐正瑥‬䭢祥牦浡ⱥ䴠湩灓敥Ɽ䴠硡灓敥Ɽ丠瑥慐正瑥㬩ऊउ晩⠠䭢祥牦浡⥥ऊउ੻उउ敒慬⵹䌾楬湥剴捥楥敶汆捯䭫祥牦浡⡥桴獩‬敎側捡敫⥴਻उ紉ऊउ汥敳ऊउ੻उउ敒慬⵹䌾楬湥剴捥楥敶汆捯䑫汥慴琨楨ⱳ丠瑥慐正瑥㬩ऊउ੽उ刉灥楬慣楴湯祂整⁳㴫丠瑥慐正瑥丮浵⤨਻उ੽紉ਊ⼉猯湥⁤桴⁥敲瑳漠⁦桴⁥汦捯⁫獡挠畬瑳牥猠浵慭楲獥ऊ晩⠠汃獵整敲䉤楯獤丮浵⤨㸠〠☠…慍䍸畬瑳牥⁳‾⤰ऊ੻उ⼯畳⁭汣獵整敲⁤潢摩⁳数⁲牧摩挠汥੬उ敎䍴畬瑳牥⹳敒敳⡴㬩ऊ䌉畬瑳牥敃汬⹳敒敳⡴㬩ऊ昉牯⠠湩㍴′潂摩湉敤⁸›汃獵整敲䉤楯獤਩उ੻उ䄉摤潔敎䍴畬瑳牥丨瑥潂摩孳潂摩湉敤嵸倮獯瑩潩Ɱ丠瑥潂摩孳潂摩湉敤嵸嘮汥捯瑩ⱹㄠ㬩ऊ紉ऊ昉牯⠠䙆潬正敎䍴畬瑳牥…汃獵整⁲›敎䍴畬瑳牥⥳ऊ笉ऊउ汃獵整⹲敃瑮潲摩⼠‽汃獵整⹲潃湵㭴ऊउ汃獵整⹲敖潬楣祴⼠‽汃獵整⹲潃湵㭴ऊ紉ਊउ⼯敫灥琠敨氠牡敧瑳挠畬瑳牥⁳桷湥琠敨敲愠敲洠牯⁥桴湡琠敨戠摵敧⁴牯愠瀠捡敫⁴污潬獷ऊ三瑥汃獵整獲匮牯⡴嵛挨湯瑳䘠汆捯乫瑥汃獵整♲䄠‬潣獮⁴䙆潬正敎䍴畬瑳牥…⥂笠爠瑥牵⁮⹁潃湵⁴‾⹂潃湵㭴素㬩ऊ椉⁦丨瑥汃獵整獲丮浵⤨㸠䴠硡汃獵整獲਩उ੻उ三瑥汃獵整獲匮瑥畎⡭慍䍸畬瑳牥ⱳ映污敳㬩ऊ紉ਊउ䙆潬正敎䍴摯捥㨺湅潣敤汃獵整獲丨瑥汃獵整獲‬汃獵整䍲汥卬穩ⱥ䴠硡灓敥Ɽ丠瑥慐正瑥㬩ऊ刉汥祡㸭汃敩瑮敒散癩䙥潬正汃獵整獲琨楨ⱳ丠瑥慐正瑥㬩ऊ刉灥楬慣楴湯祂整⁳㴫丠瑥慐正瑥丮浵⤨਻紉紊ਊ潶摩䄠汆捯䵫湡条牥㨺摁呤乯瑥汃獵整⡲潣獮⁴噆捥潴♲倠獯瑩潩Ɱ挠湯瑳䘠敖瑣牯…敖潬楣祴‬湩㍴′潃湵⥴笊ऊ⼯畳獭愠敲琠牵敮⁤湩潴洠慥獮漠据⁥癥牥⁹潢摩椠⁳摡敤੤䘉敖瑣牯䌠汥偬獯瑩潩⁮‽潐楳楴湯⼠䌠畬瑳牥敃汬楓敺਻䘉湉噴捥潴⁲敃汬䘨慍桴㨺汆潯呲䥯瑮䌨汥偬獯瑩潩⹮⥘‬䵆瑡㩨䘺潬牯潔湉⡴敃汬潐楳楴湯央Ⱙ䘠慍桴㨺汆潯呲䥯瑮䌨汥偬獯瑩潩⹮⥚㬩ऊ湩㍴′汃獵整䥲摮硥਻椉⁦椨瑮㈳‪硅獩楴杮湉敤⁸‽汃獵整䍲汥獬䘮湩⡤敃汬⤩ऊ੻उ汃獵整䥲摮硥㴠⨠硅獩楴杮湉敤㭸ऊ੽攉獬੥笉ऊ䘉汆捯乫瑥汃獵整⁲敎䍷畬瑳牥਻उ敎䍷畬瑳牥䌮汥⁬‽敃汬਻उ敎䍷畬瑳牥䌮湥牴楯⁤‽噆捥潴㩲娺牥噯捥潴㭲ऊ三睥汃獵整⹲敖潬楣祴㴠䘠敖瑣牯㨺敚潲敖瑣牯਻उ敎䍷畬瑳牥䌮畯瑮㴠〠਻उ汃獵整䥲摮硥㴠丠瑥汃獵整獲䄮摤丨睥汃獵整⥲਻उ汃獵整䍲汥獬䄮摤䌨汥ⱬ䌠畬瑳牥湉敤⥸਻紉ऊ敎䍴畬瑳牥孳汃獵整䥲摮硥⹝敃瑮潲摩⬠‽潐楳楴湯⨠䌠畯瑮਻三瑥汃獵整獲䍛畬瑳牥湉敤嵸嘮汥捯瑩⁹㴫嘠汥捯瑩⁹‪潃湵㭴ऊ敎䍴畬瑳牥孳汃獵整䥲摮硥⹝潃湵⁴㴫䌠畯瑮਻੽瘊楯⁤䙁潬正慍慮敧㩲区湥䍤慯獲卥慮獰潨⡴਩੻⼉振慯獲⁥汣獵整獲愠敲猠湥⁴獡琠敨猠浡⁥牧摩挠汥⁬畳浭牡敩⁳獡搠獩慴瑮戠楯獤‬潳挠楬湥獴欠敥⁰桳睯湩⁧桴⁥汦捯⁫桷汩⁥瑩猧挠慯獲੥三瑥汃獵整獲刮獥瑥⤨਻䌉畬瑳牥敃汬⹳敒敳⡴㬩ऊ潦⁲挨湯瑳䘠汆捯䍫慯獲䍥畬瑳牥…潃牡敳汃獵整⁲›潃牡敳汃獵整獲਩笉ऊ䄉摤潔敎䍴畬瑳牥䌨慯獲䍥畬瑳牥䌮湥牴楯Ɽ䌠慯獲䍥畬瑳牥嘮汥捯瑩ⱹ䌠慯獲䍥畬瑳牥䌮畯瑮㬩ऊ੽椉⁦丨瑥汃獵整獲丮浵⤨㴠‽⤰笠爠瑥牵㭮素ਊ昉牯⠠䙆潬正敎䍴畬瑳牥…汃獵整⁲›敎䍴畬瑳牥⥳ऊ੻उ汃獵整⹲敃瑮潲摩⼠‽汃獵整⹲潃湵㭴ऊ䌉畬瑳牥嘮汥捯瑩⁹㴯䌠畬瑳牥䌮畯瑮਻紉ऊ敎䍴畬瑳牥⹳潓瑲嬨⡝潣獮⁴䙆潬正敎䍴畬瑳牥…ⱁ挠湯瑳䘠汆捯乫瑥汃獵整♲䈠 ⁻敲畴湲䄠䌮畯瑮㸠䈠䌮畯瑮※⥽਻䘉汆捯乫瑥潃敤㩣䔺据摯䍥畬瑳牥⡳敎䍴畬瑳牥ⱳ䌠畬瑳牥敃汬楓敺‬慍卸数摥‬敎側捡敫⥴਻ऊ潦⁲䘨潃獮側慬敹䍲湯牴汯敬䥲整慲潴⁲瑉牥瑡牯㴠䜠瑥潗汲⡤⴩䜾瑥汐祡牥潃瑮潲汬牥瑉牥瑡牯⤨※瑉牥瑡牯※⬫瑉牥瑡牯਩笉ऊ䄉汐祡牥潃瑮潲汬牥‪汐祡牥潃瑮潲汬牥㴠䤠整慲潴⵲䜾瑥⤨਻उ晩⠠汐祡牥潃瑮潲汬牥☠…倡慬敹䍲湯牴汯敬⵲䤾䱳捯污潃瑮潲汬牥⤨☠…汐祡牥潃瑮潲汬牥㸭敇乴瑥潃湮捥楴湯⤨☠…汐祡牥潃瑮潲汬牥㸭敇乴瑥潃湮捥楴湯⤨㸭獉敎剴慥祤昨污敳⤩ऊ笉ऊउ敇䙴潬正敒慬⡹汐祡牥潃瑮潲汬牥⴩䌾楬湥剴捥楥敶汆捯䍫畬瑳牥⡳桴獩‬敎側捡敫⥴਻उ刉灥楬慣楴湯祂整⁳㴫丠瑥慐正瑥丮浵⤨਻उ੽紉紊ਊ潶摩䄠汆捯䵫湡条牥㨺敒散癩䙥潬正湓灡桳瑯挨湯瑳吠牁慲㱹極瑮㸸…慐正瑥਩੻⼉瀯捡敫獴映潲⁭敢潦敲琠敨映物瑳欠祥牦浡⁥慣❮⁴敢搠捥摯摥愠摮愠敲搠潲灰摥ऊ晩⠠両瑥潃敤⹣敄潣敤倨捡敫ⱴ丠瑥潂摩⥳ ⁻敲畴湲※੽ऊ潣獮⁴汦慯⁴畃牲湥呴浩⁥‽敇坴牯摬⤨㸭敇呴浩卥捥湯獤⤨਻昉牯⠠潣獮⁴䙆潬正敎䉴楯♤丠瑥潂摩㨠丠瑥潂摩⥳ऊ੻उ剆灥楬慣整䉤楯⩤删灥楬慣整䉤楯⁤‽敒汰捩瑡摥潂摩⹳楆摮丨瑥潂摩䠮湡汤⥥਻उ湩㍴′湉敤⁸‽敒汰捩瑡摥潂摩㼠䘠潬正瑓瑡⹥敇䥴摮硥刨灥楬慣整䉤楯ⵤ䰾捯污慈摮敬 ›义䕄彘低䕎਻उ晩⠠湉敤⁸㴽䤠䑎塅也乏⥅ऊ笉ऊउ⼯慷瑩映牯戠楯⁤祴数琠⁯敲汰捩瑡⁥敢潦敲猠慰湷湩⁧潢摩ੳउ椉⁦刨灥楬慣整䉤楯呤灹⁥㴽渠汵灬牴 ⁻潣瑮湩敵※੽ऊउ⼯敮⁷潢摩‬摡⁤瑩⁳瑳瑡⁥潮⁷湡⁤灳睡⁮瑩⁳捡潴⁲桴潲杵⁨桴⁥灳睡⁮畱略੥उ䘉潂摩灓睡剮煥敵瑳匠慰湷敒畱獥㭴ऊउ灓睡剮煥敵瑳䈮楯呤灹⁥‽敒汰捩瑡摥潂摩祔数਻उ匉慰湷敒畱獥⹴汆捯䡫湡汤⁥‽汆捯卫慴整䄮摤渨汵灬牴‬敎䉴楯⹤潐楳楴湯‬敎䉴楯⹤敖潬楣祴‬敎䉴楯⹤敖潬楣祴吮佯楲湥慴楴湯潒慴潴⡲⤩਻उ匉慰湷畑略⹥摁⡤灓睡剮煥敵瑳㬩ਊउ䘉敒汰捩瑡摥潂摩丠睥敒汰捩瑡摥潂摩਻उ三睥敒汰捩瑡摥潂摩䰮捯污慈摮敬㴠匠慰湷敒畱獥⹴汆捯䡫湡汤㭥ऊउ敎剷灥楬慣整䉤楯⹤慌瑳敒散癩摥楔敭㴠䌠牵敲瑮楔敭਻उ刉灥楬慣整䉤楯獤䄮摤丨瑥潂摩䠮湡汤ⱥ丠睥敒汰捩瑡摥潂摩㬩ऊउ潣瑮湩敵਻उ੽ऊ⼉猯慮⁰潴猠牥敶⁲瑳瑡ⱥ攠瑸慲潰慬楴湯欠敥獰琠敨攠牲牯猠慭汬戠瑥敷湥猠慮獰潨獴ऊ䘉潬正瑓瑡⹥潐楳楴湯孳湉敤嵸㴠丠瑥潂摩倮獯瑩潩㭮ऊ䘉潬正瑓瑡⹥敖潬楣楴獥䥛摮硥⁝‽敎䉴楯⹤敖潬楣祴਻उ敒汰捩瑡摥潂摩㸭慌瑳敒散癩摥楔敭㴠䌠牵敲瑮楔敭਻紉紊ਊ潶摩䄠汆捯䵫湡条牥㨺敒散癩䙥潬正汃獵整獲挨湯瑳吠牁慲㱹極瑮㸸…慐正瑥਩੻椉⁦ℨ䙆潬正敎䍴摯捥㨺敄潣敤汃獵整獲倨捡敫ⱴ丠瑥汃獵整獲⤩笠爠瑥牵㭮素ਊ按湯瑳映潬瑡䌠牵敲瑮楔敭㴠䜠瑥潗汲⡤⴩䜾瑥楔敭敓潣摮⡳㬩ऊ潦⁲挨湯瑳䘠汆捯乫瑥汃獵整♲䌠畬瑳牥㨠丠瑥汃獵整獲਩笉ऊ䘉汆捯䍫畬瑳牥牐硯♹倠潲祸㴠䌠畬瑳牥牐硯敩⹳楆摮牏摁⡤汃獵整⹲敃汬㬩ऊ倉潲祸䌮湥牴楯⁤‽汃獵整⹲敃瑮潲摩਻उ牐硯⹹敖潬楣祴㴠䌠畬瑳牥嘮汥捯瑩㭹ऊ倉潲祸䰮獡剴捥楥敶呤浩⁥‽畃牲湥呴浩㭥ਊउ⼯慭捴⁨畮扭牥漠⁦潬慣⁬潢摩⁳潴挠畬瑳牥猠穩੥उ潣獮⁴湩㍴′畎䱭捯污潂摩⁳‽䵆瑡㩨䴺湩䌨畬瑳牥䌮畯瑮‬慍䉸楯獤敐䍲畬瑳牥㬩ऊ眉楨敬⠠牐硯⹹潌慣䡬湡汤獥丮浵⤨㸠丠浵潌慣䉬楯獤਩उ੻उ刉浥癯剥灥楬慣整䉤楯⡤牐硯⹹潌慣䡬湡汤獥倮灯⤨㬩ऊउ牐硯⹹晏獦瑥⹳潐⡰㬩ऊ紉ऊ眉楨敬⠠牐硯⹹潌慣䡬湡汤獥丮浵⤨㰠丠浵潌慣䉬楯獤☠…敒汰捩瑡摥潂摩祔数਩उ੻उ⼉猯牰慥⁤潢摩⁳牡畯摮琠敨挠湥牴楯⁤湩楳敤琠敨挠汥੬उ䘉敖瑣牯传晦敳⁴‽䵆瑡㩨嘺慒摮⤨⨠䘠慍桴㨺剆湡剤湡敧〨〮ⱦ䌠畬瑳牥敃汬楓敺⨠〠㔮⥦਻ऊउ䉆楯卤慰湷敒畱獥⁴灓睡剮煥敵瑳਻उ匉慰湷敒畱獥⹴潂摩祔数㴠删灥楬慣整䉤楯呤灹㭥ऊउ灓睡剮煥敵瑳䘮潬正慈摮敬㴠䘠潬正瑓瑡⹥摁⡤畮汬瑰Ⱳ倠潲祸䌮湥牴楯⁤‫晏獦瑥‬牐硯⹹敖潬楣祴‬牐硯⹹敖潬楣祴吮佯楲湥慴楴湯潒慴潴⡲⤩਻उ匉慰湷畑略⹥摁⡤灓睡剮煥敵瑳㬩ਊउ倉潲祸䰮捯污慈摮敬⹳摁⡤灓睡剮煥敵瑳䘮潬正慈摮敬㬩ऊउ牐硯⹹晏獦瑥⹳摁⡤晏獦瑥㬩ऊ紉ऊ੽੽瘊楯⁤䙁潬正慍慮敧㩲刺浥癯剥灥楬慣整䉤楯⡤湩㍴′潌慣䡬湡汤⥥笊ऊ湩㍴′湉敤⁸‽汆捯卫慴整䜮瑥湉敤⡸潌慣䡬湡汤⥥਻椉⁦䤨摮硥㴠‽义䕄彘低䕎 ⁻敲畴湲※੽ऊ晩⠠䉁楯⩤䈠楯⁤‽汆捯卫慴整䈮楯獤䥛摮硥⥝ऊ੻उ⼯潢摩爠浥癯獥椠獴漠湷猠慴整眠敨⁮瑩攠摮⁳汰祡ऊ䈉楯ⵤ䐾獥牴祯⤨਻紉ऊ汥敳ऊ੻उ汆捯卫慴整刮浥癯⡥潌慣䡬湡汤⥥਻紉紊ਊ潶摩䄠汆捯䵫湡条牥㨺硅牴灡汯瑡䙥潬正昨潬瑡䐠汥慴楔敭਩੻⼉爯浥癯⁥潢摩⁳湡⁤汣獵整獲琠敨猠牥敶⁲慨⁳瑳灯数⁤敳摮湩⁧搨獥慰湷摥‬牯洠癯摥琠⁯湡瑯敨⁲湩整敲瑳琠敩⥲ऊ潣獮⁴汦慯⁴畃牲湥呴浩⁥‽敇坴牯摬⤨㸭敇呴浩卥捥湯獤⤨਻按湯瑳映潬瑡吠浩潥瑵㴠⠠䵆瑡㩨䴺硡刨摥捵摥慒整楄楶潳Ⱳㄠ ‫⤳⼠匠慮獰潨剴瑡㭥ऊ潦⁲愨瑵⁯瑉㴠删灥楬慣整䉤楯獤䌮敲瑡䥥整慲潴⡲㬩䤠㭴⬠䤫⥴ऊ੻उ晩⠠畃牲湥呴浩⁥‭瑉嘮污敵⤨䰮獡剴捥楥敶呤浩⁥‾楔敭畯⥴ऊ笉ऊउ敒潭敶敒汰捩瑡摥潂摩䤨⹴慖畬⡥⸩潌慣䡬湡汤⥥਻उ䤉⹴敒潭敶畃牲湥⡴㬩ऊ紉ऊ੽昉牯⠠畡潴䤠⁴‽汃獵整偲潲楸獥䌮敲瑡䥥整慲潴⡲㬩䤠㭴⬠䤫⥴ऊ੻उ晩⠠畃牲湥呴浩⁥‭瑉嘮污敵⤨䰮獡剴捥楥敶呤浩⁥‾楔敭畯⥴ऊ笉ऊउ潦⁲椨瑮㈳䰠捯污慈摮敬㨠䤠⹴慖畬⡥⸩潌慣䡬湡汤獥਩उ笉ऊउ刉浥癯剥灥楬慣整䉤楯⡤潌慣䡬湡汤⥥਻उ紉ऊउ瑉刮浥癯䍥牵敲瑮⤨਻उ੽紉ਊ⼉猯潴敲栠慥楤杮⁳湡⁤灳敥獤映楬桧⁴湡浩瑡潩⁮潣灭牡獥愠慧湩瑳ऊ潣獮⁴湩㍴′畎䉭楯獤㴠䘠潬正瑓瑡⹥畎⡭㬩ऊ慃瑰牵䙥楬桧䅴楮慭楴湯⤨਻椉⁦戨楓䅭楮慭整汆杩瑨਩笉ऊ䈉楯䡤慥楤杮⹳敓乴浵湕湩瑩慩楬敺⡤畎䉭楯獤㬩ऊ䈉楯卤数摥⹳敓乴浵湕湩瑩慩楬敺⡤畎䉭楯獤㬩ऊ昉牯⠠湩㍴′⁩‽㬰椠㰠丠浵潂摩㭳⬠椫਩उ੻उ䈉楯䡤慥楤杮孳嵩㴠䘠潬正瑓瑡⹥敖潬楣楴獥楛⹝敇却晡乥牯慭⡬㬩ऊउ潂摩灓敥獤楛⁝‽汆捯卫慴整嘮汥捯瑩敩孳嵩匮穩⡥㬩ऊ紉ऊ੽ऊ⼯潭敶戠楯獤愠潬杮琠敨物氠獡⁴敲汰捩瑡摥瘠汥捯瑩੹昉牯⠠湩㍴′⁩‽㬰椠㰠丠浵潂摩㭳⬠椫਩笉ऊ䘉潬正瑓瑡⹥潐楳楴湯孳嵩⬠‽汆捯卫慴整嘮汥捯瑩敩孳嵩⨠䐠汥慴楔敭਻紉ਊ⼉洯癯⁥汣獵整⁲潢摩⁳楷桴琠敨物挠畬瑳牥ऊ潦⁲吨慐物䘼湉噴捥潴Ⱳ䘠汆捯䍫畬瑳牥牐硯㹹…汃獵整偲潲祸㨠䌠畬瑳牥牐硯敩⥳ऊ੻उ䙆潬正汃獵整偲潲祸…牐硯⁹‽汃獵整偲潲祸嘮污敵਻उ牐硯⹹敃瑮潲摩⬠‽牐硯⹹敖潬楣祴⨠䐠汥慴楔敭਻उ潦⁲椨瑮㈳椠㴠〠※⁩‼牐硯⹹潌慣䡬湡汤獥丮浵⤨※⬫⥩ऊ笉ऊउ湩㍴′湉敤⁸‽汆捯卫慴整䜮瑥湉敤⡸牐硯⹹潌慣䡬湡汤獥楛⥝਻उ椉⁦䤨摮硥℠‽义䕄彘低䕎਩उ笉ऊउ䘉潬正瑓瑡⹥潐楳楴湯孳湉敤嵸㴠倠潲祸䌮湥牴楯⁤‫牐硯⹹晏獦瑥孳嵩਻उउ汆捯卫慴整嘮汥捯瑩敩孳湉敤嵸㴠倠潲祸嘮汥捯瑩㭹ऊउ੽उ੽紉ਊ⼉愯癤湡散眠湩⁧敢瑡⁳湡⁤慢歮⁳景爠灥楬慣整⁤潢摩ੳ椉⁦戨楓䅭楮慭整汆杩瑨਩笉ऊ昉牯⠠湩㍴′⁩‽㬰椠㰠丠浵潂摩㭳⬠椫਩उ੻उ䄉楮慭整汆杩瑨椨‬敄瑬呡浩ⱥ䐠汥慴楔敭㬩ऊ紉ऊ੽ऊ潃浭瑩潂摩牔湡晳牯獭䐨汥慴楔敭㬩紊
\ No newline at end of file
@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠汆捯乫瑥潃敤⹣≨ਊ慮敭灳捡੥੻⼉瀯捡敫⁴汦条ੳ按湯瑳甠湩㡴倠捡敫䭴祥牦浡⁥‽‱㰼〠਻按湯瑳甠湩㡴倠捡敫䙴物瑳桃湵⁫‽‱㰼ㄠ਻按湯瑳甠湩㡴倠捡敫䍴畬瑳牥⁳‽‱㰼㈠਻ऊ⼯灡数摮瘠污敵愠⁳⁡慶楲扡敬氠湥瑧⁨湩整敧⁲㜨戠瑩⁳数⁲祢整‬楨桧戠瑩猠瑥眠敨⁮潭敲戠瑹獥映汯潬⥷ऊ潶摩圠楲整慖䥲瑮吨牁慲㱹極瑮㸸…慐正瑥‬極瑮㈳嘠污敵਩笉ऊ眉楨敬⠠慖畬⁥㴾〠㡸⤰ऊ笉ऊउ慐正瑥䄮摤用湩㡴嘨污敵簠〠㡸⤰㬩ऊउ慖畬⁥㸾‽㬷ऊ紉ऊ倉捡敫⹴摁⡤極瑮⠸慖畬⥥㬩ऊ੽ऊ⼯楳湧摥瘠污敵⁳牡⁥楺穧条攠据摯摥猠⁯浳污⁬敮慧楴敶渠浵敢獲猠慴⁹浳污੬瘉楯⁤牗瑩卥杩敮噤牡湉⡴䅔牲祡甼湩㡴☾倠捡敫ⱴ椠瑮㈳嘠污敵਩笉ऊ圉楲整慖䥲瑮倨捡敫ⱴ⠠極瑮㈳嘨污敵 㰼ㄠ ⁞極瑮㈳嘨污敵㸠‾ㄳ⤩਻紉ਊ瘉楯⁤牗瑩䙥潬瑡吨牁慲㱹極瑮㸸…慐正瑥‬汦慯⁴慖畬⥥ऊ੻उ湩㍴′晏獦瑥㴠倠捡敫⹴摁啤楮楮楴污穩摥猨穩潥⡦汦慯⥴㬩ऊ䘉敍潭祲㨺敍捭祰☨慐正瑥佛晦敳嵴‬嘦污敵‬楳敺景昨潬瑡⤩਻紉ਊ⼉爯慥獤瘠污敵⁳牦浯愠瀠捡敫ⱴ愠祮爠慥⁤慰瑳琠敨攠摮洠牡獫琠敨爠慥敤⁲獡映楡敬੤猉牴捵⁴偆捡敫剴慥敤ੲ笉ऊ按湯瑳吠牁慲㱹極瑮㸸…慐正瑥਻उ湩㍴′晏獦瑥㴠〠਻उ潢汯戠慆汩摥㴠映污敳਻ऊ䘉慐正瑥敒摡牥挨湯瑳吠牁慲㱹極瑮㸸…湉慐正瑥 ›慐正瑥䤨偮捡敫⥴笠੽ऊ甉湩㡴删慥䉤瑹⡥਩उ੻उ椉⁦伨晦敳⁴㴾倠捡敫⹴畎⡭⤩笠戠慆汩摥㴠琠畲㭥爠瑥牵⁮㬰素ऊउ敲畴湲倠捡敫孴晏獦瑥⬫㭝ऊ紉ਊउ極瑮㈳删慥噤牡湉⡴਩उ੻उ甉湩㍴′慖畬⁥‽㬰ऊउ潦⁲椨瑮㈳匠楨瑦㴠〠※桓晩⁴‼㔳※桓晩⁴㴫㜠਩उ笉ऊउ甉湩㡴䈠瑹⁥‽敒摡祂整⤨਻उउ慖畬⁥㵼甠湩㍴⠲祂整☠〠㝸⥆㰠‼桓晩㭴ऊउ椉⁦⠨祂整☠〠㡸⤰㴠‽⤰笠爠瑥牵⁮慖畬㭥素ऊउ੽उ戉慆汩摥㴠琠畲㭥ऊउ敲畴湲〠਻उ੽ऊ椉瑮㈳删慥卤杩敮噤牡湉⡴਩उ੻उ甉湩㍴′慖畬⁥‽敒摡慖䥲瑮⤨਻उ爉瑥牵⁮湩㍴⠲慖畬⁥㸾ㄠ ⁞椭瑮㈳嘨污敵☠ㄠ㬩ऊ紉ਊउ汦慯⁴敒摡汆慯⡴਩उ੻उ昉潬瑡嘠污敵㴠〠〮㭦ऊउ晩⠠晏獦瑥⬠椠瑮㈳猨穩潥⡦汦慯⥴ ‾慐正瑥丮浵⤨ ⁻䙢楡敬⁤‽牴敵※敲畴湲嘠污敵※੽उ䘉敍潭祲㨺敍捭祰☨慖畬ⱥ☠慐正瑥佛晦敳嵴‬楳敺景昨潬瑡⤩਻उ伉晦敳⁴㴫猠穩潥⡦汦慯⥴਻उ爉瑥牵⁮慖畬㭥ऊ紉ऊ㭽ਊ⼉焯慵瑮穩⁥慶畬⁥湩嬠ㄭ‬崱琠⁯⁡祢整愠摮戠捡੫甉湩㡴儠慵瑮穩啥楮⡴汦慯⁴慖畬⥥ऊ੻उ敲畴湲甠湩㡴䘨慍桴㨺潒湵呤䥯瑮䘨慍桴㨺汃浡⡰慖畬⁥‪⸰昵⬠〠㔮ⱦ〠〮ⱦㄠ〮⥦⨠㈠㔵〮⥦㬩ऊ੽ऊ汦慯⁴敄畱湡楴敺湕瑩用湩㡴嘠污敵਩笉ऊ爉瑥牵⁮嘨污敵⼠㈠㔵〮⥦⨠㈠〮⁦‭⸱昰਻紉ਊ⼉漯瑣桡摥慲⁬湥潣楤杮洠灡⁳⁡湵瑩搠物捥楴湯漠瑮⁯⁡煳慵敲猠⁯瑩挠湡戠⁥瑳牯摥椠⁮′慶畬獥ऊ潶摩䔠据摯䑥物捥楴湯挨湯瑳䘠敖瑣牯…楄敲瑣潩Ɱ甠湩㡴…畏啴‬極瑮☸传瑵⥖ऊ੻उ汦慯⁴畓⁭‽䵆瑡㩨䄺獢䐨物捥楴湯堮 ‫䵆瑡㩨䄺獢䐨物捥楴湯央 ‫䵆瑡㩨䄺獢䐨物捥楴湯娮㬩ऊ椉⁦匨浵㰠䬠义䅄卟䅍䱌也䵕䕂⥒ऊ笉ऊउ畏啴㴠儠慵瑮穩啥楮⡴⸱昰㬩ऊउ畏噴㴠儠慵瑮穩啥楮⡴⸰昰㬩ऊउ敲畴湲਻उ੽उ汦慯⁴⁕‽楄敲瑣潩⹮⁘ 畓㭭ऊ昉潬瑡嘠㴠䐠物捥楴湯央⼠匠浵਻उ晩⠠楄敲瑣潩⹮⁚‼⸰昰਩उ੻उ⼉是汯⁤潬敷⁲敨業灳敨敲漠敶⁲桴⁥楤条湯污ੳउ昉潬瑡䘠汯敤啤㴠⠠⸱昰ⴠ䘠慍桴㨺扁⡳⥖ ‪唨㸠‽⸰昰㼠ㄠ〮⁦›ㄭ〮⥦਻उ昉潬瑡䘠汯敤噤㴠⠠⸱昰ⴠ䘠慍桴㨺扁⡳⥕ ‪嘨㸠‽⸰昰㼠ㄠ〮⁦›ㄭ〮⥦਻उ唉㴠䘠汯敤啤਻उ嘉㴠䘠汯敤噤਻उ੽उ畏啴㴠儠慵瑮穩啥楮⡴⥕਻उ畏噴㴠儠慵瑮穩啥楮⡴⥖਻紉ਊ䘉敖瑣牯䐠捥摯䑥物捥楴湯用湩㡴䔠据摯摥ⱕ甠湩㡴䔠据摯摥⥖ऊ੻उ汦慯⁴⁕‽敄畱湡楴敺湕瑩䔨据摯摥⥕਻उ汦慯⁴⁖‽敄畱湡楴敺湕瑩䔨据摯摥⥖਻उ噆捥潴⁲楄敲瑣潩⡮ⱕ嘠‬⸱昰ⴠ䘠慍桴㨺扁⡳⥕ⴠ䘠慍桴㨺扁⡳⥖㬩ऊ椉⁦䐨物捥楴湯娮㰠〠〮⥦ऊ笉ऊउ楄敲瑣潩⹮⁘‽ㄨ〮⁦‭䵆瑡㩨䄺獢嘨⤩⨠⠠⁕㴾〠〮⁦‿⸱昰㨠ⴠ⸱昰㬩ऊउ楄敲瑣潩⹮⁙‽ㄨ〮⁦‭䵆瑡㩨䄺獢唨⤩⨠⠠⁖㴾〠〮⁦‿⸱昰㨠ⴠ⸱昰㬩ऊ紉ऊ爉瑥牵⁮楄敲瑣潩⹮敇却晡乥牯慭⡬㬩ऊ੽੽瘊楯⁤䙆潬正敎䍴摯捥㨺敒敳⡴਩੻戉慈䭳祥牦浡⁥‽慦獬㭥ऊ慂敳楬敮刮獥瑥⤨਻੽瘊楯⁤䙆潬正敎䍴摯捥㨺敂楧䭮祥牦浡⡥潣獮⁴噆捥潴♲丠睥牏杩湩਩੻䬉祥牦浡䥥⭤㬫ऊ牏杩湩㴠丠睥牏杩湩਻䬉祥牦浡健敲楣楳湯㴠䘠慍桴㨺慍⡸潐楳楴湯牐捥獩潩Ɱ䬠义䅄卟䅍䱌也䵕䕂⥒਻䈉獡汥湩⹥敒敳⡴㬩ऊ䡢獡敋晹慲敭㴠琠畲㭥紊ਊ湩㍴′䙆潬正敎䍴摯捥㨺湅潣敤慐正瑥挨湯瑳吠牁慲㱹䙆潬正敎䉴楯㹤…潂摩ⱳ椠瑮㈳䘠物瑳潂摩‬湩㍴′慍䉸楯獤‬潢汯戠敋晹慲敭‬汦慯⁴楍卮数摥‬汦慯⁴慍卸数摥‬䅔牲祡甼湩㡴☾传瑵慐正瑥਩੻伉瑵慐正瑥刮獥瑥⤨਻ऊ⼯敨摡牥ऊ畏側捡敫⹴摁⡤戨敋晹慲敭㼠倠捡敫䭴祥牦浡⁥›⤰簠⠠楆獲䉴楯⁤㴽〠㼠倠捡敫䙴物瑳桃湵⁫›⤰㬩ऊ畏側捡敫⹴摁⡤敋晹慲敭摉㬩ऊ牗瑩䙥潬瑡伨瑵慐正瑥‬楍卮数摥㬩ऊ牗瑩䙥潬瑡伨瑵慐正瑥‬慍卸数摥㬩ऊ晩⠠䭢祥牦浡⥥ऊ੻उ牗瑩䙥潬瑡伨瑵慐正瑥‬牏杩湩堮㬩ऊ圉楲整汆慯⡴畏側捡敫ⱴ传楲楧⹮⥙਻उ牗瑩䙥潬瑡伨瑵慐正瑥‬牏杩湩娮㬩ऊ圉楲整汆慯⡴畏側捡敫ⱴ䬠祥牦浡健敲楣楳湯㬩ऊ੽⼉戯楯⁤潣湵⁴獩眠楲瑴湥漠据⁥桴⁥慰正瑥椠⁳畦汬‬瑩栠獡愠映硩摥猠穩⁥潳琠敨栠慥敤⁲潤獥❮⁴潭敶ऊ潣獮⁴湩㍴′潃湵佴晦敳⁴‽畏側捡敫⹴摁婤牥敯⡤⤲਻ऊ潣獮⁴湩㍴′慐正瑥祂整⁳‽䵆瑡㩨䌺慬灭䴨硡慐正瑥祂整ⱳ㘠ⰴ䘠潬正敎䵴硡慐正瑥祂整⥳਻按湯瑳椠瑮㈳䰠獡䉴楯⁤‽䵆瑡㩨䴺湩䘨物瑳潂摩⬠䘠慍桴㨺楍⡮慍䉸楯獤‬砰䙆䙆Ⱙ䈠楯獤丮浵⤨㬩ऊ潣獮⁴汦慯⁴灓敥剤湡敧㴠䴠硡灓敥⁤‭楍卮数摥਻椉瑮㈳倠敲楶畯䡳湡汤⁥‽ㄭ਻椉瑮㈳丠浵潂摩⁳‽㬰ऊ潦⁲椨瑮㈳椠㴠䘠物瑳潂摩※⁩‼慌瑳潂摩※⬫⥩ऊ੻उ潣獮⁴䙆潬正敎䉴楯♤䈠楯⁤‽潂摩孳嵩਻उ潣獮⁴湩㍴′潂摩晏獦瑥㴠传瑵慐正瑥丮浵⤨਻ऊ⼉栯湡汤獥愠敲猠牯整⁤潳漠汮⁹桴⁥慧⁰潴琠敨瀠敲楶畯⁳湯⁥獩猠湥ੴउ牗瑩噥牡湉⡴畏側捡敫ⱴ甠湩㍴⠲潂摩䠮湡汤⁥‭牐癥潩獵慈摮敬ⴠㄠ⤩਻ऊ⼉瀯獯瑩潩⁮敲慬楴敶琠⁯敫晹慲敭戠獡汥湩⁥漨⁲潴漠楲楧⁮潦⁲敫晹慲敭⁳湡⁤潢摩⁳桴瑡愠敲渠睥猠湩散琠敨欠祥牦浡⥥ऊ䘉敖瑣牯匠慣敬⁤‽䈨楯⹤潐楳楴湯ⴠ传楲楧⥮⼠䬠祥牦浡健敲楣楳湯਻उ䥆瑮敖瑣牯儠慵瑮穩摥䘨慍桴㨺潒湵呤䥯瑮匨慣敬⹤⥘‬䵆瑡㩨刺畯摮潔湉⡴捓污摥央Ⱙ䘠慍桴㨺潒湵呤䥯瑮匨慣敬⹤⥚㬩ऊ䘉湉噴捥潴⁲慂敳㴠䘠湉噴捥潴㩲娺牥噯污敵਻उ晩⠠戡敋晹慲敭਩उ੻उ椉⁦挨湯瑳䘠湉噴捥潴⩲䬠祥牦浡健獯瑩潩⁮‽慂敳楬敮䘮湩⡤潂摩䠮湡汤⥥਩उ笉ऊउ䈉獡⁥‽䬪祥牦浡健獯瑩潩㭮ऊउ੽उ੽उ牗瑩卥杩敮噤牡湉⡴畏側捡敫ⱴ儠慵瑮穩摥堮ⴠ䈠獡⹥⥘਻उ牗瑩卥杩敮噤牡湉⡴畏側捡敫ⱴ儠慵瑮穩摥央ⴠ䈠獡⹥⥙਻उ牗瑩卥杩敮噤牡湉⡴畏側捡敫ⱴ儠慵瑮穩摥娮ⴠ䈠獡⹥⥚਻ऊ⼉栯慥楤杮愠摮猠数摥ऊ昉潬瑡匠数摥㴠䈠楯⹤敖潬楣祴匮穩⡥㬩ऊ甉湩㡴䠠慥楤杮ⱕ䠠慥楤杮㭖ऊ䔉据摯䑥物捥楴湯匨数摥㸠䬠义䅄卟䅍䱌也䵕䕂⁒‿潂摩嘮汥捯瑩⁹ 灓敥⁤›噆捥潴㩲䘺牯慷摲敖瑣牯‬效摡湩啧‬效摡湩噧㬩ऊ伉瑵慐正瑥䄮摤䠨慥楤杮⥕਻उ畏側捡敫⹴摁⡤效摡湩噧㬩ऊ昉潬瑡匠数摥汁桰⁡‽灓敥剤湡敧㸠䬠义䅄卟䅍䱌也䵕䕂⁒‿匨数摥ⴠ䴠湩灓敥⥤⼠匠数摥慒杮⁥›⸰昰਻उ畏側捡敫⹴摁⡤極瑮⠸䵆瑡㩨刺畯摮潔湉⡴䵆瑡㩨䌺慬灭匨数摥汁桰ⱡ〠〮ⱦㄠ〮⥦⨠㈠㔵〮⥦⤩਻ऊ⼉戯楯⁤桴瑡搠敯湳琧映瑩猠慴瑲⁳桴⁥敮瑸瀠捡敫⁴湩瑳慥੤उ晩⠠畏側捡敫⹴畎⡭ ‾慐正瑥祂整⁳☦丠浵潂摩⁳‾⤰ऊ笉ऊउ畏側捡敫⹴敓乴浵䈨楯佤晦敳ⱴ映污敳㬩ऊउ牢慥㭫ऊ紉ऊ椉⁦戨敋晹慲敭਩उ੻उ䈉獡汥湩⹥摁⡤潂摩䠮湡汤ⱥ儠慵瑮穩摥㬩ऊ紉ऊ倉敲楶畯䡳湡汤⁥‽潂摩䠮湡汤㭥ऊ三浵潂摩⭳㬫ऊ੽ऊ畏側捡敫孴潃湵佴晦敳嵴㴠甠湩㡴丨浵潂摩⥳਻伉瑵慐正瑥䍛畯瑮晏獦瑥⬠ㄠ⁝‽極瑮⠸畎䉭楯獤㸠‾⤸਻爉瑥牵⁮畎䉭楯獤਻੽戊潯⁬䙆潬正敎䍴摯捥㨺敄潣敤挨湯瑳吠牁慲㱹極瑮㸸…慐正瑥‬䅔牲祡䘼汆捯乫瑥潂摩☾传瑵潂摩⥳笊ऊ畏䉴楯獤刮獥瑥⤨਻ऊ偆捡敫剴慥敤⁲敒摡牥倨捡敫⥴਻按湯瑳甠湩㡴䘠慬獧㴠删慥敤⹲敒摡祂整⤨਻按湯瑳甠湩㡴倠捡敫䭴祥牦浡䥥⁤‽敒摡牥刮慥䉤瑹⡥㬩ऊ潣獮⁴汦慯⁴楍卮数摥㴠删慥敤⹲敒摡汆慯⡴㬩ऊ潣獮⁴汦慯⁴慍卸数摥㴠删慥敤⹲敒摡汆慯⡴㬩ऊ潣獮⁴潢汯戠敋晹慲敭㴠⠠汆条⁳…慐正瑥敋晹慲敭 㴡〠਻ऊ晩⠠䭢祥牦浡⥥ऊ੻उ噆捥潴⁲慐正瑥牏杩湩਻उ慐正瑥牏杩湩堮㴠删慥敤⹲敒摡汆慯⡴㬩ऊ倉捡敫佴楲楧⹮⁙‽敒摡牥刮慥䙤潬瑡⤨਻उ慐正瑥牏杩湩娮㴠删慥敤⹲敒摡汆慯⡴㬩ऊ昉潬瑡倠捡敫側敲楣楳湯㴠删慥敤⹲敒摡汆慯⡴㬩ऊ椉⁦刨慥敤⹲䙢楡敬⥤笠爠瑥牵⁮慦獬㭥素ਊउ⼯瑳牡⁴景愠渠睥欠祥牦浡⁥敲汰捡獥戠獡汥湩ⱥ氠瑡牥挠畨歮⁳景椠⁴摡⁤潴琠敨戠獡汥湩੥उ晩⠠汆条⁳…慐正瑥楆獲䍴畨歮਩उ੻उ䬉祥牦浡䥥⁤‽慐正瑥敋晹慲敭摉਻उ伉楲楧⁮‽慐正瑥牏杩湩਻उ䬉祥牦浡健敲楣楳湯㴠倠捡敫側敲楣楳湯਻उ䈉獡汥湩⹥敒敳⡴㬩ऊउ䡢獡敋晹慲敭㴠琠畲㭥ऊ紉ऊ੽ऊ⼯慰正瑥⁳牡⁥湯祬甠慳汢⁥湯散琠敨猠慴瑲漠⁦桴楥⁲敫晹慲敭栠獡戠敥⁮敲散癩摥ऊ晩⠠敒摡牥戮慆汩摥簠⁼䘨慬獧☠倠捡敫䍴畬瑳牥⥳簠⁼戡慈䭳祥牦浡⁥籼倠捡敫䭴祥牦浡䥥⁤㴡䬠祥牦浡䥥⥤笠爠瑥牵⁮慦獬㭥素ਊ按湯瑳甠湩㍴′畎䉭楯獤㴠甠湩㍴⠲敒摡牥刮慥䉤瑹⡥⤩簠⠠極瑮㈳刨慥敤⹲敒摡祂整⤨ 㰼㠠㬩ऊ⼯癥牥⁹潢摩琠歡獥愠⁴敬獡⁴‷祢整ⱳ爠橥捥⁴潣湵獴琠敨瀠捡敫⁴慣❮⁴潨摬ऊ晩⠠敒摡牥戮慆汩摥簠⁼畎䉭楯獤㸠甠湩㍴⠲慐正瑥丮浵⤨⼠㜠⤩笠爠瑥牵⁮慦獬㭥素ऊ畏䉴楯獤刮獥牥敶丨浵潂摩⥳਻ऊ潣獮⁴汦慯⁴灓敥剤湡敧㴠䴠硡灓敥⁤‭楍卮数摥਻椉瑮㈳倠敲楶畯䡳湡汤⁥‽ㄭ਻昉牯⠠極瑮㈳椠㴠〠※⁩‼畎䉭楯獤※⬫⥩ऊ੻उ䙆潬正敎䉴楯⁤潂摩਻उ潂摩䠮湡汤⁥‽牐癥潩獵慈摮敬⬠ㄠ⬠椠瑮㈳刨慥敤⹲敒摡慖䥲瑮⤨㬩ऊ倉敲楶畯䡳湡汤⁥‽潂摩䠮湡汤㭥ਊउ䥆瑮敖瑣牯儠慵瑮穩摥਻उ畑湡楴敺⹤⁘‽敒摡牥刮慥卤杩敮噤牡湉⡴㬩ऊ儉慵瑮穩摥央㴠删慥敤⹲敒摡楓湧摥慖䥲瑮⤨਻उ畑湡楴敺⹤⁚‽敒摡牥刮慥卤杩敮噤牡湉⡴㬩ऊ椉⁦戨敋晹慲敭਩उ੻उ䈉獡汥湩⹥摁⡤潂摩䠮湡汤ⱥ儠慵瑮穩摥㬩ऊ紉ऊ攉獬⁥晩⠠潣獮⁴䥆瑮敖瑣牯‪敋晹慲敭潐楳楴湯㴠䈠獡汥湩⹥楆摮䈨楯⹤慈摮敬⤩ऊ笉ऊउ畑湡楴敺⁤㴫⨠敋晹慲敭潐楳楴湯਻उ੽उ潂摩倮獯瑩潩⁮‽牏杩湩⬠䘠敖瑣牯儨慵瑮穩摥堮‬畑湡楴敺⹤ⱙ儠慵瑮穩摥娮 ‪敋晹慲敭牐捥獩潩㭮ਊउ極瑮‸效摡湩啧㴠删慥敤⹲敒摡祂整⤨਻उ極瑮‸效摡湩噧㴠删慥敤⹲敒摡祂整⤨਻उ汦慯⁴灓敥⁤‽楍卮数摥⬠⠠敒摡牥刮慥䉤瑹⡥  㔲⸵昰 ‪灓敥剤湡敧਻उ潂摩嘮汥捯瑩⁹‽敄潣敤楄敲瑣潩⡮效摡湩啧‬效摡湩噧 ‪灓敥㭤ਊउ晩⠠敒摡牥戮慆汩摥 ⁻畏䉴楯獤刮獥瑥⤨※敲畴湲映污敳※੽उ畏䉴楯獤䄮摤䈨楯⥤਻紉ਊ爉瑥牵⁮牴敵਻੽瘊楯⁤䙆潬正敎䍴摯捥㨺湅潣敤汃獵整獲挨湯瑳吠牁慲㱹䙆潬正敎䍴畬瑳牥☾䌠畬瑳牥ⱳ映潬瑡䌠汥卬穩ⱥ映潬瑡䴠硡灓敥Ɽ吠牁慲㱹極瑮㸸…畏側捡敫⥴笊ऊ畏側捡敫⹴敒敳⡴㬩ਊ⼉栯慥敤ੲ伉瑵慐正瑥䄮摤倨捡敫䍴畬瑳牥⥳਻圉楲整汆慯⡴畏側捡敫ⱴ䌠汥卬穩⥥਻圉楲整汆慯⡴畏側捡敫ⱴ䴠硡灓敥⥤਻⼉振畬瑳牥挠畯瑮椠⁳牷瑩整⁮湯散琠敨瀠捡敫⁴獩映汵ⱬ愠⁳潦⁲潢摩瀠捡敫獴ऊ潣獮⁴湩㍴′潃湵佴晦敳⁴‽畏側捡敫⹴摁婤牥敯⡤⤲਻ऊ湩㍴′畎䍭畬瑳牥⁳‽㬰ऊ潦⁲挨湯瑳䘠汆捯乫瑥汃獵整♲䌠畬瑳牥㨠䌠畬瑳牥⥳ऊ੻उ潣獮⁴湩㍴′汃獵整佲晦敳⁴‽畏側捡敫⹴畎⡭㬩ऊ⼉振汥⁬潣牯楤慮整⁳湡⁤散瑮潲摩瀠獯瑩潩⁮湩楳敤琠敨挠汥੬उ牗瑩卥杩敮噤牡湉⡴畏側捡敫ⱴ䌠畬瑳牥䌮汥⹬⥘਻उ牗瑩卥杩敮噤牡湉⡴畏側捡敫ⱴ䌠畬瑳牥䌮汥⹬⥙਻उ牗瑩卥杩敮噤牡湉⡴畏側捡敫ⱴ䌠畬瑳牥䌮汥⹬⥚਻उ噆捥潴⁲敃汬晏獦瑥㴠䌠畬瑳牥䌮湥牴楯⁤ 敃汬楓敺ⴠ䘠敖瑣牯䌨畬瑳牥䌮汥⹬ⱘ䌠畬瑳牥䌮汥⹬ⱙ䌠畬瑳牥䌮汥⹬⥚਻उ畏側捡敫⹴摁⡤畑湡楴敺湕瑩䌨汥佬晦敳⹴⁘‪⸲昰ⴠㄠ〮⥦㬩ऊ伉瑵慐正瑥䄮摤儨慵瑮穩啥楮⡴敃汬晏獦瑥央⨠㈠〮⁦‭⸱昰⤩਻उ畏側捡敫⹴摁⡤畑湡楴敺湕瑩䌨汥佬晦敳⹴⁚‪⸲昰ⴠㄠ〮⥦㬩ਊउ牗瑩噥牡湉⡴畏側捡敫ⱴ䌠畬瑳牥䌮畯瑮㬩ਊउ⼯敭湡瘠汥捯瑩ⱹ椠獴猠数摥椠⁳潬敷⁲桴湡琠敨戠楯獤‧桷湥琠敨⁹敨摡椠⁮楤晦牥湥⁴楤敲瑣潩獮ऊ昉潬瑡匠数摥㴠䌠畬瑳牥嘮汥捯瑩⹹楓敺⤨਻उ極瑮‸效摡湩啧‬效摡湩噧਻उ湅潣敤楄敲瑣潩⡮灓敥⁤‾䥋䑎彁䵓䱁彌啎䉍剅㼠䌠畬瑳牥嘮汥捯瑩⁹ 灓敥⁤›噆捥潴㩲䘺牯慷摲敖瑣牯‬效摡湩啧‬效摡湩噧㬩ऊ伉瑵慐正瑥䄮摤䠨慥楤杮⥕਻उ畏側捡敫⹴摁⡤效摡湩噧㬩ऊ伉瑵慐正瑥䄮摤用湩㡴䘨慍桴㨺潒湵呤䥯瑮䘨慍桴㨺汃浡⡰慍卸数摥㸠䬠义䅄卟䅍䱌也䵕䕂⁒‿灓敥⁤ 慍卸数摥㨠〠〮ⱦ〠〮ⱦㄠ〮⥦⨠㈠㔵〮⥦⤩਻ऊ椉⁦伨瑵慐正瑥丮浵⤨㸠䘠潬正敎䵴硡慐正瑥祂整⁳籼丠浵汃獵整獲㴠‽砰䙆䙆਩उ੻उ伉瑵慐正瑥匮瑥畎⡭汃獵整佲晦敳ⱴ映污敳㬩ऊउ牢慥㭫ऊ紉ऊ三浵汃獵整獲⬫਻紉ਊ伉瑵慐正瑥䍛畯瑮晏獦瑥⁝‽極瑮⠸畎䍭畬瑳牥⥳਻伉瑵慐正瑥䍛畯瑮晏獦瑥⬠ㄠ⁝‽極瑮⠸畎䍭畬瑳牥⁳㸾㠠㬩紊ਊ潢汯䘠汆捯乫瑥潃敤㩣䐺捥摯䍥畬瑳牥⡳潣獮⁴䅔牲祡甼湩㡴☾倠捡敫ⱴ吠牁慲㱹䙆潬正敎䍴畬瑳牥☾传瑵汃獵整獲਩੻伉瑵汃獵整獲刮獥瑥⤨਻ऊ偆捡敫剴慥敤⁲敒摡牥倨捡敫⥴਻按湯瑳甠湩㡴䘠慬獧㴠删慥敤⹲敒摡祂整⤨਻按湯瑳映潬瑡䌠汥卬穩⁥‽敒摡牥刮慥䙤潬瑡⤨਻按湯瑳映潬瑡䴠硡灓敥⁤‽敒摡牥刮慥䙤潬瑡⤨਻按湯瑳甠湩㍴′畎䍭畬瑳牥⁳‽極瑮㈳刨慥敤⹲敒摡祂整⤨ ⁼用湩㍴⠲敒摡牥刮慥䉤瑹⡥⤩㰠‼⤸਻⼉支敶祲挠畬瑳牥琠歡獥愠⁴敬獡⁴〱戠瑹獥‬敲敪瑣挠畯瑮⁳桴⁥慰正瑥挠湡琧栠汯੤椉⁦刨慥敤⹲䙢楡敬⁤籼℠䘨慬獧☠倠捡敫䍴畬瑳牥⥳簠⁼畎䍭畬瑳牥⁳‾極瑮㈳倨捡敫⹴畎⡭  〱⤩笠爠瑥牵⁮慦獬㭥素ऊ畏䍴畬瑳牥⹳敒敳癲⡥畎䍭畬瑳牥⥳਻ऊ潦⁲用湩㍴′⁩‽㬰椠㰠丠浵汃獵整獲※⬫⥩ऊ੻उ䙆潬正敎䍴畬瑳牥䌠畬瑳牥਻उ汃獵整⹲敃汬堮㴠删慥敤⹲敒摡楓湧摥慖䥲瑮⤨਻उ汃獵整⹲敃汬央㴠删慥敤⹲敒摡楓湧摥慖䥲瑮⤨਻उ汃獵整⹲敃汬娮㴠删慥敤⹲敒摡楓湧摥慖䥲瑮⤨਻उ噆捥潴⁲敃汬晏獦瑥਻उ敃汬晏獦瑥堮㴠䐠煥慵瑮穩啥楮⡴敒摡牥刮慥䉤瑹⡥⤩⨠〠㔮⁦‫⸰昵਻उ敃汬晏獦瑥央㴠䐠煥慵瑮穩啥楮⡴敒摡牥刮慥䉤瑹⡥⤩⨠〠㔮⁦‫⸰昵਻उ敃汬晏獦瑥娮㴠䐠煥慵瑮穩啥楮⡴敒摡牥刮慥䉤瑹⡥⤩⨠〠㔮⁦‫⸰昵਻उ汃獵整⹲敃瑮潲摩㴠⠠噆捥潴⡲汃獵整⹲敃汬堮‬汃獵整⹲敃汬央‬汃獵整⹲敃汬娮 ‫敃汬晏獦瑥 ‪敃汬楓敺਻ऊ䌉畬瑳牥䌮畯瑮㴠椠瑮㈳刨慥敤⹲敒摡慖䥲瑮⤨㬩ਊउ極瑮‸效摡湩啧㴠删慥敤⹲敒摡祂整⤨਻उ極瑮‸效摡湩噧㴠删慥敤⹲敒摡祂整⤨਻उ汦慯⁴灓敥⁤‽刨慥敤⹲敒摡祂整⤨⼠㈠㔵〮⥦⨠䴠硡灓敥㭤ऊ䌉畬瑳牥嘮汥捯瑩⁹‽敄潣敤楄敲瑣潩⡮效摡湩啧‬效摡湩噧 ‪灓敥㭤ਊउ晩⠠敒摡牥戮慆汩摥 ⁻畏䍴畬瑳牥⹳敒敳⡴㬩爠瑥牵⁮慦獬㭥素ऊ伉瑵汃獵整獲䄮摤䌨畬瑳牥㬩ऊ੽ऊ敲畴湲琠畲㭥紊
\ No newline at end of file
@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠汆捯佫瑣敲⹥≨ਊ潶摩䘠汆捯佫瑣敲㩥刺獥瑥⤨笊ऊ潎敤⹳敒敳⡴㬩ऊ湉楤散⹳敒敳⡴㬩ऊ潂摩潐楳楴湯⁳‽畮汬瑰㭲ऊ潂摩效摡湩獧㴠渠汵灬牴਻੽瘊楯⁤䙆潬正捏牴敥㨺畂汩⡤潣獮⁴䅔牲祡䘼敖瑣牯☾倠獯瑩潩獮‬潣獮⁴䅔牲祡䘼敖瑣牯☾䠠慥楤杮⥳笊ऊ敒敳⡴㬩ਊ⼉振敨正映牯瘠污摩椠灮瑵ऊ晩⠠潐楳楴湯⹳畎⡭ 㴽〠簠⁼潐楳楴湯⹳畎⡭ 㴡䠠慥楤杮⹳畎⡭⤩笠爠瑥牵㭮素ਊ䈉楯偤獯瑩潩獮㴠☠潐楳楴湯㭳ऊ潂摩效摡湩獧㴠☠效摡湩獧਻ऊ⼯敧⁴潢湵獤漠⁦汦捯⁫湡⁤硥慰摮琠⁯⁡畣敢猠⁯捯慴瑮⁳瑳祡挠扵捩⠠⁡煳慵敲映牯瀠慬慮⁲牴敥ⱳ戠楯獤搠湯琧猠牰慥⁤污湯⁧⥚ऊ䉆硯䘠潬正潂湵獤倨獯瑩潩獮䜮瑥慄慴⤨‬潐楳楴湯⹳畎⡭⤩਻䘉敖瑣牯䔠瑸湥⁴‽汆捯䉫畯摮⹳敇䕴瑸湥⡴㬩ऊ汦慯⁴慈晬楓敺㴠⠠偢慬慮⁲‿䵆瑡㩨䴺硡䔨瑸湥⹴ⱘ䔠瑸湥⹴⥙㨠䘠慍桴㨺慍㍸䔨瑸湥⹴ⱘ䔠瑸湥⹴ⱙ䔠瑸湥⹴⥚ ‫⸱昰਻ऊ⼯癥牥⁹潢摩猠慴瑲⁳湩琠敨爠潯⁴潮敤ऊ湉楤散⹳敓乴浵湕湩瑩慩楬敺⡤潐楳楴湯⹳畎⡭⤩਻匉牣瑡档湉楤散⹳敓乴浵湕湩瑩慩楬敺⡤潐楳楴湯⹳畎⡭⤩਻昉牯⠠湩㍴′⁩‽㬰椠㰠䤠摮捩獥丮浵⤨※⬫⥩ऊ੻उ湉楤散孳嵩㴠椠਻紉ਊ䘉汆捯佫瑣敲乥摯⁥潒瑯਻刉潯⹴敃瑮牥㴠䘠潬正潂湵獤䜮瑥敃瑮牥⤨਻刉潯⹴慈晬楓敺㴠䠠污卦穩㭥ऊ潒瑯䘮物瑳湉敤⁸‽㬰ऊ潒瑯䌮畯瑮㴠倠獯瑩潩獮丮浵⤨਻刉潯⹴楆獲䍴楨摬㴠䤠䑎塅也乏㭅ऊ潒瑯倮獯瑩潩卮浵㴠䘠敖瑣牯㨺敚潲敖瑣牯਻刉潯⹴效摡湩卧浵㴠䘠敖瑣牯㨺敚潲敖瑣牯਻三摯獥䄮摤刨潯⥴਻ऊ畂汩乤摯⡥ⰰ〠㬩紊ਊ潶摩䘠汆捯佫瑣敲㩥䈺極摬潎敤椨瑮㈳丠摯䥥摮硥‬湩㍴′敄瑰⥨笊ऊ⼯潣祰渠摯⁥慶畬獥‬潎敤⁳牡慲⁹慣⁮敲污潬慣整眠楨敬挠楨摬敲⁮牡⁥摡敤੤按湯瑳䘠敖瑣牯䌠湥整⁲‽潎敤孳潎敤湉敤嵸䌮湥整㭲ऊ潣獮⁴汦慯⁴慈晬楓敺㴠丠摯獥乛摯䥥摮硥⹝慈晬楓敺਻按湯瑳椠瑮㈳䘠物瑳湉敤⁸‽潎敤孳潎敤湉敤嵸䘮物瑳湉敤㭸ऊ潣獮⁴湩㍴′潃湵⁴‽潎敤孳潎敤湉敤嵸䌮畯瑮਻ऊ⼯敬晡渠摯ⱥ猠浵甠⁰条牧来瑡獥漠⁦桴⁥潢摩⁳湩楳敤椠ੴ椉⁦䌨畯瑮㰠‽慍䱸慥卦穩⁥籼䐠灥桴㸠‽慍䑸灥桴਩笉ऊ䘉敖瑣牯倠獯瑩潩卮浵㴠䘠敖瑣牯㨺敚潲敖瑣牯਻उ噆捥潴⁲效摡湩卧浵㴠䘠敖瑣牯㨺敚潲敖瑣牯਻उ潦⁲椨瑮㈳椠㴠䘠物瑳湉敤㭸椠㰠䘠物瑳湉敤⁸‫潃湵㭴⬠椫਩उ੻उ倉獯瑩潩卮浵⬠‽⨨潂摩潐楳楴湯⥳䥛摮捩獥楛嵝਻उ䠉慥楤杮畓⁭㴫⠠䈪楯䡤慥楤杮⥳䥛摮捩獥楛嵝਻उ੽उ潎敤孳潎敤湉敤嵸倮獯瑩潩卮浵㴠倠獯瑩潩卮浵਻उ潎敤孳潎敤湉敤嵸䠮慥楤杮畓⁭‽效摡湩卧浵਻उ敲畴湲਻紉ਊ⼉振畯瑮戠楯獤瀠牥漠瑣湡ੴ按湯瑳椠瑮㈳丠浵桃汩牤湥㴠䜠瑥畎䍭楨摬敲⡮㬩ऊ湩㍴′捏慴瑮潃湵獴㡛⁝‽⁻‰㭽ऊ潦⁲椨瑮㈳椠㴠䘠物瑳湉敤㭸椠㰠䘠物瑳湉敤⁸‫潃湵㭴⬠椫਩笉ऊ按湯瑳䘠敖瑣牯…潐楳楴湯㴠⠠䈪楯偤獯瑩潩獮嬩湉楤散孳嵩㭝ऊ椉瑮㈳传瑣湡⁴‽敇佴瑣湡⡴敃瑮牥‬潐楳楴湯㬩ऊ伉瑣湡䍴畯瑮孳捏慴瑮⭝㬫ऊ੽ऊ⼯慰瑲瑩潩⁮湩楤散⁳潳攠捡⁨捯慴瑮漠湷⁳⁡潣瑮杩潵獵爠湡敧ऊ湩㍴′捏慴瑮晏獦瑥孳崸਻椉瑮㈳删湵楮杮晏獦瑥㴠䘠物瑳湉敤㭸ऊ潦⁲椨瑮㈳传瑣湡⁴‽㬰传瑣湡⁴‼畎䍭楨摬敲㭮⬠伫瑣湡⥴ऊ੻उ捏慴瑮晏獦瑥孳捏慴瑮⁝‽畒湮湩佧晦敳㭴ऊ刉湵楮杮晏獦瑥⬠‽捏慴瑮潃湵獴佛瑣湡嵴਻紉ऊ湩㍴′牗瑩佥晦敳獴㡛㭝ऊ䵆浥牯㩹䴺浥灣⡹牗瑩佥晦敳獴‬捏慴瑮晏獦瑥ⱳ猠穩潥⡦牗瑩佥晦敳獴⤩਻昉牯⠠湩㍴′⁩‽楆獲䥴摮硥※⁩‼楆獲䥴摮硥⬠䌠畯瑮※⬫⥩ऊ੻उ潣獮⁴噆捥潴♲倠獯瑩潩⁮‽⨨潂摩潐楳楴湯⥳䥛摮捩獥楛嵝਻उ湩㍴′捏慴瑮㴠䜠瑥捏慴瑮䌨湥整Ⱳ倠獯瑩潩⥮਻उ捓慲捴䥨摮捩獥坛楲整晏獦瑥孳捏慴瑮⭝崫㴠䤠摮捩獥楛㭝ऊ੽䘉敍潭祲㨺敍捭祰☨湉楤散孳楆獲䥴摮硥ⱝ☠捓慲捴䥨摮捩獥䙛物瑳湉敤嵸‬潃湵⁴‪楳敺景椨瑮㈳⤩਻ऊ⼯牣慥整挠楨摬敲੮按湯瑳椠瑮㈳䘠物瑳桃汩⁤‽潎敤⹳畎⡭㬩ऊ潣獮⁴汦慯⁴桃汩䡤污卦穩⁥‽慈晬楓敺⨠〠㔮㭦ऊ潦⁲椨瑮㈳传瑣湡⁴‽㬰传瑣湡⁴‼畎䍭楨摬敲㭮⬠伫瑣湡⥴ऊ੻उ䙆潬正捏牴敥潎敤䌠楨摬਻उ桃汩⹤敃瑮牥堮㴠䌠湥整⹲⁘‫⠨捏慴瑮☠ㄠ ‿桃汩䡤污卦穩⁥›䌭楨摬慈晬楓敺㬩ऊ䌉楨摬䌮湥整⹲⁙‽敃瑮牥央⬠⠠伨瑣湡⁴…⤲㼠䌠楨摬慈晬楓敺㨠ⴠ桃汩䡤污卦穩⥥਻उ桃汩⹤敃瑮牥娮㴠戠汐湡牡㼠䌠湥整⹲⁚›敃瑮牥娮⬠⠠伨瑣湡⁴…⤴㼠䌠楨摬慈晬楓敺㨠ⴠ桃汩䡤污卦穩⥥਻उ桃汩⹤慈晬楓敺㴠䌠楨摬慈晬楓敺਻उ桃汩⹤楆獲䥴摮硥㴠传瑣湡佴晦敳獴佛瑣湡嵴਻उ桃汩⹤潃湵⁴‽捏慴瑮潃湵獴佛瑣湡嵴਻उ桃汩⹤楆獲䍴楨摬㴠䤠䑎塅也乏㭅ऊ䌉楨摬倮獯瑩潩卮浵㴠䘠敖瑣牯㨺敚潲敖瑣牯਻उ桃汩⹤效摡湩卧浵㴠䘠敖瑣牯㨺敚潲敖瑣牯਻उ潎敤⹳摁⡤桃汩⥤਻紉ऊ潎敤孳潎敤湉敤嵸䘮物瑳桃汩⁤‽楆獲䍴楨摬਻ऊ⼯畢汩⁤档汩牤湥愠摮猠浵琠敨物愠杧敲慧整⁳湩潴琠楨⁳潮敤ऊ噆捥潴⁲潐楳楴湯畓⁭‽噆捥潴㩲娺牥噯捥潴㭲ऊ噆捥潴⁲效摡湩卧浵㴠䘠敖瑣牯㨺敚潲敖瑣牯਻昉牯⠠湩㍴′捏慴瑮㴠〠※捏慴瑮㰠丠浵桃汩牤湥※⬫捏慴瑮਩笉ऊ椉⁦伨瑣湡䍴畯瑮孳捏慴瑮⁝‾⤰ऊ笉ऊउ畂汩乤摯⡥楆獲䍴楨摬⬠传瑣湡ⱴ䐠灥桴⬠ㄠ㬩ऊउ潐楳楴湯畓⁭㴫丠摯獥䙛物瑳桃汩⁤‫捏慴瑮⹝潐楳楴湯畓㭭ऊउ效摡湩卧浵⬠‽潎敤孳楆獲䍴楨摬⬠传瑣湡嵴䠮慥楤杮畓㭭ऊ紉ऊ੽三摯獥乛摯䥥摮硥⹝潐楳楴湯畓⁭‽潐楳楴湯畓㭭ऊ潎敤孳潎敤湉敤嵸䠮慥楤杮畓⁭‽效摡湩卧浵਻੽䘊汆捯䅫杧敲慧整䘠汆捯佫瑣敲㩥儺敵祲杁牧来瑡⡥潣獮⁴噆捥潴♲䰠捯瑡潩Ɱ挠湯瑳䘠敖瑣牯…潆睲牡Ɽ映潬瑡删摡畩ⱳ映潬瑡䌠桯獥潩䙮噏‬汦慯⁴汁杩浮湥䙴噏‬汦慯⁴灏湥湩䅧杮敬‬湩㍴′硅汣摵䥥摮硥 潣獮ੴ੻䘉汆捯䅫杧敲慧整删獥汵㭴ਊ⼉振敨正琠敲⁥慨⁳敢湥戠極瑬ऊ晩⠠潎敤⹳畎⡭ 㴽〠 ⁻敲畴湲删獥汵㭴素ਊ按湯瑳映潬瑡删摡畩即畱牡摥㴠删摡畩⁳‪慒楤獵਻按湯瑳椠瑮㈳丠浵桃汩牤湥㴠䜠瑥畎䍭楨摬敲⡮㬩ਊ吉牁慲㱹湩㍴ⰲ吠湉楬敮汁潬慣潴㱲㐶㸾丠摯卥慴正਻三摯卥慴正倮獵⡨⤰਻ऊ桷汩⁥丨摯卥慴正丮浵⤨㸠〠਩笉ऊ按湯瑳䘠汆捯佫瑣敲乥摯♥丠摯⁥‽潎敤孳潎敤瑓捡⹫潐⡰慦獬⥥㭝ऊ椉⁦丨摯⹥潃湵⁴㴽〠 ⁻潣瑮湩敵※੽ऊ⼉猯楫⁰潮敤⁳桴瑡愠敲挠浯汰瑥汥⁹畯獴摩⁥景琠敨瀠牥散瑰潩⁮慲楤獵ऊ䘉敖瑣牯䈠硯晏獦瑥㴠⠠潌慣楴湯ⴠ丠摯⹥敃瑮牥⸩敇䅴獢⤨ⴠ䘠敖瑣牯丨摯⹥慈晬楓敺㬩ऊ䘉敖瑣牯䌠潬敳瑳晏獦瑥㴠䈠硯晏獦瑥䌮浯潰敮瑮慍⡸噆捥潴㩲娺牥噯捥潴⥲਻उ晩⠠汃獯獥佴晦敳⹴楓敺煓慵敲⡤ ‾慒楤獵煓慵敲⥤笠挠湯楴畮㭥素ਊउ晩⠠両摯⹥獉敌晡⤨਩उ੻उ⼉振敨正椠⁦潮敤椠⁳慦⁲湥畯桧愠慷⁹潴戠⁥牴慥整⁤獡愠猠湩汧⁥汦捯浫瑡⁥渨摯⁥慣❮⁴潣瑮楡⁮桴⁥畱牥楹杮戠楯⥤ऊउ潢汯戠潃瑮楡獮潌慣楴湯㴠䈠硯晏獦瑥堮㰠‽⸰昰☠…潂佸晦敳⹴⁙㴼〠〮⁦☦䈠硯晏獦瑥娮㰠‽⸰昰਻उ椉⁦ℨ䍢湯慴湩䱳捯瑡潩⁮☦传数楮杮湁汧⁥‾⸰昰਩उ笉ऊउ䘉敖瑣牯䌠湥牴楯⁤‽潎敤倮獯瑩潩卮浵⼠丠摯⹥潃湵㭴ऊउ䘉敖瑣牯吠䍯湥牴楯⁤‽敃瑮潲摩ⴠ䰠捯瑡潩㭮ऊउ昉潬瑡䐠獩慴据⁥‽潔敃瑮潲摩匮穩⡥㬩ऊउ椉⁦䐨獩慴据⁥㴼删摡畩⁳☦⠠⸲昰⨠丠摯⹥慈晬楓敺 ‼灏湥湩䅧杮敬⨠䐠獩慴据⥥ऊउ笉ऊउउ⼯档捥⁫晩渠摯❥⁳散瑮牥漠⁦慭獳椠⁳湩楳敤攠捡⁨数捲灥楴湯映癯ऊउउ汦慯⁴敃瑮潲摩潄⁴‽噆捥潴㩲䐺瑯牐摯捵⡴潆睲牡Ɽ吠䍯湥牴楯⁤ 楄瑳湡散㬩ऊउउ晩⠠敃瑮潲摩潄⁴‾潃敨楳湯但⥖ऊउउ੻उउउ敒畳瑬倮獯瑩潩卮浵⬠‽潎敤倮獯瑩潩卮浵਻उउउ敒畳瑬䌮桯獥潩䍮畯瑮⬠‽潎敤䌮畯瑮਻उउ紉ऊउउ晩⠠敃瑮潲摩潄⁴‾汁杩浮湥䙴噏਩उउ笉ऊउउ刉獥汵⹴效摡湩卧浵⬠‽潎敤䠮慥楤杮畓㭭ऊउउ刉獥汵⹴汁杩浮湥䍴畯瑮⬠‽潎敤䌮畯瑮਻उउ紉ऊउउ潣瑮湩敵਻उउ੽उ紉ਊउ⼉港摯⁥獩琠潯挠潬敳‬灯湥椠⁴灵ऊउ潦⁲椨瑮㈳传瑣湡⁴‽㬰传瑣湡⁴‼畎䍭楨摬敲㭮⬠伫瑣湡⥴ऊउ੻उउ潎敤瑓捡⹫畐桳丨摯⹥楆獲䍴楨摬⬠传瑣湡⥴਻उ紉ऊउ潣瑮湩敵਻उ੽ऊ⼉氯慥⁦潮敤‬档捥⁫慥档戠楯⁤硥捡汴੹उ潦⁲椨瑮㈳椠㴠丠摯⹥楆獲䥴摮硥※⁩‼潎敤䘮物瑳湉敤⁸‫潎敤䌮畯瑮※⬫⥩ऊ笉ऊउ潣獮⁴湩㍴′潂摩湉敤⁸‽湉楤散孳嵩਻उ椉⁦䈨楯䥤摮硥㴠‽硅汣摵䥥摮硥 ⁻潣瑮湩敵※੽ऊउ噆捥潴⁲潔汆捯浫瑡⁥‽⨨潂摩潐楳楴湯⥳䉛楯䥤摮硥⁝‭潌慣楴湯਻उ椉⁦吨䙯潬正慭整匮穩卥畱牡摥⤨㸠删摡畩即畱牡摥 ⁻潣瑮湩敵※੽ऊउ汦慯⁴汆捯浫瑡䑥瑯㴠䘠敖瑣牯㨺潄側潲畤瑣䘨牯慷摲‬潔汆捯浫瑡⹥敇却晡乥牯慭⡬⤩਻उ椉⁦䘨潬正慭整潄⁴‾潃敨楳湯但⥖ऊउ੻उउ敒畳瑬倮獯瑩潩卮浵⬠‽⨨潂摩潐楳楴湯⥳䉛楯䥤摮硥㭝ऊउ刉獥汵⹴潃敨楳湯潃湵⭴㬫ऊउ੽उ椉⁦䘨潬正慭整潄⁴‾汁杩浮湥䙴噏਩उ笉ऊउ刉獥汵⹴效摡湩卧浵⬠‽⨨潂摩效摡湩獧嬩潂摩湉敤嵸਻उउ敒畳瑬䄮楬湧敭瑮潃湵⭴㬫ऊउ੽उ੽紉ਊ爉瑥牵⁮敒畳瑬਻੽瘊楯⁤䙆潬正捏牴敥㨺慇桴牥敎杩扨畯獲挨湯瑳䘠敖瑣牯…潌慣楴湯‬汦慯⁴慒楤獵‬湩㍴′硅汣摵䥥摮硥‬䅔牲祡椼瑮㈳☾传瑵敎杩扨畯獲‬湩㍴′慍乸楥桧潢牵⥳挠湯瑳笊ऊ畏乴楥桧潢牵⹳敒敳⡴㬩ਊ⼉振敨正琠敲⁥慨⁳敢湥戠極瑬ऊ晩⠠潎敤⹳畎⡭ 㴽〠 ⁻敲畴湲※੽ऊ潣獮⁴汦慯⁴慒楤獵煓慵敲⁤‽慒楤獵⨠删摡畩㭳ऊ潣獮⁴湩㍴′畎䍭楨摬敲⁮‽敇乴浵桃汩牤湥⤨਻ऊ䅔牲祡椼瑮㈳‬䥔汮湩䅥汬捯瑡牯㘼㸴‾潎敤瑓捡㭫ऊ潎敤瑓捡⹫畐桳〨㬩ਊ眉楨敬⠠潎敤瑓捡⹫畎⡭ ‾⤰ऊ੻उ潣獮⁴䙆潬正捏牴敥潎敤…潎敤㴠丠摯獥乛摯卥慴正倮灯昨污敳崩਻उ晩⠠潎敤䌮畯瑮㴠‽⤰笠挠湯楴畮㭥素ਊउ⼯歳灩渠摯獥琠慨⁴牡⁥潣灭敬整祬漠瑵楳敤漠⁦桴⁥慲楤獵ऊ䘉敖瑣牯䌠潬敳瑳晏獦瑥㴠⠠䰨捯瑡潩⁮‭潎敤䌮湥整⥲䜮瑥扁⡳ ‭噆捥潴⡲潎敤䠮污卦穩⥥⸩潃灭湯湥䵴硡䘨敖瑣牯㨺敚潲敖瑣牯㬩ऊ椉⁦䌨潬敳瑳晏獦瑥匮穩卥畱牡摥⤨㸠删摡畩即畱牡摥 ⁻潣瑮湩敵※੽ऊ椉⁦ℨ潎敤䤮䱳慥⡦⤩ऊ笉ऊउ潦⁲椨瑮㈳传瑣湡⁴‽㬰传瑣湡⁴‼畎䍭楨摬敲㭮⬠伫瑣湡⥴ऊउ੻उउ潎敤瑓捡⹫畐桳丨摯⹥楆獲䍴楨摬⬠传瑣湡⥴਻उ紉ऊउ潣瑮湩敵਻उ੽ऊ⼉氯慥⁦潮敤‬档捥⁫慥档戠楯⁤硥捡汴੹उ潦⁲椨瑮㈳椠㴠丠摯⹥楆獲䥴摮硥※⁩‼潎敤䘮物瑳湉敤⁸‫潎敤䌮畯瑮※⬫⥩ऊ笉ऊउ潣獮⁴湩㍴′潂摩湉敤⁸‽湉楤散孳嵩਻उ椉⁦䈨楯䥤摮硥℠‽硅汣摵䥥摮硥☠…噆捥潴㩲䐺獩却畱牡摥⠨䈪楯偤獯瑩潩獮嬩潂摩湉敤嵸‬潌慣楴湯 㴼删摡畩即畱牡摥਩उ笉ऊउ伉瑵敎杩扨畯獲䄮摤䈨楯䥤摮硥㬩ऊउ椉⁦伨瑵敎杩扨畯獲丮浵⤨㴠‽慍乸楥桧潢牵⥳笠爠瑥牵㭮素ऊउ੽उ੽紉紊ਊ湩㍴′䙆潬正捏牴敥㨺楆摮敌晡挨湯瑳䘠敖瑣牯…潌慣楴湯 潣獮ੴ੻⼉振敨正琠敲⁥慨⁳敢湥戠極瑬ऊ晩⠠潎敤⹳畎⡭ 㴽〠 ⁻敲畴湲䤠䑎塅也乏㭅素ਊ⼉搯獥散摮椠瑮⁯桴⁥捯慴瑮挠湯慴湩湩⁧潬慣楴湯甠瑮汩愠氠慥⁦獩爠慥档摥ऊ湩㍴′潎敤湉敤⁸‽㬰ऊ桷汩⁥ℨ潎敤孳潎敤湉敤嵸䤮䱳慥⡦⤩ऊ੻उ潣獮⁴噆捥潴♲䌠湥整⁲‽潎敤孳潎敤湉敤嵸䌮湥整㭲ऊ椉瑮㈳传瑣湡⁴‽敇佴瑣湡⡴敃瑮牥‬潌慣楴湯㬩ऊ三摯䥥摮硥㴠丠摯獥乛摯䥥摮硥⹝楆獲䍴楨摬⬠传瑣湡㭴ऊ੽ऊ敲畴湲丠摯䥥摮硥਻੽
\ No newline at end of file
@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠汆捯剫汥祡潃灭湯湥⹴≨⌊湩汣摵⁥䘢潬正慍慮敧⹲≨ਊ䙕潬正敒慬䍹浯潰敮瑮㨺䙕潬正敒慬䍹浯潰敮瑮⤨笊ऊ⼯敲慬⁹湯祬猠湥獤眠敨⁮瑩⁳汦捯⁫慭慮敧⁲整汬⁳瑩琠੯倉楲慭祲潃灭湯湥呴捩⹫䍢湡癅牥楔正㴠映污敳਻匉瑥獉敒汰捩瑡摥祂敄慦汵⡴牴敵㬩ਊ䘉潬正慍慮敧⁲‽畮汬瑰㭲ऊ湓灡桳瑯即湩散敋晹慲敭㴠〠਻匉慮獰潨䍴畯瑮㴠〠਻੽瘊楯⁤䙕潬正敒慬䍹浯潰敮瑮㨺汃敩瑮敒散癩䙥潬正敋晹慲敭䥟灭敬敭瑮瑡潩⡮䙁潬正慍慮敧⩲䴠湡条牥‬潣獮⁴䅔牲祡甼湩㡴☾倠捡敫⥴笊ऊ晩⠠慍慮敧⥲ऊ੻उ慍慮敧⵲刾捥楥敶汆捯卫慮獰潨⡴慐正瑥㬩ऊ੽੽瘊楯⁤䙕潬正敒慬䍹浯潰敮瑮㨺汃敩瑮敒散癩䙥潬正敄瑬彡浉汰浥湥慴楴湯䄨汆捯䵫湡条牥‪慍慮敧Ⱳ挠湯瑳吠牁慲㱹極瑮㸸…慐正瑥਩੻椉⁦䴨湡条牥਩笉ऊ䴉湡条牥㸭敒散癩䙥潬正湓灡桳瑯倨捡敫⥴਻紉紊ਊ潶摩唠汆捯剫汥祡潃灭湯湥㩴䌺楬湥剴捥楥敶汆捯䍫畬瑳牥彳浉汰浥湥慴楴湯䄨汆捯䵫湡条牥‪慍慮敧Ⱳ挠湯瑳吠牁慲㱹極瑮㸸…慐正瑥਩੻椉⁦䴨湡条牥਩笉ऊ䴉湡条牥㸭敒散癩䙥潬正汃獵整獲倨捡敫⥴਻紉紊
\ No newline at end of file
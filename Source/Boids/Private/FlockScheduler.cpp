@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠汆捯卫档摥汵牥栮ਢ椣据畬敤∠汆捯䵫湡条牥栮ਢ椣据畬敤∠䅈⽌䍉湯潳敬慍慮敧⹲≨⌊湩汣摵⁥䈢楯獤䈯楯獤栮ढउउ⼉甯敳⁤潦⁲瑳瑡⁳牧畯⁰匢䅔䝔佒偕䉟楯獤ਢ䐊䍅䅌䕒䍟䍙䕌卟䅔⡔䕔员∨汆捯⁫湉整牧瑡⁥桃湵≫Ⱙ匠䅔彔汆捯䥫瑮来慲整桃湵Ⱬ匠䅔䝔佒偕䉟楯獤㬩䐊䍅䅌䕒䍟䍙䕌卟䅔⡔䕔员∨汆捯⁫灓瑡慩⁬湉敤≸Ⱙ匠䅔彔汆捯卫慰楴污湉敤ⱸ匠䅔䝔佒偕䉟楯獤㬩䐊䍅䅌䕒䍟䍙䕌卟䅔⡔䕔员∨汆捯⁫敎杩扨畯⁲楌瑳䌠畨歮⤢‬呓呁䙟潬正敎杩扨畯䱲獩䍴畨歮‬呓呁則問彐潂摩⥳਻䕄䱃剁彅奃䱃彅呓呁吨塅⡔䘢潬正匠楴捴⁨敎杩扨畯⁲楌瑳≳Ⱙ匠䅔彔汆捯卫楴捴乨楥桧潢牵楌瑳ⱳ匠䅔䝔佒偕䉟楯獤㬩䐊䍅䅌䕒䍟䍙䕌卟䅔⡔䕔员∨汆捯⁫瑓敥楲杮䌠畨歮⤢‬呓呁䙟潬正瑓敥楲杮桃湵Ⱬ匠䅔䝔佒偕䉟楯獤㬩䐊䍅䅌䕒䍟䍙䕌卟䅔⡔䕔员∨汆捯⁫潃灭敬整匠浩汵瑡潩≮Ⱙ匠䅔彔汆捯䍫浯汰瑥卥浩汵瑡潩Ɱ匠䅔䝔佒偕䉟楯獤㬩ਊ⼯浳污敬瑳挠畨歮猠穩ⱥ猠慭汬牥挠畨歮⁳潣瑳洠牯⁥湩琠獡⁫癯牥敨摡琠慨⁮桴祥朠楡⁮湩戠污湡散猊慴楴⁣潣獮⁴湩㍴′汆捯卫档摥汵牥楍䍮畨歮楓敺㴠ㄠ㬶ਊ瑳瑡捩吠畁潴潃獮汯噥牡慩汢㱥湩㍴㸲䌠慖䙲潬正捓敨畤敬䍲畨歮楓敺ਨ吉塅⡔䈢楯獤匮档摥汵牥䌮畨歮楓敺⤢ਬ㈉㘵ਬ吉塅⡔丢浵敢⁲景戠楯獤洠癯摥愠摮猠整牥摥戠⁹湯⁥慴歳漠⁦桴⁥桳牡摥映潬正猠档摥汵牥‬浳污敬⁲档湵獫戠污湡散戠瑥整⁲畢⁴潣瑳洠牯⁥慴歳⁳瘨污敵⁳敢潬⁷㘱愠敲爠楡敳⁤潴ㄠ⤶∮Ⱙऊ䍅䙖䑟晥畡瑬㬩猊慴楴⁣䅔瑵䍯湯潳敬慖楲扡敬椼瑮㈳‾噃牡汆捯卫档摥汵牥潌卧慴獴ਨ吉塅⡔䈢楯獤匮档摥汵牥䰮杯瑓瑡≳Ⱙऊⰰऊ䕔员∨潌⁧潷歲‬灳湡愠摮眠牯敫⁲瑵汩穩瑡潩⁮景琠敨猠慨敲⁤汦捯⁫捳敨畤敬⁲癥牥⁹敦⁷敳潣摮⁳〨㴠漠晦⸩⤢ਬ䔉噃彆敄慦汵⥴਻䘊片灡䕨敶瑮敒⁦䙕潬正捓敨畤敬卲扵祳瑳浥㨺捓敨畤敬汆捯⡫䙁潬正慍慮敧⩲䘠潬正慍慮敧Ⱳ映潬瑡䐠汥慴楔敭਩੻按敨正䤨䥳䝮浡呥牨慥⡤⤩਻椉⁦ℨ䕢灸楬楣䙴慲敭⥳ऊ੻उ瑓牡䙴慲敭䜨牆浡䍥畯瑮牥㬩ऊ੽ऊ⼯摡⁤汦捯⁫潴琠敨映慲敭猧氠慯獤ऊ潣獮⁴湩㍴′畎䍭畨歮⁳‽汆捯䵫湡条牥㸭瑓敥楲杮桃湵獫丮浵⤨਻椉瑮㈳䰠慯䥤摮硥਻笉ऊ䘉捓灯䱥捯⁫潌正☨潌摡潌正㬩ऊ䰉慯䥤摮硥㴠䰠慯獤䄮摤敄慦汵整⡤㬩ऊ䰉慯獤䱛慯䥤摮硥⹝汆捯䵫湡条牥㴠䘠潬正慍慮敧㭲ऊ䰉慯獤䱛慯䥤摮硥⹝畎䉭楯獤㴠䘠潬正慍慮敧⵲䘾潬正瑓瑡⹥畎⡭㬩ऊ䰉慯獤䱛慯䥤摮硥⹝畎呭獡獫㴠丠浵桃湵獫⨠㌠⬠㌠਻紉ऊ潣獮⁴極瑮㐶䘠慲敭㴠䰠慯䙤慲敭਻按湯瑳搠畯汢⁥捓敨畤敬楔敭㴠䘠汐瑡潦浲楔敭㨺敓潣摮⡳㬩ऊ汆捯䵫湡条牥㸭敂楧卮浩汵瑡潩⡮㬩ਊ⼉振畨歮⁳潭敶琠敨物漠湷戠楯獤ऊ䝆慲桰癅湥䅴牲祡䤠瑮来慲整癅湥獴਻䤉瑮来慲整癅湥獴刮獥牥敶丨浵桃湵獫㬩ऊ潦⁲椨瑮㈳䌠畨歮湉敤⁸‽㬰䌠畨歮湉敤⁸‼畎䍭畨歮㭳⬠䌫畨歮湉敤⥸ऊ੻उ湉整牧瑡䕥敶瑮⹳摁⡤䙆湵瑣潩䝮慲桰慔歳㨺牃慥整湁䑤獩慰捴坨敨剮慥祤嬨汆捯䵫湡条牥‬桃湵䥫摮硥‬敄瑬呡浩嵥⤨ऊ笉ऊउ汆捯䵫湡条牥㸭湉整牧瑡䍥畨歮䌨畨歮湉敤ⱸ䐠汥慴楔敭㬩ऊ紉‬䕇彔呓呁䑉匨䅔彔汆捯䥫瑮来慲整桃湵⥫‬畮汬瑰Ⱳ䔠慎敭呤牨慥獤㨺湁䡹偩楲桔敲摡楈牐呩獡⥫㬩ऊ੽ऊ⼯捯牴敥愠摮焠慵瑮穩摥映潬正慭整⁳牡⁥畢汩⁴祢漠敮琠獡⁫湯散攠敶祲戠楯⁤慨⁳潭敶੤䘉片灡䕨敶瑮牁慲⁹湉敤䕸敶瑮㭳ऊ湉敤䕸敶瑮⹳摁⡤䙆湵瑣潩䝮慲桰慔歳㨺牃慥整湁䑤獩慰捴坨敨剮慥祤嬨汆捯䵫湡条牥⡝਩笉ऊ䘉潬正慍慮敧⵲䈾極摬灓瑡慩䥬摮硥⤨਻紉‬䕇彔呓呁䑉匨䅔彔汆捯卫慰楴污湉敤⥸‬䤦瑮来慲整癅湥獴‬久浡摥桔敲摡㩳䄺祮楈牐呩牨慥䡤偩楲慔歳⤩਻ऊ⼯档湵獫朠瑡敨⁲桴楥⁲潢摩❳渠楥桧潢牵氠獩獴映潲⁭桴⁥捯牴敥⠠敲畴湲湩⁧瑡漠据⁥桷汩⁥楬瑳⁳牡⁥敲獵摥 湡⁤湯⁥慴歳猠楴捴敨⁳桴浥琠杯瑥敨ੲ䘉片灡䕨敶瑮牁慲⁹楌瑳癅湥獴਻䰉獩䕴敶瑮⹳敒敳癲⡥畎䍭畨歮⥳਻昉牯⠠湩㍴′桃湵䥫摮硥㴠〠※桃湵䥫摮硥㰠丠浵桃湵獫※⬫桃湵䥫摮硥਩笉ऊ䰉獩䕴敶瑮⹳摁⡤䙆湵瑣潩䝮慲桰慔歳㨺牃慥整湁䑤獩慰捴坨敨剮慥祤嬨汆捯䵫湡条牥‬桃湵䥫摮硥⡝਩उ੻उ䘉潬正慍慮敧⵲䜾瑡敨乲楥桧潢牵楌瑳桃湵⡫桃湵䥫摮硥㬩ऊ紉‬䕇彔呓呁䑉匨䅔彔汆捯乫楥桧潢牵楌瑳桃湵⥫‬䤦摮硥癅湥獴‬久浡摥桔敲摡㩳䄺祮楈牐呩牨慥䡤偩楲慔歳⤩਻紉ऊ䝆慲桰癅湥䅴牲祡匠楴捴䕨敶瑮㭳ऊ瑓瑩档癅湥獴䄮摤䘨畆据楴湯片灡周獡㩫䌺敲瑡䅥摮楄灳瑡档桗湥敒摡⡹䙛潬正慍慮敧嵲⤨ऊ੻उ汆捯䵫湡条牥㸭瑓瑩档敎杩扨畯䱲獩獴⤨਻紉‬䕇彔呓呁䑉匨䅔彔汆捯卫楴捴乨楥桧潢牵楌瑳⥳‬䰦獩䕴敶瑮ⱳ䔠慎敭呤牨慥獤㨺湁䡹偩楲桔敲摡楈牐呩獡⥫㬩ਊ⼉猯整牥湩⁧档湵獫漠汮⁹牷瑩⁥桴楥⁲睯⁮潢摩ⱳ眠牯敫獲瀠捩⁫桴浥甠⁰污湯獧摩⁥桴⁥档湵獫漠⁦癥牥⁹瑯敨⁲汦捯੫䘉片灡䕨敶瑮牁慲⁹桃湵䕫敶瑮㭳ऊ桃湵䕫敶瑮⹳敒敳癲⡥畎䍭畨歮⥳਻昉牯⠠湩㍴′桃湵䥫摮硥㴠〠※桃湵䥫摮硥㰠丠浵桃湵獫※⬫桃湵䥫摮硥਩笉ऊ䌉畨歮癅湥獴䄮摤䘨畆据楴湯片灡周獡㩫䌺敲瑡䅥摮楄灳瑡档桗湥敒摡⡹䙛潬正慍慮敧Ⱳ䌠畨歮湉敤ⱸ䐠汥慴楔敭⡝਩उ੻उ䘉潬正慍慮敧⵲匾整牥桃湵⡫桃湵䥫摮硥‬敄瑬呡浩⥥਻उⱽ䜠呅卟䅔䥔⡄呓呁䙟潬正瑓敥楲杮桃湵⥫‬匦楴捴䕨敶瑮ⱳ䔠慎敭呤牨慥獤㨺湁䡹偩楲桔敲摡楈牐呩獡⥫㬩ऊ੽ऊ⼯潣灭敬楴湯洠牥敧⁳档湵⁫敲畳瑬ⱳ椠獴攠敶瑮椠⁳桴⁥汦捯❫⁳潣灭敬楴湯攠敶瑮ऊ敲畴湲䘠畆据楴湯片灡周獡㩫䌺敲瑡䅥摮楄灳瑡档桗湥敒摡⡹瑛楨ⱳ䘠潬正慍慮敧Ⱳ䘠慲敭‬潌摡湉敤ⱸ匠档摥汵呥浩嵥⤨ऊ੻उ汆捯䵫湡条牥㸭潃灭敬整楓畭慬楴湯⤨਻उ敒潣摲汆捯䱫慯⡤牆浡ⱥ䰠慯䥤摮硥‬汆捯䵫湡条牥㸭慌瑳楓呭浩䵥ⱳ匠档摥汵呥浩⥥਻紉‬䕇彔呓呁䑉匨䅔彔汆捯䍫浯汰瑥卥浩汵瑡潩⥮‬䌦畨歮癅湥獴‬久浡摥桔敲摡㩳䄺祮楈牐呩牨慥䡤偩楲慔歳㬩紊ਊ湩㍴′䙕潬正捓敨畤敬卲扵祳瑳浥㨺敇䍴畨歮楓敺⤨挠湯瑳笊ऊ敲畴湲䘠慍桴㨺慍⡸噃牡汆捯卫档摥汵牥桃湵卫穩⹥敇噴污敵湏慇敭桔敲摡⤨‬汆捯卫档摥汵牥楍䍮畨歮楓敺㬩紊ਊ䅔牲祡䘼汆捯䱫慯㹤唠汆捯卫档摥汵牥畓獢獹整㩭䜺瑥牆浡䱥慯獤⤨挠湯瑳笊ऊ卆潣数潌正䰠捯⡫䰦慯䱤捯⥫਻爉瑥牵⁮牆浡䱥慯獤਻੽昊潬瑡唠汆捯卫档摥汵牥畓獢獹整㩭䜺瑥瑕汩穩瑡潩⡮ 潣獮ੴ੻按湯瑳椠瑮㈳丠浵潗歲牥⁳‽䵆瑡㩨䴺硡䘨慔歳片灡䥨瑮牥慦散㨺敇⡴⸩敇乴浵潗歲牥桔敲摡⡳Ⱙㄠ㬩ऊ敲畴湲匠慰䵮⁳‾⸰昰㼠䘠慍桴㨺楍⡮潗歲獍⼠⠠灓湡獍⨠丠浵潗歲牥⥳‬⸱昰 ›⸰昰਻੽瘊楯⁤䙕潬正捓敨畤敬卲扵祳瑳浥㨺敂楧䙮慲敭用湩㙴‴牆浡䥥⥤笊ऊ档捥⡫獉湉慇敭桔敲摡⤨㬩ऊ䕢灸楬楣䙴慲敭⁳‽牴敵਻匉慴瑲牆浡⡥牆浡䥥⥤਻੽瘊楯⁤䙕潬正捓敨畤敬卲扵祳瑳浥㨺瑓牡䙴慲敭用湩㙴‴牆浡䥥⥤笊ऊ晩⠠潌摡牆浡⁥㴽䘠慲敭摉 ⁻敲畴湲※੽ऊ⼯畳⁭潬摡⁳景琠敨氠獡⁴牦浡ⱥ映潬正⁳桴瑡栠癡湥琧爠捥牯敤⁤桴楥⁲潬摡礠瑥愠敲氠晥⁴畯⁴景琠敨猠慰੮昉潬瑡䘠慲敭潗歲獍㴠〠〮㭦ऊ湩㍴′牆浡呥獡獫㴠〠਻笉ऊ䘉捓灯䱥捯⁫潌正☨潌摡潌正㬩ऊ昉牯⠠潣獮⁴䙆潬正潌摡…潌摡㨠䰠慯獤਩उ੻उ䘉慲敭潗歲獍⬠‽潌摡圮牯䵫㭳ऊउ牆浡呥獡獫⬠‽潌摡丮浵慔歳㭳ऊ紉ऊ按湯瑳映潬瑡䘠慲敭灓湡獍㴠䘠慲敭湅呤浩⁥‾牆浡卥慴瑲楔敭㼠映潬瑡⠨牆浡䕥摮楔敭ⴠ䘠慲敭瑓牡呴浩⥥⨠ㄠ〰⸰⤰㨠〠〮㭦ਊउ晩⠠潌摡⹳畎⡭ ‾⤰ऊ笉ऊउ潗歲獍㴠䘠慍桴㨺敌灲在牯䵫ⱳ䘠慲敭潗歲獍‬⸰昱㬩ऊउ灓湡獍㴠䘠慍桴㨺敌灲匨慰䵮ⱳ䘠慲敭灓湡獍‬⸰昱㬩ऊउ畎䙭潬正⁳‽䵆瑡㩨䰺牥⡰畎䙭潬正ⱳ映潬瑡䰨慯獤丮浵⤨Ⱙ〠ㄮ⥦਻उ三浵慔歳⁳‽䵆瑡㩨䰺牥⡰畎呭獡獫‬汦慯⡴牆浡呥獡獫Ⱙ〠ㄮ⥦਻उ੽ऊ⼉猯慴瑲渠睥映慲敭ऊ䘉慲敭潌摡⁳‽潍敶敔灭䰨慯獤㬩ऊ䰉慯獤刮獥瑥⤨਻उ潌摡牆浡⁥‽牆浡䥥㭤ऊ䘉慲敭瑓牡呴浩⁥‽偆慬晴牯呭浩㩥区捥湯獤⤨਻उ牆浡䕥摮楔敭㴠䘠慲敭瑓牡呴浩㭥ऊ੽ऊ⼯潬⁧潬摡漠⁦污⁬汦捯獫ऊ晩⠠噃牡汆捯卫档摥汵牥潌卧慴獴䜮瑥慖畬佥䝮浡呥牨慥⡤ 㴡〠☠…牆浡卥慴瑲楔敭ⴠ匠慴獴潌呧浩⁥㴾㔠〮਩笉ऊ匉慴獴潌呧浩⁥‽牆浡卥慴瑲楔敭਻उ䕕䱟䝏䰨杯敔灭‬潌Ⱨ吠塅⡔䘢潬正猠档摥汵牥›⸥昱映潬正⁳湩┠〮⁦慴歳ⱳ┠㈮⁦獭眠牯⁫湩┠㈮⁦獭猠慰⁮湯┠⁤潷歲牥⁳┨〮╦‥瑵汩穩瑡潩⥮椠⁮潗汲㩤┠⹳⤢ਬउ三浵汆捯獫‬畎呭獡獫‬潗歲獍‬灓湡獍‬呆獡䝫慲桰湉整晲捡㩥䜺瑥⤨䜮瑥畎坭牯敫呲牨慥獤⤨‬敇啴楴楬慺楴湯⤨⨠ㄠ〰〮ⱦ⨠敇坴牯摬⤨㸭敇乴浡⡥⤩਻紉紊ਊ潶摩唠汆捯卫档摥汵牥畓獢獹整㩭刺捥牯䙤潬正潌摡用湩㙴‴牆浡ⱥ椠瑮㈳䰠慯䥤摮硥‬汦慯⁴汆捯坫牯䵫ⱳ搠畯汢⁥捓敨畤敬楔敭਩੻䘉捓灯䱥捯⁫潌正☨潌摡潌正㬩ਊ⼉是潬正⁳潪湩摥愠瑦牥琠敨渠硥⁴牦浡⁥瑳牡整⁤牡⁥牤灯数⁤牦浯琠敨猠慴楴瑳捩ੳ椉⁦䘨慲敭℠‽潌摡牆浡⁥籼℠潌摡⹳獉慖楬䥤摮硥䰨慯䥤摮硥⤩笠爠瑥牵㭮素ਊ按湯瑳搠畯汢⁥湅呤浩⁥‽偆慬晴牯呭浩㩥区捥湯獤⤨਻䘉汆捯䱫慯♤䰠慯⁤‽潌摡孳潌摡湉敤嵸਻䰉慯⹤潗歲獍㴠䘠潬正潗歲獍਻䰉慯⹤灓湡獍㴠映潬瑡⠨湅呤浩⁥‭捓敨畤敬楔敭 ‪〱〰〮㬩ऊ牆浡䕥摮楔敭㴠䘠慍桴㨺慍⡸牆浡䕥摮楔敭‬湅呤浩⥥਻੽
\ No newline at end of file
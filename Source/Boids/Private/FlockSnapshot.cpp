@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠汆捯卫慮獰潨⹴≨⌊湩汣摵⁥䴢獩⽣楆敬效灬牥栮ਢ椣据畬敤∠敓楲污穩瑡潩⽮敍潭祲牗瑩牥栮ਢ椣据畬敤∠敓楲污穩瑡潩⽮敍潭祲敒摡牥栮ਢ椣据畬敤∠潂摩栮ਢ渊浡獥慰散笊ऊ⼯湳灡桳瑯戠湩牡⁹潦浲瑡瘠牥楳湯‬湩牣慥敳眠敨⁮档湡楧杮匠牥慩楬敺汆捯੫按湯瑳椠瑮㈳䘠潬正湓灡桳瑯敖獲潩⁮‽㬱ऊ⼯慴⁧瑡琠敨猠慴瑲漠⁦湳灡桳瑯映汩獥ऊ潣獮⁴極瑮㈳䘠潬正湓灡桳瑯楆敬慔⁧‽砰䈴㌴䌴㘴ऻ⼯䘢䍌≋紊ਊ潶摩唠汆捯卫慮獰潨䅴獳瑥㨺敓楲污穩䙥潬正䘨牁档癩♥䄠⥲笊ऊ湩㍴′敖獲潩⁮‽汆捯卫慮獰潨噴牥楳湯਻䄉⁲㰼嘠牥楳湯਻椉⁦䄨⹲獉潌摡湩⡧ ☦嘠牥楳湯℠‽汆捯卫慮獰潨噴牥楳湯਩笉ऊ⼉氯杯眠牡楮杮琠⁯潣獮汯੥उ䕕䱟䝏䰨杯敔灭‬慗湲湩Ⱨ吠塅⡔唢獮灵潰瑲摥瘠牥楳湯┠⁤湩映潬正猠慮獰潨㩴┠⹳⤢‬敖獲潩Ɱ⨠敇乴浡⡥⤩਻उ牁匮瑥牅潲⡲㬩ऊ爉瑥牵㭮ऊ੽ऊ⼯汦捯⁫敳瑴湩獧ऊ牁㰠‼慐慲敭整獲䴮硡灓敥㭤ऊ牁㰠‼慐慲敭整獲䴮湩灓敥㭤ऊ牁㰠‼慐慲敭整獲䄮楬湧敭瑮瑓敲杮桴਻䄉⁲㰼倠牡浡瑥牥⹳敓慰慲楴湯瑓敲杮桴਻䄉⁲㰼倠牡浡瑥牥⹳潃敨楳湯瑓敲杮桴਻䄉⁲㰼倠牡浡瑥牥⹳癁楯慤据卥牴湥瑧㭨ऊ牁㰠‼慐慲敭整獲匮灥牡瑡潩䙮噏਻䄉⁲㰼倠牡浡瑥牥⹳汁杩浮湥䙴噏਻䄉⁲㰼倠牡浡瑥牥⹳潃敨楳湯但㭖ਊ⼉戯楯⁤瑳瑡ⱥ眠楲瑴湥愠⁳潣瑮杩潵獵戠潬正⁳潳椠⁴潬摡⁳湩漠敮朠੯倉獯瑩潩獮䈮汵卫牥慩楬敺䄨⥲਻嘉汥捯瑩敩⹳畂歬敓楲污穩⡥牁㬩ऊ敍桳潒慴楴湯⹳畂歬敓楲污穩⡥牁㬩ਊ⼉振敨正愠牲祡⁳慭捴⁨晡整⁲潬摡湩੧椉⁦䄨⹲獉潌摡湩⡧ ☦⠠敖潬楣楴獥丮浵⤨℠‽潐楳楴湯⹳畎⡭ 籼䴠獥剨瑯瑡潩獮丮浵⤨℠‽潐楳楴湯⹳畎⡭⤩਩笉ऊ唉彅佌⡇潌呧浥Ɒ圠牡楮杮‬䕔员∨楍浳瑡档摥戠楯⁤瑳瑡⁥湩映潬正猠慮獰潨㩴┠⹳⤢‬䜪瑥慎敭⤨㬩ऊ倉獯瑩潩獮䔮灭祴⤨਻उ敖潬楣楴獥䔮灭祴⤨਻उ敍桳潒慴楴湯⹳浅瑰⡹㬩ऊ䄉⹲敓䕴牲牯⤨਻紉紊ਊ潶摩唠汆捯卫慮獰潨䅴獳瑥㨺敓楲污穩⡥䅆捲楨敶…牁਩੻匉灵牥㨺敓楲污穩⡥牁㬩ਊ匉牥慩楬敺汆捯⡫牁㬩紊ਊ潢汯唠汆捯卫慮獰潨䅴獳瑥㨺慓敶潔楆敬挨湯瑳䘠瑓楲杮…楆敬慐桴਩੻吉牁慲㱹極瑮㸸䘠汩䑥瑡㭡ऊ䵆浥牯坹楲整⁲牗瑩牥䘨汩䑥瑡⥡਻ऊ極瑮㈳䘠汩呥条㴠䘠潬正湓灡桳瑯楆敬慔㭧ऊ牗瑩牥㰠‼楆敬慔㭧ਊ⼉猯潴敲戠楯⁤祴数戠⁹慰桴猠湩散琠敨映汩⁥獩渠瑯愠⁮獡敳ੴ䘉瑓楲杮䈠楯呤灹健瑡⁨‽潂摩祔数㼠䈠楯呤灹ⵥ䜾瑥慐桴慎敭⤨㨠䘠瑓楲杮⤨਻圉楲整⁲㰼䈠楯呤灹健瑡㭨ਊ匉牥慩楬敺汆捯⡫牗瑩牥㬩ਊ爉瑥牵⁮䙆汩䡥汥数㩲区癡䅥牲祡潔楆敬䘨汩䑥瑡ⱡ⨠楆敬慐桴㬩紊ਊ潢汯唠汆捯卫慮獰潨䅴獳瑥㨺潌摡牆浯楆敬挨湯瑳䘠瑓楲杮…楆敬慐桴਩੻吉牁慲㱹極瑮㸸䘠汩䑥瑡㭡ऊ晩⠠䘡楆敬效灬牥㨺潌摡楆敬潔牁慲⡹楆敬慄慴‬䘪汩健瑡⥨ ⁻敲畴湲映污敳※੽ऊ䵆浥牯剹慥敤⁲敒摡牥䘨汩䑥瑡⥡਻ऊ極瑮㈳䘠汩呥条㴠〠਻刉慥敤⁲㰼䘠汩呥条਻椉⁦䘨汩呥条℠‽汆捯卫慮獰潨䙴汩呥条਩笉ऊ⼉氯杯眠牡楮杮琠⁯潣獮汯੥उ䕕䱟䝏䰨杯敔灭‬慗湲湩Ⱨ吠塅⡔䘢汩⁥獩渠瑯愠映潬正猠慮獰潨㩴┠⹳⤢‬䘪汩健瑡⥨਻उ敲畴湲映污敳਻紉ਊ䘉瑓楲杮䈠楯呤灹健瑡㭨ऊ敒摡牥㰠‼潂摩祔数慐桴਻椉⁦ℨ潂摩祔数慐桴䤮䕳灭祴⤨਩笉ऊ䈉楯呤灹⁥‽潌摡汃獡㱳䉁楯㹤渨汵灬牴‬䈪楯呤灹健瑡⥨਻紉ਊ匉牥慩楬敺汆捯⡫敒摡牥㬩ਊ爉瑥牵⁮刡慥敤⹲獉牅潲⡲㬩紊
\ No newline at end of file
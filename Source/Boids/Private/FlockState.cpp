@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠汆捯卫慴整栮ਢ渊浡獥慰散笊ऊ⼯灳敲摡琠敨氠睯牥ㄠ‰楢獴漠⁦⁡慶畬⁥潳琠敨敲愠敲㈠稠牥⁯楢獴戠瑥敷湥攠捡⁨楢⁴用敳⁤潴椠瑮牥敬癡⁥祸⁺湩潴愠䴠牯潴⁮潣敤਩甉湩㍴′灓敲摡楂獴用湩㍴′慖畬⥥ऊ੻उ慖畬⁥㴦〠へ〰〰䘳㭆ऊ嘉污敵㴠⠠慖畬⁥⁼嘨污敵㰠‼㘱⤩☠〠へ〳〰䘰㭆ऊ嘉污敵㴠⠠慖畬⁥⁼嘨污敵㰠‼⤸ …砰㌰〰う䘰਻उ慖畬⁥‽嘨污敵簠⠠慖畬⁥㰼㐠⤩☠〠へ〳㍃䌰㬳ऊ嘉污敵㴠⠠慖畬⁥⁼嘨污敵㰠‼⤲ …砰㤰㐲㈹㤴਻उ敲畴湲嘠污敵਻紉ਊ⼉爯潥摲牥愠牲祡猠⁯桴瑡攠敬敭瑮椠椠⁳慴敫⁮牦浯传摲牥楛੝琉浥汰瑡㱥祴数慮敭䔠敬敭瑮祔数ਾ瘉楯⁤灁汰佹摲牥吨牁慲㱹汅浥湥呴灹㹥…牁慲ⱹ挠湯瑳吠牁慲㱹湩㍴㸲…牏敤⥲ऊ੻उ䅔牲祡䔼敬敭瑮祔数‾潓瑲摥਻उ潓瑲摥匮瑥畎啭楮楮楴污穩摥䄨牲祡丮浵⤨㬩ऊ昉牯⠠湩㍴′⁩‽㬰椠㰠传摲牥丮浵⤨※⬫⥩ऊ笉ऊउ潓瑲摥楛⁝‽牁慲孹牏敤孲嵩㭝ऊ紉ऊ䄉牲祡㴠䴠癯呥浥⡰潓瑲摥㬩ऊ੽੽椊瑮㈳䘠汆捯卫慴整㨺摁⡤䉁楯⩤䈠楯Ɽ挠湯瑳䘠敖瑣牯…潐楳楴湯‬潣獮⁴噆捥潴♲嘠汥捯瑩ⱹ挠湯瑳䘠潒慴潴♲䴠獥剨瑯瑡潩⥮笊ऊ⼯敲獵⁥⁡牦敥猠潬⁴牯洠歡⁥⁡敮⁷湯੥椉瑮㈳匠潬⁴‽牆敥汓瑯⹳畎⡭ ‾‰‿牆敥汓瑯⹳潐⡰慦獬⥥㨠匠潬呴䥯摮硥䄮摤䤨䑎塅也乏⥅਻椉⁦匨潬⁴㴽匠潬䡴湡汤獥丮浵⤨਩笉ऊ按敨正匨潬⁴㴼䘠潬正慈摮敬汓瑯慍歳㬩ऊ匉潬䡴湡汤獥䄮摤匨潬⥴਻紉ऊ潣獮⁴湩㍴′慈摮敬㴠匠潬䡴湡汤獥卛潬嵴਻䰉祡畯噴牥楳湯⬫਻ऊ汓瑯潔湉敤學汓瑯⁝‽潐楳楴湯⹳摁⡤潐楳楴湯㬩ऊ敖潬楣楴獥䄮摤嘨汥捯瑩⥹਻䴉獥剨瑯瑡潩獮䄮摤䴨獥剨瑯瑡潩⥮਻⼉猯慴瑲戠楯獤愠⁴楤晦牥湥⁴潰湩獴漠⁦桴楥⁲楷杮戠慥⁴潳映潬正⁳潤❮⁴汦灡椠⁮湵獩湯ऊ汆灡桐獡獥䄮摤䘨慍桴㨺牆捡䠨湡汤⁥‪⸰ㄶ〸㐳⥦㬩ऊ汆灡晅潦瑲⹳摁⡤⸰昵㬩ऊ慂歮湁汧獥䄮摤〨〮⥦਻䈉楯獤䄮摤䈨楯⥤਻䠉湡汤獥䄮摤䠨湡汤⥥਻ऊ敲畴湲䠠湡汤㭥紊ਊ潶摩䘠汆捯卫慴整㨺敒潭敶椨瑮㈳䠠湡汤⥥笊ऊ湩㍴′湉敤⁸‽敇䥴摮硥䠨湡汤⥥਻椉⁦䤨摮硥㴠‽义䕄彘低䕎 ⁻敲畴湲※੽䰉祡畯噴牥楳湯⬫਻ऊ⼯潭敶氠獡⁴潢摩椠瑮⁯敲潭敶⁤潢摩猧猠潬⁴湡⁤灵慤整椠獴栠湡汤੥椉瑮㈳䰠獡䥴摮硥㴠倠獯瑩潩獮丮浵⤨ⴠㄠ਻椉⁦䤨摮硥℠‽慌瑳湉敤⥸ऊ੻उ汓瑯潔湉敤學敇䡴湡汤卥潬⡴慈摮敬孳慌瑳湉敤嵸崩㴠䤠摮硥਻紉ऊ潐楳楴湯⹳敒潭敶瑁睓灡䤨摮硥‬ⰱ映污敳㬩ऊ敖潬楣楴獥刮浥癯䅥却慷⡰湉敤ⱸㄠ‬慦獬⥥਻䴉獥剨瑯瑡潩獮刮浥癯䅥却慷⡰湉敤ⱸㄠ‬慦獬⥥਻䘉慬偰慨敳⹳敒潭敶瑁睓灡䤨摮硥‬ⰱ映污敳㬩ऊ汆灡晅潦瑲⹳敒潭敶瑁睓灡䤨摮硥‬ⰱ映污敳㬩ऊ慂歮湁汧獥刮浥癯䅥却慷⡰湉敤ⱸㄠ‬慦獬⥥਻䈉楯獤刮浥癯䅥却慷⡰湉敤ⱸㄠ‬慦獬⥥਻䠉湡汤獥刮浥癯䅥却慷⡰湉敤ⱸㄠ‬慦獬⥥਻ऊ⼯牦敥猠潬⁴潦⁲敲獵⁥湵敤⁲⁡敮⁷敳楲污ऊ牆敥汓瑯䜨瑥慈摮敬汓瑯䠨湡汤⥥㬩紊ਊ潶摩䘠汆捯卫慴整㨺牆敥汓瑯椨瑮㈳匠潬⥴笊ऊ潣獮⁴湩㍴′敓楲污㴠⠠匨潬䡴湡汤獥卛潬嵴㸠‾汆捯䡫湡汤卥潬䉴瑩⥳⬠ㄠ …汆捯䡫湡汤卥牥慩䵬獡㭫ऊ汓瑯慈摮敬孳汓瑯⁝‽汓瑯簠⠠敓楲污㰠‼汆捯䡫湡汤卥潬䉴瑩⥳਻匉潬呴䥯摮硥卛潬嵴㴠䤠䑎塅也乏㭅ऊ牆敥汓瑯⹳摁⡤汓瑯㬩紊ਊ潶摩䘠汆捯卫慴整㨺浅瑰⡹਩੻倉獯瑩潩獮䔮灭祴⤨਻嘉汥捯瑩敩⹳浅瑰⡹㬩ऊ敍桳潒慴楴湯⹳浅瑰⡹㬩ऊ汆灡桐獡獥䔮灭祴⤨਻䘉慬䕰晦牯獴䔮灭祴⤨਻䈉湡䅫杮敬⹳浅瑰⡹㬩ऊ潂摩⹳浅瑰⡹㬩ऊ⼯汳瑯⁳敫灥琠敨物猠牥慩獬猠⁯慨摮敬⁳景爠浥癯摥戠楯獤猠慴⁹湩慶楬੤昉牯⠠湩㍴′慈摮敬㨠䠠湡汤獥਩笉ऊ䘉敲卥潬⡴敇䡴湡汤卥潬⡴慈摮敬⤩਻紉ऊ慈摮敬⹳浅瑰⡹㬩ऊ慌潹瑵敖獲潩⭮㬫紊ਊ潶摩䘠汆捯卫慴整㨺敒敳癲⡥湩㍴′畎䉭楯獤਩੻倉獯瑩潩獮刮獥牥敶丨浵潂摩⥳਻嘉汥捯瑩敩⹳敒敳癲⡥畎䉭楯獤㬩ऊ敍桳潒慴楴湯⹳敒敳癲⡥畎䉭楯獤㬩ऊ汆灡桐獡獥刮獥牥敶丨浵潂摩⥳਻䘉慬䕰晦牯獴刮獥牥敶丨浵潂摩⥳਻䈉湡䅫杮敬⹳敒敳癲⡥畎䉭楯獤㬩ऊ潂摩⹳敒敳癲⡥畎䉭楯獤㬩ऊ慈摮敬⹳敒敳癲⡥畎䉭楯獤㬩ऊ汓瑯潔湉敤⹸敒敳癲⡥畎䉭楯獤㬩ऊ汓瑯慈摮敬⹳敒敳癲⡥畎䉭楯獤㬩紊ਊ潢汯䘠汆捯卫慴整㨺潓瑲祂潍瑲湯潃敤⤨笊ऊ潣獮⁴湩㍴′畎䉭楯獤㴠倠獯瑩潩獮丮浵⤨਻椉⁦丨浵潂摩⁳‼⤲笠爠瑥牵⁮慦獬㭥素ਊ⼉焯慵瑮穩⁥潰楳楴湯⁳潴愠ㄠ㈰帴″牧摩漠敶⁲桴⁥汦捯⁫潢湵獤ऊ䉆硯䘠潬正潂湵獤倨獯瑩潩獮䜮瑥慄慴⤨‬畎䉭楯獤㬩ऊ噆捥潴⁲楓敺㴠䘠潬正潂湵獤䜮瑥楓敺⤨਻䘉敖瑣牯匠慣敬਻匉慣敬堮㴠匠穩⹥⁘‾䥋䑎彁䵓䱁彌啎䉍剅㼠ㄠ㈰⸳昰⼠匠穩⹥⁘›⸰昰਻匉慣敬央㴠匠穩⹥⁙‾䥋䑎彁䵓䱁彌啎䉍剅㼠ㄠ㈰⸳昰⼠匠穩⹥⁙›⸰昰਻匉慣敬娮㴠匠穩⹥⁚‾䥋䑎彁䵓䱁彌啎䉍剅㼠ㄠ㈰⸳昰⼠匠穩⹥⁚›⸰昰਻ऊ⼯畢汩⁤潳瑲欠祥⁳楷桴䴠牯潴⁮潣敤椠⁮桴⁥灵数⁲楢獴愠摮愠牲祡椠摮硥椠⁮桴⁥潬敷⁲楢獴ऊ潓瑲敋獹匮瑥畎啭楮楮楴污穩摥丨浵潂摩⥳਻昉牯⠠湩㍴′⁩‽㬰椠㰠丠浵潂摩㭳⬠椫਩笉ऊ䘉敖瑣牯䌠汥⁬‽倨獯瑩潩獮楛⁝‭汆捯䉫畯摮⹳楍⥮⨠匠慣敬਻उ極瑮㈳䴠牯潴䍮摯⁥‽灓敲摡楂獴用湩㍴⠲敃汬堮⤩簠⠠灓敲摡楂獴用湩㍴⠲敃汬央⤩㰠‼⤱簠⠠灓敲摡楂獴用湩㍴⠲敃汬娮⤩㰠‼⤲਻उ潓瑲敋獹楛⁝‽用湩㙴⠴潍瑲湯潃敤 㰼㌠⤲簠甠湩㙴⠴⥩਻紉ऊ潓瑲敋獹匮牯⡴㬩ਊ⼉振敨正椠⁦汦捯⁫獩愠牬慥祤椠⁮牯敤ੲ匉牯佴摲牥匮瑥畎啭楮楮楴污穩摥丨浵潂摩⥳਻戉潯⁬䅢牬慥祤潓瑲摥㴠琠畲㭥ऊ潦⁲椨瑮㈳椠㴠〠※⁩‼畎䉭楯獤※⬫⥩ऊ੻उ潓瑲牏敤孲嵩㴠椠瑮㈳匨牯䭴祥孳嵩☠〠䙸䙆䙆䙆⥆਻उ䅢牬慥祤潓瑲摥☠‽匨牯佴摲牥楛⁝㴽椠㬩ऊ੽椉⁦戨汁敲摡卹牯整⥤笠爠瑥牵⁮慦獬㭥素ऊ慌潹瑵敖獲潩⭮㬫ਊ⼉爯潥摲牥猠慴整愠摮甠摰瑡⁥慨摮敬⁳潴瀠楯瑮愠⁴敮⁷湩楤散ੳ䄉灰祬牏敤⡲潐楳楴湯ⱳ匠牯佴摲牥㬩ऊ灁汰佹摲牥嘨汥捯瑩敩ⱳ匠牯佴摲牥㬩ऊ灁汰佹摲牥䴨獥剨瑯瑡潩獮‬潓瑲牏敤⥲਻䄉灰祬牏敤⡲汆灡桐獡獥‬潓瑲牏敤⥲਻䄉灰祬牏敤⡲汆灡晅潦瑲ⱳ匠牯佴摲牥㬩ऊ灁汰佹摲牥䈨湡䅫杮敬ⱳ匠牯佴摲牥㬩ऊ灁汰佹摲牥䈨楯獤‬潓瑲牏敤⥲਻䄉灰祬牏敤⡲慈摮敬ⱳ匠牯佴摲牥㬩ऊ潦⁲椨瑮㈳椠㴠〠※⁩‼畎䉭楯獤※⬫⥩ऊ੻उ汓瑯潔湉敤學敇䡴湡汤卥潬⡴慈摮敬孳嵩崩㴠椠਻紉ऊ敲畴湲琠畲㭥紊
\ No newline at end of file
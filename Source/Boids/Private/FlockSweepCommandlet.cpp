@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠汆捯卫敷灥潃浭湡汤瑥栮ਢ椣据畬敤∠汆捯䵫湡条牥栮ਢ椣据畬敤∠潂摩栮ਢ椣据畬敤∠潖畬敭灓睡敮⹲≨⌊湩汣摵⁥䘢潬正捏牴敥栮ਢ椣据畬敤∠汆捯卫档摥汵牥栮ਢ椣据畬敤∠湅楧敮䔯杮湩⹥≨⌊湩汣摵⁥䔢杮湩啥楴獬栮ਢ椣据畬敤∠獁湹⽣慐慲汬汥潆⹲≨⌊湩汣摵⁥䄢祳据启獡䝫慲桰湉整晲捡獥栮ਢ椣据畬敤∠楍捳䘯汩䡥汥数⹲≨⌊湩汣摵⁥䴢獩⽣慐桴⹳≨⌊湩汣摵⁥唢扏敪瑣唯牮慥呬灹⹥≨⌊湩汣摵⁥䈢楯獤䈯楯獤栮ढउउ⼉甯敳⁤潦⁲牰橯捥⁴汧扯污挠汯楬楳湯瀠敲敳⁴䌢䱏䥌䥓乏䅟佖䑉乁䕃ਢ唊汆捯卫敷灥潃浭湡汤瑥㨺䙕潬正睓敥䍰浯慭摮敬⡴਩੻䤉䍳楬湥⁴‽慦獬㭥ऊ獉敓癲牥㴠映污敳਻䤉䕳楤潴⁲‽慦獬㭥ऊ潌呧䍯湯潳敬㴠琠畲㭥ਊ三浵潂摩⁳‽〵㬰ऊ畎卭整獰㴠㘠〰਻圉牡畭印整獰㴠ㄠ〵਻䴉慥畳敲湉整癲污㴠ㄠ㬰ऊ瑓灥楔敭㴠ㄠ〮⁦ 〶〮㭦ऊ潂摩祔数㴠渠汵灬牴਻匉慰湷潂湵獤㴠䘠潂⡸潆捲䥥楮⥴਻䌉汯楬楳湯慒楤獵㴠〠〮㭦紊ਊ湩㍴′䙕潬正睓敥䍰浯慭摮敬㩴䴺楡⡮潣獮⁴卆牴湩♧倠牡浡⥳笊ऊ⼯睳敥⁰敳瑴湩獧ऊ偆牡敳㨺慖畬⡥倪牡浡ⱳ吠塅⡔䈢楯獤∽Ⱙ丠浵潂摩⥳਻䘉慐獲㩥嘺污敵⨨慐慲獭‬䕔员∨瑓灥㵳⤢‬畎卭整獰㬩ऊ慗浲灵瑓灥⁳‽畎卭整獰⼠㐠਻䘉慐獲㩥嘺污敵⨨慐慲獭‬䕔员∨慗浲灵∽Ⱙ圠牡畭印整獰㬩ऊ偆牡敳㨺慖畬⡥倪牡浡ⱳ吠塅⡔䴢慥畳敲癅牥㵹⤢‬敍獡牵䥥瑮牥慶⥬਻䘉慐獲㩥嘺污敵⨨慐慲獭‬䕔员∨瑓灥楔敭∽Ⱙ匠整呰浩⥥਻椉瑮㈳丠浵敓摥⁳‽㬱ऊ偆牡敳㨺慖畬⡥倪牡浡ⱳ吠塅⡔匢敥獤∽Ⱙ丠浵敓摥⥳਻⼉是潬正⁳瑳灥数⁤潴敧桴牥戠瑥敷湥洠慥畳敲⁤瑳灥ⱳ攠捡⁨汦捯⁫獩愠獬⁯灳楬⁴癯牥琠敨眠牯敫獲戠⁹桴⁥汦捯⁫捳敨畤敬ੲ椉瑮㈳䈠瑡档楓敺㴠䘠慔歳片灡䥨瑮牥慦散㨺敇⡴⸩敇乴浵潗歲牥桔敲摡⡳㬩ऊ偆牡敳㨺慖畬⡥倪牡浡ⱳ吠塅⡔倢牡污敬㵬⤢‬慂捴卨穩⥥਻䘉瑓楲杮传瑵異側瑡⁨‽偆瑡獨㨺潃扭湩⡥偆瑡獨㨺牐橯捥却癡摥楄⡲Ⱙ吠塅⡔䘢潬正睓敥獰⤢‬卆牴湩㩧债楲瑮⡦䕔员∨汆捯卫敷灥╟⹳獣≶Ⱙ⨠䑆瑡呥浩㩥为睯⤨吮卯牴湩⡧⤩㬩ऊ偆牡敳㨺慖畬⡥倪牡浡ⱳ吠塅⡔伢瑵異㵴⤢‬畏灴瑵慐桴㬩ऊ畎䉭楯獤㴠䘠慍桴㨺慍⡸畎䉭楯獤‬⤱਻三浵瑓灥⁳‽䵆瑡㩨䴺硡丨浵瑓灥ⱳㄠ㬩ऊ慗浲灵瑓灥⁳‽䵆瑡㩨䌺慬灭在牡畭印整獰‬ⰰ丠浵瑓灥⁳‭⤱਻䴉慥畳敲湉整癲污㴠䘠慍桴㨺慍⡸敍獡牵䥥瑮牥慶ⱬㄠ㬩ऊ畎卭敥獤㴠䘠慍桴㨺慍⡸畎卭敥獤‬⤱਻䈉瑡档楓敺㴠䘠慍桴㨺慍⡸慂捴卨穩ⱥㄠ㬩ਊ吉牁慲㱹䙆潬正睓敥䅰楸㹳䄠數㭳ऊ晩⠠倡牡敳片摩倨牡浡ⱳ䄠數⥳ ⁻敲畴湲ㄠ※੽ऊ卆牴湩⁧慍买浡㭥ऊ偆牡敳㨺慖畬⡥倪牡浡ⱳ吠塅⡔䴢灡∽Ⱙ䴠灡慎敭㬩ऊ坕牯摬‪潗汲⁤‽牃慥整睓敥坰牯摬䴨灡慎敭㬩ऊ晩⠠圡牯摬 ⁻敲畴湲ㄠ※੽ऊ⼯畲獮猠慴瑲映潲⁭桴⁥敳瑴湩獧漠⁦⁡汦捯⁫慭慮敧⁲汰捡摥椠⁮桴⁥慭⁰挨慬獳搠晥畡瑬⁳湩愠⁮浥瑰⁹潷汲⥤ऊ卆牴湩⁧敔灭慬整慎敭਻䘉慐獲㩥嘺污敵⨨慐慲獭‬䕔员∨敔灭慬整∽Ⱙ吠浥汰瑡乥浡⥥਻䄉汆捯䵫湡条牥‪敔灭慬整㴠渠汵灬牴਻昉牯⠠䅔瑣牯瑉牥瑡牯䄼汆捯䵫湡条牥‾瑉在牯摬㬩䤠㭴⬠䤫⥴ऊ੻उ晩⠠敔灭慬整慎敭䤮䕳灭祴⤨簠⁼瑉㸭敇乴浡⡥ 㴽吠浥汰瑡乥浡⥥ऊ笉ऊउ敔灭慬整㴠⨠瑉਻उ戉敲歡਻उ੽紉ऊ晩⠠吡浥汰瑡⁥☦℠敔灭慬整慎敭䤮䕳灭祴⤨਩笉ऊ唉彅佌⡇潌呧浥Ɒ䔠牲牯‬䕔员∨汆捯⁫睳敥⁰整灭慬整┠⁳潮⁴潦湵⁤湩洠灡┠⹳⤢‬吪浥汰瑡乥浡ⱥ⨠慍买浡⥥਻उ敄瑳潲卹敷灥潗汲⡤潗汲⥤਻उ敲畴湲ㄠ਻紉ਊ⼉戯楯⁤祴数猠瑥⁳数捲灥楴湯愠摮挠汯楬楳湯爠摡畩ੳ䘉瑓楲杮䈠楯䍤慬獳慎敭਻椉⁦䘨慐獲㩥嘺污敵⨨慐慲獭‬䕔员∨潂摩汃獡㵳⤢‬潂摩汃獡乳浡⥥਩笉ऊ䈉楯呤灹⁥‽潌摡汃獡㱳䉁楯㹤渨汵灬牴‬䈪楯䍤慬獳慎敭㬩ऊ੽攉獬੥笉ऊ䈉楯呤灹⁥‽敔灭慬整☠…敔灭慬整㸭敒汰捩瑡摥潂摩祔数㼠吠浥汰瑡ⵥ刾灥楬慣整䉤楯呤灹⁥›協扵汣獡佳㱦䉁楯㹤䄨潂摩㨺瑓瑡捩汃獡⡳⤩਻紉ऊ晩⠠䈡楯呤灹⥥ऊ੻उ䕕䱟䝏䰨杯敔灭‬牅潲Ⱳ吠塅⡔䘢潬正猠敷灥戠楯⁤汣獡⁳猥渠瑯映畯摮∮Ⱙ⨠潂摩汃獡乳浡⥥਻उ敄瑳潲卹敷灥潗汲⡤潗汲⥤਻उ敲畴湲ㄠ਻紉ऊ潃汬獩潩剮摡畩⁳‽潂摩祔数䜮瑥敄慦汵佴橢捥⡴⴩䜾瑥潃汬獩潩剮摡畩⡳㬩ਊ⼉戯楯獤猠慰湷椠⁮桴⁥慭❰⁳楦獲⁴潶畬敭猠慰湷牥‬牯愠潲湵⁤桴⁥整灭慬整ऊ汦慯⁴灓睡䕮瑸湥⁴‽〲〰〮㭦ऊ偆牡敳㨺慖畬⡥倪牡浡ⱳ吠塅⡔匢慰湷硅整瑮∽Ⱙ匠慰湷硅整瑮㬩ऊ䅔瑣牯瑉牥瑡牯䄼潖畬敭灓睡敮㹲匠慰湷牥瑉在牯摬㬩ऊ灓睡䉮畯摮⁳‽灓睡敮䥲⁴‿灓睡敮䥲⵴䜾瑥潃灭湯湥獴潂湵楤杮潂⡸ ›䉆硯㨺畂汩䅤䉁⡂敔灭慬整㼠吠浥汰瑡ⵥ䜾瑥捁潴䱲捯瑡潩⡮ ›噆捥潴㩲娺牥噯捥潴Ⱳ䘠敖瑣牯匨慰湷硅整瑮⤩਻ऊ⼯癥牥⁹潣扭湩瑡潩⁮景猠敷瑰瘠污敵ⱳ漠据⁥数⁲敳摥ऊ湩㍴′畎卭瑥⁳‽㬱ऊ潦⁲挨湯瑳䘠汆捯卫敷灥硁獩…硁獩㨠䄠數⥳ऊ੻उ畎卭瑥⁳㴪䄠楸⹳慖畬獥丮浵⤨਻紉ऊ䅔牲祡䘼汆捯卫敷灥畒㹮删湵㭳ऊ畒獮匮瑥畎⡭畎卭瑥⁳‪畎卭敥獤㬩ऊ潦⁲椨瑮㈳匠瑥㴠〠※敓⁴‼畎卭瑥㭳⬠匫瑥਩笉ऊ昉牯⠠湩㍴′敓摥㴠〠※敓摥㰠丠浵敓摥㭳⬠匫敥⥤ऊ笉ऊउ䙆潬正睓敥剰湵…畒⁮‽畒獮卛瑥⨠丠浵敓摥⁳‫敓摥㭝ऊउ畒⹮敓摥㴠匠敥㭤ऊउ湩㍴′慖畬䥥摮硥㴠匠瑥਻उ昉牯⠠潣獮⁴䙆潬正睓敥䅰楸♳䄠楸⁳›硁獥਩उ笉ऊउ刉湵嘮污敵⹳摁⡤硁獩嘮污敵孳慖畬䥥摮硥┠䄠楸⹳慖畬獥丮浵⤨⥝਻उउ慖畬䥥摮硥⼠‽硁獩嘮污敵⹳畎⡭㬩ऊउ੽उ੽紉ऊ䕕䱟䝏䰨杯敔灭‬楄灳慬ⱹ吠塅⡔䘢潬正猠敷灥›搥瀠牡浡瑥牥猠瑥⁳⁸搥猠敥獤‬搥戠楯獤映牯┠⁤瑳灥⁳┨⁤慷浲灵 湩戠瑡档獥漠⁦搥∮Ⱙ丠浵敓獴‬畎卭敥獤‬畎䉭楯獤‬畎卭整獰‬慗浲灵瑓灥ⱳ䈠瑡档楓敺㬩ਊ⼉琯敨猠敷灥猠整獰映潬正⁳慭祮琠浩獥瀠牥攠杮湩⁥牦浡ⱥ猠⁯瑩戠来湩⁳桴⁥捳敨畤敬❲⁳牦浡獥椠獴汥੦唉汆捯卫档摥汵牥畓獢獹整⩭匠档摥汵牥㴠圠牯摬㸭敇却扵祳瑳浥唼汆捯卫档摥汵牥畓獢獹整㹭⤨਻椉⁦ℨ捓敨畤敬⥲ऊ੻उ䕕䱟䝏䰨杯敔灭‬牅潲Ⱳ吠塅⡔丢⁯汦捯⁫捳敨畤敬⁲湩映潬正猠敷灥眠牯摬∮⤩਻उ敄瑳潲卹敷灥潗汲⡤潗汲⥤਻उ敲畴湲ㄠ਻紉ऊ極瑮㐶匠敷灥牆浡⁥‽捓敨畤敬⵲䜾瑥牆浡䥥⡤㬩ਊ按湯瑳搠畯汢⁥睓敥印慴瑲楔敭㴠䘠汐瑡潦浲楔敭㨺敓潣摮⡳㬩ऊ潦⁲椨瑮㈳䘠物瑳畒⁮‽㬰䘠物瑳畒⁮‼畒獮丮浵⤨※楆獲剴湵⬠‽慂捴卨穩⥥ऊ੻उ䅔牲祡楖睥䘼汆捯卫敷灥畒㹮䈠瑡档刨湵⹳敇䑴瑡⡡ ‫楆獲剴湵‬䵆瑡㩨䴺湩䈨瑡档楓敺‬畒獮丮浵⤨ⴠ䘠物瑳畒⥮㬩ऊ昉牯⠠䙆潬正睓敥剰湵…畒⁮›慂捴⥨ऊ笉ऊउ畒⹮汆捯䵫湡条牥㴠匠慰湷畒䙮潬正在牯摬‬敔灭慬整‬硁獥‬畒⥮਻उ੽ऊ昉牯⠠湩㍴′瑓灥㴠〠※瑓灥㰠丠浵瑓灥㭳⬠匫整⥰ऊ笉ऊउ⼯潣湵獴愠敲漠汮⁹敲潣摲摥漠据⁥汦捯獫栠癡⁥敳瑴敬੤उ椉⁦匨整⁰㴽圠牡畭印整獰਩उ笉ऊउ昉牯⠠䙆潬正睓敥剰湵…畒⁮›慂捴⥨ऊउ笉ऊउउ畒⹮汆捯䵫湡条牥㸭敔敬敭牴⹹敒敳⡴㬩ऊउ紉ऊउ੽ऊउ晩⠠瑓灥㸠‽慗浲灵瑓灥⁳☦⠠瑓灥ⴠ圠牡畭印整獰 ‥敍獡牵䥥瑮牥慶⁬㴽〠਩उ笉ऊउ⼉洯慥畳敲⁤瑳灥⁳畲⁮湯⁥汦捯⁫瑡愠琠浩⁥潳琠敨物猠浩汵瑡潩⁮楴敭椠湳琧猠慨敲⁤楷桴漠桴牥爠湵⁳攨捡⁨汦捯⁫瑳汩⁬灳敲摡⁳癯牥攠敶祲眠牯敫⥲ऊउ昉牯⠠䙆潬正睓敥剰湵…畒⁮›慂捴⥨ऊउ笉ऊउउ捓敨畤敬⵲䈾来湩牆浡⡥⬫睓敥䙰慲敭㬩ऊउउ畒⹮汆捯䵫湡条牥㸭瑓牡却浩汵瑡潩⡮瑓灥楔敭㬩ऊउउ畒⹮汆捯䵫湡条牥㸭楆楮桳楓畭慬楴湯⤨਻उउ刉湵丮浵楔敭卤整獰⬫਻उउ刉湵匮浩獍畓⁭㴫删湵䘮潬正慍慮敧⵲䰾獡却浩楔敭獍਻उउ刉湵匮慰䵮即浵⬠‽畒⹮汆捯䵫湡条牥㸭慌瑳楓卭慰䵮㭳ऊउउ畒⹮慍卸浩獍㴠䘠慍桴㨺慍⡸畒⹮慍卸浩獍‬畒⹮汆捯䵫湡条牥㸭慌瑳楓呭浩䵥⥳਻उउ੽ऊउ⼉戯桥癡潩牵搠敯湳琧搠灥湥⁤湯琠浩湩Ⱨ爠湵⁳牡⁥敭獡牵摥椠⁮慰慲汬汥ऊउ倉牡污敬䙬牯䈨瑡档丮浵⤨‬瑛楨ⱳ☠慂捴嵨椨瑮㈳删湵湉敤⥸ऊउ笉ऊउउ敍獡牵剥湵䈨瑡档剛湵湉敤嵸㬩ऊउ紉㬩ऊउ੽उ攉獬੥उ笉ऊउ⼉漯桴牥猠整獰漠汮⁹摡慶据⁥桴⁥汦捯獫‬癥牥⁹汦捯⁫景琠敨戠瑡档椠⁳楫正摥戠晥牯⁥潪湩湩⁧湡⁹潳琠敨⁹畲⁮污湯獧摩⁥慥档漠桴牥漠⁮桴⁥桳牡摥眠牯敫獲ऊउ匉档摥汵牥㸭敂楧䙮慲敭⬨匫敷灥牆浡⥥਻उउ潦⁲䘨汆捯卫敷灥畒♮删湵㨠䈠瑡档਩उउ੻उउ刉湵䘮潬正慍慮敧⵲匾慴瑲楓畭慬楴湯匨整呰浩⥥਻उउ੽उउ潦⁲䘨汆捯卫敷灥畒♮删湵㨠䈠瑡档਩उउ੻उउ刉湵䘮潬正慍慮敧⵲䘾湩獩卨浩汵瑡潩⡮㬩ऊउ紉ऊउ੽उ੽ऊ⼉猯浵慭楲敳挠畯瑮⁳湡⁤敲敬獡⁥桴⁥慢捴❨⁳汦捯獫ऊ昉牯⠠䙆潬正睓敥剰湵…畒⁮›慂捴⥨ऊ笉ऊउ䙆潬正敔敬敭牴♹吠汥浥瑥祲㴠删湵䘮潬正慍慮敧⵲吾汥浥瑥祲਻उ吉汥浥瑥祲吮歡卥浡汰⡥畎卭整獰⨠匠整呰浩ⱥ删湵䘮潬正慍慮敧⵲䘾潬正瑓瑡⹥潐楳楴湯⥳਻उ刉湵䌮獯⁴‽敔敬敭牴⹹敇却浡汰獥⤨䰮獡⡴㬩ऊउ畒⹮汆捯䵫湡条牥㸭敄瑳潲⡹㬩ऊउ畒⹮汆捯䵫湡条牥㴠渠汵灬牴਻उ੽उ潃汬捥䝴牡慢敧䜨剁䅂䕇䍟䱏䕌呃佉彎䕋偅䱆䝁⥓਻ऊ唉彅佌⡇潌呧浥Ɒ䐠獩汰祡‬䕔员∨汆捯⁫睳敥㩰┠⁤景┠⁤畲獮搠湯⁥┨ㄮ⁦⥳∮Ⱙ䘠物瑳畒⁮‫慂捴⹨畎⡭Ⱙ删湵⹳畎⡭Ⱙ䘠汐瑡潦浲楔敭㨺敓潣摮⡳ ‭睓敥印慴瑲楔敭㬩ऊ੽ऊ敄瑳潲卹敷灥潗汲⡤潗汲⥤਻ऊ晩⠠圡楲整敒畳瑬⡳畏灴瑵慐桴‬硁獥‬畒獮⤩ऊ੻उ䕕䱟䝏䰨杯敔灭‬牅潲Ⱳ吠塅⡔䘢楡敬⁤潴眠楲整映潬正猠敷灥爠獥汵獴琠⁯猥∮Ⱙ⨠畏灴瑵慐桴㬩ऊ爉瑥牵⁮㬱ऊ੽唉彅佌⡇潌呧浥Ɒ䐠獩汰祡‬䕔员∨汆捯⁫睳敥⁰敲畳瑬⁳牷瑩整⁮潴┠⹳⤢‬伪瑵異側瑡⥨਻爉瑥牵⁮㬰紊ਊ潢汯唠汆捯卫敷灥潃浭湡汤瑥㨺慐獲䝥楲⡤潣獮⁴卆牴湩♧倠牡浡ⱳ吠牁慲㱹䙆潬正睓敥䅰楸㹳…畏䅴數⥳挠湯瑳笊ऊ⼯牧摩椠⁳楧敶⁮湩楬敮漠⁲獡愠映汩⁥楷桴漠敮瀠潲数瑲⁹数⁲楬敮⠠楬敮⁳瑳牡楴杮眠瑩⁨‣牡⁥潣浭湥獴਩吉牁慲㱹卆牴湩㹧䔠瑮楲獥਻䘉瑓楲杮䜠楲㭤ऊ卆牴湩⁧片摩楆敬਻椉⁦䘨慐獲㩥嘺污敵⨨慐慲獭‬䕔员∨片摩楆敬∽Ⱙ䜠楲䙤汩⥥਩笉ऊ椉⁦ℨ䙆汩䡥汥数㩲䰺慯䙤汩呥卯牴湩䅧牲祡䔨瑮楲獥‬䜪楲䙤汩⥥਩उ੻उ唉彅佌⡇潌呧浥Ɒ䔠牲牯‬䕔员∨慆汩摥琠⁯敲摡映潬正猠敷灥朠楲⁤楦敬┠⹳⤢‬䜪楲䙤汩⥥਻उ爉瑥牵⁮慦獬㭥ऊ紉ऊ੽攉獬⁥晩⠠偆牡敳㨺慖畬⡥倪牡浡ⱳ吠塅⡔䜢楲㵤⤢‬片摩⤩ऊ੻उ片摩倮牡敳湉潴牁慲⡹湅牴敩ⱳ吠塅⡔㬢⤢㬩ऊ੽ऊ潦⁲䘨瑓楲杮䔠瑮祲㨠䔠瑮楲獥਩笉ऊ䔉瑮祲吮楲卭慴瑲湁䕤摮湉楬敮⤨਻उ晩⠠湅牴⹹獉浅瑰⡹ 籼䔠瑮祲匮慴瑲坳瑩⡨䕔员∨∣⤩ ⁻潣瑮湩敵※੽ऊ䘉汆捯卫敷灥硁獩䄠楸㭳ऊ䘉瑓楲杮嘠污敵㭳ऊ椉⁦ℨ湅牴⹹灓楬⡴䕔员∨∽Ⱙ☠硁獩丮浡ⱥ☠慖畬獥⤩ऊ笉ऊउ䕕䱟䝏䰨杯敔灭‬牅潲Ⱳ吠塅⡔䘢潬正猠敷灥朠楲⁤湥牴⁹猥椠湳琧丠浡㵥慖畬ⱥ慖畬⹥⤢‬䔪瑮祲㬩ऊउ敲畴湲映污敳਻उ੽उ硁獩丮浡⹥牔浩瑓牡䅴摮湅䥤汮湩⡥㬩ऊ嘉污敵⹳慐獲䥥瑮䅯牲祡䄨楸⹳慖畬獥‬䕔员∨∬⤩਻उ潦⁲䘨瑓楲杮…慖畬⁥›硁獩嘮污敵⥳ऊ笉ऊउ慖畬⹥牔浩瑓牡䅴摮湅䥤汮湩⡥㬩ऊ紉ਊउ⼯湡⁹畮敭楲⁣牰灯牥祴漠⁦桴⁥慭慮敧⁲慣⁮敢猠敷瑰⠠⹩⹥猠整牥湩⁧瑳敲杮桴ⱳ䘠噏ⱳ丠浵敓獮牯ⱳ猠数摥氠浩瑩⥳ऊ䄉楸⹳牐灯牥祴㴠䘠湩䙤牐灯牥祴䘼畎敭楲偣潲数瑲㹹䄨汆捯䵫湡条牥㨺瑓瑡捩汃獡⡳Ⱙ⨠硁獩丮浡⥥਻उ晩⠠䄡楸⹳牐灯牥祴簠⁼硁獩嘮污敵⹳畎⡭ 㴽〠਩उ੻उ唉彅佌⡇潌呧浥Ɒ䔠牲牯‬䕔员∨汆捯⁫睳敥⁰牧摩攠瑮祲┠⁳獩❮⁴⁡畮敭楲⁣汆捯⁫慍慮敧⁲牰灯牥祴眠瑩⁨慶畬獥∮Ⱙ⨠硁獩丮浡⥥਻उ爉瑥牵⁮慦獬㭥ऊ紉ऊ伉瑵硁獥䄮摤䄨楸⥳਻紉ਊ爉瑥牵⁮牴敵਻੽唊潗汲⩤唠汆捯卫敷灥潃浭湡汤瑥㨺牃慥整睓敥坰牯摬挨湯瑳䘠瑓楲杮…慍买浡⥥挠湯瑳笊ऊ坕牯摬‪潗汲⁤‽畮汬瑰㭲ऊ晩⠠慍买浡⹥獉浅瑰⡹⤩ऊ੻उ⼯浥瑰⁹潷汲Ɽ戠楯獤栠癡⁥潮桴湩⁧潴愠潶摩ऊ圉牯摬㴠唠潗汲㩤䌺敲瑡坥牯摬䔨潗汲呤灹㩥䜺浡ⱥ映污敳㬩ऊ੽攉獬੥笉ऊ唉慐正条⩥䴠灡慐正条⁥‽潌摡慐正条⡥畮汬瑰Ⱳ⨠慍买浡ⱥ䰠䅏彄潎敮㬩ऊ圉牯摬㴠䴠灡慐正条⁥‿坕牯摬㨺楆摮潗汲䥤偮捡慫敧䴨灡慐正条⥥㨠渠汵灬牴਻उ晩⠠圡牯摬਩उ੻उ唉彅佌⡇潌呧浥Ɒ䔠牲牯‬䕔员∨慆汩摥琠⁯潬摡洠灡┠⁳潦⁲汦捯⁫睳敥⹰⤢‬䴪灡慎敭㬩ऊउ敲畴湲渠汵灬牴਻उ੽उ潗汲ⵤ圾牯摬祔数㴠䔠潗汲呤灹㩥䜺浡㭥ऊ圉牯摬㸭湉瑩潗汲⡤坕牯摬㨺湉瑩慩楬慺楴湯慖畬獥⤨䄮汬睯畁楤偯慬批捡⡫慦獬⥥刮煥極敲䡳瑩牐硯敩⡳慦獬⥥䌮敲瑡乥癡杩瑡潩⡮慦獬⥥䌮敲瑡䅥卉獹整⡭慦獬⥥匮潨汵卤浩汵瑡健票楳獣昨污敳⸩敓呴慲獮捡楴湯污昨污敳⤩਻紉ऊ潗汲ⵤ䄾摤潔潒瑯⤨਻ऊ坆牯摬潃瑮硥♴圠牯摬潃瑮硥⁴‽䕇杮湩ⵥ䌾敲瑡乥睥潗汲䍤湯整瑸䔨潗汲呤灹㩥䜺浡⥥਻圉牯摬潃瑮硥⹴敓䍴牵敲瑮潗汲⡤潗汲⥤਻ऊ⼯敲楧瑳牥挠浯潰敮瑮⁳潳氠癥汥朠潥敭牴⁹獩椠⁮桴⁥桰獹捩⁳捳湥⁥琨敨眠牯摬渠癥牥戠来湩⁳汰祡‬湯祬琠敨猠敷灥猧映潬正⁳牡⁥瑳灥数⥤ऊ潗汲ⵤ唾摰瑡坥牯摬潃灭湯湥獴琨畲ⱥ映污敳㬩ऊ敲畴湲圠牯摬਻੽瘊楯⁤䙕潬正睓敥䍰浯慭摮敬㩴䐺獥牴祯睓敥坰牯摬唨潗汲⩤圠牯摬 潣獮ੴ੻䜉湅楧敮㸭敄瑳潲坹牯摬潃瑮硥⡴潗汲⥤਻圉牯摬㸭敄瑳潲坹牯摬昨污敳㬩ऊ潗汲ⵤ刾浥癯䙥潲剭潯⡴㬩紊ਊ䙁潬正慍慮敧⩲唠汆捯卫敷灥潃浭湡汤瑥㨺灓睡剮湵汆捯⡫坕牯摬‪潗汲Ɽ䄠汆捯䵫湡条牥‪敔灭慬整‬潣獮⁴䅔牲祡䘼汆捯卫敷灥硁獩☾䄠數ⱳ挠湯瑳䘠汆捯卫敷灥畒♮删湵 潣獮ੴ੻䘉捁潴卲慰湷慐慲敭整獲匠慰湷慐慲敭整獲਻匉慰湷慐慲敭整獲吮浥汰瑡⁥‽敔灭慬整਻匉慰湷慐慲敭整獲匮慰湷潃汬獩潩䡮湡汤湩佧敶牲摩⁥‽卅慰湷捁潴䍲汯楬楳湯慈摮楬杮敍桴摯㨺汁慷獹灓睡㭮ऊ䍕慬獳‪汆捯䵫湡条牥汃獡⁳‽敔灭慬整㼠吠浥汰瑡ⵥ䜾瑥汃獡⡳ ›䙁潬正慍慮敧㩲区慴楴䍣慬獳⤨਻按湯瑳䘠牔湡晳牯⁭灓睡呮慲獮潦浲㴠吠浥汰瑡⁥‿敔灭慬整㸭敇䅴瑣牯牔湡晳牯⡭ ›呆慲獮潦浲㨺摉湥楴祴਻䄉汆捯䵫湡条牥‪汆捯䵫湡条牥㴠圠牯摬㸭灓睡䅮瑣牯䄼汆捯䵫湡条牥⠾汆捯䵫湡条牥汃獡ⱳ匠慰湷牔湡晳牯Ɑ匠慰湷慐慲敭整獲㬩ਊ⼉愯灰祬爠湵猧瀠牡浡瑥牥ੳ昉牯⠠湩㍴′硁獩湉敤⁸‽㬰䄠楸䥳摮硥㰠䄠數⹳畎⡭㬩⬠䄫楸䥳摮硥਩笉ऊ䘉畎敭楲偣潲数瑲⩹倠潲数瑲⁹‽硁獥䅛楸䥳摮硥⹝牐灯牥祴਻उ牐灯牥祴㸭敓乴浵牥捩牐灯牥祴慖畬䙥潲卭牴湩⡧牐灯牥祴㸭潃瑮楡敮偲牴潔慖畬健牴瘼楯㹤䘨潬正慍慮敧⥲‬刪湵嘮污敵孳硁獩湉敤嵸㬩ऊ੽ऊ⼯敳⁴灵愠⁳⁡敨摡敬獳映潬正猠浩汵瑡摥漠⁮桴⁥桳牡摥猠档摥汵牥⠠桷瑡戠来湩瀠慬⁹潤獥映牯栠慥汤獥⁳畲獮Ⱙ眠瑩潨瑵愠祮桴湩⁧桴瑡挠慨杮獥ऊ⼯敳瑴湩獧洠摩爠湵⠠潧敶湲牯 牯眠牯⁫桴瑡椠湳琧猠浩汵瑡潩⁮爨灥楬慣楴湯‬整敬敭牴⁹慳灭敬⁳湡⁤硥潰瑲⁳牡⁥慴敫⁮祢琠敨猠敷灥਩䘉潬正慍慮敧⵲戾獉效摡敬獳㴠琠畲㭥ऊ汆捯䵫湡条牥㸭䅢祳据楓畭慬楴湯㴠琠畲㭥ऊ汆捯䵫湡条牥㸭啢敳桓牡摥捓敨畤敬⁲‽牴敵਻䘉潬正慍慮敧⵲戾湅扡敬潇敶湲牯㴠映污敳਻䘉潬正慍慮敧⵲戾敒汰捩瑡䙥潬正㴠映污敳਻䘉潬正慍慮敧⵲戾敒潣摲敔敬敭牴⁹‽牴敵਻䘉潬正慍慮敧⵲吾汥浥瑥祲慓灭敬湉整癲污㴠䴠塁晟瑬਻䘉潬正慍慮敧⵲吾汥浥瑥祲硅潰瑲湉整癲污㴠〠〮㭦ऊ汆捯䵫湡条牥㸭畂汩䅤潶摩湡散敓獮牯⡳㬩ऊ汆捯䵫湡条牥㸭灁汰兹慵楬祴敌敶⡬㬩ऊ汆捯䵫湡条牥㸭慇桴牥效摡敬獳潖畬敭⡳㬩ऊ晩⠠汆捯䵫湡条牥㸭啢敳汆睯楆汥⥤ऊ੻उ汆捯䵫湡条牥㸭慂敫汆睯楆汥⡤㬩ऊ੽ऊ⼯灳睡⁮潢摩⁳牦浯琠敨爠湵猧猠敥⁤潳攠敶祲瀠牡浡瑥牥猠瑥猠慴瑲⁳牦浯琠敨猠浡⁥汦捯獫ऊ䉁楯⩤䐠晥畡瑬潂摩㴠䈠楯呤灹⹥敇䑴晥畡瑬扏敪瑣⤨਻䘉潬正慍慮敧⵲倾牥散瑰潩剮摡畩⁳‽䵆瑡㩨䴺硡䘨潬正慍慮敧⵲倾牥散瑰潩剮摡畩ⱳ䐠晥畡瑬潂摩㸭敇側牥散瑰潩剮摡畩⡳⤩਻䘉潬正慍慮敧⵲刾灥楬慣整䉤楯呤灹⁥‽潂摩祔数਻䘉潬正慍慮敧⵲䘾潬正瑓瑡⹥敒敳癲⡥畎䉭楯獤㬩ऊ剆湡潤卭牴慥⁭瑓敲浡刨湵匮敥⥤਻昉牯⠠湩㍴′⁩‽㬰椠㰠丠浵潂摩㭳⬠椫਩笉ऊ按湯瑳䘠敖瑣牯倠獯瑩潩⡮瑓敲浡䘮慒摮慒杮⡥灓睡䉮畯摮⹳楍⹮ⱘ匠慰湷潂湵獤䴮硡堮Ⱙ匠牴慥⹭剆湡剤湡敧匨慰湷潂湵獤䴮湩央‬灓睡䉮畯摮⹳慍⹸⥙‬瑓敲浡䘮慒摮慒杮⡥灓睡䉮畯摮⹳楍⹮ⱚ匠慰湷潂湵獤䴮硡娮⤩਻उ潣獮⁴噆捥潴⁲敖潬楣祴㴠匠牴慥⹭敇啴楮噴捥潴⡲ ‪瑓敲浡䘮慒摮慒杮⡥汆捯䵫湡条牥㸭楍卮数摥‬汆捯䵫湡条牥㸭慍卸数摥㬩ऊ䘉潬正慍慮敧⵲䘾潬正瑓瑡⹥摁⡤畮汬瑰Ⱳ倠獯瑩潩Ɱ嘠汥捯瑩ⱹ嘠汥捯瑩⹹潔牏敩瑮瑡潩剮瑯瑡牯⤨㬩ऊ੽ऊ敲畴湲䘠潬正慍慮敧㭲紊ਊ潶摩唠汆捯卫敷灥潃浭湡汤瑥㨺敍獡牵剥湵䘨汆捯卫敷灥畒♮删湵 潣獮ੴ੻按湯瑳䘠汆捯卫慴整…汆捯卫慴整㴠删湵䘮潬正慍慮敧⵲䘾潬正瑓瑡㭥ऊ潣獮⁴湩㍴′畎剭湵潂摩⁳‽汆捯卫慴整丮浵⤨਻椉⁦丨浵畒䉮楯獤㴠‽⤰笠爠瑥牵㭮素ਊ⼉瀯汯牡穩瑡潩⁮獩琠敨氠湥瑧⁨景琠敨洠慥⁮敨摡湩⁧ㄨ㴠攠敶祲戠楯⁤汦敩⁳桴⁥慳敭眠祡‬敮牡〠㴠渠⁯潣浭湯搠物捥楴湯਩吉牁慲㱹噆捥潴㹲䠠慥楤杮㭳ऊ效摡湩獧匮瑥畎啭楮楮楴污穩摥丨浵畒䉮楯獤㬩ऊ噆捥潴⁲效摡湩卧浵㴠䘠敖瑣牯㨺敚潲敖瑣牯਻昉牯⠠湩㍴′⁩‽㬰椠㰠丠浵畒䉮楯獤※⬫⥩ऊ੻उ效摡湩獧楛⁝‽汆捯卫慴整嘮汥捯瑩敩孳嵩䜮瑥慓敦潎浲污⤨਻उ效摡湩卧浵⬠‽效摡湩獧楛㭝ऊ੽刉湵倮汯牡穩瑡潩卮浵⬠‽效摡湩卧浵匮穩⡥  畎剭湵潂摩㭳ਊ⼉港慥敲瑳映潬正慭整眠瑩楨⁮数捲灥楴湯爠摡畩ⱳ戠楯獤眠潨敳挠汯楬楳湯猠桰牥獥漠敶汲灡愠摮戠楯獤椠獮摩⁥敬敶⁬敧浯瑥祲ऊ䙆潬正捏牴敥传瑣敲㭥ऊ捏牴敥䈮極摬䘨潬正瑓瑡⹥潐楳楴湯ⱳ䠠慥楤杮⥳਻按湯瑳映潬瑡䌠汯楬楳湯楄瑳湡散煓慵敲⁤‽䵆瑡㩨区畱牡⡥潃汬獩潩剮摡畩⁳‪⸲昰㬩ऊ潣獮⁴汦慯⁴敓牡档慒楤獵㴠䘠慍桴㨺慍⡸畒⹮汆捯䵫湡条牥㸭敐捲灥楴湯慒楤獵‬潃汬獩潩剮摡畩⁳‪⸲昰㬩ऊ潣獮⁴䍆汯楬楳湯桓灡⁥潃汬獩潩卮慨数㴠䘠潃汬獩潩卮慨数㨺慍敫灓敨敲䌨汯楬楳湯慒楤獵㬩ऊ䍆汯楬楳湯畑牥偹牡浡⁳畑牥偹牡浡瑥牥⡳䍓久彅啑剅彙呓呁䘨潬正睓敥⥰‬慦獬⥥਻唉潗汲⩤圠牯摬㴠删湵䘮潬正慍慮敧⵲䜾瑥潗汲⡤㬩ऊ䅔牲祡椼瑮㈳‾敎杩扨畯獲਻昉牯⠠湩㍴′⁩‽㬰椠㰠丠浵畒䉮楯獤※⬫⥩ऊ੻उ潣獮⁴噆捥潴♲倠獯瑩潩⁮‽汆捯卫慴整倮獯瑩潩獮楛㭝ऊ三楥桧潢牵⹳敒敳⡴㬩ऊ伉瑣敲⹥慇桴牥敎杩扨畯獲倨獯瑩潩Ɱ匠慥捲剨摡畩ⱳ椠‬敎杩扨畯獲㬩ਊउ汦慯⁴敎牡獥䑴獩慴据卥畱牡摥㴠䴠塁晟瑬਻उ潦⁲椨瑮㈳丠楥桧潢牵㨠丠楥桧潢牵⥳ऊ笉ऊउ潣獮⁴汦慯⁴楄瑳湡散煓慵敲⁤‽噆捥潴㩲䐺獩却畱牡摥倨獯瑩潩Ɱ䘠潬正瑓瑡⹥潐楳楴湯孳敎杩扨畯嵲㬩ऊउ敎牡獥䑴獩慴据卥畱牡摥㴠䘠慍桴㨺楍⡮敎牡獥䑴獩慴据卥畱牡摥‬楄瑳湡散煓慵敲⥤਻उ⼉振畯瑮攠捡⁨慰物漠据੥उ椉⁦丨楥桧潢牵㸠椠☠…楄瑳湡散煓慵敲⁤‼潃汬獩潩䑮獩慴据卥畱牡摥਩उ笉ऊउ刉湵䌮汯楬楳湯⭳㬫ऊउ੽उ੽उ晩⠠敎牡獥䑴獩慴据卥畱牡摥㰠䴠塁晟瑬਩उ੻उ刉湵丮慥敲瑳楄瑳湡散畓⁭㴫䘠慍桴㨺煓瑲丨慥敲瑳楄瑳湡散煓慵敲⥤਻उ刉湵丮浵敎牡獥⭴㬫ऊ紉ऊ攉獬੥उ੻उ⼉戯楯獤眠瑩⁨潮映潬正慭整椠⁮敳牡档爠摡畩⁳牡⁥潣湵整⁤灡牡⁴湩瑳慥⁤景猠敫楷杮琠敨搠獩慴据੥उ刉湵丮浵獉汯瑡摥⬫਻उ੽ऊ椉⁦䌨汯楬楳湯慒楤獵㸠〠〮⁦☦圠牯摬㸭癏牥慬䅰祮敔瑳祂桃湡敮⡬潐楳楴湯‬兆慵㩴䤺敤瑮瑩ⱹ䌠䱏䥌䥓乏䅟佖䑉乁䕃‬潃汬獩潩卮慨数‬畑牥偹牡浡瑥牥⥳਩उ੻उ刉湵伮獢慴汣䍥湯慴瑣⭳㬫ऊ紉ऊ੽刉湵丮浵敍獡牵獥⬫਻੽戊潯⁬䙕潬正睓敥䍰浯慭摮敬㩴场楲整敒畳瑬⡳潣獮⁴卆牴湩♧䘠汩健瑡ⱨ挠湯瑳吠牁慲㱹䙆潬正睓敥䅰楸㹳…硁獥‬潣獮⁴䅔牲祡䘼汆捯卫敷灥畒㹮…畒獮 潣獮ੴ੻⼉栯慥敤⁲潲੷䘉瑓楲杮吠硥⁴‽䕔员∨畒Ɱ敓摥⤢਻昉牯⠠潣獮⁴䙆潬正睓敥䅰楸♳䄠楸⁳›硁獥਩笉ऊ吉硥⁴㴫吠塅⡔Ⱒ⤢⬠䄠楸⹳慎敭਻紉ऊ敔瑸⬠‽䕔员∨䈬楯獤䌬畯瑮摥瑓灥ⱳ楔敭卤整獰䴬慥卮浩獍䴬硡楓䵭ⱳ敍湡灓湡獍听慲散偳牥瑓灥䄬潶摩湡散睓敥獰敐卲整Ɒ敍湡敎杩扨畯獲倬汯牡穩瑡潩Ɱ敎牡獥乴楥桧潢牵楄瑳湡散䤬潳慬整䙤慲瑣潩Ɱ潃汬獩潩獮敐卲整Ɒ扏瑳捡敬潃瑮捡獴敐卲整屰≮㬩ਊ⼉漯敮爠睯瀠牥爠湵‬敢慨楶畯⁲湡⁤楴敭愠敲愠敶慲敧⁤癯牥洠慥畳敲⁤瑳灥ⱳ琠敨渠慥敲瑳渠楥桧潢牵搠獩慴据⁥癯牥戠楯獤琠慨⁴慨⁤⁡敮杩扨畯ੲ昉牯⠠湩㍴′畒䥮摮硥㴠〠※畒䥮摮硥㰠删湵⹳畎⡭㬩⬠别湵湉敤⥸ऊ੻उ潣獮⁴䙆潬正睓敥剰湵…畒⁮‽畒獮剛湵湉敤嵸਻उ潣獮⁴汦慯⁴敍獡牵獥㴠䘠慍桴㨺慍⡸畒⹮畎䵭慥畳敲ⱳㄠ㬩ऊ按湯瑳映潬瑡吠浩摥瑓灥⁳‽䵆瑡㩨䴺硡刨湵丮浵楔敭卤整獰‬⤱਻उ潣獮⁴湩㙴‴畎䵭慥畳敲䉤楯獤㴠删湵丮浵敎牡獥⁴‫畒⹮畎䥭潳慬整㭤ऊ吉硥⁴㴫䘠瑓楲杮㨺牐湩晴吨塅⡔┢Ɽ搥⤢‬畒䥮摮硥‬畒⹮敓摥㬩ऊ昉牯⠠潣獮⁴卆牴湩♧嘠污敵㨠删湵嘮污敵⥳ऊ笉ऊउ敔瑸⬠‽䕔员∨∬ ‫慖畬㭥ऊ紉ऊ吉硥⁴㴫䘠瑓楲杮㨺牐湩晴吨塅⡔Ⱒ搥┬Ɽ搥┬㌮ⱦ⸥昳┬㌮ⱦ⸥昱┬ㄮⱦ⸥昲┬㌮ⱦ⸥昱┬㌮ⱦ⸥昲┬㈮屦≮Ⱙऊउ畒⹮潃瑳丮浵潂摩ⱳ删湵䌮獯⹴畎䙭慲敭ⱳ删湵丮浵楔敭卤整獰‬畒⹮楓䵭即浵⼠吠浩摥瑓灥ⱳ删湵䴮硡楓䵭ⱳ删湵匮慰䵮即浵⼠吠浩摥瑓灥ⱳऊउ畒⹮潃瑳吮慲散偳牥牆浡ⱥ删湵䌮獯⹴癁楯慤据卥敷灥偳牥牆浡ⱥ删湵䌮獯⹴敍湡敎杩扨畯獲ਬउ刉湵倮汯牡穩瑡潩卮浵⼠䴠慥畳敲ⱳ删湵丮浵敎牡獥⁴‾‰‿畒⹮敎牡獥䑴獩慴据卥浵⼠删湵丮浵敎牡獥⁴›⸰ⰰ丠浵敍獡牵摥潂摩⁳‾‰‿潤扵敬刨湵丮浵獉汯瑡摥  畎䵭慥畳敲䉤楯獤㨠〠〮ਬउ刉湵䌮汯楬楳湯⁳ 敍獡牵獥‬畒⹮扏瑳捡敬潃瑮捡獴⼠䴠慥畳敲⥳਻紉ਊ爉瑥牵⁮䙆汩䡥汥数㩲区癡卥牴湩呧䙯汩⡥敔瑸‬䘪汩健瑡⥨਻੽
\ No newline at end of file
@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠汆捯呫汥浥瑥祲栮ਢ椣据畬敤∠楍捳䘯汩䡥汥数⹲≨ਊ潶摩䘠汆捯呫汥浥瑥祲㨺敒潣摲牆浡⡥汦慯⁴楓呭浩䵥⥳笊ऊ畎䙭慲敭⭳㬫ऊ楓呭浩卥浵⬠‽楓呭浩䵥㭳ऊ慍卸浩楔敭㴠䘠慍桴㨺慍⡸慍卸浩楔敭‬楓呭浩䵥⥳਻੽瘊楯⁤䙆潬正敔敬敭牴㩹䄺摤潃湵獴挨湯瑳䘠汆捯呫汥浥瑥祲潃湵獴…潃湵獴਩੻䘉慲敭潃湵獴丮楥桧潢牵畓⁭㴫䌠畯瑮⹳敎杩扨畯卲浵਻䘉慲敭潃湵獴匮整牥摥潂摩⁳㴫䌠畯瑮⹳瑓敥敲䉤楯獤਻䘉慲敭潃湵獴䴮硡敎杩扨畯獲㴠䘠慍桴㨺慍⡸牆浡䍥畯瑮⹳慍乸楥桧潢牵ⱳ䌠畯瑮⹳慍乸楥桧潢牵⥳਻昉牯⠠湩㍴′楂⁮‽㬰䈠湩㰠䘠潬正敔敬敭牴䡹獩潴牧浡楂獮※⬫楂⥮ऊ੻उ牆浡䍥畯瑮⹳敎杩扨畯䡲獩潴牧浡䉛湩⁝㴫䌠畯瑮⹳敎杩扨畯䡲獩潴牧浡䉛湩㭝ऊ੽䘉慲敭潃湵獴䄮潶摩湡散睓敥獰⬠‽潃湵獴䄮潶摩湡散睓敥獰਻䘉慲敭潃湵獴吮慲散⁳㴫䌠畯瑮⹳牔捡獥਻੽瘊楯⁤䙆潬正敔敬敭牴㩹吺歡卥浡汰⡥汦慯⁴楔敭‬潣獮⁴䅔牲祡䘼敖瑣牯☾倠獯瑩潩獮਩੻䘉汆捯呫汥浥瑥祲慓灭敬匠浡汰㭥ऊ慓灭敬吮浩⁥‽楔敭਻匉浡汰⹥畎䙭慲敭⁳‽畎䙭慲敭㭳ऊ慓灭敬丮浵潂摩⁳‽潐楳楴湯⹳畎⡭㬩ऊ慓灭敬䴮慥卮浩楔敭獍㴠丠浵牆浡獥㸠〠㼠匠浩楔敭畓⁭ 畎䙭慲敭⁳›⸰昰਻匉浡汰⹥慍卸浩楔敭獍㴠䴠硡楓呭浩㭥ऊ慓灭敬䴮慥乮楥桧潢牵⁳‽牆浡䍥畯瑮⹳瑓敥敲䉤楯獤㸠〠㼠映潬瑡搨畯汢⡥牆浡䍥畯瑮⹳敎杩扨畯卲浵  牆浡䍥畯瑮⹳瑓敥敲䉤楯獤 ›⸰昰਻匉浡汰⹥慍乸楥桧潢牵⁳‽牆浡䍥畯瑮⹳慍乸楥桧潢牵㭳ऊ䵆浥牯㩹䴺浥灣⡹慓灭敬丮楥桧潢牵楈瑳杯慲Ɑ䘠慲敭潃湵獴丮楥桧潢牵楈瑳杯慲Ɑ猠穩潥⡦牆浡䍥畯瑮⹳敎杩扨畯䡲獩潴牧浡⤩਻匉浡汰⹥癁楯慤据卥敷灥偳牥牆浡⁥‽畎䙭慲敭⁳‾‰‿汦慯⡴牆浡䍥畯瑮⹳癁楯慤据卥敷灥⥳⼠丠浵牆浡獥㨠〠〮㭦ऊ慓灭敬吮慲散偳牥牆浡⁥‽畎䙭慲敭⁳‾‰‿汦慯⡴牆浡䍥畯瑮⹳牔捡獥  畎䙭慲敭⁳›⸰昰਻ऊ⼯潣湵⁴潢摩⁳湩攠捡⁨牧摩挠汥੬䐉湥楳祴片摩刮獥瑥⤨਻按湯瑳映潬瑡䤠癮敃汬楓敺㴠ㄠ〮⁦ 䵆瑡㩨䴺硡䌨汥卬穩ⱥㄠ〮⥦਻昉牯⠠潣獮⁴噆捥潴♲倠獯瑩潩⁮›潐楳楴湯⥳ऊ੻उ䥆瑮敖瑣牯䌠汥⡬䵆瑡㩨䘺潬牯潔湉⡴潐楳楴湯堮⨠䤠癮敃汬楓敺Ⱙ䘠慍桴㨺汆潯呲䥯瑮倨獯瑩潩⹮⁙‪湉䍶汥卬穩⥥‬䵆瑡㩨䘺潬牯潔湉⡴潐楳楴湯娮⨠䤠癮敃汬楓敺⤩਻उ湩㍴☲䌠汥䑬湥楳祴㴠䐠湥楳祴片摩䘮湩佤䅲摤䌨汥⥬਻उ敃汬敄獮瑩⭹㬫ऊ匉浡汰⹥慍䍸汥䑬湥楳祴㴠䘠慍桴㨺慍⡸慓灭敬䴮硡敃汬敄獮瑩ⱹ䌠汥䑬湥楳祴㬩ऊ੽匉浡汰⹥捏畣楰摥敃汬⁳‽敄獮瑩䝹楲⹤畎⡭㬩ਊ⼉搯潲⁰汯敤瑳猠浡汰獥漠据⁥畦汬ऊ晩⠠慍卸浡汰獥㸠〠☠…慓灭敬⹳畎⡭ 㴾䴠硡慓灭敬⥳ऊ੻उ慓灭敬⹳敒潭敶瑁〨‬慓灭敬⹳畎⡭ ‭慍卸浡汰獥⬠ㄠ‬慦獬⥥਻紉ऊ慓灭敬⹳摁⡤慓灭敬㬩ਊ⼉猯慴瑲愠捣浵汵瑡湩⁧敮瑸猠浡汰੥刉獥瑥牆浡獥⤨਻੽瘊楯⁤䙆潬正敔敬敭牴㩹刺獥瑥⤨笊ऊ敒敳䙴慲敭⡳㬩ऊ慓灭敬⹳浅瑰⡹㬩ऊ敄獮瑩䝹楲⹤浅瑰⡹㬩紊ਊ潶摩䘠汆捯呫汥浥瑥祲㨺敒敳䙴慲敭⡳਩੻三浵牆浡獥㴠〠਻匉浩楔敭畓⁭‽⸰昰਻䴉硡楓呭浩⁥‽⸰昰਻䘉慲敭潃湵獴㴠䘠汆捯呫汥浥瑥祲潃湵獴⤨਻੽挊湯瑳吠䡃剁‪䙆潬正敔敬敭牴㩹䜺瑥楈瑳杯慲䉭湩慌敢⡬湩㍴′楂⥮笊ऊ瑳瑡捩挠湯瑳吠䡃剁‪慌敢獬䙛潬正敔敬敭牴䡹獩潴牧浡楂獮⁝‽⁻䕔员∨∰Ⱙ吠塅⡔ㄢ⤢‬䕔员∨∲Ⱙ吠塅⡔㌢㐭⤢‬䕔员∨ⴵ∸Ⱙ吠塅⡔㤢ㄭ∶Ⱙ吠塅⡔ㄢⴷ㈳⤢‬䕔员∨㌳∫ 㭽ऊ敲畴湲䰠扡汥孳䵆瑡㩨䌺慬灭䈨湩‬ⰰ䘠潬正敔敬敭牴䡹獩潴牧浡楂獮ⴠㄠ崩਻੽戊潯⁬䙆潬正敔敬敭牴㩹䔺灸牯䍴噓挨湯瑳䘠瑓楲杮…楆敬慐桴 潣獮ੴ੻⼉栯慥敤⁲潲੷䘉瑓楲杮吠硥⁴‽䕔员∨楔敭䘬慲敭ⱳ潂摩ⱳ敍湡楓䵭ⱳ慍卸浩獍䴬慥乮楥桧潢牵ⱳ慍乸楥桧潢牵≳㬩ऊ潦⁲椨瑮㈳䈠湩㴠〠※楂⁮‼汆捯呫汥浥瑥祲楈瑳杯慲䉭湩㭳⬠䈫湩਩笉ऊ吉硥⁴㴫䘠瑓楲杮㨺牐湩晴吨塅⡔Ⱒ敎杩扨畯獲╟≳Ⱙ䜠瑥楈瑳杯慲䉭湩慌敢⡬楂⥮㬩ऊ੽吉硥⁴㴫吠塅⡔Ⱒ癁楯慤据卥敷灥偳牥牆浡ⱥ牔捡獥敐䙲慲敭伬捣灵敩䍤汥獬䴬硡敃汬敄獮瑩屹≮㬩ਊ⼉漯敮爠睯瀠牥猠浡汰੥昉牯⠠潣獮⁴䙆潬正敔敬敭牴卹浡汰♥匠浡汰⁥›慓灭敬⥳ऊ੻उ敔瑸⬠‽卆牴湩㩧债楲瑮⡦䕔员∨⸥昳┬Ɽ搥┬㌮ⱦ⸥昳┬㈮ⱦ搥⤢‬慓灭敬吮浩ⱥ匠浡汰⹥畎䙭慲敭ⱳ匠浡汰⹥畎䉭楯獤‬慓灭敬䴮慥卮浩楔敭獍‬慓灭敬䴮硡楓呭浩䵥ⱳ匠浡汰⹥敍湡敎杩扨畯獲‬慓灭敬䴮硡敎杩扨畯獲㬩ऊ昉牯⠠湩㍴′楂⁮‽㬰䈠湩㰠䘠潬正敔敬敭牴䡹獩潴牧浡楂獮※⬫楂⥮ऊ笉ऊउ敔瑸⬠‽卆牴湩㩧债楲瑮⡦䕔员∨┬≤Ⱙ匠浡汰⹥敎杩扨畯䡲獩潴牧浡䉛湩⥝਻उ੽उ敔瑸⬠‽卆牴湩㩧债楲瑮⡦䕔员∨┬㈮ⱦ⸥昲┬Ɽ搥湜⤢‬慓灭敬䄮潶摩湡散睓敥獰敐䙲慲敭‬慓灭敬吮慲散偳牥牆浡ⱥ匠浡汰⹥捏畣楰摥敃汬ⱳ匠浡汰⹥慍䍸汥䑬湥楳祴㬩ऊ੽ऊ敲畴湲䘠楆敬效灬牥㨺慓敶瑓楲杮潔楆敬吨硥ⱴ⨠楆敬慐桴㬩紊ਊ潢汯䘠汆捯呫汥浥瑥祲㨺硅潰瑲半乏挨湯瑳䘠瑓楲杮…楆敬慐桴 潣獮ੴ੻䘉瑓楲杮吠硥⁴‽卆牴湩㩧债楲瑮⡦䕔员∨屻屮屴挢汥卬穩履㨢┠ㄮⱦ湜瑜≜楨瑳杯慲䉭湩屳㨢嬠⤢‬敃汬楓敺㬩ऊ潦⁲椨瑮㈳䈠湩㴠〠※楂⁮‼汆捯呫汥浥瑥祲楈瑳杯慲䉭湩㭳⬠䈫湩਩笉ऊ吉硥⁴㴫䘠瑓楲杮㨺牐湩晴吨塅⡔┢屳┢屳∢Ⱙ䈠湩㸠〠㼠吠塅⡔Ⱒ∠ ›䕔员∨⤢‬敇䡴獩潴牧浡楂䱮扡汥䈨湩⤩਻紉ਊ⼉猯浡汰獥ऊ敔瑸⬠‽䕔员∨ⱝ湜瑜≜慳灭敬屳㨢嬠⤢਻昉牯⠠湩㍴′⁩‽㬰椠㰠匠浡汰獥丮浵⤨※⬫⥩ऊ੻उ潣獮⁴䙆潬正敔敬敭牴卹浡汰♥匠浡汰⁥‽慓灭敬孳嵩਻उ敔瑸⬠‽卆牴湩㩧债楲瑮⡦䕔员∨猥湜瑜瑜⁻≜楴敭≜›⸥昳‬≜牦浡獥≜›搥‬≜潢摩屳㨢┠Ɽ尠洢慥卮浩獍≜›⸥昳‬≜慭卸浩獍≜›⸥昳‬≜敭湡敎杩扨畯獲≜›⸥昲‬≜慭乸楥桧潢牵屳㨢┠Ɽ尠渢楥桧潢牵楈瑳杯慲屭㨢嬠⤢ਬउ椉㸠〠㼠吠塅⡔Ⱒ⤢㨠吠塅⡔∢Ⱙ匠浡汰⹥楔敭‬慓灭敬丮浵牆浡獥‬慓灭敬丮浵潂摩ⱳ匠浡汰⹥敍湡楓呭浩䵥ⱳ匠浡汰⹥慍卸浩楔敭獍‬慓灭敬䴮慥乮楥桧潢牵ⱳ匠浡汰⹥慍乸楥桧潢牵⥳਻उ潦⁲椨瑮㈳䈠湩㴠〠※楂⁮‼汆捯呫汥浥瑥祲楈瑳杯慲䉭湩㭳⬠䈫湩਩उ੻उ吉硥⁴㴫䘠瑓楲杮㨺牐湩晴吨塅⡔┢╳≤Ⱙ䈠湩㸠〠㼠吠塅⡔Ⱒ∠ ›䕔员∨⤢‬慓灭敬丮楥桧潢牵楈瑳杯慲孭楂嵮㬩ऊ紉ऊ吉硥⁴㴫䘠瑓楲杮㨺牐湩晴吨塅⡔崢‬≜癡楯慤据卥敷灥偳牥牆浡履㨢┠㈮ⱦ尠琢慲散偳牥牆浡履㨢┠㈮ⱦ尠漢捣灵敩䍤汥獬≜›搥‬≜慭䍸汥䑬湥楳祴≜›搥素⤢‬慓灭敬䄮潶摩湡散睓敥獰敐䙲慲敭‬慓灭敬吮慲散偳牥牆浡ⱥ匠浡汰⹥捏畣楰摥敃汬ⱳ匠浡汰⹥慍䍸汥䑬湥楳祴㬩ऊ੽ऊ⼯敤獮瑩⁹牧摩漠⁦桴⁥慬整瑳猠浡汰⁥獡嬠ⱸ礠‬ⱺ戠楯獤⁝数⁲捯畣楰摥挠汥੬吉硥⁴㴫吠塅⡔尢屮嵴尬屮屴搢湥楳祴片摩≜›≛㬩ऊ潢汯戠楆獲䍴汥⁬‽牴敵਻昉牯⠠潣獮⁴偔楡㱲䥆瑮敖瑣牯‬湩㍴㸲…敃汬㨠䐠湥楳祴片摩਩笉ऊ吉硥⁴㴫䘠瑓楲杮㨺牐湩晴吨塅⡔┢屳屮屴孴搥‬搥‬搥‬搥≝Ⱙ戠楆獲䍴汥⁬‿䕔员∨⤢㨠吠塅⡔Ⱒ⤢‬敃汬䬮祥堮‬敃汬䬮祥央‬敃汬䬮祥娮‬敃汬嘮污敵㬩ऊ戉楆獲䍴汥⁬‽慦獬㭥ऊ੽吉硥⁴㴫吠塅⡔尢屮嵴湜屽≮㬩ਊ爉瑥牵⁮䙆汩䡥汥数㩲区癡卥牴湩呧䙯汩⡥敔瑸‬䘪汩健瑡⥨਻੽
\ No newline at end of file
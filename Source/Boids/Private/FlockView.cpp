@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠汆捯噫敩⹷≨⌊湩汣摵⁥䘢潬正瑓瑡⹥≨ਊ潶摩䘠汆捯噫敩㩷䈺極摬挨湯瑳䘠汆捯卫慴整…汆捯卫慴整‬潣獮⁴䙆潬正片畯獰‪汆捯䝫潲灵ⱳ甠湩㙴‴湉敖獲潩Ɱ映潬瑡䤠呮浩⥥笊ऊ敖獲潩⁮‽湉敖獲潩㭮ऊ楔敭㴠䤠呮浩㭥ਊ⼉振灯⁹瑳瑡ⱥ愠牲祡⁳敫灥琠敨物愠汬捯瑡潩⁮桷湥愠瘠敩⁷獩爠略敳੤倉獯瑩潩獮刮獥瑥⤨਻倉獯瑩潩獮䄮灰湥⡤汆捯卫慴整倮獯瑩潩獮㬩ऊ敖潬楣楴獥刮獥瑥⤨਻嘉汥捯瑩敩⹳灁数摮䘨潬正瑓瑡⹥敖潬楣楴獥㬩ऊ慈摮敬⹳敒敳⡴㬩ऊ慈摮敬⹳灁数摮䘨潬正瑓瑡⹥慈摮敬⥳਻匉潬䥴摮捩獥匮瑥畎啭楮楮楴污穩摥䘨潬正瑓瑡⹥敇乴浵汓瑯⡳⤩਻昉牯⠠湩㍴′汓瑯㴠〠※汓瑯㰠匠潬䥴摮捩獥丮浵⤨※⬫汓瑯਩笉ऊ匉潬䥴摮捩獥卛潬嵴㴠䘠潬正瑓瑡⹥敇却潬䥴摮硥匨潬⥴਻紉ਊ⼉振灯⁹牧畯獰ऊ片畯獰刮獥瑥⤨਻䜉潲灵湉楤散⹳敒敳⡴㬩ऊ晩⠠汆捯䝫潲灵⥳ऊ੻उ片畯獰䄮灰湥⡤汆捯䝫潲灵⵳䜾瑥片畯獰⤨㬩ऊ䜉潲灵湉楤散⹳敓乴浵湕湩瑩慩楬敺⡤慈摮敬⹳畎⡭⤩਻उ潦⁲椨瑮㈳椠㴠〠※⁩‼慈摮敬⹳畎⡭㬩⬠椫਩उ੻उ䜉潲灵湉楤散孳嵩㴠䘠潬正片畯獰㸭敇䝴潲灵湉敤⡸慈摮敬孳嵩㬩ऊ紉ऊ੽ऊ⼯畳⁭汦捯⁫条牧来瑡獥ऊ潣獮⁴湩㍴′畎䉭楯獤㴠倠獯瑩潩獮丮浵⤨਻䌉湥牴楯⁤‽噆捥潴㩲娺牥噯捥潴㭲ऊ敍湡敖潬楣祴㴠䘠敖瑣牯㨺敚潲敖瑣牯਻䈉畯摮⁳‽䉆硯䘨牯散湉瑩㬩ऊ晩⠠畎䉭楯獤㴠‽⤰笠爠瑥牵㭮素ਊ昉牯⠠湩㍴′⁩‽㬰椠㰠丠浵潂摩㭳⬠椫਩笉ऊ䌉湥牴楯⁤㴫倠獯瑩潩獮楛㭝ऊ䴉慥噮汥捯瑩⁹㴫嘠汥捯瑩敩孳嵩਻紉ऊ敃瑮潲摩⼠‽畎䉭楯獤਻䴉慥噮汥捯瑩⁹㴯丠浵潂摩㭳ऊ潂湵獤㴠䘠潂⡸潐楳楴湯⹳敇䑴瑡⡡Ⱙ丠浵潂摩⥳਻੽椊瑮㈳䘠汆捯噫敩㩷䜺瑥湉敤⡸湩㍴′慈摮敬 潣獮ੴ੻⼉猯慴敬栠湡汤獥搠湯琧洠瑡档琠敨栠湡汤⁥景琠敨戠楯⁤潮⁷湩琠敨物猠潬ੴ按湯瑳椠瑮㈳匠潬⁴‽䙆潬正瑓瑡㩥䜺瑥慈摮敬汓瑯䠨湡汤⥥਻按湯瑳椠瑮㈳䤠摮硥㴠䠠湡汤⁥㴾〠☠…汓瑯湉楤散⹳獉慖楬䥤摮硥匨潬⥴㼠匠潬䥴摮捩獥卛潬嵴㨠䤠䑎塅也乏㭅ऊ敲畴湲䤠摮硥℠‽义䕄彘低䕎☠…慈摮敬孳湉敤嵸㴠‽慈摮敬㼠䤠摮硥㨠䤠䑎塅也乏㭅紊
\ No newline at end of file
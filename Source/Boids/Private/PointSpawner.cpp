@@ -1,63 +1 @@
-// Copyright ©2020 Samuel Harrison
-
-//includes
-#include "PointSpawner.h"
-#include "Components/BillboardComponent.h"
-#include "Boid.h"
-#include "FlockManager.h"
-
-APointSpawner::APointSpawner()
-{
-	//disable ticking
-	PrimaryActorTick.bCanEverTick = false;
-
-	//setup visual component
-	SpawnPointBillboard = CreateDefaultSubobject<UBillboardComponent>(TEXT("Spawn Point Billboard Component"));
-	RootComponent = SpawnPointBillboard;
-
-	//set default number of boids to spawn
-	NumBoidsToSpawn = 0;
-}
-
-void APointSpawner::BeginPlay()
-{
-	Super::BeginPlay();
-
-	//spawn initial boid flock
-	SpawnBoids(NumBoidsToSpawn);
-}
-
-
-void APointSpawner::SpawnBoids(int32 NumBoids)
-{
-	//check for assigned flock manager
-	if (AssignedFlockManager == nullptr)
-	{
-		//log warning to console
-		UE_LOG(LogTemp, Warning, TEXT("No FlockManager found for Boid spawner: %s."), *GetName());
-		return;
-	}
-
-	//check BoidType is set in BP
-	if (BoidType == nullptr)
-	{
-		//log warning to console
-		UE_LOG(LogTemp, Warning, TEXT("BoidType not set for Spawner: %s"), *GetName());
-		return;
-	}
-
-	//spawn boids
-	FVector SpawnLocation = this->GetActorLocation();
-	FRotator SpawnRotation = FRotator::ZeroRotator;
-	FActorSpawnParameters BoidSpawnParams;
-	BoidSpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-	BoidSpawnParams.Owner = AssignedFlockManager;
-
-	for (int32 i = 0; i < NumBoids; ++i)
-	{
-		//spawn boids at point in random directions
-		SpawnRotation = FMath::VRand().ToOrientationRotator();
-		AssignedFlockManager->AddBoidToFlock(GetWorld()->SpawnActor<ABoid>(BoidType, SpawnLocation, SpawnRotation, BoidSpawnParams));
-	}
-}
-
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠潐湩却慰湷牥栮ਢ椣据畬敤∠潃灭湯湥獴䈯汩扬慯摲潃灭湯湥⹴≨⌊湩汣摵⁥䈢楯⹤≨⌊湩汣摵⁥䘢潬正慍慮敧⹲≨ਊ偁楯瑮灓睡敮㩲䄺潐湩却慰湷牥⤨笊ऊ⼯楤慳汢⁥楴正湩੧倉楲慭祲捁潴呲捩⹫䍢湡癅牥楔正㴠映污敳਻ऊ⼯敳畴⁰楶畳污挠浯潰敮瑮ऊ灓睡偮楯瑮楂汬潢牡⁤‽牃慥整敄慦汵却扵扯敪瑣唼楂汬潢牡䍤浯潰敮瑮⠾䕔员∨灓睡⁮潐湩⁴楂汬潢牡⁤潃灭湯湥≴⤩਻刉潯䍴浯潰敮瑮㴠匠慰湷潐湩䉴汩扬慯摲਻ऊ⼯敳⁴敤慦汵⁴畮扭牥漠⁦潢摩⁳潴猠慰湷ऊ畎䉭楯獤潔灓睡⁮‽㬰紊ਊ潶摩䄠潐湩却慰湷牥㨺敂楧偮慬⡹਩੻匉灵牥㨺敂楧偮慬⡹㬩ਊ⼉猯慰湷椠楮楴污戠楯⁤汦捯⁫昨潬正洠湡条牥爠獥潴敲⁳瑩⁳汦捯⁫牦浯愠猠慮獰潨⁴湩瑳慥⁤桷湥眠牡⁭瑳牡整⥤ऊ晩⠠獁楳湧摥汆捯䵫湡条牥㴠‽畮汬瑰⁲籼℠獁楳湧摥汆捯䵫湡条牥㸭獉慗浲瑓牡整⡤⤩ऊ੻उ灓睡䉮楯獤丨浵潂摩味卯慰湷㬩ऊ੽੽ਊ潶摩䄠潐湩却慰湷牥㨺灓睡䉮楯獤椨瑮㈳丠浵潂摩⥳笊ऊ⼯档捥⁫潦⁲獡楳湧摥映潬正洠湡条牥ऊ晩⠠獁楳湧摥汆捯䵫湡条牥㴠‽畮汬瑰⥲ऊ੻उ⼯潬⁧慷湲湩⁧潴挠湯潳敬ऊ唉彅佌⡇潌呧浥Ɒ圠牡楮杮‬䕔员∨潎䘠潬正慍慮敧⁲潦湵⁤潦⁲潂摩猠慰湷牥›猥∮Ⱙ⨠敇乴浡⡥⤩਻उ敲畴湲਻紉ਊ⼉振敨正䈠楯呤灹⁥獩猠瑥椠⁮偂ऊ晩⠠潂摩祔数㴠‽畮汬瑰⥲ऊ੻उ⼯潬⁧慷湲湩⁧潴挠湯潳敬ऊ唉彅佌⡇潌呧浥Ɒ圠牡楮杮‬䕔员∨潂摩祔数渠瑯猠瑥映牯匠慰湷牥›猥⤢‬䜪瑥慎敭⤨㬩ऊ爉瑥牵㭮ऊ੽ऊ⼯畱略⁥潢摩⁳潴戠⁥灳睡敮⁤祢映潬正洠湡条牥ऊ噆捥潴⁲灓睡䱮捯瑡潩⁮‽桴獩㸭敇䅴瑣牯潌慣楴湯⤨਻䘉潒慴潴⁲灓睡剮瑯瑡潩⁮‽剆瑯瑡牯㨺敚潲潒慴潴㭲ਊ昉牯⠠湩㍴′⁩‽㬰椠㰠丠浵潂摩㭳⬠椫਩笉ऊ⼉猯慰湷戠楯獤愠⁴潰湩⁴湩爠湡潤⁭楤敲瑣潩獮ऊ匉慰湷潒慴楴湯㴠䘠慍桴㨺剖湡⡤⸩潔牏敩瑮瑡潩剮瑯瑡牯⤨਻उ獁楳湧摥汆捯䵫湡条牥㸭畑略䉥楯卤慰湷䈨楯呤灹ⱥ䘠牔湡晳牯⡭灓睡剮瑯瑡潩Ɱ匠慰湷潌慣楴湯⤩਻紉紊ਊ
\ No newline at end of file
@@ -1,108 +1 @@
-// Copyright ©2020 Samuel Harrison
-
-//includes
-#include "TargetObject.h"
-#include "Components/SphereComponent.h"
-#include "Components/StaticMeshComponent.h"
-#include "Boid.h"
-
-ATargetObject::ATargetObject()
-{
-	//enable ticking
-	PrimaryActorTick.bCanEverTick = true;
-
-	//setup collision component
-	TargetCollision = CreateDefaultSubobject<USphereComponent>(TEXT("Target Collision Component"));
-	RootComponent = TargetCollision;
-	TargetCollision->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-	TargetCollision->SetCollisionResponseToAllChannels(ECR_Ignore);
-	TargetCollision->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
-
-	//setup mesh component
-	TargetMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Target Mesh Component"));
-	TargetMesh->SetupAttachment(RootComponent);
-	TargetMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-	TargetMesh->SetCollisionResponseToAllChannels(ECR_Ignore);
-
-	//setup target force
-	TargetForceStrength = 0.0f;
-	bProximityScaled = false;
-	bInvertProximityScaling = false;
-	bHasRange = true;
-}
-
-void ATargetObject::BeginPlay()
-{
-	Super::BeginPlay();
-
-	//bind collision component overlap events to delegates
-	if (TargetCollision)
-	{
-		TargetCollision->OnComponentBeginOverlap.AddDynamic(this, &ATargetObject::OnTargetOverlapBegin);
-		TargetCollision->OnComponentEndOverlap.AddDynamic(this, &ATargetObject::OnTargetOverlapEnd);
-	}
-}
-
-void ATargetObject::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-	//apply target force to affected boids
-	ApplyTargetForces();
-}
-
-void ATargetObject::OnTargetOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult & SweepResult)
-{
-	//check if actor entering target range is a boid and valid
-	ABoid* EnteringBoid = Cast<ABoid>(OtherActor);
-	if (EnteringBoid)
-	{
-		BoidsInRange.Add(EnteringBoid);
-	}
-}
-
-void ATargetObject::OnTargetOverlapEnd(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
-{
-	//check if actor exiting target range is a boid and valid
-	ABoid* ExitingBoid = Cast<ABoid>(OtherActor);
-	if (ExitingBoid)
-	{
-		BoidsInRange.Remove(ExitingBoid);
-	}
-}
-
-void ATargetObject::ApplyTargetForces()
-{
-	FVector TargetForce = FVector::ZeroVector;
-
-	if (bHasRange)
-	{
-		//get list of overlapping boids
-		for (ABoid* Boid : BoidsInRange)
-		{
-			//get unscaled force
-			TargetForce = this->GetActorLocation() - Boid->GetActorLocation();
-			TargetForce = TargetForce.GetSafeNormal();
-			TargetForce *= TargetForceStrength;
-			TargetForce -= Boid->GetBoidVelocity();
-
-			//add force to boid target force stack
-			Boid->AddTargetForce(TargetForce);
-			//TODO: add distance factor
-			if (bProximityScaled)
-			{
-				if (bInvertProximityScaling)
-				{
-
-				}
-			}
-		}
-	}
-	else
-	{
-		//get ALL boids
-
-		//TODO: calculate unscaled force
-		//TODO: add distance factor
-	}
-}
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠慔杲瑥扏敪瑣栮ਢ椣据畬敤∠潃灭湯湥獴匯桰牥䍥浯潰敮瑮栮ਢ椣据畬敤∠潃灭湯湥獴匯慴楴䵣獥䍨浯潰敮瑮栮ਢ椣据畬敤∠潂摩栮ਢ䄊慔杲瑥扏敪瑣㨺呁牡敧佴橢捥⡴਩੻⼉支慮汢⁥楴正湩੧倉楲慭祲捁潴呲捩⹫䍢湡癅牥楔正㴠琠畲㭥ਊ⼉猯瑥灵挠汯楬楳湯挠浯潰敮瑮ऊ慔杲瑥潃汬獩潩⁮‽牃慥整敄慦汵却扵扯敪瑣唼灓敨敲潃灭湯湥㹴吨塅⡔吢牡敧⁴潃汬獩潩⁮潃灭湯湥≴⤩਻刉潯䍴浯潰敮瑮㴠吠牡敧䍴汯楬楳湯਻吉牡敧䍴汯楬楳湯㸭敓䍴汯楬楳湯湅扡敬⡤䍅汯楬楳湯湅扡敬㩤儺敵祲湏祬㬩ऊ慔杲瑥潃汬獩潩⵮匾瑥潃汬獩潩剮獥潰獮呥䅯汬桃湡敮獬䔨剃䥟湧牯⥥਻吉牡敧䍴汯楬楳湯㸭敓䍴汯楬楳湯敒灳湯敳潔桃湡敮⡬䍅彃慐湷‬䍅归癏牥慬⥰਻ऊ⼯敳畴⁰敭桳挠浯潰敮瑮ऊ慔杲瑥敍桳㴠䌠敲瑡䑥晥畡瑬畓潢橢捥㱴单慴楴䵣獥䍨浯潰敮瑮⠾䕔员∨慔杲瑥䴠獥⁨潃灭湯湥≴⤩਻吉牡敧䵴獥⵨匾瑥灵瑁慴档敭瑮刨潯䍴浯潰敮瑮㬩ऊ慔杲瑥敍桳㸭敓䍴汯楬楳湯湅扡敬⡤䍅汯楬楳湯湅扡敬㩤为䍯汯楬楳湯㬩ऊ慔杲瑥敍桳㸭敓䍴汯楬楳湯敒灳湯敳潔汁䍬慨湮汥⡳䍅归杉潮敲㬩ਊ⼉猯瑥灵琠牡敧⁴潦捲੥吉牡敧䙴牯散瑓敲杮桴㴠〠〮㭦ऊ偢潲楸業祴捓污摥㴠映污敳਻戉湉敶瑲牐硯浩瑩卹慣楬杮㴠映污敳਻戉慈剳湡敧㴠琠畲㭥紊ਊ潶摩䄠慔杲瑥扏敪瑣㨺敂楧偮慬⡹਩੻匉灵牥㨺敂楧偮慬⡹㬩ਊ⼉戯湩⁤潣汬獩潩⁮潣灭湯湥⁴癯牥慬⁰癥湥獴琠⁯敤敬慧整ੳ椉⁦吨牡敧䍴汯楬楳湯਩笉ऊ吉牡敧䍴汯楬楳湯㸭湏潃灭湯湥䉴来湩癏牥慬⹰摁䑤湹浡捩琨楨ⱳ☠呁牡敧佴橢捥㩴伺呮牡敧佴敶汲灡敂楧⥮਻उ慔杲瑥潃汬獩潩⵮伾䍮浯潰敮瑮湅佤敶汲灡䄮摤祄慮業⡣桴獩‬䄦慔杲瑥扏敪瑣㨺湏慔杲瑥癏牥慬䕰摮㬩ऊ੽੽瘊楯⁤呁牡敧佴橢捥㩴吺捩⡫汦慯⁴敄瑬呡浩⥥笊ऊ畓数㩲吺捩⡫敄瑬呡浩⥥਻ऊ⼯灡汰⁹慴杲瑥映牯散琠⁯晡敦瑣摥戠楯獤ऊ灁汰呹牡敧䙴牯散⡳㬩紊ਊ潶摩䄠慔杲瑥扏敪瑣㨺湏慔杲瑥癏牥慬䉰来湩唨牐浩瑩癩䍥浯潰敮瑮‪癏牥慬灰摥潃灭湯湥ⱴ䄠捁潴⩲传桴牥捁潴Ⱳ唠牐浩瑩癩䍥浯潰敮瑮‪瑏敨䍲浯Ɒ椠瑮㈳传桴牥潂祤湉敤ⱸ戠潯⁬䙢潲卭敷灥‬潣獮⁴䡆瑩敒畳瑬☠匠敷灥敒畳瑬਩੻⼉振敨正椠⁦捡潴⁲湥整楲杮琠牡敧⁴慲杮⁥獩愠戠楯⁤湡⁤慶楬੤䄉潂摩‪湅整楲杮潂摩㴠䌠獡㱴䉁楯㹤伨桴牥捁潴⥲਻椉⁦䔨瑮牥湩䉧楯⥤ऊ੻उ潂摩䥳剮湡敧䄮摤䔨瑮牥湩䉧楯⥤਻紉紊ਊ潶摩䄠慔杲瑥扏敪瑣㨺湏慔杲瑥癏牥慬䕰摮唨牐浩瑩癩䍥浯潰敮瑮‪癏牥慬灰摥潃灭湯湥ⱴ䄠捁潴⩲传桴牥捁潴Ⱳ唠牐浩瑩癩䍥浯潰敮瑮‪瑏敨䍲浯Ɒ椠瑮㈳传桴牥潂祤湉敤⥸笊ऊ⼯档捥⁫晩愠瑣牯攠楸楴杮琠牡敧⁴慲杮⁥獩愠戠楯⁤湡⁤慶楬੤䄉潂摩‪硅瑩湩䉧楯⁤‽慃瑳䄼潂摩⠾瑏敨䅲瑣牯㬩ऊ晩⠠硅瑩湩䉧楯⥤ऊ੻उ潂摩䥳剮湡敧刮浥癯⡥硅瑩湩䉧楯⥤਻紉紊ਊ潶摩䄠慔杲瑥扏敪瑣㨺灁汰呹牡敧䙴牯散⡳਩੻䘉敖瑣牯吠牡敧䙴牯散㴠䘠敖瑣牯㨺敚潲敖瑣牯਻ऊ晩⠠䡢獡慒杮⥥ऊ੻उ⼯敧⁴楬瑳漠⁦癯牥慬灰湩⁧潢摩ੳउ潦⁲䄨潂摩‪潂摩㨠䈠楯獤湉慒杮⥥ऊ笉ऊउ⼯敧⁴湵捳污摥映牯散ऊउ慔杲瑥潆捲⁥‽桴獩㸭敇䅴瑣牯潌慣楴湯⤨ⴠ䈠楯ⵤ䜾瑥捁潴䱲捯瑡潩⡮㬩ऊउ慔杲瑥潆捲⁥‽慔杲瑥潆捲⹥敇却晡乥牯慭⡬㬩ऊउ慔杲瑥潆捲⁥㴪吠牡敧䙴牯散瑓敲杮桴਻उ吉牡敧䙴牯散ⴠ‽潂摩㸭敇䉴楯噤汥捯瑩⡹㬩ਊउ⼉愯摤映牯散琠⁯潢摩琠牡敧⁴潦捲⁥瑳捡੫उ䈉楯ⵤ䄾摤慔杲瑥潆捲⡥慔杲瑥潆捲⥥਻उ⼉启䑏㩏愠摤搠獩慴据⁥慦瑣牯ऊउ晩⠠偢潲楸業祴捓污摥਩उ笉ऊउ椉⁦戨湉敶瑲牐硯浩瑩卹慣楬杮਩उउ੻ऊउ紉ऊउ੽उ੽紉ऊ汥敳ऊ੻उ⼯敧⁴䱁⁌潢摩ੳऊ⼉启䑏㩏挠污畣慬整甠獮慣敬⁤潦捲੥उ⼯佔佄›摡⁤楤瑳湡散映捡潴ੲ紉紊
\ No newline at end of file
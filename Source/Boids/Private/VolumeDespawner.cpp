@@ -1,50 +1 @@
-// Copyright ©2020 Samuel Harrison
-
-//includes
-#include "VolumeDespawner.h"
-#include "Components/BoxComponent.h"
-#include "Components/StaticMeshComponent.h"
-#include "Boid.h"
-#include "FlockManager.h"
-
-AVolumeDespawner::AVolumeDespawner()
-{
-	//disable ticking
-	PrimaryActorTick.bCanEverTick = false;
-
-	//setup box component
-	VolumeDespawnerCollision = CreateDefaultSubobject<UBoxComponent>(TEXT("Volume Despawner Collision Component"));
-	RootComponent = VolumeDespawnerCollision;
-	VolumeDespawnerCollision->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-	VolumeDespawnerCollision->SetCollisionResponseToAllChannels(ECR_Ignore);
-	VolumeDespawnerCollision->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
-
-	//setup static mesh component
-	VolumeDespawnerMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Volume Despawner Mesh Component"));
-	VolumeDespawnerMesh->SetupAttachment(RootComponent);
-	VolumeDespawnerMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-	VolumeDespawnerMesh->SetCollisionResponseToAllChannels(ECR_Ignore);
-}
-
-void AVolumeDespawner::BeginPlay()
-{
-	Super::BeginPlay();
-
-	//bind collision component overlap event to delegate that gets called to perform despawn logic
-	if (VolumeDespawnerCollision)
-	{
-		VolumeDespawnerCollision->OnComponentBeginOverlap.AddDynamic(this, &AVolumeDespawner::OnOutletOverlapBegin);
-	}
-}
-
-void AVolumeDespawner::OnOutletOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult & SweepResult)
-{
-	//check if entering actor is a boid and valid
-	ABoid* EnteringBoid = Cast<ABoid>(OtherActor);
-	if (EnteringBoid)
-	{
-		//remove boid from flock and destroy it
-		EnteringBoid->GetFlockManager()->RemoveBoidFromFlock(EnteringBoid);
-		EnteringBoid->Destroy();
-	}
-}
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠潖畬敭敄灳睡敮⹲≨⌊湩汣摵⁥䌢浯潰敮瑮⽳潂䍸浯潰敮瑮栮ਢ椣据畬敤∠潃灭湯湥獴匯慴楴䵣獥䍨浯潰敮瑮栮ਢ椣据畬敤∠潂摩栮ਢ椣据畬敤∠汆捯䵫湡条牥栮ਢ䄊潖畬敭敄灳睡敮㩲䄺潖畬敭敄灳睡敮⡲਩੻⼉搯獩扡敬琠捩楫杮ऊ牐浩牡䅹瑣牯楔正戮慃䕮敶呲捩⁫‽慦獬㭥ਊ⼉猯瑥灵戠硯挠浯潰敮瑮ऊ潖畬敭敄灳睡敮䍲汯楬楳湯㴠䌠敲瑡䑥晥畡瑬畓潢橢捥㱴䉕硯潃灭湯湥㹴吨塅⡔嘢汯浵⁥敄灳睡敮⁲潃汬獩潩⁮潃灭湯湥≴⤩਻刉潯䍴浯潰敮瑮㴠嘠汯浵䑥獥慰湷牥潃汬獩潩㭮ऊ潖畬敭敄灳睡敮䍲汯楬楳湯㸭敓䍴汯楬楳湯湅扡敬⡤䍅汯楬楳湯湅扡敬㩤儺敵祲湏祬㬩ऊ潖畬敭敄灳睡敮䍲汯楬楳湯㸭敓䍴汯楬楳湯敒灳湯敳潔汁䍬慨湮汥⡳䍅归杉潮敲㬩ऊ潖畬敭敄灳睡敮䍲汯楬楳湯㸭敓䍴汯楬楳湯敒灳湯敳潔桃湡敮⡬䍅彃慐湷‬䍅归癏牥慬⥰਻ऊ⼯敳畴⁰瑳瑡捩洠獥⁨潣灭湯湥ੴ嘉汯浵䑥獥慰湷牥敍桳㴠䌠敲瑡䑥晥畡瑬畓潢橢捥㱴单慴楴䵣獥䍨浯潰敮瑮⠾䕔员∨潖畬敭䐠獥慰湷牥䴠獥⁨潃灭湯湥≴⤩਻嘉汯浵䑥獥慰湷牥敍桳㸭敓畴䅰瑴捡浨湥⡴潒瑯潃灭湯湥⥴਻嘉汯浵䑥獥慰湷牥敍桳㸭敓䍴汯楬楳湯湅扡敬⡤䍅汯楬楳湯湅扡敬㩤为䍯汯楬楳湯㬩ऊ潖畬敭敄灳睡敮䵲獥⵨匾瑥潃汬獩潩剮獥潰獮呥䅯汬桃湡敮獬䔨剃䥟湧牯⥥਻੽瘊楯⁤噁汯浵䑥獥慰湷牥㨺敂楧偮慬⡹਩੻匉灵牥㨺敂楧偮慬⡹㬩ਊ⼉戯湩⁤潣汬獩潩⁮潣灭湯湥⁴癯牥慬⁰癥湥⁴潴搠汥来瑡⁥桴瑡朠瑥⁳慣汬摥琠⁯数晲牯⁭敤灳睡⁮潬楧੣椉⁦嘨汯浵䑥獥慰湷牥潃汬獩潩⥮ऊ੻उ潖畬敭敄灳睡敮䍲汯楬楳湯㸭湏潃灭湯湥䉴来湩癏牥慬⹰摁䑤湹浡捩琨楨ⱳ☠噁汯浵䑥獥慰湷牥㨺湏畏汴瑥癏牥慬䉰来湩㬩ऊ੽੽瘊楯⁤噁汯浵䑥獥慰湷牥㨺湏畏汴瑥癏牥慬䉰来湩唨牐浩瑩癩䍥浯潰敮瑮‪癏牥慬灰摥潃灭湯湥ⱴ䄠捁潴⩲传桴牥捁潴Ⱳ唠牐浩瑩癩䍥浯潰敮瑮‪瑏敨䍲浯Ɒ椠瑮㈳传桴牥潂祤湉敤ⱸ戠潯⁬䙢潲卭敷灥‬潣獮⁴䡆瑩敒畳瑬☠匠敷灥敒畳瑬਩੻⼉振敨正椠⁦湥整楲杮愠瑣牯椠⁳⁡潢摩愠摮瘠污摩ऊ䉁楯⩤䔠瑮牥湩䉧楯⁤‽慃瑳䄼潂摩⠾瑏敨䅲瑣牯㬩ऊ晩⠠湅整楲杮潂摩਩笉ऊ⼉爯浥癯⁥潢摩映潲⁭汦捯⁫湡⁤敤瑳潲⁹瑩ऊ䔉瑮牥湩䉧楯ⵤ䜾瑥汆捯䵫湡条牥⤨㸭敒潭敶潂摩牆浯汆捯⡫湅整楲杮潂摩㬩ऊ䔉瑮牥湩䉧楯ⵤ䐾獥牴祯⤨਻紉紊
\ No newline at end of file
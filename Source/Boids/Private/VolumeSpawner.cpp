@@ -1,98 +1 @@
-// Copyright ©2020 Samuel Harrison
-
-//includes
-#include "VolumeSpawner.h"
-#include "Components/BoxComponent.h"
-#include "Components/ArrowComponent.h"
-#include "Components/StaticMeshComponent.h"
-#include "Boid.h"
-#include "FlockManager.h"
-
-AVolumeSpawner::AVolumeSpawner()
-{
-	//disable ticking
-	PrimaryActorTick.bCanEverTick = false;
-
-	//setup box component
-	VolumeSpawnerCollision = CreateDefaultSubobject<UBoxComponent>(TEXT("Volume Spawner Collision Component"));
-	RootComponent = VolumeSpawnerCollision;
-	VolumeSpawnerCollision->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-	VolumeSpawnerCollision->SetCollisionResponseToAllChannels(ECR_Ignore);
-
-	//setup arrow component
-	VolumeSpawnerFlowArrow = CreateDefaultSubobject<UArrowComponent>(TEXT("Volume Spawner Flow Arrow Component"));
-	VolumeSpawnerFlowArrow->SetupAttachment(RootComponent);
-
-	//setup mesh component
-	VolumeSpawnerMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Volume Spawner Mesh Component"));
-	VolumeSpawnerMesh->SetupAttachment(RootComponent);
-	VolumeSpawnerMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-	VolumeSpawnerMesh->SetCollisionResponseToAllChannels(ECR_Ignore);
-
-	//set default number of boids to spawn and interval
-	NumBoidsToSpawn = 0;
-	SpawnInterval = 1.0f;
-
-	//set type of spawner
-	SpawnType = Burst;
-}
-
-void AVolumeSpawner::BeginPlay()
-{
-	Super::BeginPlay();
-
-	//Bind spawn timer delegate
-	SpawnTimerDelegate.BindUFunction(this, FName("SpawnBoids"), NumBoidsToSpawn);
-
-	//spawn initial boid flock
-	SpawnBoids(NumBoidsToSpawn);
-}
-
-void AVolumeSpawner::SpawnBoids(int32 NumBoids)
-{
-	//check for assigned flock manager
-	if (AssignedFlockManager == nullptr)
-	{
-		//log warning to console
-		UE_LOG(LogTemp, Warning, TEXT("No FlockManager found for Boid spawner: %s."), *GetName());
-		return;
-	}
-
-	//check BoidType is set in BP
-	if (BoidType == nullptr)
-	{
-		//log warning to console
-		UE_LOG(LogTemp, Warning, TEXT("BoidType not set for Spawner: %s"), *GetName());
-		return;
-	}
-
-	//spawn boids
-	FVector SpawnLocation = FVector::ZeroVector;
-	FRotator SpawnRotation = VolumeSpawnerFlowArrow->GetComponentRotation();
-	FActorSpawnParameters BoidSpawnParams;
-	BoidSpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-	BoidSpawnParams.Owner = AssignedFlockManager;
-
-	for (int32 i = 0; i < NumBoids; ++i)
-	{
-		//spawn boids within volume
-		SpawnLocation.X = FMath::FRandRange(-VolumeSpawnerCollision->GetScaledBoxExtent().X, VolumeSpawnerCollision->GetScaledBoxExtent().X);
-		SpawnLocation.Y = FMath::FRandRange(-VolumeSpawnerCollision->GetScaledBoxExtent().Y, VolumeSpawnerCollision->GetScaledBoxExtent().Y);
-		SpawnLocation.Z = FMath::FRandRange(-VolumeSpawnerCollision->GetScaledBoxExtent().Z, VolumeSpawnerCollision->GetScaledBoxExtent().Z);
-		SpawnLocation += this->GetActorLocation();
-		AssignedFlockManager->AddBoidToFlock(GetWorld()->SpawnActor<ABoid>(BoidType, SpawnLocation, SpawnRotation, BoidSpawnParams));
-	}
-
-	switch (SpawnType)
-	{
-	case Burst:
-		//do nothing, 1 spawn and done
-		break;
-	case Flow:
-		//set timer for continuous spawning over time
-		GetWorldTimerManager().SetTimer(SpawnTimerHandle, SpawnTimerDelegate, SpawnInterval, false);
-		break;
-	default:
-		break;
-	}
-}
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊椯据畬敤ੳ椣据畬敤∠潖畬敭灓睡敮⹲≨⌊湩汣摵⁥䌢浯潰敮瑮⽳潂䍸浯潰敮瑮栮ਢ椣据畬敤∠潃灭湯湥獴䄯牲睯潃灭湯湥⹴≨⌊湩汣摵⁥䌢浯潰敮瑮⽳瑓瑡捩敍桳潃灭湯湥⹴≨⌊湩汣摵⁥䈢楯⹤≨⌊湩汣摵⁥䘢潬正慍慮敧⹲≨ਊ噁汯浵卥慰湷牥㨺噁汯浵卥慰湷牥⤨笊ऊ⼯楴正湩⁧獩漠汮⁹湥扡敬⁤潦⁲汦睯猠慰湷湩੧倉楲慭祲捁潴呲捩⹫䍢湡癅牥楔正㴠琠畲㭥ऊ牐浩牡䅹瑣牯楔正戮瑓牡坴瑩周捩䕫慮汢摥㴠映污敳਻ऊ⼯敳畴⁰潢⁸潣灭湯湥ੴ嘉汯浵卥慰湷牥潃汬獩潩⁮‽牃慥整敄慦汵却扵扯敪瑣唼潂䍸浯潰敮瑮⠾䕔员∨潖畬敭匠慰湷牥䌠汯楬楳湯䌠浯潰敮瑮⤢㬩ऊ潒瑯潃灭湯湥⁴‽潖畬敭灓睡敮䍲汯楬楳湯਻嘉汯浵卥慰湷牥潃汬獩潩⵮匾瑥潃汬獩潩䕮慮汢摥䔨潃汬獩潩䕮慮汢摥㨺潎潃汬獩潩⥮਻嘉汯浵卥慰湷牥潃汬獩潩⵮匾瑥潃汬獩潩剮獥潰獮呥䅯汬桃湡敮獬䔨剃䥟湧牯⥥਻ऊ⼯敳畴⁰牡潲⁷潣灭湯湥ੴ嘉汯浵卥慰湷牥汆睯牁潲⁷‽牃慥整敄慦汵却扵扯敪瑣唼牁潲䍷浯潰敮瑮⠾䕔员∨潖畬敭匠慰湷牥䘠潬⁷牁潲⁷潃灭湯湥≴⤩਻嘉汯浵卥慰湷牥汆睯牁潲⵷匾瑥灵瑁慴档敭瑮刨潯䍴浯潰敮瑮㬩ਊ⼉猯瑥灵洠獥⁨潣灭湯湥ੴ嘉汯浵卥慰湷牥敍桳㴠䌠敲瑡䑥晥畡瑬畓潢橢捥㱴单慴楴䵣獥䍨浯潰敮瑮⠾䕔员∨潖畬敭匠慰湷牥䴠獥⁨潃灭湯湥≴⤩਻嘉汯浵卥慰湷牥敍桳㸭敓畴䅰瑴捡浨湥⡴潒瑯潃灭湯湥⥴਻嘉汯浵卥慰湷牥敍桳㸭敓䍴汯楬楳湯湅扡敬⡤䍅汯楬楳湯湅扡敬㩤为䍯汯楬楳湯㬩ऊ潖畬敭灓睡敮䵲獥⵨匾瑥潃汬獩潩剮獥潰獮呥䅯汬桃湡敮獬䔨剃䥟湧牯⥥਻ऊ⼯敳⁴敤慦汵⁴畮扭牥漠⁦潢摩⁳潴猠慰湷愠摮椠瑮牥慶੬三浵潂摩味卯慰湷㴠〠਻匉慰湷湉整癲污㴠ㄠ〮㭦ऊ汆睯捁畣畭慬潴⁲‽⸰昰਻ऊ⼯敳⁴祴数漠⁦灳睡敮ੲ匉慰湷祔数㴠䈠牵瑳਻੽瘊楯⁤噁汯浵卥慰湷牥㨺敂楧偮慬⡹਩੻匉灵牥㨺敂楧偮慬⡹㬩ਊ⼉猯慰湷椠楮楴污戠楯⁤汦捯⁫昨潬正洠湡条牥爠獥潴敲⁳瑩⁳汦捯⁫牦浯愠猠慮獰潨⁴湩瑳慥⁤桷湥眠牡⁭瑳牡整⥤ऊ晩⠠獁楳湧摥汆捯䵫湡条牥㴠‽畮汬瑰⁲籼℠獁楳湧摥汆捯䵫湡条牥㸭獉慗浲瑓牡整⡤⤩ऊ੻उ灓睡䉮楯獤丨浵潂摩味卯慰湷㬩ऊ੽ऊ⼯汦睯猠慰湷牥⁳敫灥攠業瑴湩⁧潢摩⁳癥牥⁹牦浡੥匉瑥捁潴呲捩䕫慮汢摥匨慰湷祔数㴠‽汆睯㬩紊ਊ潶摩䄠潖畬敭灓睡敮㩲吺捩⡫汦慯⁴敄瑬呡浩⥥笊ऊ畓数㩲吺捩⡫敄瑬呡浩⥥਻ऊ睳瑩档⠠灓睡呮灹⥥ऊ੻按獡⁥汆睯਺उ⼯浥瑩戠楯獤愠⁴⁡潣瑮湩潵獵爠瑡⁥景丠浵潂摩味卯慰湷瀠牥匠慰湷湉整癲污ऊ䘉潬䅷捣浵汵瑡牯⬠‽畎䉭楯獤潔灓睡⁮‪敄瑬呡浩⁥ 䵆瑡㩨䴺硡匨慰湷湉整癲污‬⸰㄰⥦਻उ晩⠠汆睯捁畣畭慬潴⁲㴾ㄠ〮⥦ऊ笉ऊउ湩㍴′畎䉭楯獤㴠䘠慍桴㨺汆潯呲䥯瑮䘨潬䅷捣浵汵瑡牯㬩ऊउ汆睯捁畣畭慬潴⁲㴭丠浵潂摩㭳ऊउ灓睡䉮楯獤丨浵潂摩⥳਻उ੽उ牢慥㭫ऊ敤慦汵㩴ऊ戉敲歡਻紉紊ਊ潶摩䄠潖畬敭灓睡敮㩲区慰湷潂摩⡳湩㍴′畎䉭楯獤਩੻⼉振敨正映牯愠獳杩敮⁤汦捯⁫慭慮敧ੲ椉⁦䄨獳杩敮䙤潬正慍慮敧⁲㴽渠汵灬牴਩笉ऊ⼉氯杯眠牡楮杮琠⁯潣獮汯੥उ䕕䱟䝏䰨杯敔灭‬慗湲湩Ⱨ吠塅⡔丢⁯汆捯䵫湡条牥映畯摮映牯䈠楯⁤灳睡敮㩲┠⹳⤢‬䜪瑥慎敭⤨㬩ऊ爉瑥牵㭮ऊ੽ऊ⼯档捥⁫潂摩祔数椠⁳敳⁴湩䈠੐椉⁦䈨楯呤灹⁥㴽渠汵灬牴਩笉ऊ⼉氯杯眠牡楮杮琠⁯潣獮汯੥उ䕕䱟䝏䰨杯敔灭‬慗湲湩Ⱨ吠塅⡔䈢楯呤灹⁥潮⁴敳⁴潦⁲灓睡敮㩲┠≳Ⱙ⨠敇乴浡⡥⤩਻उ敲畴湲਻紉ਊ⼉焯敵敵戠楯獤琠⁯敢猠慰湷摥戠⁹汦捯⁫慭慮敧ੲ䘉敖瑣牯匠慰湷潌慣楴湯㴠䘠敖瑣牯㨺敚潲敖瑣牯਻䘉潒慴潴⁲灓睡剮瑯瑡潩⁮‽潖畬敭灓睡敮䙲潬䅷牲睯㸭敇䍴浯潰敮瑮潒慴楴湯⤨਻ऊ潦⁲椨瑮㈳椠㴠〠※⁩‼畎䉭楯獤※⬫⥩ऊ੻उ⼯灳睡⁮潢摩⁳楷桴湩瘠汯浵੥उ灓睡䱮捯瑡潩⹮⁘‽䵆瑡㩨䘺慒摮慒杮⡥嘭汯浵卥慰湷牥潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩ⱘ嘠汯浵卥慰湷牥潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩⥘਻उ灓睡䱮捯瑡潩⹮⁙‽䵆瑡㩨䘺慒摮慒杮⡥嘭汯浵卥慰湷牥潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩ⱙ嘠汯浵卥慰湷牥潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩⥙਻उ灓睡䱮捯瑡潩⹮⁚‽䵆瑡㩨䘺慒摮慒杮⡥嘭汯浵卥慰湷牥潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩ⱚ嘠汯浵卥慰湷牥潃汬獩潩⵮䜾瑥捓污摥潂䕸瑸湥⡴⸩⥚਻उ灓睡䱮捯瑡潩⁮㴫琠楨⵳䜾瑥捁潴䱲捯瑡潩⡮㬩ऊ䄉獳杩敮䙤潬正慍慮敧⵲儾敵敵潂摩灓睡⡮潂摩祔数‬呆慲獮潦浲匨慰湷潒慴楴湯‬灓睡䱮捯瑡潩⥮㬩ऊ੽੽
\ No newline at end of file
@@ -1,136 +1 @@
-// Copyright ©2020 Samuel Harrison
-
-//README:~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-//An autonomous actor that can be spawned into the level and exhibit a bird-like, flocking motion with other Boid actors.
-//
-//The Boid mechanics are broken into 3 levels; Action, Steering, Locomotion.
-//Action is the goal for the Boid, this implementation uses "flocking" but it could also be objectives like "flee", "hunt", "wander", etc.
-//Steering layer determines the path the Boid will take. This implementation uses perception to apply flocking forces to the Boid, but it could be boiled down to something as easy as "turn left" (i.e. a rider telling a horse to move left or giddy-up).
-//Locomotion layer takes the inputs from steering and applies the physical attributes of the Boid to implement the desired movement. The Boid uses its engines, brakes, wings, legs, wheels, rudder, etc. to physically attempt to follow the path indicated by the steering inputs.
-
-//boid behavior based off research done by Craig Reynolds
-//https://www.red3d.com/cwr/boids/
-//steering behaviors for autonomous characters paper
-//https://www.red3d.com/cwr/steer/gdc99/
-
-//this project also was inspirationally fueled from a YouTube talk by Daniel Shiffman
-//Coding Challenge #124: Flocking Simulation
-//https://youtu.be/mhjuuHl6qHM
-//p5js code source and interactive example
-//https://github.com/CodingTrain/website/blob/master/CodingChallenges/CC_124_Flocking_Boids/P5/boid.js
-//https://processing.org/examples/flocking.html
-
-//collision avoidance system inspired by YouTube demo of Sebastian Lague
-//Coding Adventure: Boids
-//https://youtu.be/bqtqltqcQhw
-//source (C# in Unity)
-//https://github.com/SebLague/Boids
-
-//spherical raycast avoidance design from Stackoverflow discussion
-//https://stackoverflow.com/questions/9600801/evenly-distributing-n-points-on-a-sphere/44164075#44164075
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-
-
-#pragma once
-
-//includes
-#include "CoreMinimal.h"
-#include "GameFramework/Actor.h"
-#include "Boid.generated.h"
-
-//forward declares
-class UStaticMeshComponent;
-class USphereComponent;
-class AFlockManager;
-
-UCLASS()
-class BOIDS_API ABoid : public AActor
-{
-	GENERATED_BODY()
-
-public:
-	//default constructor
-	ABoid();
-
-	//called to update each frame
-	virtual void Tick(float DeltaTime) override;
-
-protected:
-	//called on level start or when spawned
-	virtual void BeginPlay() override;
-
-	//COMPONENTS
-protected:
-	//boid collision component
-	UPROPERTY(VisibleAnywhere, Category = "Boid|Components")
-	USphereComponent* BoidCollision;
-
-	//boid static mesh component for visuals
-	UPROPERTY(VisibleAnywhere, Category = "Boid|Components")
-	UStaticMeshComponent* BoidMesh;
-
-	//collision sensor used to generate cohesion steering forces
-	UPROPERTY(VisibleAnywhere, Category = "Boid|Components")
-	USphereComponent* PerceptionSensor;
-
-	//FLOCK MANAGER
-protected:
-	//flock manager that controls this boid's perception and steering behaviors
-	AFlockManager* FlockManager;
-
-public:
-	inline AFlockManager* GetFlockManager() { return FlockManager; }
-
-	//TODO: create "FindFlockManager" helper function to look for a flock manager for cases where they don't get properly assigned (i.e. a manually placed boid in editor).
-
-	//MOVEMENT
-protected:
-	//boid velocity
-	FVector BoidVelocity;
-
-	//boid mesh rotation used for smoothly interpolating mesh rotations
-	FRotator CurrentRotation;
-
-	//smoothly updates the boid mesh's rotation to follow the velocity
-	void UpdateMeshRotation();
-
-	//TODO: add physical parameters to boid motion, mass, turning radius, max acceleration/braking force, gravity, etc.
-
-public:
-	UFUNCTION(BlueprintCallable)
-	inline FVector GetBoidVelocity() { return BoidVelocity; };
-
-	//STEERING
-protected:
-	//return separation steering force directed to avoid crowding/collision with local flockmates
-	FVector	Separate(TArray<AActor*> Flock);
-	//return alignment steering force directed towards the average heading of local flockmates
-	FVector Align(TArray<AActor*> Flock);
-	//return cohesion steering force directed toward the average position of local flockmates
-	FVector GroupUp(TArray<AActor*> Flock);
-	//apply behavioral steering to boid and update movement
-	void Steer(float DeltaTime);
-
-	//AVOIDANCE
-protected:
-	//checks if boid is on imminent collision course with obstacle
-	bool IsObstacleAhead();
-	//return obstacle avoidance force steering towards the unobstructed direction
-	FVector AvoidObstacle();
-
-	//TARGET STEERING
-protected:
-	//list of target forces
-	TArray<FVector> TargetForces;
-
-public:
-	//adds target force to stack to be applied
-	void AddTargetForce(FVector TargetForce);
-
-	//DEBUG
-	//TODO: add debug mode for showing boid collision, perception radius, velocity, sensors, etc.
-
-	//ACTION
-	//TODO: create goal setting logic (simple state machine) that allows boid to have different selectable settings (i.e. flock, wander, hunt, flee, etc.)
-	//^can add avoidance hierarchy to this so that when a boid is going to hit an obstacle it becomes the priority of steering
-};
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⼯湁愠瑵湯浯畯⁳捡潴⁲桴瑡挠湡戠⁥灳睡敮⁤湩潴琠敨氠癥汥愠摮攠桸扩瑩愠戠物ⵤ楬敫‬汦捯楫杮洠瑯潩⁮楷桴漠桴牥䈠楯⁤捡潴獲ਮ⼯⼊启敨䈠楯⁤敭档湡捩⁳牡⁥牢歯湥椠瑮⁯″敬敶獬※捁楴湯‬瑓敥楲杮‬潌潣潭楴湯ਮ⼯捁楴湯椠⁳桴⁥潧污映牯琠敨䈠楯Ɽ琠楨⁳浩汰浥湥慴楴湯甠敳⁳昢潬正湩≧戠瑵椠⁴潣汵⁤污潳戠⁥扯敪瑣癩獥氠歩⁥昢敬≥‬栢湵≴‬眢湡敤≲‬瑥⹣⼊匯整牥湩⁧慬敹⁲敤整浲湩獥琠敨瀠瑡⁨桴⁥潂摩眠汩⁬慴敫‮桔獩椠灭敬敭瑮瑡潩⁮獵獥瀠牥散瑰潩⁮潴愠灰祬映潬正湩⁧潦捲獥琠⁯桴⁥潂摩‬畢⁴瑩挠畯摬戠⁥潢汩摥搠睯⁮潴猠浯瑥楨杮愠⁳慥祳愠⁳琢牵⁮敬瑦•椨攮‮⁡楲敤⁲整汬湩⁧⁡潨獲⁥潴洠癯⁥敬瑦漠⁲楧摤⵹灵⸩⼊䰯捯浯瑯潩⁮慬敹⁲慴敫⁳桴⁥湩異獴映潲⁭瑳敥楲杮愠摮愠灰楬獥琠敨瀠票楳慣⁬瑡牴扩瑵獥漠⁦桴⁥潂摩琠⁯浩汰浥湥⁴桴⁥敤楳敲⁤潭敶敭瑮‮桔⁥潂摩甠敳⁳瑩⁳湥楧敮ⱳ戠慲敫ⱳ眠湩獧‬敬獧‬桷敥獬‬畲摤牥‬瑥⹣琠⁯桰獹捩污祬愠瑴浥瑰琠⁯潦汬睯琠敨瀠瑡⁨湩楤慣整⁤祢琠敨猠整牥湩⁧湩異獴ਮ⼊戯楯⁤敢慨楶牯戠獡摥漠晦爠獥慥捲⁨潤敮戠⁹牃楡⁧敒湹汯獤⼊栯瑴獰⼺眯睷爮摥搳挮浯振牷戯楯獤ਯ⼯瑳敥楲杮戠桥癡潩獲映牯愠瑵湯浯畯⁳档牡捡整獲瀠灡牥⼊栯瑴獰⼺眯睷爮摥搳挮浯振牷猯整牥术捤㤹ਯ⼊琯楨⁳牰橯捥⁴污潳眠獡椠獮楰慲楴湯污祬映敵敬⁤牦浯愠夠畯畔敢琠污⁫祢䐠湡敩⁬桓晩浦湡⼊䌯摯湩⁧桃污敬杮⁥ㄣ㐲›汆捯楫杮匠浩汵瑡潩੮⼯瑨灴㩳⼯潹瑵⹵敢洯橨畵汈然䵈⼊瀯樵⁳潣敤猠畯捲⁥湡⁤湩整慲瑣癩⁥硥浡汰੥⼯瑨灴㩳⼯楧桴扵挮浯䌯摯湩呧慲湩眯扥楳整戯潬⽢慭瑳牥䌯摯湩䍧慨汬湥敧⽳䍃ㅟ㐲䙟潬正湩彧潂摩⽳㕐戯楯⹤獪⼊栯瑴獰⼺瀯潲散獳湩⹧牯⽧硥浡汰獥是潬正湩⹧瑨汭ਊ⼯潣汬獩潩⁮癡楯慤据⁥祳瑳浥椠獮楰敲⁤祢夠畯畔敢搠浥⁯景匠扥獡楴湡䰠条敵⼊䌯摯湩⁧摁敶瑮牵㩥䈠楯獤⼊栯瑴獰⼺礯畯畴戮⽥煢煴瑬捱桑੷⼯潳牵散⠠⍃椠⁮湕瑩⥹⼊栯瑴獰⼺术瑩畨⹢潣⽭敓䱢条敵䈯楯獤ਊ⼯灳敨楲慣⁬慲捹獡⁴癡楯慤据⁥敤楳湧映潲⁭瑓捡潫敶晲潬⁷楤捳獵楳湯⼊栯瑴獰⼺猯慴正癯牥汦睯挮浯焯敵瑳潩獮㤯〶㠰㄰支敶汮⵹楤瑳楲畢楴杮渭瀭楯瑮⵳湯愭猭桰牥⽥㐴㘱〴㔷㐣ㄴ㐶㜰ਵ⼯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾ਊ瀣慲浧⁡湯散ਊ⼯湩汣摵獥⌊湩汣摵⁥䌢牯䵥湩浩污栮ਢ椣据畬敤∠慇敭牆浡睥牯⽫捁潴⹲≨⌊湩汣摵⁥䈢楯⹤敧敮慲整⹤≨ਊ⼯潦睲牡⁤敤汣牡獥挊慬獳唠瑓瑡捩敍桳潃灭湯湥㭴挊慬獳唠灓敨敲潃灭湯湥㭴挊慬獳䄠汆捯䵫湡条牥਻唊䱃十⡓਩汣獡⁳佂䑉当偁⁉䉁楯⁤›異汢捩䄠捁潴ੲ੻䜉久剅呁䑅䉟䑏⡙਩瀊扵楬㩣ऊ⼯敤慦汵⁴潣獮牴捵潴ੲ䄉潂摩⤨਻瀊潲整瑣摥਺⼉振污敬⁤湯氠癥汥猠慴瑲漠⁲桷湥猠慰湷摥ऊ楶瑲慵⁬潶摩䈠来湩汐祡⤨漠敶牲摩㭥ਊ⼉振污敬⁤桷湥戠楯⁤獩搠獥牴祯摥漠⁲敲潭敶⁤牦浯氠癥汥ऊ楶瑲慵⁬潶摩䔠摮汐祡挨湯瑳䔠湅偤慬剹慥潳㩮吺灹⁥湅偤慬剹慥潳⥮漠敶牲摩㭥ਊ⼉䌯䵏佐䕎呎੓牰瑯捥整㩤ऊ⼯潢摩挠汯楬楳湯挠浯潰敮瑮ऊ偕佒䕐呒⡙楖楳汢䅥祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤潃灭湯湥獴⤢ऊ单桰牥䍥浯潰敮瑮‪潂摩潃汬獩潩㭮ਊ⼉戯楯⁤瑳瑡捩洠獥⁨潣灭湯湥⁴潦⁲楶畳污ੳ唉剐偏剅奔嘨獩扩敬湁睹敨敲‬慃整潧祲㴠∠潂摩䍼浯潰敮瑮≳਩唉瑓瑡捩敍桳潃灭湯湥⩴䈠楯䵤獥㭨ਊ⼉振汯楬楳湯猠湥潳⁲獵摥琠⁯敧敮慲整挠桯獥潩⁮瑳敥楲杮映牯散ੳ唉剐偏剅奔嘨獩扩敬湁睹敨敲‬慃整潧祲㴠∠潂摩䍼浯潰敮瑮≳਩唉灓敨敲潃灭湯湥⩴倠牥散瑰潩卮湥潳㭲ਊ異汢捩਺⼉爯摡畩⁳桴瑡琠敨戠楯⁤数捲楥敶⁳汦捯浫瑡獥椠੮昉潬瑡䜠瑥敐捲灥楴湯慒楤獵⤨਻⼉爯摡畩⁳景戠楯❤⁳潣汬獩潩⁮灳敨敲ऊ汦慯⁴敇䍴汯楬楳湯慒楤獵⤨਻ऊ⼯档捥獫椠⁦潢摩椠⁳畣牲湥汴⁹湩楳敤漠⁦桴⁥扯瑳捡敬⠠⹩⹥渠⁯敮摥琠⁯癡楯⽤浩潰獳扩敬琠⥯ऊ潢汯䤠䥳獮摩佥獢慴汣⡥潣獮⁴䅁瑣牯‪扏瑳捡敬㬩ਊ⼉䘯佌䭃䴠乁䝁剅瀊潲整瑣摥਺⼉是潬正洠湡条牥琠慨⁴潣瑮潲獬琠楨⁳潢摩猧瀠牥散瑰潩⁮湡⁤瑳敥楲杮戠桥癡潩獲ऊ䙁潬正慍慮敧⩲䘠潬正慍慮敧㭲ਊ⼉栯湡汤⁥景戠楯❤⁳瑳瑡⁥湩琠敨映潬正洠湡条牥ऊ湩㍴′汆捯䡫湡汤㭥ਊ異汢捩਺椉汮湩⁥䙁潬正慍慮敧⩲䜠瑥汆捯䵫湡条牥⤨笠爠瑥牵⁮汆捯䵫湡条牥※੽⼉栯湡汤⁥獵摥琠⁯摡牤獥⁳桴⁥潢摩琠牨畯桧椠獴映潬正洠湡条牥⠠⹩⹥䄠摤潂摩潆捲⥥‬义䕄彘低䕎眠楨敬琠敨戠楯⁤獩❮⁴湩愠映潬正ਮ⼉愯栠湡汤⁥潧獥猠慴敬眠敨⁮桴⁥潢摩椠⁳敲潭敶⁤牦浯椠獴映潬正‬瑳污⁥慨摮敬⁳牡⁥敲敪瑣摥戠⁹桴⁥慭慮敧⁲昨牯散⁳湯琠敨⁭牡⁥牤灯数⥤‬档捥⁫楷桴䤠䉳楯䡤湡汤噥污摩ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤潆捲獥⤢ऊ湩楬敮椠瑮㈳䜠瑥汆捯䡫湡汤⡥ ⁻敲畴湲䘠潬正慈摮敬※੽椉汮湩⁥潶摩匠瑥汆捯䡫湡汤⡥湩㍴′敎䙷潬正慈摮敬 ⁻汆捯䡫湡汤⁥‽敎䙷潬正慈摮敬※੽ऊ⼯佔佄›牣慥整∠楆摮汆捯䵫湡条牥•敨灬牥映湵瑣潩⁮潴氠潯⁫潦⁲⁡汦捯⁫慭慮敧⁲潦⁲慣敳⁳桷牥⁥桴祥搠湯琧朠瑥瀠潲数汲⁹獡楳湧摥⠠⹩⹥愠洠湡慵汬⁹汰捡摥戠楯⁤湩攠楤潴⥲ਮऊ⼯位䕖䕍呎ऊ⼯潢摩瀠獯瑩潩Ɱ瘠汥捯瑩⁹湡⁤敭桳爠瑯瑡潩⁮牡⁥楳畭慬整⁤祢琠敨映潬正洠湡条牥愠摮眠楲瑴湥戠捡⁫潴琠敨戠楯⁤慥档映慲敭瀊扵楬㩣ऊ⼯灵慤整⁳桴⁥潢摩洠獥❨⁳潲慴楴湯琠⁯桴⁥汦捯⁫慭慮敧❲⁳浳潯桴摥爠瑯瑡潩੮瘉楯⁤灕慤整敍桳潒慴楴湯挨湯瑳䘠潒慴潴♲䴠獥剨瑯瑡潩⥮਻⼉眯楲整⁳楷杮戠慥ⱴ映慬⁰晥潦瑲愠摮戠湡⁫湡汧⁥潴琠敨戠楯⁤敭桳猧挠獵潴⁭牰浩瑩癩⁥慤慴映潲⁭慄慴湉敤ⱸ瀠慬敹⁤祢椠獴洠瑡牥慩⹬ऊ⼯桴⁥慭整楲污愠癤湡散⁳桴⁥楷杮戠慥⁴瑩敳晬⠠桰獡⁥‽牦捡搨瑡⁡桰獡⁥‫汦灡爠瑡⁥‪楔敭⤩‬潳搠瑡⁡獩漠汮⁹敲牷瑩整⁮湯散琠敨洠瑡牥慩❬⁳桰獡ⱥऊ⼯桴⁥汦灡攠晦牯⁴牯琠敨戠湡⁫湡汧⁥獩洠牯⁥桴湡吠汯牥湡散漠晦⠠慥档眠楲整洠牡獫琠敨洠獥❨⁳敲摮牥猠慴整搠物祴Ⱙ爠瑥牵獮琠畲⁥晩眠楲瑴湥ऊ潢汯唠摰瑡䙥楬桧䅴楮慭楴湯椨瑮㈳䐠瑡䥡摮硥‬汦慯⁴汆灡桐獡ⱥ映潬瑡䘠慬剰瑡ⱥ映潬瑡䘠慬䕰晦牯ⱴ映潬瑡䈠湡䅫杮敬‬汦慯⁴楔敭‬汦慯⁴潔敬慲据⥥਻⼉振敨正⁳晩戠楯⁤敭桳眠獡爠湥敤敲⁤湯猠牣敥⁮楷桴湩琠汯牥湡散猠捥湯獤⠠景ⵦ捳敲湥愠摮漠捣畬敤⁤敭桳獥愠敲❮⥴ऊ潢汯圠獡敍桳敒散瑮祬敒摮牥摥昨潬瑡吠汯牥湡散㬩ਊ⼉启䑏㩏愠摤瀠票楳慣⁬慰慲敭整獲琠⁯潢摩洠瑯潩Ɱ洠獡ⱳ琠牵楮杮爠摡畩ⱳ洠硡愠捣汥牥瑡潩⽮牢歡湩⁧潦捲ⱥ朠慲楶祴‬瑥⹣ਊ唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬਩䘉敖瑣牯䜠瑥潂摩敖潬楣祴⤨਻ऊ⼯潭敶戠楯⁤湡⁤瑩⁳楳畭慬整⁤瑳瑡⁥潴渠睥氠捯瑡潩⁮椨攮‮整敬潰瑲਩瘉楯⁤敓䉴楯䱤捯瑡潩⡮潣獮⁴噆捥潴♲丠睥潌慣楴湯㬩ਊ⼉启剁䕇⁔呓䕅䥒䝎瀊扵楬㩣ऊ⼯摡獤琠牡敧⁴潦捲⁥潴琠敨映潬正洠湡条牥猧映牯散戠晵敦⁲潴戠⁥灡汰敩⁤湯琠敨戠楯❤⁳敮瑸猠浩汵瑡摥映慲敭ऊ潶摩䄠摤慔杲瑥潆捲⡥噆捥潴⁲慔杲瑥潆捲⥥਻瀊潲整瑣摥਺⼉是楬桧⁴湡浩瑡潩⁮慤慴氠獡⁴牷瑩整⁮潴琠敨洠獥⁨瀨慨敳愠⁴楴敭〠‬汦灡爠瑡ⱥ映慬⁰晥潦瑲‬慢歮愠杮敬 湡⁤瑩⁳湩敤⁸䤨䑎塅也乏⁅湵楴⁬牷瑩整⥮ऊ噆捥潴㑲䘠楬桧䑴瑡㭡ऊ湩㍴′汆杩瑨慄慴湉敤㭸ਊ⼉䐯䉅䝕ऊ⼯潢摩瀠牥散瑰潩⁮慲楤獵‬敶潬楣祴‬敳獮牯⁳湡⁤汦捯浫瑡獥愠敲搠慲湷戠⁹桴⁥汦捯⁫慭慮敧Ⱳ猠敥挠湯潳敬瘠牡慩汢⁥潂摩⹳敄畢੧ऊ⼯䍁䥔乏ऊ⼯汦捯Ⱬ眠湡敤⁲湡⁤汦敥愠敲猠汥捥整⁤数⁲汦捯⁫楷桴琠敨映潬正洠湡条牥猧䈠桥癡潩ੲ⼉启䑏㩏挠敲瑡⁥潧污猠瑥楴杮氠杯捩⠠楳灭敬猠慴整洠捡楨敮 桴瑡愠汬睯⁳⁡楳杮敬戠楯⁤潴猠楷捴⁨潧污⁳椨攮‮畨瑮‬汦敥眠敨⁮桴敲瑡湥摥‬瑥⹣਩⼉帯慣⁮摡⁤癡楯慤据⁥楨牥牡档⁹潴琠楨⁳潳琠慨⁴桷湥愠戠楯⁤獩朠楯杮琠⁯楨⁴湡漠獢慴汣⁥瑩戠捥浯獥琠敨瀠楲牯瑩⁹景猠整牥湩੧㭽
\ No newline at end of file
@@ -1,73 +1 @@
-// Copyright ©2020 Samuel Harrison
-
-//README:~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-//An actor that can be placed in the world to spawn and contain Boids in a designated area.
-//Boids that leave the cage boundary are teleported to the other side, similar to the game Asteroids.
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-
-#pragma once
-
-//includes
-#include "CoreMinimal.h"
-#include "GameFramework/Actor.h"
-#include "BoidCageSpawner.generated.h"
-
-//forward declares
-class UBoxComponent;
-class UStaticMeshComponent;
-class ABoid;
-class AFlockManager;
-
-UCLASS()
-class BOIDS_API ABoidCageSpawner : public AActor
-{
-	GENERATED_BODY()
-
-public:
-	//default constructor used to set initial properties
-	ABoidCageSpawner();
-
-protected:
-	//setup logic called when level starts or spawned
-	virtual void BeginPlay() override;
-
-	//COMPONENTS
-protected:
-	//collision component used to keep all boids within the cage boundaries
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Boid|Components")
-	UBoxComponent* CageCollision;
-
-	//static mesh component used for visuals of cage
-	//TODO: create custom SM in blender for use as base mesh and custom collision for cage wall avoidance
-	UPROPERTY(VisibleAnywhere, Category = "Boid|Components")
-	UStaticMeshComponent* CageMesh;
-
-	//CAGE OVERLAP EVENTS
-protected:
-	//OnEndOverlap event delegate
-	//checks if a boid has escaped the cage bounds and if so places them on the opposite side within the cage (similar to the game Asteroids)
-	//TODO: method assumes no rotation of the cage has been made in editor (possible to add more advance checks if more robust implementations are needed)
-	UFUNCTION()
-	void OnCageOverlapEnd(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
-
-	//TODO: add different functionality for handling exits such as (reflecting boid, deleting and new random spawn, etc.)
-
-	//BOID SPAWNING
-public:
-	//the number of boids to spawn for the initial flock in the cage
-	UPROPERTY(EditAnywhere, Category = "Boid|Spawn", meta = (ClampMin = "0", ClampMax = "500"))
-	int32 NumBoidsToSpawn;
-
-	//type of boid to spawn
-	UPROPERTY(EditAnywhere, Category = "Boid|Spawn")
-	TSubclassOf<ABoid> BoidType;
-
-	//spawn a swarm of boids in the cage
-	void SpawnBoids(int NumBoids);
-
-	//flock manager that has been assigned to spawned boids
-	UPROPERTY(EditAnywhere, Category = "Boid|Spawn")
-	AFlockManager* AssignedFlockManager;
-
-	//TODO: add ramped spawning feature, allowing boids to be spawned over duration instead of all at once to reduce processing load on single frame to multiple frames
-};
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾⼊䄯⁮捡潴⁲桴瑡挠湡戠⁥汰捡摥椠⁮桴⁥潷汲⁤潴猠慰湷愠摮挠湯慴湩䈠楯獤椠⁮⁡敤楳湧瑡摥愠敲⹡⼊䈯楯獤琠慨⁴敬癡⁥桴⁥慣敧戠畯摮牡⁹牡⁥整敬潰瑲摥琠⁯桴⁥瑯敨⁲楳敤‬楳業慬⁲潴琠敨朠浡⁥獁整潲摩⹳⼊縯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾ਊ瀣慲浧⁡湯散ਊ⼯湩汣摵獥⌊湩汣摵⁥䌢牯䵥湩浩污栮ਢ椣据畬敤∠慇敭牆浡睥牯⽫捁潴⹲≨⌊湩汣摵⁥䈢楯䍤条卥慰湷牥朮湥牥瑡摥栮ਢ⼊是牯慷摲搠捥慬敲ੳ汣獡⁳䉕硯潃灭湯湥㭴挊慬獳唠瑓瑡捩敍桳潃灭湯湥㭴挊慬獳䄠潂摩਻汣獡⁳䙁潬正慍慮敧㭲ਊ䍕䅌卓⤨挊慬獳䈠䥏卄䅟䥐䄠潂摩慃敧灓睡敮⁲›異汢捩䄠捁潴ੲ੻䜉久剅呁䑅䉟䑏⡙਩瀊扵楬㩣ऊ⼯敤慦汵⁴潣獮牴捵潴⁲獵摥琠⁯敳⁴湩瑩慩⁬牰灯牥楴獥ऊ䉁楯䍤条卥慰湷牥⤨਻瀊潲整瑣摥਺⼉猯瑥灵氠杯捩挠污敬⁤桷湥氠癥汥猠慴瑲⁳牯猠慰湷摥ऊ楶瑲慵⁬潶摩䈠来湩汐祡⤨漠敶牲摩㭥ਊ⼉䌯䵏佐䕎呎੓牰瑯捥整㩤ऊ⼯潣汬獩潩⁮潣灭湯湥⁴獵摥琠⁯敫灥愠汬戠楯獤眠瑩楨⁮桴⁥慣敧戠畯摮牡敩ੳ唉剐偏剅奔嘨獩扩敬湁睹敨敲‬求敵牰湩剴慥佤汮ⱹ䌠瑡来牯⁹‽䈢楯籤潃灭湯湥獴⤢ऊ䉕硯潃灭湯湥⩴䌠条䍥汯楬楳湯਻ऊ⼯瑳瑡捩洠獥⁨潣灭湯湥⁴獵摥映牯瘠獩慵獬漠⁦慣敧ऊ⼯佔佄›牣慥整挠獵潴⁭䵓椠⁮汢湥敤⁲潦⁲獵⁥獡戠獡⁥敭桳愠摮挠獵潴⁭潣汬獩潩⁮潦⁲慣敧眠污⁬癡楯慤据੥唉剐偏剅奔嘨獩扩敬湁睹敨敲‬慃整潧祲㴠∠潂摩䍼浯潰敮瑮≳਩唉瑓瑡捩敍桳潃灭湯湥⩴䌠条䵥獥㭨ਊ⼉䌯䝁⁅噏剅䅌⁐噅久協瀊潲整瑣摥਺⼉伯䕮摮癏牥慬⁰癥湥⁴敤敬慧整ऊ⼯档捥獫椠⁦⁡潢摩栠獡攠捳灡摥琠敨挠条⁥潢湵獤愠摮椠⁦潳瀠慬散⁳桴浥漠⁮桴⁥灯潰楳整猠摩⁥楷桴湩琠敨挠条⁥猨浩汩牡琠⁯桴⁥慧敭䄠瑳牥楯獤਩⼉启䑏㩏洠瑥潨⁤獡畳敭⁳潮爠瑯瑡潩⁮景琠敨挠条⁥慨⁳敢湥洠摡⁥湩攠楤潴⁲瀨獯楳汢⁥潴愠摤洠牯⁥摡慶据⁥档捥獫椠⁦潭敲爠扯獵⁴浩汰浥湥慴楴湯⁳牡⁥敮摥摥਩唉商䍎䥔乏⤨ऊ潶摩传䍮条佥敶汲灡湅⡤偕楲業楴敶潃灭湯湥⩴传敶汲灡数䍤浯潰敮瑮‬䅁瑣牯‪瑏敨䅲瑣牯‬偕楲業楴敶潃灭湯湥⩴传桴牥潃灭‬湩㍴′瑏敨䉲摯䥹摮硥㬩ਊ⼉启䑏㩏愠摤搠晩敦敲瑮映湵瑣潩慮楬祴映牯栠湡汤湩⁧硥瑩⁳畳档愠⁳爨晥敬瑣湩⁧潢摩‬敤敬楴杮愠摮渠睥爠湡潤⁭灳睡Ɱ攠捴⤮ਊ⼉䈯䥏⁄偓坁䥎䝎瀊扵楬㩣ऊ⼯桴⁥畮扭牥漠⁦潢摩⁳潴猠慰湷映牯琠敨椠楮楴污映潬正椠⁮桴⁥慣敧ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩卼慰湷Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽〢Ⱒ䌠慬灭慍⁸‽ㄢ〰〰⤢਩椉瑮㈳丠浵潂摩味卯慰湷਻ऊ⼯祴数漠⁦潢摩琠⁯灳睡੮唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤灓睡≮਩吉畓换慬獳晏䄼潂摩‾潂摩祔数਻ऊ⼯畱略⁥⁡睳牡⁭景戠楯獤琠⁯敢猠慰湷摥椠⁮桴⁥慣敧戠⁹桴⁥獡楳湧摥映潬正洠湡条牥ऊ潶摩匠慰湷潂摩⡳湩⁴畎䉭楯獤㬩ਊ⼉是潬正洠湡条牥琠慨⁴慨⁳敢湥愠獳杩敮⁤潴猠慰湷摥戠楯獤ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩卼慰湷⤢ऊ䙁潬正慍慮敧⩲䄠獳杩敮䙤潬正慍慮敧㭲紊਻
\ No newline at end of file
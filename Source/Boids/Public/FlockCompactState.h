@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⼯畑湡楴敺⁤潣祰漠⁦桴⁥汦捯⁫瑳瑡⁥敲摡戠⁹桴⁥瑳敥楲杮欠牥敮⁬桷湥愠䘠潬正䴠湡条牥焠慵瑮穩獥映潬正慭整⹳䤠⁴獩瀠捡敫੤⼯牦浯琠敨映汵⁬牰捥獩潩⁮瑳瑡⁥慥档映慲敭愠摮愠摤⁳潴琠敨映潬正猧洠浥牯ⱹ眠慨⁴瑩猠癡獥椠⁳敭潭祲琠慲晦捩漠⁦桴⁥敫湲汥ਮ⼯慅档戠楯⁤慴敫⁳㈱戠瑹獥›⁡㘱戭瑩瀠獯瑩潩⁮敲慬楴敶琠⁯桴⁥汦捯❫⁳潢湵獤‬湡漠瑣桡摥慲⁬敨摡湩⁧湡⁤⁡㘱戭瑩猠数摥ਬ⼯湩瑳慥⁤景琠敨㈠‴祢整⁳景映汵⁬牰捥獩潩⁮潰楳楴湯愠摮栠慥楤杮琠敨欠牥敮⁬敲摡⁳牦浯琠潷猠灥牡瑡⁥牡慲獹ਮ⼯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⌊牰条慭漠据੥⼊椯据畬敤ੳ椣据畬敤∠潃敲楍楮慭⹬≨ਊ⼯畱湡楴敺⁤瑳瑡⁥景漠敮戠楯੤瑳畲瑣䘠潃灭捡䉴楯੤੻⼉瀯獯瑩潩⁮敲慬楴敶琠⁯汦捯⁫牯杩湩椠⁮瑳灥⁳景倠獯瑩潩卮慣敬ऊ湩ㅴ‶潐楳楴湯㍛㭝ऊ⼯捯慴敨牤污攠据摯摥栠慥楤杮ऊ湩ㅴ‶效摡湩孧崲਻⼉猯数摥椠⁮瑳灥⁳景匠数摥捓污੥甉湩ㅴ‶灓敥㭤紊਻挊慬獳䈠䥏卄䅟䥐䘠汆捯䍫浯慰瑣瑓瑡੥੻異汢捩਺⼉焯慵瑮穩⁥潰楳楴湯⁳湡⁤敶潬楣楴獥漠⁦汦捯Ⱬ瀠獯瑩潩獮愠敲猠潴敲⁤敲慬楴敶琠⁯桴⁥潢湵獤漠⁦桴⁥汦捯੫瘉楯⁤慐正挨湯瑳吠牁慲㱹噆捥潴㹲…潐楳楴湯ⱳ挠湯瑳吠牁慲㱹噆捥潴㹲…敖潬楣楴獥‬汦慯⁴慍卸数摥㬩ऊ潶摩䔠灭祴⤨਻ऊ⼯敤潣灭敲獳戠楯⁤瑳瑡੥䘉剏䕃义䥌䕎䘠敖瑣牯䜠瑥潐楳楴湯椨瑮㈳䤠摮硥 潣獮ੴ笉ऊ按湯瑳䘠潃灭捡䉴楯♤䈠楯⁤‽潂摩孳湉敤嵸਻उ敲畴湲传楲楧⁮‫噆捥潴⡲潂摩倮獯瑩潩孮崰‬潂摩倮獯瑩潩孮崱‬潂摩倮獯瑩潩孮崲 ‪潐楳楴湯捓污㭥ऊ੽䘉剏䕃义䥌䕎䘠敖瑣牯䜠瑥效摡湩⡧湩㍴′湉敤⥸挠湯瑳ऊ੻उ潣獮⁴䍆浯慰瑣潂摩…潂摩㴠䈠楯獤䥛摮硥㭝ऊ昉潬瑡唠㴠䈠楯⹤效摡湩孧崰⼠㌠㜲㜶〮㭦ऊ昉潬瑡嘠㴠䈠楯⹤效摡湩孧崱⼠㌠㜲㜶〮㭦ऊ䘉敖瑣牯䠠慥楤杮唨‬ⱖㄠ〮⁦‭䵆瑡㩨䄺獢唨 ‭䵆瑡㩨䄺獢嘨⤩਻उ晩⠠效摡湩⹧⁚‼⸰昰਩उ੻उ䠉慥楤杮堮㴠⠠⸱昰ⴠ䘠慍桴㨺扁⡳⥖ ‪唨㸠‽⸰昰㼠ㄠ〮⁦›ㄭ〮⥦਻उ䠉慥楤杮央㴠⠠⸱昰ⴠ䘠慍桴㨺扁⡳⥕ ‪嘨㸠‽⸰昰㼠ㄠ〮⁦›ㄭ〮⥦਻उ੽उ敲畴湲䠠慥楤杮䜮瑥湕慳敦潎浲污⤨਻紉ऊ但䍒䥅䱎义⁅噆捥潴⁲敇噴汥捯瑩⡹湩㍴′湉敤⥸挠湯瑳ऊ੻उ敲畴湲䜠瑥效摡湩⡧湉敤⥸⨠⠠潂摩孳湉敤嵸匮数摥⨠匠数摥捓污⥥਻紉ਊ椉汮湩⁥湩㍴′畎⡭ 潣獮⁴⁻敲畴湲䈠楯獤丮浵⤨※੽⼉猯穩⁥景漠敮戠楯❤⁳潣灭捡⁴瑳瑡⁥湩戠瑹獥ऊ瑳瑡捩椠汮湩⁥湩㍴′敇䉴瑹獥敐䉲楯⡤ ⁻敲畴湲猠穩潥⡦䍆浯慰瑣潂摩㬩素ਊ牰癩瑡㩥ऊ䅔牲祡䘼潃灭捡䉴楯㹤䈠楯獤਻⼉振湥整⁲景映潬正戠畯摮⁳湡⁤楳敺漠⁦潰楳楴湯猠整ੰ䘉敖瑣牯传楲楧⁮‽噆捥潴㩲娺牥噯捥潴㭲ऊ汦慯⁴潐楳楴湯捓污⁥‽⸱昰਻⼉猯穩⁥景猠数摥猠整ੰ昉潬瑡匠数摥捓污⁥‽⸱昰਻㭽
\ No newline at end of file
@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⼯片摩漠⁦畧摩湡散搠物捥楴湯⁳慢敫⁤祢愠䘠潬正䴠湡条牥漠敶⁲桴⁥敲楧湯椠獴戠楯獤映祬琠牨畯桧ਮ⼯癅牥⁹牦敥挠汥⁬潰湩獴愠潬杮琠敨猠潨瑲獥⁴潲瑵⁥牡畯摮漠獢慴汣獥琠睯牡獤愠朠慯⁬椨攮‮⁡潖畬敭䐠獥慰湷牥愠⁴桴⁥湥⁤景⼊愯洠杩慲楴湯爠畯整Ⱙ猠⁯潢摩⁳慣⁮潦汬睯氠湯⁧潲瑵獥琠牨畯桧挠畬瑴牥摥氠癥汥⁳祢猠浡汰湩⁧⁡楳杮敬挠汥⁬慥档甠摰瑡੥⼯湩瑳慥⁤景琠慲楣杮琠敨物眠祡愠潲湵⁤癥牥⁹扯瑳捡敬‮求捯敫⁤散汬⁳潰湩⁴慢正漠瑵琠⁯桴⁥敮牡獥⁴牦敥挠汥⹬⼊縯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾ਊ瀣慲浧⁡湯散ਊ⼯湩汣摵獥⌊湩汣摵⁥䌢牯䵥湩浩污栮ਢ挊慬獳䈠䥏卄䅟䥐䘠汆捯䙫潬䙷敩摬笊瀊扵楬㩣ऊ⼯慢敫映敩摬漠敶⁲潂湵獤琠睯牡獤䜠慯ⱬ䤠䉳潬正摥挨汥⁬散瑮牥‬散汬栠污⁦楳敺 敲畴湲⁳牴敵映牯挠汥獬漠敶汲灡楰杮愠⁮扯瑳捡敬ਮ⼉振汥⁬楳敺椠⁳湩牣慥敳⁤湵楴⁬桴⁥潢湵獤映瑩椠⁮慍䍸汥獬‬潢湵獤眠瑩⁨潮栠楥桧⁴慢敫愠猠湩汧⁥慬敹⁲瀨慬慮⁲汦捯獫⸩ऊ潶摩䈠極摬挨湯瑳䘠潂♸䈠畯摮ⱳ映潬瑡䤠䍮汥卬穩ⱥ挠湯瑳䘠敖瑣牯…潇污‬䙔湵瑣潩剮晥戼潯⡬潣獮⁴噆捥潴♲‬汦慯⥴‾獉求捯敫Ɽ椠瑮㈳䴠硡敃汬⁳‽㘲ㄲ㐴㬩ਊ⼉支灭祴琠敨映敩摬ऊ潶摩删獥瑥⤨਻ऊ⼯敧⁴畧摩湡散搠物捥楴湯漠⁦桴⁥散汬挠湯慴湩湩⁧潌慣楴湯‬敺潲漠瑵楳敤漠⁦桴⁥楦汥⁤牯眠敨敲琠敨朠慯⁬慣❮⁴敢爠慥档摥ऊ噆捥潴⁲慓灭敬挨湯瑳䘠敖瑣牯…潌慣楴湯 潣獮㭴ਊ椉汮湩⁥潢汯䤠䉳極瑬⤨挠湯瑳笠爠瑥牵⁮楄敲瑣潩獮丮浵⤨㸠〠※੽椉汮湩⁥汦慯⁴敇䍴汥卬穩⡥ 潣獮⁴⁻敲畴湲䌠汥卬穩㭥素ऊ湩楬敮挠湯瑳䘠湉噴捥潴♲䜠瑥楄敭獮潩獮⤨挠湯瑳笠爠瑥牵⁮楄敭獮潩獮※੽椉汮湩⁥湩㍴′敇乴浵求捯敫䍤汥獬⤨挠湯瑳笠爠瑥牵⁮畎䉭潬正摥敃汬㭳素ऊ湩楬敮椠瑮㈳䜠瑥畎啭牮慥档扡敬敃汬⡳ 潣獮⁴⁻敲畴湲丠浵湕敲捡慨汢䍥汥獬※੽瀊楲慶整਺⼉术瑥挠湥整⁲景愠挠汥੬䘉剏䕃义䥌䕎䘠敖瑣牯䜠瑥敃汬敃瑮牥椨瑮㈳堠‬湩㍴′ⱙ椠瑮㈳娠 潣獮ੴ笉ऊ爉瑥牵⁮牏杩湩⬠⠠噆捥潴⡲ⱘ夠‬⥚⬠〠㔮⥦⨠䌠汥卬穩㭥ऊ੽䘉剏䕃义䥌䕎椠瑮㈳䜠瑥敃汬湉敤⡸湩㍴′ⱘ椠瑮㈳夠‬湩㍴′⥚挠湯瑳ऊ੻उ敲畴湲堠⬠䐠浩湥楳湯⹳⁘‪夨⬠䐠浩湥楳湯⹳⁙‪⥚਻紉ਊ⼉洯湩浩浵挠牯敮⁲景琠敨朠楲੤䘉敖瑣牯传楲楧⁮‽噆捥潴㩲娺牥噯捥潴㭲ऊ汦慯⁴敃汬楓敺㴠〠〮㭦ऊ⼯畮扭牥漠⁦散汬⁳污湯⁧慥档愠楸ੳ䘉湉噴捥潴⁲楄敭獮潩獮㴠䘠湉噴捥潴㩲娺牥噯污敵਻ऊ⼯潮浲污穩摥搠物捥楴湯瀠牥挠汥੬吉牁慲㱹噆捥潴㹲䐠物捥楴湯㭳ਊ⼉戯歡摥挠汥⁬潣湵獴‬獵摥椠⁮潬獧ऊ湩㍴′畎䉭潬正摥敃汬⁳‽㬰ऊ湩㍴′畎啭牮慥档扡敬敃汬⁳‽㬰紊਻
\ No newline at end of file
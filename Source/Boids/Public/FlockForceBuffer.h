@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⼯硅整湲污映牯散⁳湡⁤浩異獬獥猠扵業瑴摥映牯琠敨戠楯獤漠⁦⁡汆捯⁫慍慮敧⁲牦浯愠祮琠牨慥Ɽ搠慲湩摥漠据⁥数⁲楳畭慬整⁤牦浡⹥⼊䘯牯散⁳牡⁥牷瑩整⁮湩潴映硩摥猭穩⁥慢捴敨⁳湩瑳慥⁤景愠渠摯⁥数⁲潦捲ⱥ猠⁯畳浢瑩楴杮映牯散⁳潤獥❮⁴污潬慣整漠据⁥桴੥⼯畢晦牥栠獡眠牡敭⁤灵‮畓浢瑩楴杮椠⁳潬正昭敲㩥愠琠牨慥⁤慴敫⁳桴⁥灯湥戠瑡档漠⁦瑩⁳慬敮眠瑩⁨湡愠潴業⁣硥档湡敧‬牷瑩獥⼊椯瑮⁯瑩愠摮瀠瑵⁳瑩戠捡Ⱬ猠⁯桴⁥慢捴⁨慨⁳湯⁥睯敮⁲瑡愠琠浩⹥吠潷琠牨慥獤洠敥楴杮漠⁮⁡慬敮攠捡⁨牷瑩⁥桴楥⁲睯⁮慢捴੨⼯湩瑳慥⁤景眠楡楴杮‬湡⁤桷捩敨敶⁲慢捴⁨獩搠獩汰捡摥眠敨⁮異瑴湩⁧瑩戠捡⁫獩栠湡敤⁤湯氠歩⁥⁡畦汬漠敮‮畆汬戠瑡档獥愠敲⼊栯湡敤⁤潴琠敨搠慲湩琠牨畯桧愠氠捯⵫牦敥氠獩⁴湡⁤牤楡敮⁤慢捴敨⁳牡⁥敲祣汣摥ਮ⼯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⌊牰条慭漠据੥⼊椯据畬敤ੳ椣据畬敤∠潃敲楍楮慭⹬≨⌊湩汣摵⁥䌢湯慴湩牥⽳潌正牆敥楌瑳栮ਢ⼊支瑸牥慮⁬潦捲⁥牯椠灭汵敳猠扵業瑴摥映牯愠戠楯੤瑳畲瑣䘠汆捯䙫牯散笊ऊ湩㍴′慈摮敬਻䘉敖瑣牯䘠牯散਻⼉椯灭汵敳⁳档湡敧瘠汥捯瑩⁹瑡漠据ⱥ映牯散⁳牡⁥灡汰敩⁤癯牥琠敨映慲敭猧琠浩⁥瑳灥ऊ潢汯戠浉異獬㭥紊਻挊慬獳䈠䥏卄䅟䥐䘠汆捯䙫牯散畂晦牥笊瀊扵楬㩣ऊ䙆潬正潆捲䉥晵敦⡲ ‽敤慦汵㭴ऊ䙾汆捯䙫牯散畂晦牥⤨਻䘉汆捯䙫牯散畂晦牥挨湯瑳䘠汆捯䙫牯散畂晦牥⤦㴠搠汥瑥㭥ऊ䙆潬正潆捲䉥晵敦♲漠数慲潴㵲挨湯瑳䘠汆捯䙫牯散畂晦牥⤦㴠搠汥瑥㭥ਊ⼉愯摤愠映牯散‬慳敦琠⁯慣汬映潲⁭湡⁹桴敲摡ऊ潶摩䄠摤挨湯瑳䘠汆捯䙫牯散…潆捲⥥਻ऊ⼯楶楳⁴癥牥⁹潦捲⁥摡敤⁤潳映牡愠摮爠捥捹敬琠敨物戠瑡档獥‬潦捲獥椠⁮⁡慢捴⁨⁡畳浢瑩楴杮琠牨慥⁤潨摬⁳畤楲杮琠敨搠慲湩愠敲氠晥⁴潦⁲桴⁥敮瑸搠慲湩⠠湯⁥牤楡⁮瑡愠琠浩⥥ऊ潶摩䐠慲湩吨畆据楴湯敒㱦潶摩挨湯瑳䘠汆捯䙫牯散⤦‾楖楳潴⥲਻ऊ⼯牤灯攠敶祲映牯散愠摤摥猠⁯慦ੲ瘉楯⁤浅瑰⡹㬩ਊ牰癩瑡㩥ऊ⼯楦數ⵤ楳敺戠潬正漠⁦潦捲獥‬敲祣汣摥戠瑥敷湥搠慲湩ੳ猉牴捵⁴䉆瑡档ऊ੻उ瑳瑡捩挠湯瑳硥牰椠瑮㈳䌠灡捡瑩⁹‽㈱㬸ऊ䘉汆捯䙫牯散䘠牯散孳慃慰楣祴㭝ऊ椉瑮㈳丠浵㴠〠਻紉਻ऊ⼯灯湥戠瑡档漠⁦桴⁥桴敲摡⁳牷瑩湩⁧桴潲杵⁨⁡慬敮⠠畮汬眠楨敬愠琠牨慥⁤牯琠敨搠慲湩栠汯獤椠⥴‬桴敲摡⁳牡⁥灳敲摡漠敶⁲慬敮⁳祢椠੤猉牴捵⁴䱆湡੥笉ऊ䘉慂捴⩨瘠汯瑡汩⁥慂捴⁨‽畮汬瑰㭲ऊ㭽ऊ瑳瑡捩挠湯瑳硥牰椠瑮㈳丠浵慌敮⁳‽㬸ऊ䱆湡⁥慌敮孳畎䱭湡獥㭝ਊ⼉是汵⁬牯搠獩汰捡摥戠瑡档獥眠楡楴杮映牯琠敨搠慲湩‬湡⁤牤楡敮⁤慢捴敨⁳敲摡⁹潦⁲敲獵੥吉潌正牆敥潐湩整䱲獩啴潮摲牥摥䘼慂捴ⱨ倠䅌䙔剏彍䅃䡃彅䥌䕎卟婉㹅䘠汵䉬瑡档獥਻吉潌正牆敥潐湩整䱲獩啴潮摲牥摥䘼慂捴ⱨ倠䅌䙔剏彍䅃䡃彅䥌䕎卟婉㹅䘠敲䉥瑡档獥਻ऊ⼯捳慲捴⁨畢晦牥爠略敳⁤敢睴敥⁮牤楡獮ऊ䅔牲祡䘼慂捴⩨‾牄楡敮䉤瑡档獥਻㭽
\ No newline at end of file
@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⼯片畯獰漠⁦潢摩⁳牴捡敫⁤祢愠䘠潬正䴠湡条牥愠⁳瑩⁳汦捯⁫灳楬獴愠摮洠牥敧⁳椨攮‮牡畯摮漠獢慴汣獥漠⁲桷湥映敬楥杮⸩⼊䄯朠潲灵椠⁳⁡潣湮捥整⁤潣灭湯湥⁴景琠敨渠楥桧潢牵朠慲桰‬癥牥⁹潢摩椠⁮⁡牧畯⁰獩眠瑩楨⁮桴⁥楬歮爠摡畩⁳景愠潮桴牥戠楯੤⼯湩椠⹴䔠捡⁨灵慤整氠湩獫琠敨戠楯獤椠⁮慲杮⁥景攠捡⁨瑯敨⁲湩愠猠湩汧⁥慰獳漠敶⁲桴⁥慭慮敧❲⁳畣牲湥⁴捯牴敥⠠楬歮⁳牡੥⼯敭杲摥椠瑮⁯⁡湵潩⵮楦摮映牯獥⥴‬潳琠慲正湩⁧敮敶⁲敲捳湡⁳癥牥⁹慰物漠⁦潢摩⹳䈠瑥敷湥爠扥極摬⁳楬歮⁳牡⁥湯祬愠灰楬摥⼊琯⁯牧畯獰›牧畯獰琠慨⁴潣敭眠瑩楨⁮慲杮⁥敭杲⁥湡⁤敮⁷潢摩⁳潪湩愠朠潲灵漠⁮桴⁥灵慤整琠敨⁹灡数牡‬畢⁴⁡牧畯⁰桴瑡⼊搯楲瑦⁳灡牡⁴瑳祡⁳湯⁥牧畯⁰湵楴⁬牧畯獰愠敲爠扥極瑬映潲⁭捳慲捴⁨癥牥⁹敦⁷灵慤整ⱳ猠⁯灳楬獴愠敲猠敥⁮灵琠੯⼯敒畢汩䥤瑮牥慶⁬灵慤整⁳慬整‮慅档朠潲灵漠⁦⁡敲畢汩⁤慴敫⁳桴⁥摩漠⁦桴⁥牰癥潩獵朠潲灵洠獯⁴景椠獴戠楯獤挠浡⁥牦浯ਮ⼯片畯⁰条牧来瑡獥⠠散瑮潲摩‬敭湡瘠汥捯瑩ⱹ戠畯摮⥳愠敲爠晥敲桳摥攠敶祲甠摰瑡⁥牦浯琠敨挠牵敲瑮戠楯⁤瑳瑡⹥⼊縯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾ਊ瀣慲浧⁡湯散ਊ⼯湩汣摵獥⌊湩汣摵⁥䌢牯䵥湩浩污栮ਢ椣据畬敤∠汆捯䝫潲灵⹳敧敮慲整⹤≨ਊ⼯潦睲牡⁤敤汣牡獥挊慬獳䘠汆捯卫慴整਻汣獡⁳䙆潬正捏牴敥਻⼊振湯敮瑣摥朠潲灵漠⁦潢摩⁳楷桴湩愠映潬正唊呓啒呃䈨畬灥楲瑮祔数਩瑳畲瑣䘠汆捯䝫潲灵笊ऊ䕇䕎䅒䕔彄佂奄⤨ਊ⼉椯⁤敫瑰戠⁹⁡牧畯⁰捡潲獳猠敷灥⁳桷汩⁥瑩栠汯獤琠敨猠浡⁥潢摩ⱳ琠敨氠牡敧瑳瀠牡⁴景愠猠汰瑩欠敥獰琠敨椠੤唉剐偏剅奔嘨獩扩敬湁睹敨敲‬求敵牰湩剴慥佤汮⥹ऊ湩㍴′摉㴠䤠䑎塅也乏㭅ऊ⼯汦捯⁫慨摮敬⁳景戠楯獤椠⁮牧畯ੰ唉剐偏剅奔嘨獩扩敬湁睹敨敲‬求敵牰湩剴慥佤汮⥹ऊ䅔牲祡椼瑮㈳‾慈摮敬㭳ऊ偕佒䕐呒⡙楖楳汢䅥祮桷牥ⱥ䈠畬灥楲瑮敒摡湏祬਩䘉敖瑣牯䌠湥牴楯⁤‽噆捥潴㩲娺牥噯捥潴㭲ऊ偕佒䕐呒⡙楖楳汢䅥祮桷牥ⱥ䈠畬灥楲瑮敒摡湏祬਩䘉敖瑣牯䴠慥噮汥捯瑩⁹‽噆捥潴㩲娺牥噯捥潴㭲ऊ偕佒䕐呒⡙楖楳汢䅥祮桷牥ⱥ䈠畬灥楲瑮敒摡湏祬਩䘉潂⁸潂湵獤㴠䘠潂⡸潆捲䥥楮⥴਻ऊ湩楬敮椠瑮㈳丠浵⤨挠湯瑳笠爠瑥牵⁮慈摮敬⹳畎⡭㬩素紊਻挊慬獳䈠䥏卄䅟䥐䘠汆捯䝫潲灵ੳ੻異汢捩਺⼉氯湩⁫慥档戠楯⁤潴攠敶祲戠楯⁤楷桴湩䰠湩剫摡畩⁳湩琠敨漠瑣敲ⱥ眠楨档洠獵⁴敢戠極瑬映潲⁭桴⁥汦捯⁫瑳瑡❥⁳畣牲湥⁴潰楳楴湯⹳朠潲灵⁳牡⁥敭杲摥ऊ⼯污湯⁧桴⁥楬歮⁳湡⁤敲畢汩⁴癥牥⁹敒畢汩䥤瑮牥慶⁬灵慤整⁳愨摮漠⁮桴⁥楦獲⁴灵慤整愠瑦牥愠爠獥瑥 潴猠汰瑩琠敨Ɑ爠瑥牵獮琠畲⁥晩朠潲灵⁳敷敲爠扥極瑬ऊ潢汯唠摰瑡⡥潣獮⁴䙆潬正瑓瑡♥䘠潬正瑓瑡ⱥ挠湯瑳䘠汆捯佫瑣敲♥传瑣敲ⱥ映潬瑡䰠湩剫摡畩ⱳ椠瑮㈳删扥極摬湉整癲污㬩ਊ⼉是牯敧⁴癥牥⁹牧畯⁰湡⁤敲畢汩⁤湯琠敨渠硥⁴灵慤整ऊ潶摩删獥瑥⤨਻ऊ湩楬敮挠湯瑳吠牁慲㱹䙆潬正片畯㹰…敇䝴潲灵⡳ 潣獮⁴⁻敲畴湲䜠潲灵㭳素ऊ⼯敧⁴湩敤⁸湩潴朠潲灵⁳景愠戠楯❤⁳牧畯⁰䤨䑎塅也乏⁅湵楴⁬桴⁥潢摩猧映物瑳甠摰瑡ⱥ愠摮映牯猠慴敬栠湡汤獥਩椉瑮㈳䜠瑥片畯䥰摮硥椨瑮㈳䠠湡汤⥥挠湯瑳਻椉汮湩⁥湩㍴′敇乴浵敒畢汩獤⤨挠湯瑳笠爠瑥牵⁮畎剭扥極摬㭳素ਊ牰癩瑡㩥ऊ⼯楬歮攠敶祲戠楯⁤潴椠獴渠楥桧潢牵⁳湩琠敨漠瑣敲ⱥ琠牵⁮桴⁥潦敲瑳椠瑮⁯牧畯獰愠摮洠瑡档琠敨物椠獤眠瑩⁨桴⁥牰癥潩獵朠潲灵ੳ瘉楯⁤敒畢汩⡤潣獮⁴䙆潬正瑓瑡♥䘠潬正瑓瑡ⱥ挠湯瑳䘠汆捯佫瑣敲♥传瑣敲ⱥ映潬瑡䰠湩剫摡畩⥳਻⼉氯湩⁫癥牥⁹潢摩琠⁯瑩⁳敮杩扨畯獲椠⁮桴⁥捯牴敥愠摮洠牥敧琠敨朠潲灵⁳楬歮摥‬潢摩⁳摡敤⁤楳据⁥桴⁥慬瑳甠摰瑡⁥瑳牡⁴湩愠朠潲灵漠⁦桴楥⁲睯੮瘉楯⁤敍杲⡥潣獮⁴䙆潬正瑓瑡♥䘠潬正瑓瑡ⱥ挠湯瑳䘠汆捯佫瑣敲♥传瑣敲ⱥ映潬瑡䰠湩剫摡畩⥳਻⼉爯晥敲桳朠潲灵愠杧敲慧整⁳牦浯挠牵敲瑮戠楯⁤瑳瑡ⱥ戠楯獤爠浥癯摥猠湩散琠敨氠獡⁴敲畢汩⁤牡⁥牤灯数⁤牦浯琠敨物朠潲灵ऊ潶摩唠摰瑡䅥杧敲慧整⡳潣獮⁴䙆潬正瑓瑡♥䘠潬正瑓瑡⥥਻⼉术瑥爠潯⁴景愠戠楯❤⁳敳ⱴ栠污楶杮琠敨瀠瑡⁨湯琠敨眠祡甠ੰ椉瑮㈳䘠湩剤潯⡴湩㍴′湉敤⥸਻⼉洯牥敧琠敨猠瑥⁳景琠潷戠楯獤‬浳污敬⁲敳⁴潧獥甠摮牥琠敨氠牡敧⁲湯੥瘉楯⁤楌歮椨瑮㈳䤠摮硥ⱁ椠瑮㈳䤠摮硥⥂਻ऊ⼯灵慤整⁳楳据⁥牧畯獰眠牥⁥慬瑳爠扥極瑬⠠义䕄彘低䕎㴠爠扥極摬漠⁮桴⁥敮瑸甠摰瑡⥥ऊ湩㍴′灕慤整即湩散敒畢汩⁤‽义䕄彘低䕎਻椉瑮㈳丠浵敒畢汩獤㴠〠਻ऊ䅔牲祡䘼汆捯䝫潲灵‾片畯獰਻⼉椯摮硥椠瑮⁯牧畯獰漠⁦慥档栠湡汤⁥汳瑯愠摮琠敨栠湡汤⁥牧畯数⁤湩椠ⱴ愠猠潬⁴敲獵摥戠⁹⁡敮⁷潢摩搠敯湳琧椠桮牥瑩琠敨朠潲灵漠⁦桴⁥敲潭敶⁤湯੥吉牁慲㱹湩㍴㸲匠潬䝴潲灵㭳ऊ䅔牲祡椼瑮㈳‾片畯数䡤湡汤獥਻椉瑮㈳丠硥䝴潲灵摉㴠〠਻ऊ⼯湵潩⵮楦摮映牯獥⁴癯牥戠楯獤戠⁹牡慲⁹湩敤⁸桷汩⁥敲畢汩楤杮愠摮漠敶⁲牧畯獰戠⁹湩敤⁸桷汩⁥敭杲湩Ⱨ爠潯獴愠敲琠敨物漠湷瀠牡湥⁴湡⁤楳敺ੳ⼉愯敲漠汮⁹敫瑰甠⁰潴搠瑡⁥湯爠潯獴ऊ䅔牲祡椼瑮㈳‾慐敲瑮㭳ऊ䅔牲祡椼瑮㈳‾楓敺㭳ਊ⼉猯牣瑡档戠晵敦獲爠略敳⁤敢睴敥⁮睳敥獰ऊ䅔牲祡椼瑮㈳‾敎杩扨畯獲਻吉牁慲㱹湩㍴㸲删潯䝴潲灵㭳紊਻
\ No newline at end of file
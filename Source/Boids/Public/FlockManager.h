@@ -1,153 +1 @@
-// Copyright ©2020 Samuel Harrison
-
-//README:~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-//Actor placed in the level that stores the perception and steering settings of the boids it controls.
-//Used as a way to manipulate the behavior of the entire flock and optimize flock-wide logic changes.
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-
-#pragma once
-
-//includes
-#include "CoreMinimal.h"
-#include "GameFramework/Actor.h"
-#include "FlockManager.generated.h"
-
-//forward declares
-class UBillboardComponent;
-class ABoid;
-
-UCLASS()
-class BOIDS_API AFlockManager : public AActor
-{
-	GENERATED_BODY()
-
-public:
-	//default constructor
-	AFlockManager();
-
-protected:
-	//setup logic called when level starts or spawned
-	virtual void BeginPlay() override;
-
-	//COMPONENTS
-protected:
-	//billboard visuals component
-	UPROPERTY(VisibleAnywhere, Category = "Boid|Components")
-	UBillboardComponent* FlockManagerBillboard;
-
-	//BOID FLOCK
-protected:
-	//list of boids in flock
-	TArray<ABoid*> BoidsInFlock;
-
-public:
-	//adding and removing boids to/from flock when spawned or despawned
-	void AddBoidToFlock(ABoid* Boid);
-	void RemoveBoidFromFlock(ABoid* Boid);
-
-	//MOVEMENT
-	//TODO: add property listener or logic check to ensure max !< min or min !> max when changed in editor
-	//TODO: move to a locomotion class/component
-protected:
-	UPROPERTY(EditAnywhere, Category = "Boid|Movement", meta = (ClampMin = "0.0"))
-	float MaxSpeed;
-	UPROPERTY(EditAnywhere, Category = "Boid|Movement", meta = (ClampMin = "0.0"))
-	float MinSpeed;
-
-public:
-	//movement property getters + setters
-	UFUNCTION(BlueprintCallable, Category = "Boid|Movement")
-	inline float GetMaxSpeed() { return MaxSpeed; };
-	UFUNCTION(BlueprintCallable, Category = "Boid|Movement")
-	inline float GetMinSpeed() { return MinSpeed; };
-	UFUNCTION(BlueprintCallable, Category = "Boid|Movement")
-	void SetMaxSpeed(float NewMaxSpeed);
-	UFUNCTION(BlueprintCallable, Category = "Boid|Movement")
-	void SetMinSpeed(float NewMinSpeed);
-
-	//TODO: logic to transform boid movement from 3d <-> 2d
-	//void SetMovementDim(bool b2D){for (ABoid* Boid : BoidsInFlock) Boid->SetActorLocation(x,y, z = 0)}
-	//need 2d version of all perception, steering and boid movement logic
-
-	//STEERING
-protected:
-	//behavioral steering force strengths
-	//TODO: add clamping to logical values on changes in editor meta = (ClampMin = "X", ClampMax = "Y")
-	UPROPERTY(EditAnywhere, Category = "Boid|Steering")
-	float AlignmentStrength;
-	UPROPERTY(EditAnywhere, Category = "Boid|Steering")
-	float SeparationStrength;
-	UPROPERTY(EditAnywhere, Category = "Boid|Steering")
-	float CohesionStrength;
-	UPROPERTY(EditAnywhere, Category = "Boid|Steering")
-	float AvoidanceStrength;
-
-public:
-	//steering property getters + setters
-	UFUNCTION(BlueprintCallable, Category = "Boid|Steering")
-	inline float GetAlignmentStrength() { return AlignmentStrength; };
-	UFUNCTION(BlueprintCallable, Category = "Boid|Steering")
-	inline float GetSeparationStrength() { return SeparationStrength; };
-	UFUNCTION(BlueprintCallable, Category = "Boid|Steering")
-	inline float GetCohesionStrength() { return CohesionStrength; };
-	UFUNCTION(BlueprintCallable, Category = "Boid|Steering")
-	inline float GetAvoidanceStrength() { return AvoidanceStrength; };
-	UFUNCTION(BlueprintCallable, Category = "Boid|Steering")
-	void SetAlignmentStrength(float NewAlignmentStrength);
-	UFUNCTION(BlueprintCallable, Category = "Boid|Steering")
-	void SetSeparationStrength(float NewSeparationStrength);
-	UFUNCTION(BlueprintCallable, Category = "Boid|Steering")
-	void SetCohesionStrength(float NewCohesionStrength);
-	UFUNCTION(BlueprintCallable, Category = "Boid|Steering")
-	void SetAvoidanceStrength(float NewAvoidanceStrength);
-
-	//PERCEPTION
-protected:
-	//determines the field of view of each perception field to determine if a flockmate is sensed (1.0 boid can only sense things directly in front of it, -1 boid can sense in all directions)
-	UPROPERTY(EditAnywhere, Category = "Boid|Perception", meta = (ClampMin = "-1.0", ClampMax = "1.0"))
-	float SeparationFOV;
-	UPROPERTY(EditAnywhere, Category = "Boid|Perception", meta = (ClampMin = "-1.0", ClampMax = "1.0"))
-	float AlignmentFOV;
-	UPROPERTY(EditAnywhere, Category = "Boid|Perception", meta = (ClampMin = "-1.0", ClampMax = "1.0"))
-	float CohesionFOV;
-
-public:
-	//getters + setters
-	UFUNCTION(BlueprintCallable, Category = "Boid|Perception")
-	inline float GetSeparationFOV() { return SeparationFOV; };
-	UFUNCTION(BlueprintCallable, Category = "Boid|Perception")
-	inline float GetAlignmentFOV() { return AlignmentFOV; };
-	UFUNCTION(BlueprintCallable, Category = "Boid|Perception")
-	inline float GetCohesionFOV() { return CohesionFOV; };
-	//TODO: add setters for perception FOV's
-
-	//TODO: add logic to get and set boid's perception sensor component radius
-
-	//AVOIDANCE
-protected:
-	//number of avoidance sensors
-	UPROPERTY(EditAnywhere, Category = "Boid|Avoidance", meta = (ClampMin = "0", ClampMax = "1000"))
-	int32 NumSensors;
-	//golden ratio constant used for spacing the packing points onto the sphere
-	const float GoldenRatio = (1.0f + FMath::Sqrt(5.0f)) / 2;
-	//range of the avoidance collision sensors
-	UPROPERTY(EditAnywhere, Category = "Boid|Avoidance", meta = (ClampMin = "0"))
-	float SensorRadius;
-	//avoidance sensor directions
-	TArray<FVector> AvoidanceSensors;
-	//creates the directions that the avoidance sensors point
-	void BuildAvoidanceSensors();
-
-public:
-	//getters + setters
-	inline float GetSensorRadius() { return SensorRadius; }
-	inline TArray<FVector> GetAvoidanceSensors() { return AvoidanceSensors; }
-
-	//TODO: add getters and setters for NumSensors, Sensor Radius, etc.
-
-	//FLOCK RESET
-	//TODO: add reset function to destroy current flock and generate new one using assigned spawners
-
-	//FLOCK PRESETS
-	//TODO: add flock presets that store settings for "general" boid behavior, can be used to reset boid at good starting settings
-};
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾⼊䄯瑣牯瀠慬散⁤湩琠敨氠癥汥琠慨⁴瑳牯獥琠敨瀠牥散瑰潩⁮湡⁤瑳敥楲杮猠瑥楴杮⁳景琠敨戠楯獤椠⁴潣瑮潲獬ਮ⼯獕摥愠⁳⁡慷⁹潴洠湡灩汵瑡⁥桴⁥敢慨楶牯漠⁦桴⁥湥楴敲映潬正愠摮漠瑰浩穩⁥汦捯⵫楷敤氠杯捩挠慨杮獥ਮ⼯桔⁥汦捯⁫慭慮敧⁲睯獮琠敨猠浩汵瑡潩⁮瑳瑡⁥景椠獴戠楯獤愠摮洠癯獥‬数捲楥敶⁳湡⁤瑳敥獲琠敨眠潨敬映潬正攠捡⁨牦浡⹥⼊縯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾ਊ瀣慲浧⁡湯散ਊ⼯湩汣摵獥⌊湩汣摵⁥䌢牯䵥湩浩污栮ਢ椣据畬敤∠慇敭牆浡睥牯⽫捁潴⹲≨⌊湩汣摵⁥吢浥汰瑡獥䤯瑮来牥敓畱湥散栮ਢ椣据畬敤∠汆捯佫瑣敲⹥≨⌊湩汣摵⁥䘢潬正瑓瑡⹥≨⌊湩汣摵⁥䘢潬正敎䍴摯捥栮ਢ椣据畬敤∠汆捯䍫浯慰瑣瑓瑡⹥≨⌊湩汣摵⁥䘢潬正湓灡桳瑯栮ਢ椣据畬敤∠汆捯呫汥浥瑥祲栮ਢ椣据畬敤∠汆捯䙫潬䙷敩摬栮ਢ椣据畬敤∠汆捯䝫潲灵⹳≨⌊湩汣摵⁥䘢潬正楖睥栮ਢ椣据畬敤∠汆捯䙫牯散畂晦牥栮ਢ椣据畬敤∠汆捯䵫湡条牥朮湥牥瑡摥栮ਢ⼊是牯慷摲搠捥慬敲ੳ汣獡⁳䉕汩扬慯摲潃灭湯湥㭴挊慬獳䄠潂摩਻汣獡⁳䙕潬正湓灡桳瑯獁敳㭴挊慬獳唠汆捯剫汥祡潃灭湯湥㭴挊慬獳䄠汐祡牥潃瑮潲汬牥਻汣獡⁳䙁潬正慍慮敧㭲ਊ⼯楳畭慬楴湯焠慵楬祴猠瑥楴杮⁳獵摥戠⁹桴⁥汦捯❫⁳牦浡⁥畢杤瑥朠癯牥潮ੲ单剔䍕⡔求敵牰湩呴灹⥥猊牴捵⁴䙆潬正畑污瑩䱹癥汥笊ऊ䕇䕎䅒䕔彄佂奄⤨ਊ⼉是慲瑣潩⁮景愠潶摩湡散猠湥潳獲琠慲散⁤桷湥猠慥捲楨杮映牯愠⁮湵扯瑳畲瑣摥搠物捥楴湯ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬求敵牰湩剴慥佤汮ⱹ洠瑥⁡‽䌨慬灭楍⁮‽〢〮Ⱒ䌠慬灭慍⁸‽ㄢ〮⤢਩昉潬瑡匠湥潳䙲慲瑣潩⁮‽⸱昰਻ऊ⼯慭楸畭⁭畮扭牥漠⁦汦捯浫瑡獥挠湯楳敤敲⁤数⁲潢摩⠠‰‽潮氠浩瑩਩唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䈠畬灥楲瑮敒摡湏祬‬敭慴㴠⠠汃浡䵰湩㴠∠∰⤩ऊ湩㍴′慍乸楥桧潢牵⁳‽㬰ਊ⼉港浵敢⁲景映慲敭⁳敢睴敥⁮瑳敥楲杮甠摰瑡獥漠⁦慥档戠楯⁤戨楯獤猠楴汬洠癯⁥癥牥⁹牦浡⥥ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬求敵牰湩剴慥佤汮ⱹ洠瑥⁡‽䌨慬灭楍⁮‽ㄢ⤢਩椉瑮㈳匠整牥湩卧牴摩⁥‽㬱ਊ⼉戯楯獤映牵桴牥琠慨⁮桴獩映潲⁭癥牥⁹汰祡牥瘠敩⁷瑳敥⁲瑡搠畯汢⁥桴⁥瑳楲敤⠠‰‽潮䰠䑏਩唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䈠畬灥楲瑮敒摡湏祬‬敭慴㴠⠠汃浡䵰湩㴠∠⸰∰⤩ऊ汦慯⁴佌䑄獩慴据⁥‽⸰昰਻㭽ਊ⼯楦敬映牯慭⁴景攠灸牯整⁤汦捯⁫整敬敭牴੹䕕啎⡍求敵牰湩呴灹⥥攊畮⁭汣獡⁳䙅潬正敔敬敭牴䙹牯慭⁴›極瑮ਸ੻䌉噓ਬ䨉体੎㭽ਊ⼯潧污漠⁦桴⁥潢摩⁳湩愠映潬正唊久䵕䈨畬灥楲瑮祔数਩湥浵挠慬獳䔠汆捯䉫桥癡潩⁲›極瑮ਸ੻⼉猯灥牡瑡ⱥ愠楬湧‬牧畯⁰灵愠摮愠潶摩漠獢慴汣獥ऊ汆捯Ⱬऊ⼯敳慰慲整愠摮愠潶摩漠獢慴汣獥眠楨敬爠慯業杮椠⁮慲摮浯搠物捥楴湯ⱳ椠湧牯湩⁧汦捯浫瑡⁥敨摡湩獧愠摮瀠獯瑩潩獮ऊ慗摮牥ਬ⼉是潬正眠楨敬猠整牥湩⁧睡祡映潲⁭敮牡祢瀠慬敹⁲楶睥ੳ䘉敬੥㭽ਊ⼯瑳敥楲杮爠汵獥攠慶畬瑡摥戠⁹桴⁥瑳敥楲杮欠牥敮ⱬ琠敨映潬正洠湡条牥爠湵⁳⁡敫湲汥挠浯楰敬⁤潦⁲桴⁥畲敬⁳瑩⁳敳瑴湩獧甠敳渊浡獥慰散䔠汆捯剫汵੥੻攉畮⁭祔数㨠甠湩㍴ਲ笉ऊ匉灥牡瑡潩⁮‽ⰱऊ䄉楬湧敭瑮㴠㈠ਬउ潃敨楳湯㴠㐠ਬउ⼯汦捯浫瑡獥漠瑵楳敤琠敨瀠牥散瑰潩⁮但獖愠敲椠湧牯摥⠠潮⁴敮摥摥眠楨敬攠敶祲䘠噏椠⁳ㄭ਩उ楆汥佤噦敩⁷‽ⰸऊ䄉潶摩湡散㴠ㄠⰶऊ⼉戯楯獤洠癯⁥湯愠栠牯穩湯慴⁬汰湡ⱥ猠整牥湩⁧湡⁤癡楯慤据⁥湯祬眠牯⁫湩堠愠摮夠ऊ倉慬慮⁲‽㈳ਬउ⼯畮扭牥漠⁦畲敬猠瑥ੳउ畎剭汵卥瑥⁳‽㐶ऊ㭽紊ਊ⼯条牧来瑡⁥瑳瑡⁥景瀠牡⁴景愠映潬正眠楨敬琠敨映潬正椠⁳楳畭慬整⁤潣牡敳祬唊呓啒呃䈨畬灥楲瑮祔数਩瑳畲瑣䘠汆捯䍫慯獲䍥畬瑳牥笊ऊ䕇䕎䅒䕔彄佂奄⤨ਊ唉剐偏剅奔嘨獩扩敬湁睹敨敲‬求敵牰湩剴慥佤汮⥹ऊ噆捥潴⁲敃瑮潲摩㴠䘠敖瑣牯㨺敚潲敖瑣牯਻⼉猯慴摮牡⁤敤楶瑡潩⁮景戠楯⁤潰楳楴湯⁳牡畯摮琠敨挠湥牴楯⁤湯攠捡⁨硡獩ऊ偕佒䕐呒⡙楖楳汢䅥祮桷牥ⱥ䈠畬灥楲瑮敒摡湏祬਩䘉敖瑣牯匠牰慥⁤‽噆捥潴㩲娺牥噯捥潴㭲ऊ⼯敭湡瘠汥捯瑩⁹景戠楯獤椠⁮汣獵整ੲ唉剐偏剅奔嘨獩扩敬湁睹敨敲‬求敵牰湩剴慥佤汮⥹ऊ噆捥潴⁲敖潬楣祴㴠䘠敖瑣牯㨺敚潲敖瑣牯਻唉剐偏剅奔嘨獩扩敬湁睹敨敲‬求敵牰湩剴慥佤汮⥹ऊ湩㍴′潃湵⁴‽㬰ऊ⼯祴数漠⁦潢摩猠慰湷摥眠敨⁮桴⁥汣獵整⁲獩琠牵敮⁤慢正椠瑮⁯潢摩ੳ唉剐偏剅奔嘨獩扩敬湁睹敨敲‬求敵牰湩剴慥佤汮⥹ऊ協扵汣獡佳㱦䉁楯㹤䈠楯呤灹㭥紊਻⼊氯湩⁥敲潣摲摥戠⁹桴⁥楳畭慬楴湯映牯琠敨映潬正搠扥杵瘠獩慵楬慺楴湯猊牴捵⁴䙆潬正敄畢䱧湩੥੻䘉敖瑣牯匠慴瑲਻䘉敖瑣牯䔠摮਻䘉潃潬⁲潃潬㭲紊਻⼊是潬正慭整⁳景愠戠楯⁤灳楬⁴湩潴渠獥整⁤数捲灥楴湯爠湩獧‬慥档猠整牥湩⁧畲敬漠汮⁹敲摡⁳桴⁥汦捯浫瑡獥眠瑩楨⁮瑩⁳睯⁮慲楤獵猊牴捵⁴䙆潬正慭整楒杮ੳ੻吉牁慲噹敩㱷潣獮⁴湩㍴㸲匠灥牡瑡潩㭮ऊ䅔牲祡楖睥挼湯瑳椠瑮㈳‾汁杩浮湥㭴ऊ䅔牲祡楖睥挼湯瑳椠瑮㈳‾潃敨楳湯਻㭽ਊ⼯慲杮⁥景戠楯獤猠整牥摥戠⁹湯⁥慴歳‬档湵獫漠⁦⁡汦捯⁫慣⁮瑳敥⁲湩瀠牡污敬⁬潳攠捡⁨敫灥⁳瑩⁳睯⁮捳慲捴⁨湡⁤敲畳瑬ੳ瑳畲瑣䘠汆捯卫整牥湩䍧畨歮笊ऊ⼯楦獲⁴潢摩愠摮漠敮瀠獡⁴桴⁥慬瑳戠楯⁤瑳敥敲⁤祢琠敨挠畨歮ऊ湩㍴′楆獲䉴楯⁤‽㬰ऊ湩㍴′湅䉤楯⁤‽㬰ਊ⼉是潬正慭整椠摮捩獥爠略敳⁤敢睴敥⁮潢摩ⱳ映潬正慭整⁳潳瑲摥戠⁹楲杮愠摮琠敨爠湩⁧景攠捡⁨慧桴牥摥映潬正慭整ऊ䅔牲祡椼瑮㈳‾汆捯浫瑡獥਻吉牁慲㱹湩㍴㸲删湩獧਻吉牁慲㱹極瑮㸸删湩䥧摮捩獥਻ऊ⼯敤畢⁧楬敮⁳湡⁤整敬敭牴⁹敲潣摲摥眠楨敬猠整牥湩Ⱨ洠牥敧⁤湩潴琠敨洠湡条牥漠据⁥癥牥⁹档湵⁫獩搠湯੥吉牁慲㱹䙆潬正敄畢䱧湩㹥䐠扥杵楌敮㭳ऊ䙆潬正敔敬敭牴䍹畯瑮⁳敔敬敭牴㭹ऊ⼯楬瑳⁳慧桴牥摥映牯琠敨挠畨歮猧戠楯獤眠楨敬渠楥桧潢牵氠獩獴愠敲爠扥極瑬⠠瑳牡獴愠敲漠晦敳獴椠瑮⁯桴⁥档湵❫⁳湩楤散⥳‬瑳瑩档摥椠瑮⁯桴⁥慭慮敧❲⁳楬瑳ੳ吉牁慲㱹湩㍴㸲丠楥桧潢牵楌瑳瑓牡獴਻吉牁慲㱹湩㍴㸲丠楥桧潢牵楌瑳湉楤散㭳ऊ⼯牴敵椠⁦⁡潢摩漠⁦桴⁥档湵⁫潭敶⁤慦⁲湥畯桧映潲⁭瑩⁳楬瑳愠据潨⁲潴爠扥極摬攠敶祲氠獩ੴ戉潯⁬乢楥桧潢牵楌瑳即慴敬㴠映污敳਻ऊ⼯楴敭猠数瑮洠癯湩Ⱨ朠瑡敨楲杮氠獩獴映牯愠摮猠整牥湩⁧桴⁥档湵੫昉潬瑡圠牯䵫⁳‽⸰昰਻㭽ਊ⼯潢摩眠楡楴杮琠⁯敢猠慰湷摥戠⁹桴⁥汦捯⁫慭慮敧ੲ瑳畲瑣䘠潂摩灓睡剮煥敵瑳笊ऊ協扵汣獡佳㱦䉁楯㹤䈠楯呤灹㭥ऊ呆慲獮潦浲匠慰湷牔湡晳牯㭭ऊ⼯慨摮敬漠⁦汦捯⁫瑳瑡⁥污敲摡⁹敲瑳牯摥映牯琠楨⁳潢摩⠠义䕄彘低䕎映牯愠渠睥戠楯⥤ऊ湩㍴′汆捯䡫湡汤⁥‽义䕄彘低䕎਻㭽ਊ⼯楬歮戠瑥敷湥愠戠楯⁤敲汰捩瑡摥映潲⁭桴⁥敳癲牥愠摮椠獴氠捯污映潬正猠慴整猊牴捵⁴剆灥楬慣整䉤楯੤੻椉瑮㈳䰠捯污慈摮敬਻昉潬瑡䰠獡剴捥楥敶呤浩㭥紊਻⼊振楬湥⁴楳敤攠灸湡楳湯漠⁦⁡汣獵整⁲畳浭牡⁹敲散癩摥映潲⁭桴⁥敳癲牥猊牴捵⁴䙆潬正汃獵整偲潲祸笊ऊ噆捥潴⁲敃瑮潲摩਻䘉敖瑣牯嘠汥捯瑩㭹ऊ汦慯⁴慌瑳敒散癩摥楔敭਻⼉氯捯污戠楯獤爠灥敲敳瑮湩⁧桴⁥汣獵整⁲湡⁤桴楥⁲景獦瑥⁳牦浯椠獴挠湥牴楯੤吉牁慲㱹湩㍴㸲䰠捯污慈摮敬㭳ऊ䅔牲祡䘼敖瑣牯‾晏獦瑥㭳紊਻⼊琯捩⁫畦据楴湯琠慨⁴潪湩⁳⁡汦捯⁫慭慮敧❲⁳獡湹档潲潮獵猠浩汵瑡潩⁮湡⁤潣浭瑩⁳潢摩琠慲獮潦浲⁳湩愠氠瑡牥琠捩⁫牧畯ੰ单剔䍕⡔਩瑳畲瑣䘠汆捯䍫浯業呴捩䙫湵瑣潩⁮›異汢捩䘠楔正畆据楴湯笊ऊ䕇䕎䅒䕔彄佂奄⤨ਊ⼉是潬正洠湡条牥琠慨⁴睯獮琠楨⁳楴正映湵瑣潩੮䄉汆捯䵫湡条牥‪慔杲瑥㴠渠汵灬牴਻⼉漯汮⁹潪湩愠猠浩汵瑡潩⁮桴瑡琠慲散⁳桴⁥桰獹捩⁳捳湥ⱥ戠晥牯⁥桰獹捩⁳瑳牡獴⠠牴湡晳牯獭愠敲猠楴汬挠浯業瑴摥戠⁹桴⁥潣浭瑩琠捩⥫ऊ潢汯戠桐獹捩䩳楯⁮‽慦獬㭥ਊ瘉物畴污瘠楯⁤硅捥瑵呥捩⡫汦慯⁴敄瑬呡浩ⱥ䔠敌敶呬捩⁫楔正祔数‬久浡摥桔敲摡㩳吺灹⁥畃牲湥呴牨慥Ɽ挠湯瑳䘠片灡䕨敶瑮敒♦䴠䍹浯汰瑥潩䝮慲桰癅湥⥴漠敶牲摩㭥ऊ楶瑲慵⁬卆牴湩⁧楄条潮瑳捩敍獳条⡥ 癯牥楲敤਻㭽ਊ整灭慬整㸼猊牴捵⁴協牴捵佴獰祔数牔楡獴䘼汆捯䍫浯業呴捩䙫湵瑣潩㹮㨠瀠扵楬⁣協牴捵佴獰祔数牔楡獴慂敳㰲䙆潬正潃浭瑩楔正畆据楴湯ਾ੻攉畮⁭⁻楗桴潃祰㴠映污敳素਻㭽ਊ䍕䅌卓⤨挊慬獳䈠䥏卄䅟䥐䄠汆捯䵫湡条牥㨠瀠扵楬⁣䅁瑣牯笊ऊ䕇䕎䅒䕔彄佂奄⤨ਊ異汢捩਺⼉搯晥畡瑬挠湯瑳畲瑣牯ऊ䙁潬正慍慮敧⡲㬩ਊ⼉振污敬⁤潴甠摰瑡⁥慥档映慲敭‬楳畭慬整⁳桴⁥桷汯⁥汦捯੫瘉物畴污瘠楯⁤楔正昨潬瑡䐠汥慴楔敭 癯牥楲敤਻瀊潲整瑣摥਺⼉猯瑥灵氠杯捩挠污敬⁤桷湥氠癥汥猠慴瑲⁳牯猠慰湷摥ऊ楶瑲慵⁬潶摩䈠来湩汐祡⤨漠敶牲摩㭥ऊ⼯慷瑩⁳潦⁲⁡楳畭慬楴湯猠楴汬椠⁮汦杩瑨戠晥牯⁥桴⁥慭慮敧⁲潧獥愠慷੹瘉物畴污瘠楯⁤湅偤慬⡹潣獮⁴䕅摮汐祡敒獡湯㨺祔数䔠摮汐祡敒獡湯 癯牥楲敤਻⼉爯来獩整獲琠敨挠浯業⁴楴正愠潬杮楳敤琠敨洠湡条牥猧琠捩੫瘉物畴污瘠楯⁤敒楧瑳牥捁潴呲捩䙫湵瑣潩獮戨潯⁬剢来獩整⥲漠敶牲摩㭥ਊ⼉䌯䵏佐䕎呎੓牰瑯捥整㩤ऊ⼯楢汬潢牡⁤楶畳污⁳潣灭湯湥ੴ唉剐偏剅奔嘨獩扩敬湁睹敨敲‬慃整潧祲㴠∠潂摩䍼浯潰敮瑮≳਩唉楂汬潢牡䍤浯潰敮瑮‪汆捯䵫湡条牥楂汬潢牡㭤ਊ⼉䈯䥏⁄䱆䍏ੋ牰瑯捥整㩤ऊ⼯数⵲潢摩猠慴整漠⁦癥牥⁹潢摩椠⁮汦捯੫䘉汆捯卫慴整䘠潬正瑓瑡㭥ਊ⼉港浵敢⁲景映慲敭⁳敢睴敥⁮敲猭牯楴杮映潬正猠慴整椠瑮⁯潍瑲湯漠摲牥映牯洠浥牯⁹潬慣楬祴漠⁦敮杩扨畯獲⠠‰‽敮敶⥲ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䙼潬正Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽〢⤢਩椉瑮㈳䴠牯潴卮牯䥴瑮牥慶㭬ऊ湩㍴′牆浡獥楓据䵥牯潴卮牯㭴ਊ⼉琯畲⁥桷汩⁥潢摩琠慲獮潦浲⁳牡⁥敢湩⁧潣浭瑩整Ɽ戠楯獤爠浥癯摥搠牵湩⁧桴獩琠浩⁥牡⁥敲潭敶⁤湯散椠❴⁳潤敮ऊ潢汯戠獉潃浭瑩楴杮牔湡晳牯獭਻吉牁慲㱹湩㍴㸲倠湥楤杮敒潭慶獬਻瀊扵楬㩣ऊ⼯摡楤杮愠摮爠浥癯湩⁧潢摩⁳潴是潲⁭汦捯⁫桷湥猠慰湷摥漠⁲敤灳睡敮੤瘉楯⁤摁䉤楯呤䙯潬正䄨潂摩‪潂摩㬩ऊ潶摩删浥癯䉥楯䙤潲䙭潬正䄨潂摩‪潂摩㬩ਊ⼉戯楯⁤瑳瑡⁥捡散獳戠⁹慨摮敬‬敶潬楣祴椠⁳桴⁥湯⁥慬瑳挠浯業瑴摥⠠敺潲甠瑮汩琠敨戠楯❤⁳楦獲⁴牦浡⁥慨⁳敢湥瀠扵楬桳摥਩䘉敖瑣牯䜠瑥潂摩敖潬楣祴椨瑮㈳䈠楯䡤湡汤⥥਻瘉楯⁤敓䉴楯䱤捯瑡潩⡮湩㍴′潂摩慈摮敬‬潣獮⁴噆捥潴♲丠睥潌慣楴湯㬩ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤汆捯≫਩椉汮湩⁥湩㍴′敇乴浵潂摩⡳ ⁻敲畴湲䘠潬正瑓瑡⹥畎⡭ ‫畎䍭慯獲䉥楯獤※㭽ਊ⼉儯䅕呎婉䑅䘠佌䭃䅍䕔੓牰瑯捥整㩤ऊ⼯瑳敥楲杮爠慥獤映潬正慭整⁳牦浯愠焠慵瑮穩摥挠灯⁹景琠敨物猠慴整⠠㈱椠獮整摡漠⁦㐲戠瑹獥瀠牥映潬正慭整Ⱙ爠摥捵獥洠浥牯⁹牴晡楦⁣景瘠牥੹⼉氯牡敧映潬正⹳琠敨挠灯⁹獩欠灥⁴敮瑸琠⁯桴⁥畦汬瀠敲楣楳湯猠慴整‬潳椠⁴潣瑳⁳㈱攠瑸慲戠瑹獥瀠牥戠楯੤唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤汆捯≫਩戉潯⁬兢慵瑮穩䙥潬正慭整㭳ਊ⼉焯慵瑮穩摥挠灯⁹景瀠獯瑩潩獮愠摮瘠汥捯瑩敩⁳慰正摥攠捡⁨牦浡ⱥ爠慥⁤潦⁲汦捯浫瑡獥戠⁹桴⁥瑳敥楲杮欠牥敮੬䘉汆捯䍫浯慰瑣瑓瑡⁥潃灭捡却慴整਻ऊ⼯敧⁴汦捯浫瑡⁥瑳瑡⁥牦浯琠敨焠慵瑮穩摥挠灯⁹桷湥攠慮汢摥ऊ但䍒䥅䱎义⁅噆捥潴⁲敇䙴潬正慭整潐楳楴湯椨瑮㈳䤠摮硥 潣獮⁴⁻敲畴湲戠畑湡楴敺汆捯浫瑡獥㼠䌠浯慰瑣瑓瑡⹥敇側獯瑩潩⡮湉敤⥸㨠䘠潬正瑓瑡⹥潐楳楴湯孳湉敤嵸※੽䘉剏䕃义䥌䕎䘠敖瑣牯䜠瑥汆捯浫瑡䡥慥楤杮椨瑮㈳䤠摮硥 潣獮⁴⁻敲畴湲戠畑湡楴敺汆捯浫瑡獥㼠䌠浯慰瑣瑓瑡⹥敇䡴慥楤杮䤨摮硥 ›潂摩效摡湩獧䥛摮硥㭝素ਊ異汢捩਺唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩䙼潬正⤢ऊ湩楬敮戠潯⁬獉汆捯浫瑡入慵瑮穩瑡潩䕮慮汢摥⤨笠爠瑥牵⁮兢慵瑮穩䙥潬正慭整㭳素਻唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩䙼潬正⤢ऊ潶摩匠瑥汆捯浫瑡入慵瑮穩瑡潩䕮慮汢摥戨潯⁬䕢慮汢摥㬩ऊ⼯祢整⁳景猠浩汵瑡潩⁮瑳瑡⁥瑳牯摥瀠牥戠楯Ɽ椠据畬楤杮琠敨焠慵瑮穩摥挠灯੹唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩䙼潬正⤢ऊ湩㍴′敇却慴整祂整偳牥潂摩⤨਻⼉支瑸慲戠瑹獥瀠牥戠楯⁤景琠敨焠慵瑮穩摥挠灯ⱹ猠潴敲⁤湯琠灯漠⁦桴⁥畦汬瀠敲楣楳湯猠慴整⠠‰桷湥渠瑯焠慵瑮穩摥਩唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩䙼潬正⤢ऊ湩㍴′敇兴慵瑮穩摥祂整偳牥潂摩⤨਻⼉戯瑹獥琠敨猠整牥湩⁧敫湲汥爠慥獤映牯攠捡⁨汦捯浫瑡੥唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩䙼潬正⤢ऊ湩㍴′敇䭴牥敮䉬瑹獥敐䉲楯⡤㬩ऊ⼯潬⁧敭潭祲甠敳愠摮猠浩汵瑡潩⁮桴潲杵灨瑵漠⁦汦捯Ⱬ愠摮琠敨洠浥牯⁹⁡〱欰戠楯⁤汦捯⁫潷汵⁤獵੥唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃汬湉摅瑩牯‬慃整潧祲㴠∠潂摩䙼潬正⤢ऊ潶摩䰠杯汆捯卫潴慲敧瑓瑡⡳㬩ਊ⼉匯䅐乗义ੇ牰瑯捥整㩤ऊ⼯潢摩⁳慷瑩湩⁧潴戠⁥灳睡敮Ɽ搠慲湩摥椠⁮牯敤⁲楷桴湩琠敨猠慰湷戠摵敧⁴慥档映慲敭ऊ䅔牲祡䘼潂摩灓睡剮煥敵瑳‾灓睡兮敵敵਻ऊ⼯慭楸畭⁭畮扭牥漠⁦潢摩⁳灳睡敮⁤数⁲牦浡⁥〨㴠渠⁯楬業⥴ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩卼慰湷Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽〢⤢਩椉瑮㈳䴠硡灓睡獮敐䙲慲敭਻⼉洯硡浩浵琠浩⁥灳湥⁴灳睡楮杮戠楯獤瀠牥映慲敭椠⁮業汬獩捥湯獤⠠‰‽潮氠浩瑩਩唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤灓睡≮‬敭慴㴠⠠汃浡䵰湩㴠∠⸰∰⤩ऊ汦慯⁴灓睡䉮摵敧䵴㭳ਊ⼉猯慰湷焠敵敵⁤潢摩⁳湵楴⁬桴⁥牦浡❥⁳灳睡⁮畢杤瑥椠⁳獵摥甠ੰ瘉楯⁤牐捯獥即慰湷畑略⡥㬩ਊ異汢捩਺⼉焯敵敵愠戠楯⁤潴戠⁥灳睡敮⁤湩潴琠敨映潬正漠敶⁲桴⁥敮瑸映慲敭ੳ瘉楯⁤畑略䉥楯卤慰湷吨畓换慬獳晏䄼潂摩‾潂摩祔数‬潣獮⁴呆慲獮潦浲…灓睡呮慲獮潦浲㬩ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤灓睡≮਩椉汮湩⁥湩㍴′敇乴浵畑略摥灓睡獮⤨笠爠瑥牵⁮灓睡兮敵敵丮浵⤨※㭽ਊ⼉䠯䅅䱄卅⁓䥓啍䅌䥔乏瀊潲整瑣摥਺⼉猯浩汵瑡⁥潢摩⁳獡映潬正猠慴整漠汮ⱹ眠瑩潨瑵戠楯⁤捡潴獲⠠潮洠獥⁨牯挠汯楬楳湯挠浯潰敮瑮⥳‬湯搠摥捩瑡摥猠牥敶獲漠⁲楷桴ⴠ汆捯䡫慥汤獥⹳ऊ⼯癡楯慤据⁥瑳汩⁬牴捡獥氠癥汥朠潥敭牴⁹桴潲杵⁨桴⁥桰獹捩⁳捳湥੥唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤效摡敬獳⤢ऊ潢汯戠汁潬䡷慥汤獥㭳ऊ⼯牴敵椠⁦潢摩⁳牡⁥楳畭慬整⁤楷桴畯⁴捡潴獲ऊ潢汯戠獉效摡敬獳਻ऊ⼯敤灳睡敮⁲潶畬敭⁳湡⁤慣敧⁳景琠楨⁳汦捯Ⱬ愠灰楬摥琠⁯敨摡敬獳戠楯獤戠⁹潰楳楴湯椠獮整摡漠⁦癯牥慬⁰癥湥獴ऊ䅔牲祡䘼潂㹸䠠慥汤獥䑳獥慰湷潂湵獤਻吉牁慲㱹䉆硯‾效摡敬獳慃敧潂湵獤਻ऊ⼯档捥⁫晩琠楨⁳牰捯獥⁳湯祬渠敥獤戠楯⁤潰楳楴湯⁳渨瑯楨杮椠⁳敲摮牥摥਩戉潯⁬桓畯摬畒䡮慥汤獥⡳ 潣獮㭴ऊ⼯摡⁤汦捯⁫瑳瑡⁥景愠猠慰湷爠煥敵瑳眠瑩潨瑵猠慰湷湩⁧瑩⁳捡潴ੲ瘉楯⁤摁䡤慥汤獥䉳楯⡤潣獮⁴䉆楯卤慰湷敒畱獥♴匠慰湷敒畱獥⥴਻⼉是湩⁤敤灳睡敮獲愠摮琠楨⁳汦捯❫⁳慣敧⁳湩琠敨氠癥汥ऊ潶摩䜠瑡敨䡲慥汤獥噳汯浵獥⤨਻⼉搯獥慰湷戠楯獤椠獮摩⁥敤灳睡敮獲愠摮洠癯⁥潢摩⁳桴瑡氠晥⁴桴楥⁲慣敧琠⁯瑩⁳瑯敨⁲楳敤ऊ潶摩䄠灰祬效摡敬獳潖畬敭⡳㬩ਊ⼉支瑳浩瑡⁥敭潭祲漠⁦⁡潢摩愠瑣牯愠摮椠獴挠浯潰敮瑮⁳牦浯琠敨搠晥畡瑬⁳渨瑯挠畯瑮湩⁧桰獹捩⁳潢楤獥愠摮爠湥敤⁲瑳瑡⥥ऊ湩㍴′獅楴慭整捁潴䉲瑹獥敐䉲楯⡤㬩ਊ異汢捩਺唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩䡼慥汤獥≳਩椉汮湩⁥潢汯䤠䡳慥汤獥⡳ ⁻敲畴湲戠獉效摡敬獳※㭽ਊ⼉䔯员剅䅎⁌但䍒卅瀊潲整瑣摥਺⼉是牯散⁳畳浢瑩整⁤牦浯愠祮琠牨慥Ɽ搠慲湩摥椠瑮⁯慔杲瑥潆捲獥愠摮吠牡敧䥴灭汵敳⁳湯散瀠牥猠浩汵瑡摥映慲敭ऊ䙆潬正潆捲䉥晵敦⁲潆捲䉥晵敦㭲ਊ⼉猯浵焠敵敵⁤潦捲獥愠摮椠灭汵敳⁳数⁲潢摩映牯琠敨渠硥⁴楳畭慬楴湯ऊ潶摩䐠慲湩潆捲䉥晵敦⡲湩㍴′畎䉭楯獤㬩ਊ異汢捩਺⼉愯摤映牯散琠⁯⁡潢摩戠⁹汦捯⁫慨摮敬映牯椠獴渠硥⁴楳畭慬整⁤牦浡ⱥ猠晡⁥潴挠污⁬牦浯愠祮琠牨慥੤唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩䙼牯散≳਩瘉楯⁤摁䉤楯䙤牯散椨瑮㈳䠠湡汤ⱥ䘠敖瑣牯䘠牯散㬩ऊ⼯摡⁤湩瑳湡⁴敶潬楣祴挠慨杮⁥潴愠戠楯⁤祢映潬正栠湡汤⁥湯椠獴渠硥⁴楳畭慬整⁤牦浡ⱥ猠晡⁥潴挠污⁬牦浯愠祮琠牨慥੤唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩䙼牯散≳਩瘉楯⁤摁䉤楯䥤灭汵敳椨瑮㈳䠠湡汤ⱥ䘠敖瑣牯䤠灭汵敳㬩ऊ⼯档捥⁫晩愠映潬正栠湡汤⁥瑳汩⁬摡牤獥敳⁳⁡潢摩漠⁦桴獩映潬正‬慨摮敬⁳景爠浥癯摥戠楯獤猠慴⁹湩慶楬⁤癥湥漠据⁥桴楥⁲汳瑯椠⁳敲獵摥ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤潆捲獥⤢ऊ湩楬敮戠潯⁬獉潂摩慈摮敬慖楬⡤湩㍴′慈摮敬 潣獮⁴⁻敲畴湲䘠潬正瑓瑡⹥獉慖楬䡤湡汤⡥慈摮敬㬩素ਊ⼉䘯佌䭃嘠䕉੗牰瑯捥整㩤ऊ⼯慬整瑳瀠扵楬桳摥瘠敩ⱷ愠摮愠瀠敲楶畯⁳楶睥爠捥捹敬⁤湯散攠敶祲爠慥敤⁲慨⁳敲敬獡摥椠ੴ吉桓牡摥瑐㱲䙆潬正楖睥‬卅䵐摯㩥吺牨慥卤晡㹥䰠瑡獥噴敩㭷ऊ協慨敲偤牴䘼汆捯噫敩ⱷ䔠偓潍敤㨺桔敲摡慓敦‾灓牡噥敩㭷ऊ⼯畧牡獤䰠瑡獥噴敩ⱷ爠慥敤獲挠湡朠瑥椠⁴牦浯愠祮琠牨慥੤洉瑵扡敬䘠牃瑩捩污敓瑣潩⁮汆捯噫敩䱷捯㭫ऊ極瑮㐶䘠潬正楖睥敖獲潩㭮ਊ⼉瀯扵楬桳挠浯業瑴摥映潬正猠慴整愠⁳⁡敮⁷楶睥ऊ潶摩倠扵楬桳汆捯噫敩⡷㬩ਊ異汢捩਺⼉术瑥氠瑡獥⁴楶睥漠⁦桴⁥汦捯⁫椨癮污摩甠瑮汩琠敨映物瑳映慲敭椠⁳異汢獩敨⥤‬慳敦琠⁯慣汬映潲⁭湡⁹桴敲摡‬桴⁥楶睥猠慴獹瘠污摩眠楨敬椠❴⁳敨摬ऊ䙆潬正楖睥瑐⁲敇䙴潬正楖睥⤨挠湯瑳਻⼉是潬正愠杧敲慧整⁳景琠敨氠瑡獥⁴楶睥ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤楖睥⤢ऊ噆捥潴⁲敇䙴潬正敃瑮潲摩⤨挠湯瑳਻唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩噼敩≷਩䘉敖瑣牯䜠瑥汆捯䵫慥噮汥捯瑩⡹ 潣獮㭴ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤楖睥⤢ऊ䉆硯䜠瑥汆捯䉫畯摮⡳ 潣獮㭴ਊ⼉䴯噏䵅久੔⼉启䑏㩏愠摤瀠潲数瑲⁹楬瑳湥牥漠⁲潬楧⁣档捥⁫潴攠獮牵⁥慭⁸㰡洠湩漠⁲業⁮㸡洠硡眠敨⁮档湡敧⁤湩攠楤潴ੲ⼉启䑏㩏洠癯⁥潴愠氠捯浯瑯潩⁮汣獡⽳潣灭湯湥ੴ牰瑯捥整㩤ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䵼癯浥湥≴‬敭慴㴠⠠汃浡䵰湩㴠∠⸰∰⤩ऊ汦慯⁴慍卸数摥਻唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤潍敶敭瑮Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽〢〮⤢਩昉潬瑡䴠湩灓敥㭤ਊ異汢捩਺⼉洯癯浥湥⁴牰灯牥祴朠瑥整獲⬠猠瑥整獲ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤潍敶敭瑮⤢ऊ湩楬敮映潬瑡䜠瑥慍卸数摥⤨笠爠瑥牵⁮慍卸数摥※㭽ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤潍敶敭瑮⤢ऊ湩楬敮映潬瑡䜠瑥楍卮数摥⤨笠爠瑥牵⁮楍卮数摥※㭽ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤潍敶敭瑮⤢ऊ潶摩匠瑥慍卸数摥昨潬瑡丠睥慍卸数摥㬩ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤潍敶敭瑮⤢ऊ潶摩匠瑥楍卮数摥昨潬瑡丠睥楍卮数摥㬩ਊ牰瑯捥整㩤ऊ⼯潣獮牴楡⁮潢摩⁳潴愠栠牯穩湯慴⁬汰湡⁥瑡琠敨映潬正洠湡条牥猧栠楥桧⁴椨攮‮敨摲ⱳ映獩⁨湩愠猠慨汬睯瀠湯⥤ऊ⼯汰湡牡映潬正⁳数捲楥敶眠瑩⁨⁡畱摡牴敥‬瑳敥⁲湩㈠⁄湡⁤癡楯⁤扯瑳捡敬⁳楷桴愠爠湩⁧景猠湥潳獲椠獮整摡漠⁦⁡灳敨敲ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䵼癯浥湥≴਩戉潯⁬偢慬慮䵲癯浥湥㭴ऊ⼯敨杩瑨漠⁦桴⁥汰湡⁥桴⁥楳畭慬楴湯爠湵⁳楷桴琠楨⁳牦浡੥昉潬瑡匠浩汐湡䡥楥桧㭴ਊ異汢捩਺唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩䵼癯浥湥≴਩椉汮湩⁥潢汯䤠偳慬慮䵲癯浥湥⡴ ⁻敲畴湲戠汐湡牡潍敶敭瑮※㭽ऊ⼯睳瑩档戠瑥敷湥㌠⁄湡⁤汰湡牡洠癯浥湥ⱴ戠楯獤愠敲洠癯摥漠瑮⁯桴⁥汰湡⁥湯琠敨渠硥⁴楳畭慬楴湯ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤潍敶敭瑮⤢ऊ潶摩匠瑥汐湡牡潍敶敭瑮戨潯⁬䕢慮汢摥㬩ਊ⼉匯䕔剅义ੇ牰瑯捥整㩤ऊ⼯敢慨楶牯污猠整牥湩⁧潦捲⁥瑳敲杮桴ੳ⼉启䑏㩏愠摤挠慬灭湩⁧潴氠杯捩污瘠污敵⁳湯挠慨杮獥椠⁮摥瑩牯洠瑥⁡‽䌨慬灭楍⁮‽堢Ⱒ䌠慬灭慍⁸‽夢⤢ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩卼整牥湩≧਩昉潬瑡䄠楬湧敭瑮瑓敲杮桴਻唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤瑓敥楲杮⤢ऊ汦慯⁴敓慰慲楴湯瑓敲杮桴਻唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤瑓敥楲杮⤢ऊ汦慯⁴潃敨楳湯瑓敲杮桴਻唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤瑓敥楲杮⤢ऊ汦慯⁴癁楯慤据卥牴湥瑧㭨ਊ異汢捩਺⼉猯整牥湩⁧牰灯牥祴朠瑥整獲⬠猠瑥整獲ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤瑓敥楲杮⤢ऊ湩楬敮映潬瑡䜠瑥汁杩浮湥却牴湥瑧⡨ ⁻敲畴湲䄠楬湧敭瑮瑓敲杮桴※㭽ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤瑓敥楲杮⤢ऊ湩楬敮映潬瑡䜠瑥敓慰慲楴湯瑓敲杮桴⤨笠爠瑥牵⁮敓慰慲楴湯瑓敲杮桴※㭽ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤瑓敥楲杮⤢ऊ湩楬敮映潬瑡䜠瑥潃敨楳湯瑓敲杮桴⤨笠爠瑥牵⁮潃敨楳湯瑓敲杮桴※㭽ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤瑓敥楲杮⤢ऊ湩楬敮映潬瑡䜠瑥癁楯慤据卥牴湥瑧⡨ ⁻敲畴湲䄠潶摩湡散瑓敲杮桴※㭽ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤瑓敥楲杮⤢ऊ潶摩匠瑥汁杩浮湥却牴湥瑧⡨汦慯⁴敎䅷楬湧敭瑮瑓敲杮桴㬩ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤瑓敥楲杮⤢ऊ潶摩匠瑥敓慰慲楴湯瑓敲杮桴昨潬瑡丠睥敓慰慲楴湯瑓敲杮桴㬩ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤瑓敥楲杮⤢ऊ潶摩匠瑥潃敨楳湯瑓敲杮桴昨潬瑡丠睥潃敨楳湯瑓敲杮桴㬩ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤瑓敥楲杮⤢ऊ潶摩匠瑥癁楯慤据卥牴湥瑧⡨汦慯⁴敎䅷潶摩湡散瑓敲杮桴㬩ਊ⼉䈯䡅噁佉੒牰瑯捥整㩤ऊ⼯潧污漠⁦桴⁥潢摩ⱳ猠汥捥獴琠敨猠整牥湩⁧畲敬⁳獵摥琠杯瑥敨⁲楷桴琠敨猠整牥湩⁧瑳敲杮桴ੳ唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤敂慨楶牯⤢ऊ䙅潬正敂慨楶牯䈠桥癡潩㭲ऊ⼯瑳敲杮桴漠⁦桴⁥慲摮浯猠整牥湩⁧景眠湡敤楲杮戠楯獤ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䉼桥癡潩≲‬敭慴㴠⠠摅瑩潃摮瑩潩⁮‽䈢桥癡潩⁲㴽䔠汆捯䉫桥癡潩㩲场湡敤≲⤩ऊ汦慯⁴慗摮牥瑓敲杮桴਻⼉是敬楥杮戠楯獤猠整牥愠慷⁹牦浯瀠慬敹⁲楶睥⁳汣獯牥琠慨⁮桴獩ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䉼桥癡潩≲‬敭慴㴠⠠汃浡䵰湩㴠∠⸰∰‬摅瑩潃摮瑩潩⁮‽䈢桥癡潩⁲㴽䔠汆捯䉫桥癡潩㩲䘺敬≥⤩ऊ汦慯⁴汆敥慒楤獵਻唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤敂慨楶牯Ⱒ洠瑥⁡‽䔨楤䍴湯楤楴湯㴠∠敂慨楶牯㴠‽䙅潬正敂慨楶牯㨺汆敥⤢਩昉潬瑡䘠敬卥牴湥瑧㭨ਊ⼉戯桥癡潩Ⱳ爠汵⁥敳⁴䔨汆捯剫汵⁥汦条⥳愠摮戠桥癡潩⁲敳瑴湩獧琠敨猠浩汵瑡潩⁮畲獮眠瑩⁨桴獩映慲敭ऊ䙅潬正敂慨楶牯匠浩敂慨楶牯਻甉湩㍴′楓剭汵獥਻昉潬瑡匠浩慗摮牥瑓敲杮桴਻昉潬瑡匠浩汆敥慒楤獵਻昉潬瑡匠浩汆敥瑓敲杮桴਻ऊ⼯敧⁴桴⁥畲敬⁳敮摥摥戠⁹畣牲湥⁴敳瑴湩獧‬畲敬⁳楷桴渠⁯晥敦瑣⠠敺潲猠牴湥瑧ⱨⴠ‱但⥖愠敲氠晥⁴畯ੴ甉湩㍴′敇剴汵卥瑥⤨挠湯瑳਻瀊扵楬㩣ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤敂慨楶牯⤢ऊ湩楬敮䔠汆捯䉫桥癡潩⁲敇䉴桥癡潩⡲ ⁻敲畴湲䈠桥癡潩㭲素਻唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩䉼桥癡潩≲਩瘉楯⁤敓䉴桥癡潩⡲䙅潬正敂慨楶牯丠睥敂慨楶牯㬩ਊ⼉倯剅䕃呐佉੎牰瑯捥整㩤ऊ⼯敤整浲湩獥琠敨映敩摬漠⁦楶睥漠⁦慥档瀠牥散瑰潩⁮楦汥⁤潴搠瑥牥業敮椠⁦⁡汦捯浫瑡⁥獩猠湥敳⁤ㄨ〮戠楯⁤慣⁮湯祬猠湥敳琠楨杮⁳楤敲瑣祬椠⁮牦湯⁴景椠ⱴⴠ‱潢摩挠湡猠湥敳椠⁮污⁬楤敲瑣潩獮਩唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤敐捲灥楴湯Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽ⴢ⸱∰‬汃浡䵰硡㴠∠⸱∰⤩ऊ汦慯⁴敓慰慲楴湯但㭖ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮‬敭慴㴠⠠汃浡䵰湩㴠∠ㄭ〮Ⱒ䌠慬灭慍⁸‽ㄢ〮⤢਩昉潬瑡䄠楬湧敭瑮但㭖ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮‬敭慴㴠⠠汃浡䵰湩㴠∠ㄭ〮Ⱒ䌠慬灭慍⁸‽ㄢ〮⤢਩昉潬瑡䌠桯獥潩䙮噏਻瀊扵楬㩣ऊ⼯敧瑴牥⁳‫敳瑴牥ੳ唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮਩椉汮湩⁥汦慯⁴敇却灥牡瑡潩䙮噏⤨笠爠瑥牵⁮敓慰慲楴湯但㭖素਻唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮਩椉汮湩⁥汦慯⁴敇䅴楬湧敭瑮但⡖ ⁻敲畴湲䄠楬湧敭瑮但㭖素਻唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮਩椉汮湩⁥汦慯⁴敇䍴桯獥潩䙮噏⤨笠爠瑥牵⁮潃敨楳湯但㭖素਻⼉启䑏㩏愠摤猠瑥整獲映牯瀠牥散瑰潩⁮但❖ੳऊ⼯䕐䍒偅䥔乏删义升瀊潲整瑣摥਺⼉瀯牥散瑰潩⁮慲楤獵漠⁦慥档猠整牥湩⁧畲敬⠠‰‽獵⁥桴⁥潢摩猧瀠牥散瑰潩⁮敳獮牯爠摡畩⥳‮汦捯浫瑡獥愠敲朠瑡敨敲⁤湯散眠瑩楨੮⼉琯敨氠牡敧瑳爠摡畩⁳湡⁤灳楬⁴湩潴渠獥整⁤楲杮ⱳ猠⁯敳慰慲楴湯挠湡猠慴⁹汣獯⁥慲杮⁥桷汩⁥潣敨楳湯氠潯獫映牵桴牥漠瑵ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮‬敭慴㴠⠠汃浡䵰湩㴠∠⸰∰⤩ऊ汦慯⁴敓慰慲楴湯慒楤獵਻唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤敐捲灥楴湯Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽〢〮⤢਩昉潬瑡䄠楬湧敭瑮慒楤獵਻唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤敐捲灥楴湯Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽〢〮⤢਩昉潬瑡䌠桯獥潩剮摡畩㭳ਊ⼉爯汵⁥慲楤⁩桴⁥楳畭慬楴湯爠湵⁳楷桴琠楨⁳牦浡ⱥ映潬正慭整⁳牡⁥慧桴牥摥眠瑩楨⁮桴⁥畱牥⁹慲楤獵ऊ汦慯⁴楓卭灥牡瑡潩剮摡畩㭳ऊ汦慯⁴楓䅭楬湧敭瑮慒楤獵਻昉潬瑡匠浩潃敨楳湯慒楤獵਻昉潬瑡匠浩畑牥剹摡畩㭳ऊ⼯煳慵敲⁤慲楤獵漠⁦慥档爠湩⁧椨湮牥潭瑳映物瑳 湡⁤桴⁥楲杮攠捡⁨畲敬爠慥獤甠⁰潴⠠敳慰慲楴湯‬污杩浮湥ⱴ挠桯獥潩⥮ऊ汦慯⁴楓剭湩剧摡楩煓慵敲孤崳਻椉瑮㈳匠浩畒敬楒杮孳崳਻⼉是污敳眠敨⁮癥牥⁹畲敬甠敳⁳桴⁥慳敭爠摡畩⁳湡⁤汦捯浫瑡獥搠湯琧渠敥⁤潴戠⁥灳楬ੴ戉潯⁬卢浩敎瑳摥楒杮㭳ਊ⼉爯獥汯敶爠汵⁥慲楤⁩湡⁤楲杮戠畯摮⁳潦⁲桴獩映慲敭猧猠浩汵瑡潩੮瘉楯⁤灕慤整敐捲灥楴湯楒杮⡳㬩ऊ⼯灳楬⁴汦捯浫瑡獥朠瑡敨敲⁤湩潴愠挠畨歮猧猠牣瑡档椠瑮⁯敮瑳摥爠湩獧ऊ䙆潬正慭整楒杮⁳灓楬䙴潬正慭整⡳湩㍴′潂摩湉敤ⱸ䘠汆捯卫整牥湩䍧畨歮…桃湵⥫਻瀊扵楬㩣ऊ⼯敧瑴牥⁳‫敳瑴牥ੳ唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮਩椉汮湩⁥汦慯⁴敇却灥牡瑡潩剮摡畩⡳ ⁻敲畴湲匠灥牡瑡潩剮摡畩㭳素਻唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮਩椉汮湩⁥汦慯⁴敇䅴楬湧敭瑮慒楤獵⤨笠爠瑥牵⁮汁杩浮湥剴摡畩㭳素਻唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮਩椉汮湩⁥汦慯⁴敇䍴桯獥潩剮摡畩⡳ ⁻敲畴湲䌠桯獥潩剮摡畩㭳素਻唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮਩瘉楯⁤敓却灥牡瑡潩剮摡畩⡳汦慯⁴敎卷灥牡瑡潩剮摡畩⥳਻唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮਩瘉楯⁤敓䅴楬湧敭瑮慒楤獵昨潬瑡丠睥汁杩浮湥剴摡畩⥳਻唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮਩瘉楯⁤敓䍴桯獥潩剮摡畩⡳汦慯⁴敎䍷桯獥潩剮摡畩⥳਻ऊ⼯䕎䝉䉈問⁒䥌呓੓牰瑯捥整㩤ऊ⼯慣档⁥慥档戠楯❤⁳汦捯浫瑡獥眠瑩楨⁮数捲灥楴湯爠摡畩⁳‫歳湩愠摮爠略敳琠敨⁭湵楴⁬⁡潢摩栠獡洠癯摥洠牯⁥桴湡栠污⁦桴⁥歳湩⠠潦⁲慬杲ⱥ猠潬⁷潭楶杮映潬正⥳ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮਩戉潯⁬啢敳敎杩扨畯䱲獩獴਻⼉洯牡楧⁮摡敤⁤潴瀠牥散瑰潩⁮慲楤獵眠敨⁮畢汩楤杮渠楥桧潢牵氠獩獴‬慬杲牥猠楫獮愠敲爠扥極瑬氠獥⁳景整⁮畢⁴档捥⁫潭敲映潬正慭整ੳ唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤敐捲灥楴湯Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽ㄢ〮Ⱒ䔠楤䍴湯楤楴湯㴠∠啢敳敎杩扨畯䱲獩獴⤢਩昉潬瑡丠楥桧潢牵歓湩਻ऊ⼯敮杩扨畯⁲歳湩琠敨猠浩汵瑡潩⁮畲獮眠瑩⁨桴獩映慲敭⠠‰‽楬瑳⁳楤慳汢摥਩昉潬瑡匠浩敎杩扨畯卲楫㭮ऊ⼯汦捯浫瑡獥漠⁦癥牥⁹潢摩猠潴敲⁤慢正琠⁯慢正‬潢摩椠猧氠獩⁴獩丠楥桧潢牵楌瑳湉楤散孳敎杩扨畯䱲獩却慴瑲孳嵩‬敎杩扨畯䱲獩却慴瑲孳⁩‫崱਩吉牁慲㱹湩㍴㸲丠楥桧潢牵楌瑳瑓牡獴਻吉牁慲㱹湩㍴㸲丠楥桧潢牵楌瑳湉楤散㭳ऊ⼯潢摩瀠獯瑩潩獮琠敨氠獩獴眠牥⁥畢汩⁴瑡ऊ䅔牲祡䘼敖瑣牯‾敎杩扨畯䱲獩䅴据潨獲਻⼉爯摡畩⁳湡⁤汦捯⁫瑳瑡⁥慬潹瑵琠敨氠獩獴眠牥⁥畢汩⁴潦ੲ昉潬瑡丠楥桧潢牵楌瑳慒楤獵਻甉湩㍴′敎杩扨畯䱲獩䱴祡畯㭴ऊ⼯牦浡獥愠摮氠獩⁴敲畢汩獤猠湩散猠浩汵瑡潩⁮瑳瑡⁳敷敲氠獡⁴潬杧摥ऊ湩㍴′敎杩扨畯䱲獩䙴慲敭㭳ऊ湩㍴′敎杩扨畯䱲獩䉴極摬㭳ਊ⼉氯獩獴愠敲甠敳⁤祢琠敨挠牵敲瑮猠浩汵瑡潩Ɱ愠摮愠敲爠扥極瑬戠⁹瑩⠠湡⁹潢摩洠癯摥洠牯⁥桴湡栠污⁦桴⁥歳湩‬潢摩⁳敷敲愠摤摥漠⁲敲潭敶Ɽ漠⁲数捲灥楴湯爠摡畩⁳档湡敧⥤ऊ潢汯戠楓啭敳敎杩扨畯䱲獩獴਻戉潯⁬剢扥極摬敎杩扨畯䱲獩獴਻ऊ⼯慧桴牥琠敨氠獩獴漠⁦湯⁥档湵❫⁳潢摩⁳晩氠獩獴愠敲爠扥極瑬⠠捯牴敥洠獵⁴敢戠極瑬਩瘉楯⁤慇桴牥敎杩扨畯䱲獩䍴畨歮椨瑮㈳䌠畨歮湉敤⥸਻⼉愯灰湥⁤桴⁥楬瑳⁳景攠敶祲挠畨歮椠瑮⁯桴⁥慭慮敧❲⁳楬瑳⁳湯散攠敶祲挠畨歮椠⁳慧桴牥摥ऊ潶摩匠楴捴乨楥桧潢牵楌瑳⡳㬩ऊ⼯潭敶氠獩獴戠極瑬戠晥牯⁥⁡潍瑲湯猠牯⁴潴琠敨猠牯整⁤湩楤散ⱳ匠牯佴摲牥栠汯獤琠敨漠摬椠摮硥漠⁦慥档戠楯੤瘉楯⁤敒慭买楥桧潢牵楌瑳⡳潣獮⁴䅔牲祡椼瑮㈳☾匠牯佴摲牥㬩ऊ⼯敧⁴汦捯浫瑡獥眠瑩楨⁮慒楤獵漠⁦⁡潢摩映潲⁭瑩⁳慣档摥氠獩ⱴ猠潴獰漠据⁥慍乸楥桧潢牵⁳牡⁥潦湵⁤〨㴠渠⁯楬業⥴ऊ潶摩䜠瑡敨䱲獩整乤楥桧潢牵⡳湩㍴′潂摩湉敤ⱸ映潬瑡删摡畩ⱳ吠牁慲㱹湩㍴㸲…畏乴楥桧潢牵ⱳ椠瑮㈳䴠硡敎杩扨畯獲 潣獮㭴ਊ異汢捩਺唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮਩椉汮湩⁥潢汯䤠啳楳杮敎杩扨畯䱲獩獴⤨笠爠瑥牵⁮啢敳敎杩扨畯䱲獩獴※㭽ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤敐捲灥楴湯⤢ऊ潶摩匠瑥敎杩扨畯䱲獩獴湅扡敬⡤潢汯戠湅扡敬⥤਻ऊ⼯䝁則䝅呁⁅䕐䍒偅䥔乏瀊潲整瑣摥਺⼉甯敳琠敨映潬正漠瑣敲⁥潦⁲潣敨楳湯愠摮愠楬湧敭瑮椠獮整摡漠⁦桴⁥潢摩猧瀠牥散瑰潩⁮敳獮牯‬敳慰慲楴湯猠慴獹攠慸瑣ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮਩戉潯⁬啢敳杁牧来瑡健牥散瑰潩㭮ऊ⼯慲楤獵甠敳⁤潦⁲潣敨楳湯愠摮愠楬湧敭瑮眠敨⁮条牧来瑡⁥数捲灥楴湯椠⁳湥扡敬⁤挨湡戠⁥畭档氠牡敧⁲桴湡琠敨瀠牥散瑰潩⁮敳獮牯਩唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤敐捲灥楴湯Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽〢〮Ⱒ䔠楤䍴湯楤楴湯㴠∠啢敳杁牧来瑡健牥散瑰潩≮⤩ऊ汦慯⁴杁牧来瑡健牥散瑰潩剮摡畩㭳ऊ⼯捯牴敥渠摯獥眠潨敳猠穩⁥ 楤瑳湡散椠⁳敢潬⁷桴獩愠杮敬愠敲琠敲瑡摥愠⁳⁡楳杮敬映潬正慭整⠠‰‽硥捡ⱴ氠牡敧⁲‽慦瑳牥戠瑵挠慯獲牥਩唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤敐捲灥楴湯Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽〢〮Ⱒ䌠慬灭慍⁸‽㈢〮Ⱒ䔠楤䍴湯楤楴湯㴠∠啢敳杁牧来瑡健牥散瑰潩≮⤩ऊ汦慯⁴灏湥湩䅧杮敬਻ऊ⼯潢摩栠慥楤杮⁳渨牯慭楬敺⁤敶潬楣祴 瑡琠敨猠慴瑲漠⁦桴⁥牦浡ⱥ椠摮硥洠瑡档獥映潬正猠慴整ऊ䅔牲祡䘼敖瑣牯‾潂摩效摡湩獧਻⼉猯慰楴污椠摮硥漠⁦汦捯⁫楷桴瀠牥渠摯⁥条牧来瑡獥ऊ䙆潬正捏牴敥䘠潬正捏牴敥਻⼉爯摡畩⁳景琠敨戠楯獤‧数捲灥楴湯猠湥潳Ⱳ甠敳⁤潦⁲硥捡⁴汦捯浫瑡⁥畱牥敩ੳ昉潬瑡倠牥散瑰潩剮摡畩㭳ਊ異汢捩਺⼉术瑥整獲⬠猠瑥整獲ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤敐捲灥楴湯⤢ऊ湩楬敮戠潯⁬獉杁牧来瑡健牥散瑰潩䕮慮汢摥⤨笠爠瑥牵⁮啢敳杁牧来瑡健牥散瑰潩㭮素਻唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮਩瘉楯⁤敓䅴杧敲慧整敐捲灥楴湯湅扡敬⡤潢汯戠湅扡敬⥤਻唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮਩椉汮湩⁥汦慯⁴敇䅴杧敲慧整敐捲灥楴湯慒楤獵⤨笠爠瑥牵⁮杁牧来瑡健牥散瑰潩剮摡畩㭳素਻唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮਩瘉楯⁤敓䅴杧敲慧整敐捲灥楴湯慒楤獵昨潬瑡丠睥杁牧来瑡健牥散瑰潩剮摡畩⥳਻ऊ⼯噁䥏䅄䍎੅牰瑯捥整㩤ऊ⼯畮扭牥漠⁦癡楯慤据⁥敳獮牯ੳ唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤癁楯慤据≥‬敭慴㴠⠠汃浡䵰湩㴠∠∰‬汃浡䵰硡㴠∠〱〰⤢਩椉瑮㈳丠浵敓獮牯㭳ऊ⼯畮扭牥漠⁦癡楯慤据⁥敳獮牯⁳湩琠敨爠湩⁧獵摥戠⁹汰湡牡洠癯浥湥ੴ唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤癁楯慤据≥‬敭慴㴠⠠汃浡䵰湩㴠∠∰‬汃浡䵰硡㴠∠㘳∰‬摅瑩潃摮瑩潩⁮‽戢汐湡牡潍敶敭瑮⤢਩椉瑮㈳丠浵汐湡牡敓獮牯㭳ऊ⼯潧摬湥爠瑡潩挠湯瑳湡⁴獵摥映牯猠慰楣杮琠敨瀠捡楫杮瀠楯瑮⁳湯潴琠敨猠桰牥੥按湯瑳映潬瑡䜠汯敤剮瑡潩㴠⠠⸱昰⬠䘠慍桴㨺煓瑲㔨〮⥦  㬲ऊ⼯慲杮⁥景琠敨愠潶摩湡散挠汯楬楳湯猠湥潳獲ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䅼潶摩湡散Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽〢⤢਩昉潬瑡匠湥潳割摡畩㭳ऊ⼯癡楯慤据⁥敳獮牯搠物捥楴湯ੳ吉牁慲㱹噆捥潴㹲䄠潶摩湡散敓獮牯㭳ऊ⼯牣慥整⁳桴⁥楤敲瑣潩獮琠慨⁴桴⁥癡楯慤据⁥敳獮牯⁳潰湩ⱴ愠猠桰牥⁥景猠湥潳獲漠⁲⁡楲杮映牯瀠慬慮⁲潭敶敭瑮ऊ潶摩䈠極摬癁楯慤据卥湥潳獲⤨਻瀊扵楬㩣ऊ⼯敧瑴牥⁳‫敳瑴牥ੳ椉汮湩⁥汦慯⁴敇却湥潳割摡畩⡳ ⁻敲畴湲匠湥潳割摡畩㭳素ऊ湩楬敮吠牁慲㱹噆捥潴㹲䜠瑥癁楯慤据卥湥潳獲⤨笠爠瑥牵⁮癁楯慤据卥湥潳獲※੽ऊ⼯佔佄›摡⁤敧瑴牥⁳湡⁤敳瑴牥⁳潦⁲畎卭湥潳獲‬敓獮牯删摡畩ⱳ攠捴ਮऊ⼯䥓啍䅌䥔乏瀊潲整瑣摥਺⼉洯癯ⱥ瀠牥散癩⁥湡⁤瑳敥⁲癥牥⁹潢摩椠⁮汦捯⁫湯琠敨挠污楬杮琠牨慥Ɽ漠汮⁹敲摡⁳桴⁥湩異⁴湳灡桳瑯猠⁯瑩挠湡爠湵漠晦琠敨朠浡⁥桴敲摡ऊ潶摩匠浩汵瑡䙥潬正昨潬瑡䐠汥慴楔敭㬩ऊ⼯楳畭慬楴湯瀠慨敳ⱳ爠湵椠⁮牯敤⁲祢匠浩汵瑡䙥潬正漠⁲獡琠獡獫戠⁹桴⁥汦捯⁫捳敨畤敬⁲挨畨歮瀠慨敳⁳畲⁮湩瀠牡污敬⥬਺⼉䈯来湩楓畭慬楴湯‬湉整牧瑡䍥畨歮‬畂汩卤慰楴污湉敤ⱸ䜠瑡敨乲楥桧潢牵楌瑳桃湵Ⱬ匠楴捴乨楥桧潢牵楌瑳ⱳ匠整牥桃湵Ⱬ䌠浯汰瑥卥浩汵瑡潩੮⼉猯穩⁥数⁲潢摩戠晵敦獲愠摮搠捥摩⁥晩渠楥桧潢牵氠獩獴洠獵⁴敢爠扥極瑬⠠慧敭琠牨慥Ɽ戠晥牯⁥湡⁹慴歳਩瘉楯⁤敂楧卮浩汵瑡潩⡮㬩ऊ⼯潭敶琠敨戠楯獤漠⁦湯⁥档湵⁫湡⁤档捥⁫晩琠敨⁹潭敶⁤潴⁯慦⁲牦浯琠敨物渠楥桧潢牵氠獩⁴湡档牯ੳ瘉楯⁤湉整牧瑡䍥畨歮椨瑮㈳䌠畨歮湉敤ⱸ映潬瑡䐠汥慴楔敭㬩ऊ⼯敲畢汩⁤桴⁥捯牴敥愠摮焠慵瑮穩摥映潬正慭整⁳癥牥⁹档湵⁫敲摡⁳牦浯琠敨洠癯摥戠楯獤ऊ潶摩䈠極摬灓瑡慩䥬摮硥⤨਻⼉猯整牥琠敨戠楯獤漠⁦湯⁥档湵੫瘉楯⁤瑓敥䍲畨歮椨瑮㈳䌠畨歮湉敤ⱸ映潬瑡䐠汥慴楔敭㬩ऊ⼯敭杲⁥敤畢⁧楬敮ⱳ琠汥浥瑥祲愠摮琠浩湩獧漠⁦癥牥⁹档湵੫瘉楯⁤潃灭敬整楓畭慬楴湯⤨਻⼉猯汰瑩映潬正椠瑮⁯瑳敥楲杮挠畨歮⁳景甠⁰潴䌠畨歮楓敺戠楯獤⠠慣汬摥漠⁮桴⁥慧敭琠牨慥⁤敢潦敲琠敨猠浩汵瑡潩⁮瑳牡獴਩瘉楯⁤畂汩卤整牥湩䍧畨歮⡳湩㍴′畎䉭楯獤‬湩㍴′桃湵卫穩⥥਻⼉爯湵琠敨猠整牥湩⁧敫湲汥挠浯楰敬⁤潦⁲桴⁥牦浡❥⁳畲敬猠瑥愠摮戠桥癡潩⁲癯牥愠挠畨歮ऊ潶摩匠整牥汆捯⡫䙆潬正瑓敥楲杮桃湵♫䌠畨歮‬汦慯⁴敄瑬呡浩⥥਻⼉瀯捩⁫敫湲汥映潲⁭桴⁥畲敬猠瑥⁳景愠戠桥癡潩ੲ琉浥汰瑡㱥䙅潬正敂慨楶牯䤠䉮桥癡潩Ⱳ甠湩㍴⸲⸮删汵卥瑥㹳ऊ潶摩䐠獩慰捴卨整牥湩䭧牥敮⡬極瑮㈳删汵卥瑥‬䙆潬正瑓敥楲杮桃湵♫䌠畨歮‬汦慯⁴敄瑬呡浩ⱥ吠湉整敧卲煥敵据㱥極瑮㈳‬畒敬敓獴⸮㸮㬩ऊ⼯楦摮映潬正慭整⁳湡⁤瑳敥⁲癥牥⁹潢摩漠⁦⁡档湵Ⱬ爠汵獥渠瑯椠⁮畒敬⁳牡⁥潣灭汩摥漠瑵ऊ整灭慬整甼湩㍴′畒敬ⱳ䔠汆捯䉫桥癡潩⁲湉敂慨楶牯ਾ瘉楯⁤畒卮整牥湩䭧牥敮⡬䙆潬正瑓敥楲杮桃湵♫䌠畨歮‬汦慯⁴敄瑬呡浩⥥਻⼉愯灰祬戠桥癡潩慲⁬瑳敥楲杮琠⁯潢摩愠摮甠摰瑡⁥瑩⁳敶潬楣祴ऊ⼯瑓敥楲杮敄瑬呡浩⁥獩琠敨琠浩⁥楳据⁥桴⁥潢摩氠獡⁴瑳敥敲Ɽ眠楨档挠湡戠⁥敳敶慲⁬牦浡獥眠敨⁮瑳敥楲杮椠⁳瑳楲敤੤琉浥汰瑡㱥極瑮㈳删汵獥‬䙅潬正敂慨楶牯䤠䉮桥癡潩㹲ऊ潶摩匠整牥潂摩椨瑮㈳䈠楯䥤摮硥‬潣獮⁴䙆潬正慭整楒杮♳䘠潬正慭整ⱳ䘠汆捯卫整牥湩䍧畨歮…桃湵Ⱬ映潬瑡䐠汥慴楔敭‬汦慯⁴瑓敥楲杮敄瑬呡浩⥥਻⼉眯楲整猠浩汵瑡摥琠慲獮潦浲⁳慢正琠⁯潢摩愠瑣牯ੳ瘉楯⁤潃浭瑩潂摩牔湡晳牯獭昨潬瑡䐠汥慴楔敭㬩ਊ⼉猯楫⁰潣浳瑥捩甠摰瑡獥⠠敭桳猠潭瑯楨杮 景戠楯獤眠潨敳洠獥⁨慨湳琧戠敥⁮敲摮牥摥爠捥湥汴ⱹ漠晦猭牣敥⁮牯漠捣畬敤⁤潢摩⁳湯祬朠瑥琠敨物琠慲獮潦浲ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩卼浩汵瑡潩≮਩戉潯⁬卢楫䡰摩敤䍮獯敭楴獣਻⼉猯捥湯獤猠湩散愠戠楯⁤慷⁳慬瑳爠湥敤敲⁤敢潦敲椠⁴潣湵獴愠⁳楨摤湥ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩卼浩汵瑡潩≮‬敭慴㴠⠠汃浡䵰湩㴠∠⸰∰‬摅瑩潃摮瑩潩⁮‽戢歓灩楈摤湥潃浳瑥捩≳⤩ऊ汦慯⁴楖楳楢楬祴潔敬慲据㭥ऊ⼯畮扭牥漠⁦潢摩⁳桷獯⁥潣浳瑥捩甠摰瑡⁥慷⁳歳灩数⁤湩琠敨氠獡⁴潣浭瑩ऊ湩㍴′畎䡭摩敤䉮楯獤਻ऊ⼯敲畴湲猠灥牡瑡潩⁮瑳敥楲杮映牯散搠物捥整⁤潴愠潶摩挠潲摷湩⽧潣汬獩潩⁮楷桴氠捯污映潬正慭整ੳ琉浥汰瑡㱥潢汯戠獕䙥噏ਾ䘉敖瑣牯匉灥牡瑡⡥湩㍴′潂摩湉敤ⱸ吠牁慲噹敩㱷潣獮⁴湩㍴㸲䘠潬正慭整⥳਻⼉爯瑥牵⁮污杩浮湥⁴瑳敥楲杮映牯散搠物捥整⁤潴慷摲⁳桴⁥癡牥条⁥敨摡湩⁧景氠捯污映潬正慭整ੳ琉浥汰瑡㱥潢汯戠獕䙥噏ਾ䘉敖瑣牯䄠楬湧椨瑮㈳䈠楯䥤摮硥‬䅔牲祡楖睥挼湯瑳椠瑮㈳‾汆捯浫瑡獥㬩ऊ⼯敲畴湲挠桯獥潩⁮瑳敥楲杮映牯散搠物捥整⁤潴慷摲琠敨愠敶慲敧瀠獯瑩潩⁮景氠捯污映潬正慭整ੳ琉浥汰瑡㱥潢汯戠獕䙥噏ਾ䘉敖瑣牯䜠潲灵灕椨瑮㈳䈠楯䥤摮硥‬䅔牲祡楖睥挼湯瑳椠瑮㈳‾汆捯浫瑡獥㬩ऊ⼯敲畴湲愠楬湧敭瑮猠整牥湩⁧潦捲⁥牦浯愠杧敲慧整⁤汦捯浫瑡⁥敨摡湩獧ऊ噆捥潴⁲汁杩⡮湩㍴′潂摩湉敤ⱸ挠湯瑳䘠汆捯䅫杧敲慧整…杁牧来瑡⥥਻⼉爯瑥牵⁮潣敨楳湯猠整牥湩⁧潦捲⁥牦浯愠杧敲慧整⁤汦捯浫瑡⁥潰楳楴湯ੳ䘉敖瑣牯䜠潲灵灕椨瑮㈳䈠楯䥤摮硥‬潣獮⁴䙆潬正杁牧来瑡♥䄠杧敲慧整㬩ਊ⼉振敨正⁳晩戠楯⁤獩漠⁮浩業敮瑮挠汯楬楳湯挠畯獲⁥楷桴漠獢慴汣੥戉潯⁬獉扏瑳捡敬桁慥⡤湩㍴′潂摩湉敤ⱸ䘠汆捯卫整牥湩䍧畨歮…桃湵⥫਻⼉爯瑥牵⁮扯瑳捡敬愠潶摩湡散映牯散猠整牥湩⁧潴慷摲⁳桴⁥湵扯瑳畲瑣摥搠物捥楴湯ऊ噆捥潴⁲癁楯佤獢慴汣⡥湩㍴′潂摩湉敤ⱸ䘠汆捯卫整牥湩䍧畨歮…桃湵⥫਻⼉爯瑥牵⁮慲摮浯猠整牥湩⁧潦捲⁥景愠眠湡敤楲杮戠楯Ɽ挠慨杮獥搠物捥楴湯攠敶祲映睥映慲敭ੳ䘉敖瑣牯圠湡敤⡲湩㍴′潂摩湉敤⥸਻⼉爯瑥牵⁮瑳敥楲杮映牯散愠慷⁹牦浯瀠慬敹⁲楶睥⁳楷桴湩映敬⁥慲楤獵ऊ噆捥潴⁲汆敥椨瑮㈳䈠楯䥤摮硥㬩ऊ⼯敲畴湲猠整牥湩⁧潦捲⁥污湯⁧桴⁥慢敫⁤汦睯映敩摬ऊ噆捥潴⁲潆汬睯汆睯楆汥⡤湩㍴′潂摩湉敤ⱸ䘠汆捯卫整牥湩䍧畨歮…桃湵⥫਻ऊ⼯瑳敥楲杮挠畨歮⁳景琠敨映慲敭‬⁡楳杮敬挠畨歮甠汮獥⁳桴⁥汦捯⁫捳敨畤敬⁲瑳敥獲琠敨⁭湩瀠牡污敬੬吉牁慲㱹䙆潬正瑓敥楲杮桃湵㹫匠整牥湩䍧畨歮㭳ਊ⼉港浵敢⁲景映慲敭⁳楳畭慬整Ɽ甠敳⁤潴猠慴杧牥猠牴摩摥猠整牥湩⁧灵慤整ੳ甉湩㍴′楓畭慬楴湯牆浡㭥ऊ⼯潬慣楴湯⁳景瀠慬敹⁲楶睥ⱳ甠敳⁤潦⁲楤瑳湡散戠獡摥猠整牥湩⁧佌੄吉牁慲㱹噆捥潴㹲嘠敩䱷捯瑡潩獮਻ऊ⼯䱆䝉呈䄠䥎䅍䥔乏ऊ⼯楷杮映慬灰湩⁧湡⁤慢歮湩⁧牡⁥汰祡摥戠⁹桴⁥潢摩洠獥❨⁳慭整楲污⠠⹩⹥愠戠歡摥瘠牥整⁸湡浩瑡潩⁮整瑸牵⥥映潲⁭数⵲潢摩挠獵潴⁭牰浩瑩癩⁥慤慴ਬ⼉琯敨猠浩汵瑡潩⁮湯祬愠癤湡散⁳慥档戠楯❤⁳楷杮戠慥⁴桰獡⁥湡⁤慢歮愠杮敬猠⁯汦捯獫愠楮慭整眠瑩潨瑵猠敫敬慴⁬敭桳獥漠⁲湡浩瑡潩⁮汢敵牰湩獴瀊潲整瑣摥਺⼉眯楲整映楬桧⁴湡浩瑡潩⁮慤慴琠⁯楶楳汢⁥潢摩洠獥敨ⱳ琠敨物洠瑡牥慩⁬慨⁳潴爠慥⁤瑩琠⁯湡浩瑡੥唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤湁浩瑡潩≮਩戉潯⁬䅢楮慭整汆杩瑨਻⼉是物瑳挠獵潴⁭牰浩瑩癩⁥慤慴椠摮硥眠楲瑴湥‬桴⁥慭整楲污爠慥獤映慬⁰桰獡⁥瑡琠浩⁥‰湡⁤汦灡爠瑡⁥椨獴瀠慨敳椠⁳牦捡瀨慨敳⬠爠瑡⁥‪楔敭⤩ਬ⼉是慬⁰晥潦瑲⠠‰‽汧摩湩Ⱨㄠ㴠映汵⁬汦灡 湡⁤慢歮愠杮敬⠠慲楤湡⥳映潲⁭瑩ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䅼楮慭楴湯Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽〢Ⱒ䔠楤䍴湯楤楴湯㴠∠䅢楮慭整汆杩瑨⤢਩椉瑮㈳䘠楬桧䑴瑡䥡摮硥਻⼉氯牡敧瑳攠牲牯椠⁮汦灡瀠慨敳⠠祣汣獥Ⱙ映慬⁰晥潦瑲愠摮戠湡⁫湡汧⁥爨摡慩獮 桴⁥慭整楲污挠湡搠楲瑦戠⁹敢潦敲愠戠楯❤⁳慤慴椠⁳敲牷瑩整Ɱऊ⼯癥牥⁹牷瑩⁥慭歲⁳桴⁥敭桳猧爠湥敤⁲瑳瑡⁥楤瑲⁹潳氠牡敧⁲潴敬慲据獥猠癡⁥敲摮牥琠牨慥⁤潷歲ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䅼楮慭楴湯Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽〢〮Ⱒ䌠慬灭慍⁸‽〢㔮Ⱒ䔠楤䍴湯楤楴湯㴠∠䅢楮慭整汆杩瑨⤢਩昉潬瑡䘠楬桧䑴瑡呡汯牥湡散਻⼉眯湩⁧敢瑡⁳数⁲敳潣摮漠⁦汧摩湩⁧昨獡ⱴ猠潬楷杮搠睯⁮牯搠癩湩⥧愠摮漠⁦瑳畲杧楬杮戠楯獤⠠汳睯‬灳敥楤杮甠⁰牯挠楬扭湩⥧ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䅼楮慭楴湯Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽〢〮Ⱒ䔠楤䍴湯楤楴湯㴠∠䅢楮慭整汆杩瑨⤢਩昉潬瑡䴠湩汆灡慒整਻唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤湁浩瑡潩≮‬敭慴㴠⠠汃浡䵰湩㴠∠⸰∰‬摅瑩潃摮瑩潩⁮‽戢湁浩瑡䙥楬桧≴⤩ऊ汦慯⁴慍䙸慬剰瑡㭥ऊ⼯慬杲獥⁴慢歮愠杮敬椠⁮敤牧敥ⱳ戠楯獤戠湡⁫湩潴琠牵獮氠歩⁥⁡潣牯楤慮整⁤畴湲⠠慴⁮慢歮㴠猠数摥⨠琠牵⁮慲整⼠朠慲楶祴਩唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤湁浩瑡潩≮‬敭慴㴠⠠汃浡䵰湩㴠∠⸰∰‬汃浡䵰硡㴠∠㤸〮Ⱒ䔠楤䍴湯楤楴湯㴠∠䅢楮慭整汆杩瑨⤢਩昉潬瑡䴠硡慂歮湁汧㭥ਊ⼉是楬桧⁴湡浩瑡潩⁮敳瑴湩獧琠敨猠浩汵瑡潩⁮畲獮眠瑩⁨桴獩映慲敭ऊ潢汯戠楓䅭楮慭整汆杩瑨਻昉潬瑡匠浩楍䙮慬剰瑡㭥ऊ汦慯⁴楓䵭硡汆灡慒整਻昉潬瑡匠浩慍䉸湡䅫杮敬਻⼉猯数摥爠湡敧映楬桧⁴晥潦瑲椠⁳敭獡牵摥愠慧湩瑳‬敫瑰愠慰瑲映潲⁭桴⁥瑳敥楲杮猠数摥爠湡敧愠⁳汣敩瑮⁳潤❮⁴瑳敥ੲ昉潬瑡匠浩汆杩瑨楍卮数摥਻昉潬瑡匠浩汆杩瑨慍卸数摥਻⼉戯楯⁤灳敥獤愠⁴桴⁥瑳牡⁴景琠敨映慲敭‬湩敤⁸慭捴敨⁳汦捯⁫瑳瑡੥吉牁慲㱹汦慯㹴䈠楯卤数摥㭳ਊ⼉振灯⁹汦杩瑨愠楮慭楴湯猠瑥楴杮⁳敲摡戠⁹桴⁥楳畭慬楴湯⠠慧敭琠牨慥⥤ऊ潶摩䌠灡畴敲汆杩瑨湁浩瑡潩⡮㬩ऊ⼯摡慶据⁥楷杮戠慥⁴湡⁤慢歮漠⁦⁡潢摩映潲⁭瑩⁳档湡敧椠⁮敶潬楣祴漠敶⁲桃湡敧敄瑬呡浩⁥琨敨琠浩⁥楳据⁥瑩氠獡⁴瑳敥敲⥤ऊ潶摩䄠楮慭整汆杩瑨椨瑮㈳䈠楯䥤摮硥‬汦慯⁴敄瑬呡浩ⱥ映潬瑡䌠慨杮䑥汥慴楔敭㬩ਊ異汢捩਺唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩䅼楮慭楴湯⤢ऊ湩楬敮戠潯⁬獉汆杩瑨湁浩瑡摥⤨笠爠瑥牵⁮䅢楮慭整汆杩瑨※㭽ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤湁浩瑡潩≮਩瘉楯⁤敓䙴楬桧䅴楮慭整⡤潢汯戠湅扡敬⥤਻ऊ⼯則問卐ऊ⼯桴⁥汦捯⁫獩猠汰瑩椠瑮⁯牧畯獰漠⁦潢摩⁳楬歮摥琠牨畯桧映潬正慭整⁳楷桴湩愠氠湩⁫慲楤獵⠠敳⁥䙆潬正片畯獰Ⱙ猠⁯佌ⱄ挠浡牥⁡牦浡湩੧⼉愯摮愠慮祬楴獣挠湡眠牯⁫楷桴攠捡⁨牧畯⁰獡愠眠潨敬‮牧畯獰愠敲琠慲正摥戠⁹桴⁥楳畭慬楴湯⠠潮⁴湯渠瑥潷歲挠楬湥獴 湡⁤異汢獩敨⁤楷桴琠敨映潬正瘠敩੷牰瑯捥整㩤ऊ⼯牴捡⁫牧畯獰琠敨映潬正猠汰瑩⁳湩潴ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䝼潲灵≳਩戉潯⁬呢慲正片畯獰਻⼉搯獩慴据⁥楬歮湩⁧睴⁯潢摩⁳湩潴琠敨猠浡⁥牧畯⁰〨㴠戠楯⁤数捲灥楴湯爠摡畩⥳ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䝼潲灵≳‬敭慴㴠⠠汃浡䵰湩㴠∠⸰∰‬摅瑩潃摮瑩潩⁮‽戢牔捡䝫潲灵≳⤩ऊ汦慯⁴片畯䱰湩剫摡畩㭳ऊ⼯牦浡獥戠瑥敷湥朠潲灵爠扥極摬ⱳ朠潲灵⁳敭杲⁥癥牥⁹牦浡⁥畢⁴牡⁥湯祬猠汰瑩戠⁹⁡敲畢汩Ɽ猠⁯⁡灳楬⁴獩猠敥⁮灵琠⁯桴獩洠湡⁹牦浡獥氠瑡੥唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤片畯獰Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽ㄢⰢ䔠楤䍴湯楤楴湯㴠∠呢慲正片畯獰⤢਩椉瑮㈳䜠潲灵敒畢汩䥤瑮牥慶㭬ਊ⼉术潲灵琠慲正湩⁧敳瑴湩獧琠敨猠浩汵瑡潩⁮畲獮眠瑩⁨桴獩映慲敭ऊ潢汯戠楓呭慲正片畯獰਻昉潬瑡匠浩片畯䱰湩剫摡畩㭳ऊ湩㍴′楓䝭潲灵敒畢汩䥤瑮牥慶㭬ऊ⼯牧畯獰漠⁦桴⁥汦捯Ⱬ漠汮⁹潴捵敨⁤祢琠敨猠浩汵瑡潩⁮湡⁤祢瀠扵楬桳湩⁧桴⁥汦捯⁫楶睥ऊ䙆潬正片畯獰䘠潬正片畯獰਻ऊ⼯潣祰朠潲灵琠慲正湩⁧敳瑴湩獧爠慥⁤祢琠敨猠浩汵瑡潩⁮木浡⁥桴敲摡਩瘉楯⁤慃瑰牵䝥潲灵牔捡楫杮⤨਻⼉爯扥極摬朠潲灵⁳桷湥搠敵愠摮爠晥敲桳朠潲灵愠杧敲慧整⁳攨摮漠⁦楳畭慬楴湯਩瘉楯⁤灕慤整片畯獰⤨਻瀊扵楬㩣ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤片畯獰⤢ऊ湩楬敮戠潯⁬獉牔捡楫杮片畯獰⤨笠爠瑥牵⁮呢慲正片畯獰※㭽ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤片畯獰⤢ऊ潶摩匠瑥牔捡䝫潲灵⡳潢汯戠湅扡敬⥤਻⼉术瑥朠潲灵⁳景琠敨氠瑡獥⁴楶睥ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤片畯獰⤢ऊ䅔牲祡䘼汆捯䝫潲灵‾敇䙴潬正片畯獰⤨挠湯瑳਻⼉术瑥氠牡敧瑳朠潲灵漠⁦桴⁥慬整瑳瘠敩ⱷ爠瑥牵獮映污敳椠⁦桴牥⁥牡⁥潮朠潲灵ੳ唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩䝼潲灵≳਩戉潯⁬敇䱴牡敧瑳汆捯䝫潲灵䘨汆捯䝫潲灵…畏䝴潲灵 潣獮㭴ऊ⼯敧⁴摩漠⁦桴⁥牧畯⁰⁡潢摩戠汥湯獧琠⁯湩琠敨氠瑡獥⁴楶睥⠠义䕄彘低䕎椠⁦桴⁥潢摩椠湳琧朠潲灵摥礠瑥਩唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩䝼潲灵≳਩椉瑮㈳䜠瑥潂摩片畯䥰⡤湩㍴′慈摮敬 潣獮㭴ਊ⼉䄯奓䍎匠䵉䱕呁佉੎牰瑯捥整㩤ऊ⼯楳畭慬整映潬正愠⁳⁡慴歳朠慲桰樠扯欠捩敫⁤牦浯琠敨洠湡条牥猧琠捩⁫瀨敲瀠票楳獣 湡⁤潪湩摥戠⁹桴⁥潣浭瑩琠捩Ⱬ漠敶汲灡楰杮漠桴牥朠浡⁥桴敲摡眠牯੫唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤楓畭慬楴湯⤢ऊ潢汯戠獁湹卣浩汵瑡潩㭮ऊ⼯楴正朠潲灵琠敨愠祳据牨湯畯⁳楳畭慬楴湯椠⁳潪湩摥愠摮戠楯⁤牴湡晳牯獭愠敲挠浯業瑴摥椠Ɱ氠瑡牥朠潲灵⁳敬癡⁥潭敲琠浩⁥潴漠敶汲灡ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩卼浩汵瑡潩≮‬敭慴㴠⠠摅瑩潃摮瑩潩⁮‽戢獁湹卣浩汵瑡潩≮⤩ऊ䕔畮䅭䉳瑹㱥呅捩楫杮片畯㹰匠浩汵瑡潩䩮楯呮捩䝫潲灵਻⼉猯汰瑩愠祳据牨湯畯⁳楳畭慬楴湯椠瑮⁯楦敮朠慲湩摥琠獡獫猠档摥汵摥眠瑩⁨癥牥⁹瑯敨⁲汦捯⁫湩琠敨眠牯摬漠⁮桴⁥桳牡摥眠牯敫⁲潰汯ਬ⼉猯⁯⁡慬杲⁥汦捯⁫瑳敥獲漠⁮癥牥⁹潷歲牥椠獮整摡漠⁦湯⁥猨敥唠汆捯卫档摥汵牥畓獢獹整⥭ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩卼浩汵瑡潩≮‬敭慴㴠⠠摅瑩潃摮瑩潩⁮‽戢獁湹卣浩汵瑡潩≮⤩ऊ潢汯戠獕卥慨敲卤档摥汵牥਻⼉氯杯猠浩汵瑡潩Ɱ漠敶汲灡愠摮樠楯⁮慷瑩琠浩獥攠敶祲映睥猠捥湯獤ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩卼浩汵瑡潩≮਩戉潯⁬䱢杯楓畭慬楴湯瑓瑡㭳ਊ⼉琯捩⁫畦据楴湯樠楯楮杮琠敨猠浩汵瑡潩⁮湡⁤潣浭瑩楴杮戠楯⁤牴湡晳牯獭ऊ䙆潬正潃浭瑩楔正畆据楴湯䌠浯業呴捩㭫ऊ⼯楴正映湵瑣潩⁮潪湩湩⁧⁡楳畭慬楴湯琠慨⁴畲獮愠潶摩湡散琠慲散⁳敢潦敲琠敨瀠票楳獣猠散敮猠慴瑲⁳灵慤楴杮⠠䝔卟慴瑲桐獹捩⥳ਬ⼉猯散敮焠敵楲獥映潲⁭慴歳琠牨慥獤愠敲❮⁴慳敦眠楨敬瀠票楳獣爠湵⁳潳猠捵⁨⁡楳畭慬楴湯漠汮⁹癯牥慬獰琠敨爠獥⁴景吠彇牐健票楳獣ऊ䙆潬正潃浭瑩楔正畆据楴湯倠票楳獣潊湩楔正਻⼉猯浩汵瑡潩⁮慴歳椠⁮汦杩瑨⠠畮汬眠敨⁮楳畭慬楴杮漠⁮桴⁥慧敭琠牨慥⥤ऊ䝆慲桰癅湥剴晥匠浩汵瑡潩呮獡㭫ऊ⼯牴敵映潲⁭楫正湩⁧桴⁥楳畭慬楴湯甠瑮汩椠獴爠獥汵獴愠敲挠浯業瑴摥ऊ潢汯戠楓畭慬楴湯敐摮湩㭧ऊ潢汯戠敐摮湩䅧祳据਻昉潬瑡倠湥楤杮敄瑬呡浩㭥ऊ⼯牴敵椠⁦桴⁥数摮湩⁧楳畭慬楴湯琠慲散⁳潦⁲扯瑳捡敬ⱳ愠摮琠浩⁥桴⁥慧敭琠牨慥⁤慷瑩摥映牯椠⁴敢潦敲瀠票楳獣ऊ潢汯戠敐摮湩呧慲散㭳ऊ汦慯⁴桐獹捩䩳楯坮楡䵴㭳ਊ⼉樯楯⁮⁡数摮湩⁧楳畭慬楴湯琠慨⁴牴捡獥‬慣汬摥戠晥牯⁥桰獹捩⁳瑳牡獴ऊ潶摩䨠楯䉮晥牯健票楳獣⤨਻ऊ⼯湩異獴琠敨猠浩汵瑡潩⁮敲摡ⱳ挠灯敩⁤湯琠敨朠浡⁥桴敲摡戠晥牯⁥瑩猠慴瑲⁳潳琠敨⁹慣⁮敫灥挠慨杮湩⁧桷汩⁥瑩爠湵ੳ䘉汆捯卫慮獰潨側牡浡瑥牥⁳楓偭牡浡瑥牥㭳ऊ䙆潬正畑污瑩䱹癥汥匠浩畑污瑩㭹ऊ⼯癡楯慤据⁥敳獮牯⁳牴捡摥愠⁴桴⁥捡楴敶焠慵楬祴氠癥汥‬牦湯⵴潭瑳映物瑳ऊ䅔牲祡䘼敖瑣牯‾楓䅭潶摩湡散敓獮牯㭳ऊ汦慯⁴楓卭湥潳割摡畩㭳ऊ潢汯戠楓䅭杧敲慧整敐捲灥楴湯਻昉潬瑡匠浩杁牧来瑡健牥散瑰潩剮摡畩㭳ऊ汦慯⁴楓佭数楮杮湁汧㭥ऊ䅔牲祡䘼敖瑣牯‾慔杲瑥潆捲獥਻吉牁慲㱹噆捥潴㹲吠牡敧䥴灭汵敳㭳ਊ⼉琯浩⁥桴⁥慬瑳猠浩汵瑡潩⁮潴歯猠浵敭⁤癯牥琠敨琠牨慥獤琠慨⁴慲⁮瑩‬湡⁤楴敭映潲⁭瑩⁳瑳牡⁴湵楴⁬瑩眠獡搠湯੥昉潬瑡䰠獡却浩楔敭獍਻昉潬瑡䰠獡却浩灓湡獍਻⼉猯慴瑲漠⁦桴⁥慬瑳猠浩汵瑡潩⁮湡⁤楴敭椠獴猠牥慩⁬桰獡獥琠潯⁫挨畨歮瀠慨敳⁳牡⁥楴敭⁤数⁲档湵⥫ऊ潤扵敬匠浩瑓牡呴浩㭥ऊ汦慯⁴牐灥牡䵥㭳ऊ⼯浳潯桴摥琠浩⁥桴⁥楳畭慬楴湯爠湡愠潬杮楳敤漠桴牥朠浡⁥桴敲摡眠牯Ⱬ愠摮琠浩⁥桴⁥慧敭琠牨慥⁤慷瑩摥映牯椠⁴瑡琠敨樠楯੮昉潬瑡匠浩癏牥慬䵰㭳ऊ汦慯⁴潊湩慗瑩獍਻昉潬瑡匠浩汵瑡潩卮慴獴楔敭਻ऊ⼯潳瑲映潬正‬湳灡桳瑯椠灮瑵⁳湡⁤瑳牡⁴楳畭慬楴杮漠⁮桴⁥慧敭琠牨慥⁤牯愠⁳⁡慴歳ऊ潶摩匠慴瑲楓畭慬楴湯昨潬瑡䐠汥慴楔敭㬩ऊ⼯汢捯⁫湵楴⁬楳畭慬楴湯琠獡⁫獩搠湯ⱥ挠污敬⁤敢潦敲挠慨杮湩⁧瑳瑡⁥瑩爠慥獤ऊ潶摩圠楡䙴牯楓畭慬楴湯⤨਻ऊ⼯汦捯⁫捳敨畤敬⁲畲獮琠敨猠浩汵瑡潩⁮桰獡獥愠⁳慴歳ੳ昉楲湥⁤汣獡⁳䙕潬正捓敨畤敬卲扵祳瑳浥਻⼉瀯牡浡瑥牥猠敷灥⁳敳⁴灵愠摮猠整⁰敨摡敬獳映潬正⁳楤敲瑣祬ऊ牦敩摮挠慬獳唠汆捯卫敷灥潃浭湡汤瑥਻瀊扵楬㩣ऊ⼯潪湩猠浩汵瑡潩Ɱ挠浯業⁴潢摩琠慲獮潦浲⁳湡⁤敳摮映潬正琠⁯汣敩瑮⁳挨污敬⁤祢挠浯業⁴楴正‬潤獥渠瑯楨杮椠⁦潮桴湩⁧獩瀠湥楤杮਩瘉楯⁤楆楮桳楓畭慬楴湯⤨਻ऊ⼯敧瑴牥ੳ唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩卼浩汵瑡潩≮਩椉汮湩⁥潢汯䤠䅳祳据楓畭慬楴湯湅扡敬⡤ ⁻敲畴湲戠獁湹卣浩汵瑡潩㭮素਻唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩卼浩汵瑡潩≮਩椉汮湩⁥潢汯䤠啳楳杮桓牡摥捓敨畤敬⡲ ⁻敲畴湲戠獕卥慨敲卤档摥汵牥※㭽ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤楓畭慬楴湯⤢ऊ湩楬敮映潬瑡䜠瑥楓佭敶汲灡獍⤨笠爠瑥牵⁮楓佭敶汲灡獍※㭽ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤楓畭慬楴湯⤢ऊ湩楬敮映潬瑡䜠瑥潊湩慗瑩獍⤨笠爠瑥牵⁮潊湩慗瑩獍※㭽ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤楓畭慬楴湯⤢ऊ湩楬敮椠瑮㈳䜠瑥畎䡭摩敤䉮楯獤⤨笠爠瑥牵⁮畎䡭摩敤䉮楯獤※㭽ਊ⼉䐯䉅䝕嘠卉䅕䥌䅚䥔乏ऊ⼯湥扡敬⁤楷桴挠湯潳敬瘠牡慩汢⁥潂摩⹳敄畢Ⱨ猠浡汰摥戠楯獤愠敲搠慲湷琠牨畯桧琠敨眠牯摬猧氠湩⁥慢捴敨⁲湩漠敮猠扵業獳潩⁮数⁲牦浡੥牰瑯捥整㩤ऊ⼯牴敵椠⁦桴⁥楳畭慬楴湯爠捥牯獤搠扥杵氠湩獥琠楨⁳牦浡ⱥ愠摮琠敨瘠獩慵楬慺楴湯映慬獧椠⁴敲潣摲ੳ戉潯⁬䑢扥杵慃瑰牵㭥ऊ湩㍴′敄畢䙧慬獧਻⼉戯楯獤搠慲湷琠楨⁳牦浡ⱥ椠摮硥洠瑡档獥映潬正猠慴整⠠敳⁴敢潦敲琠敨猠浩汵瑡潩⁮瑳牡獴਩吉楂䅴牲祡㸼䐠扥杵慓灭敬㭤ऊ⼯癡楯慤据⁥慲獹愠摮渠楥桧潢牵氠湩獫漠⁦慳灭敬⁤潢摩⁳敲潣摲摥戠⁹桴⁥楳畭慬楴湯ऊ䅔牲祡䘼汆捯䑫扥杵楌敮‾敄畢䱧湩獥਻ऊ⼯档潯敳戠楯獤琠⁯牤睡映潲⁭癥牥⁹瑎⁨潢摩漠⁲桴⁥潢摩⁳湵敤⁲桴⁥畣獲牯ऊ潶摩匠浡汰䑥扥杵潂摩⡳㬩ऊ⼯牤睡爠捥牯敤⁤楬敮⁳湡⁤桴⁥慳灭敬⁤潢摩❳瀠牥散瑰潩Ɱ瘠汥捯瑩⁹湡⁤捯牴敥挠汥獬ऊ潶摩䐠慲䙷潬正敄畢⡧㬩ਊ⼉振敨正椠⁦楳畭慬楴湯爠捥牯獤搠扥杵映慬⁧潦⁲潢摩ऊ但䍒䥅䱎义⁅潢汯匠潨汵䍤灡畴敲敄畢⡧湩㍴′潂摩湉敤ⱸ椠瑮㈳䘠慬⥧挠湯瑳笠爠瑥牵⁮䑢扥杵慃瑰牵⁥☦⠠敄畢䙧慬獧☠䘠慬⥧℠‽‰☦䐠扥杵慓灭敬孤潂摩湉敤嵸※੽ऊ⼯䕔䕌䕍剔ਖ਼牰瑯捥整㩤ऊ⼯敲潣摲渠楥桧潢牵挠畯瑮ⱳ愠潶摩湡散猠敷灥ⱳ猠浩汵瑡潩⁮楴敭愠摮映潬正搠湥楳祴ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩呼汥浥瑥祲⤢ऊ潢汯戠敒潣摲敔敬敭牴㭹ऊ⼯敳潣摮⁳敢睴敥⁮整敬敭牴⁹慳灭敬ੳ唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤敔敬敭牴≹‬敭慴㴠⠠汃浡䵰湩㴠∠⸰∱‬摅瑩潃摮瑩潩⁮‽戢敒潣摲敔敬敭牴≹⤩ऊ汦慯⁴敔敬敭牴卹浡汰䥥瑮牥慶㭬ऊ⼯楳敺漠⁦敤獮瑩⁹牧摩挠汥獬ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩呼汥浥瑥祲Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽ㄢ〰〮Ⱒ䔠楤䍴湯楤楴湯㴠∠剢捥牯呤汥浥瑥祲⤢਩昉潬瑡吠汥浥瑥祲敃汬楓敺਻⼉猯捥湯獤戠瑥敷湥攠灸牯獴琠⁯慓敶⽤汆捯呫汥浥瑥祲‬污潳攠灸牯整⁤桷湥瀠慬⁹湥獤⠠‰‽湯祬眠敨⁮硥潰瑲摥洠湡慵汬⥹ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩呼汥浥瑥祲Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽〢〮Ⱒ䔠楤䍴湯楤楴湯㴠∠剢捥牯呤汥浥瑥祲⤢਩昉潬瑡吠汥浥瑥祲硅潰瑲湉整癲污਻唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤敔敬敭牴≹‬敭慴㴠⠠摅瑩潃摮瑩潩⁮‽戢敒潣摲敔敬敭牴≹⤩ऊ䙅潬正敔敬敭牴䙹牯慭⁴敔敬敭牴䙹牯慭㭴ऊ⼯牤睡搠湥楳祴朠楲⁤獡愠⁮湩眭牯摬栠慥浴灡⠠汢敵㴠猠慰獲ⱥ爠摥㴠洠獯⁴牣睯敤⁤散汬਩唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤敔敬敭牴≹‬敭慴㴠⠠摅瑩潃摮瑩潩⁮‽戢敒潣摲敔敬敭牴≹⤩ऊ潢汯戠桓睯敄獮瑩䡹慥浴灡਻ऊ䙆潬正敔敬敭牴⁹敔敬敭牴㭹ऊ⼯牴敵椠⁦桴⁥楳畭慬楴湯爠捥牯獤琠汥浥瑥祲琠楨⁳牦浡੥戉潯⁬呢汥浥瑥祲慃瑰牵㭥ऊ⼯楴敭猠湩散氠獡⁴整敬敭牴⁹慳灭敬愠摮攠灸牯ੴ昉潬瑡吠汥浥瑥祲慓灭敬楔敭਻昉潬瑡吠汥浥瑥祲硅潰瑲楔敭਻ऊ⼯敲潣摲映湩獩敨⁤牦浡ⱥ琠歡⁥慳灭敬⁳湡⁤硥潰瑲琠敨⁭桷湥搠敵ऊ潶摩唠摰瑡呥汥浥瑥祲昨潬瑡䐠汥慴楔敭㬩ऊ⼯牤睡搠湥楳祴朠楲⁤散汬⁳桴潲杵⁨桴⁥楬敮戠瑡档牥ऊ潶摩䐠慲䑷湥楳祴效瑡慭⡰㬩ऊ⼯敧⁴畦汬瀠瑡⁨景琠汥浥瑥祲映汩੥䘉瑓楲杮䜠瑥敔敬敭牴䙹汩健瑡⡨ 潣獮㭴ਊ異汢捩਺⼉眯楲整爠捥牯敤⁤整敬敭牴⁹慳灭敬⁳潴匠癡摥䘯潬正敔敬敭牴੹唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃汬湉摅瑩牯‬慃整潧祲㴠∠潂摩呼汥浥瑥祲⤢ऊ潶摩䔠灸牯䙴潬正敔敬敭牴⡹㬩ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤敔敬敭牴≹਩瘉楯⁤敓呴汥浥瑥祲湅扡敬⡤潢汯戠湅扡敬⥤਻ऊ⼯䱆坏䘠䕉䑌瀊潲整瑣摥਺⼉猯整牥戠楯獤愠潬杮愠映潬⁷楦汥⁤慢敫⁤牡畯摮漠獢慴汣獥琠睯牡獤琠敨映潬⁷楦汥⁤潧污⠠⹩⹥洠杩慲楴湯映潲⁭⁡潶畬敭猠慰湷牥琠⁯⁡潶畬敭搠獥慰湷牥਩唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤汆睯楆汥≤਩戉潯⁬啢敳汆睯楆汥㭤ऊ⼯捡潴⁲潢摩⁳牡⁥潲瑵摥琠Ɐ甠畳污祬愠瘠汯浵⁥敤灳睡敮⁲牯琠牡敧⁴扯敪瑣ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䙼潬䙷敩摬Ⱒ洠瑥⁡‽䔨楤䍴湯楤楴湯㴠∠啢敳汆睯楆汥≤⤩ऊ䅁瑣牯‪汆睯楆汥䝤慯㭬ऊ⼯慨晬猠穩⁥景琠敨爠来潩⁮牡畯摮琠敨映潬正洠湡条牥挠癯牥摥戠⁹桴⁥汦睯映敩摬ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䙼潬䙷敩摬Ⱒ洠瑥⁡‽䔨楤䍴湯楤楴湯㴠∠啢敳汆睯楆汥≤⤩ऊ噆捥潴⁲汆睯楆汥䕤瑸湥㭴ऊ⼯楳敺漠⁦汦睯映敩摬挠汥獬‬湩牣慥敳⁤晩琠敨爠来潩⁮潷汵⁤敮摥琠潯洠湡⁹散汬ੳ唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤汆睯楆汥≤‬敭慴㴠⠠汃浡䵰湩㴠∠〵〮Ⱒ䔠楤䍴湯楤楴湯㴠∠啢敳汆睯楆汥≤⤩ऊ汦慯⁴汆睯楆汥䍤汥卬穩㭥ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䙼潬䙷敩摬Ⱒ洠瑥⁡‽䔨楤䍴湯楤楴湯㴠∠啢敳汆睯楆汥≤⤩ऊ汦慯⁴汆睯楆汥卤牴湥瑧㭨ਊ䘉汆捯䙫潬䙷敩摬䘠潬䙷敩摬਻⼉是潬⁷楦汥⁤瑳敲杮桴琠敨猠浩汵瑡潩⁮畲獮眠瑩⁨桴獩映慲敭⠠‰桷汩⁥潮映敩摬椠⁳慢敫⥤ऊ汦慯⁴楓䙭潬䙷敩摬瑓敲杮桴਻瀊扵楬㩣ऊ⼯慢敫映潬⁷楦汥⁤潴慷摲⁳桴⁥汦睯映敩摬朠慯ⱬ挠污⁬条楡⁮晡整⁲桴⁥潧污漠⁲扯瑳捡敬⁳潭敶ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤汆睯楆汥≤਩瘉楯⁤慂敫汆睯楆汥⡤㬩ऊ⼯档湡敧映潬⁷楦汥⁤潧污愠摮爠扥歡⁥桴⁥汦睯映敩摬ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤汆睯楆汥≤਩瘉楯⁤敓䙴潬䙷敩摬潇污䄨捁潴⩲丠睥汆睯楆汥䝤慯⥬਻唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩䙼潬䙷敩摬⤢ऊ湩楬敮䄠捁潴⩲䜠瑥汆睯楆汥䝤慯⡬ ⁻敲畴湲䘠潬䙷敩摬潇污※㭽ਊ⼉䌯䅏卒⁅䥓啍䅌䥔乏瀊潲整瑣摥਺⼉是潬正椠⁳楳畭慬整⁤潣牡敳祬眠楨敬琠楨⁳瑳敲浡湩⁧敬敶⁬獩❮⁴楶楳汢⁥丨湯⁥‽潮⁴楴摥琠⁯⁡瑳敲浡湩⁧敬敶⥬ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䍼慯獲≥਩䘉慎敭匠牴慥業杮敌敶乬浡㭥ऊ⼯汦捯⁫獩猠浩汵瑡摥挠慯獲汥⁹桷汩⁥癥牥⁹汰祡牥瘠敩⁷獩映牵桴牥琠慨⁮桴獩映潲⁭瑩⠠‰‽敮敶⥲ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䍼慯獲≥‬敭慴㴠⠠汃浡䵰湩㴠∠⸰∰⤩ऊ汦慯⁴潃牡敳楄瑳湡散਻⼉猯捥湯獤戠瑥敷湥挠慯獲⁥楳畭慬楴湯猠整獰ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䍼慯獲≥‬敭慴㴠⠠汃浡䵰湩㴠∠⸰∰⤩ऊ汦慯⁴潃牡敳灕慤整湉整癲污਻⼉港浵敢⁲景挠畬瑳牥⁳桴⁥汦捯⁫獩爠摥捵摥琠੯唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤潃牡敳Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽ㄢ⤢਩椉瑮㈳䴠硡潃牡敳汃獵整獲਻⼉振慯獲⁥汣獵整獲猠整牥戠捡⁫潴慷摲琠敨映潬正洠湡条牥漠据⁥畦瑲敨⁲桴湡琠楨⁳〨㴠挠畬瑳牥⁳潲浡映敲汥⥹ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䍼慯獲≥‬敭慴㴠⠠汃浡䵰湩㴠∠⸰∰⤩ऊ汦慯⁴潃牡敳潈敭慒楤獵਻ऊ⼯汣獵整獲漠⁦潣牡敳祬猠浩汵瑡摥映潬正‬浥瑰⁹桷汩⁥潢摩⁳牡⁥楳畭慬整⁤湩楤楶畤污祬ऊ偕佒䕐呒⡙楖楳汢䥥獮慴据佥汮ⱹ䌠瑡来牯⁹‽䈢楯籤潃牡敳⤢ऊ䅔牲祡䘼汆捯䍫慯獲䍥畬瑳牥‾潃牡敳汃獵整獲਻戉潯⁬䥢䍳慯獲㭥ऊ湩㍴′畎䍭慯獲䉥楯獤਻⼉琯浩⁥楳据⁥慬瑳挠慯獲⁥瑳灥愠摮渠浵敢⁲景猠整獰琠歡湥⠠敳摥⁳敲票牤瑡潩⥮ऊ汦慯⁴潃牡敳瑓灥楔敭਻椉瑮㈳䌠慯獲卥整獰਻ऊ⼯睳瑩档戠瑥敷湥挠慯獲⁥湡⁤湩楤楶畤污猠浩汵瑡潩⁮桷湥渠敥敤⁤湡⁤瑳灥挠慯獲⁥汦捯Ⱬ爠瑥牵獮琠畲⁥桷汩⁥潣牡敳ऊ潢汯唠摰瑡䍥慯獲卥浩汵瑡潩⡮汦慯⁴敄瑬呡浩⥥਻⼉振敨正椠⁦汦捯❫⁳瑳敲浡湩⁧敬敶⁬獩栠摩敤⁮牯映潬正椠⁳慦⁲牦浯攠敶祲瀠慬敹⁲楶睥ऊ潢汯匠潨汵卤浩汵瑡䍥慯獲⡥㬩ऊ⼯敲畤散映潬正琠⁯汣獵整獲愠摮搠獥牴祯椠獴戠楯獤ऊ潶摩䔠瑮牥潃牡敳楓畭慬楴湯⤨਻⼉猯慰湷戠楯獤映潲⁭汣獵整獲ऊ潶摩䔠楸䍴慯獲卥浩汵瑡潩⡮㬩ऊ⼯潭敶挠畬瑳牥⁳污湯⁧桴楥⁲敶潬楣祴‬污杩楮杮愠摮朠潲灵湩⁧楷桴攠捡⁨瑯敨ੲ瘉楯⁤瑓灥潃牡敳汆捯⡫汦慯⁴瑓灥楔敭㬩ऊ⼯摡⁤潢摩猠慰湷摥眠楨敬挠慯獲⁥潴椠獴渠慥敲瑳挠畬瑳牥ऊ潶摩䄠摤潃牡敳潂摩吨畓换慬獳晏䄼潂摩‾潂摩祔数‬潣獮⁴呆慲獮潦浲…灓睡呮慲獮潦浲㬩ਊ異汢捩਺唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩䍼慯獲≥਩椉汮湩⁥潢汯䤠䍳慯獲⡥ ⁻敲畴湲戠獉潃牡敳※㭽ਊ⼉䘯䅒䕍䈠䑕䕇⁔佇䕖乒剏瀊潲整瑣摥਺⼉愯瑵浯瑡捩污祬氠睯牥漠⁲慲獩⁥楳畭慬楴湯焠慵楬祴琠⁯敫灥映潬正猠浩汵瑡潩⁮楴敭渠慥⁲慔杲瑥楓呭浩䵥ੳ唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤潇敶湲牯⤢ऊ潢汯戠湅扡敬潇敶湲牯਻⼉琯牡敧⁴汦捯⁫楳畭慬楴湯琠浩⁥数⁲牦浡⁥湩洠汩楬敳潣摮ੳ唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤潇敶湲牯Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽〢ㄮⰢ䔠楤䍴湯楤楴湯㴠∠䕢慮汢䝥癯牥潮≲⤩ऊ汦慯⁴慔杲瑥楓呭浩䵥㭳ऊ⼯畱污瑩⁹獩漠汮⁹慲獩摥愠慧湩漠据⁥楳畭慬楴湯琠浩⁥獩戠汥睯琠楨⁳牦捡楴湯漠⁦桴⁥慴杲瑥⠠票瑳牥獥獩戠湡⥤ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩䝼癯牥潮≲‬敭慴㴠⠠汃浡䵰湩㴠∠⸰∰‬汃浡䵰硡㴠∠⸱∰‬摅瑩潃摮瑩潩⁮‽戢湅扡敬潇敶湲牯⤢਩昉潬瑡唠杰慲敤桔敲桳汯㭤ऊ⼯畮扭牥漠⁦牦浡獥琠敨猠浩汵瑡潩⁮慨⁳潴猠慴⁹癯牥甯摮牥戠摵敧⁴敢潦敲焠慵楬祴椠⁳潬敷敲⁤爨楡楳杮琠歡獥㐠琠浩獥愠⁳潬杮਩唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤潇敶湲牯Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽ㄢⰢ䔠楤䍴湯楤楴湯㴠∠䕢慮汢䝥癯牥潮≲⤩ऊ湩㍴′潇敶湲牯敓瑴敬牆浡獥਻⼉焯慵楬祴氠癥汥⁳牯敤敲⁤牦浯戠獥⁴〨 潴挠敨灡獥ੴ唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤潇敶湲牯⤢ऊ䅔牲祡䘼汆捯八慵楬祴敌敶㹬儠慵楬祴敌敶獬਻ऊ⼯湩敤⁸景挠牵敲瑮焠慵楬祴氠癥汥ऊ湩㍴′畑污瑩䱹癥汥਻⼉猯潭瑯敨⁤汦捯⁫楳畭慬楴湯琠浩⁥湩洠汩楬敳潣摮ੳ昉潬瑡匠浩楔敭獍਻⼉是慲敭⁳灳湥⁴癯牥漠⁲湵敤⁲畢杤瑥猠湩散氠獡⁴畱污瑩⁹档湡敧ऊ湩㍴′牆浡獥癏牥畂杤瑥਻椉瑮㈳䘠慲敭啳摮牥畂杤瑥਻ऊ⼯敳瑴湩獧漠⁦畣牲湥⁴畱污瑩⁹敬敶⁬灡汰敩⁤潴琠敨猠浩汵瑡潩੮䘉汆捯八慵楬祴敌敶⁬捁楴敶畑污瑩㭹ऊ湩㍴′捁楴敶敓獮牯潃湵㭴ਊ⼉洯慥畳敲猠浩汵瑡潩⁮楴敭愠摮猠整⁰畱污瑩⁹敬敶⁬灵漠⁲潤湷ऊ潶摩唠摰瑡䝥癯牥潮⡲汦慯⁴牆浡卥浩楔敭獍㬩ऊ⼯灡汰⁹敳瑴湩獧漠⁦畣牲湥⁴畱污瑩⁹敬敶੬瘉楯⁤灁汰兹慵楬祴敌敶⡬㬩ਊ異汢捩਺⼉术瑥整獲⬠猠瑥整獲ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤潇敶湲牯⤢ऊ湩楬敮椠瑮㈳䜠瑥畑污瑩䱹癥汥⤨笠爠瑥牵⁮畑污瑩䱹癥汥※㭽ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤潇敶湲牯⤢ऊ潶摩匠瑥畑污瑩䱹癥汥椨瑮㈳丠睥畑污瑩䱹癥汥㬩ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤潇敶湲牯⤢ऊ湩楬敮映潬瑡䜠瑥楓呭浩䵥⡳ ⁻敲畴湲匠浩楔敭獍※㭽ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠瑡来牯⁹‽䈢楯籤潇敶湲牯⤢ऊ潶摩匠瑥潇敶湲牯湅扡敬⡤潢汯戠湅扡敬⥤਻ऊ⼯乓偁䡓呏瀊潲整瑣摥਺⼉猯慮獰潨⁴獡敳⁴敲瑳牯摥愠⁴敬敶⁬瑳牡⁴桷湥眠牡⁭瑳牡楴杮‬湡⁤楦汬摥眠敨⁮慣瑰牵湩⁧湩攠楤潴ੲ唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤湓灡桳瑯⤢ऊ䙕潬正湓灡桳瑯獁敳⩴䘠潬正湓灡桳瑯਻⼉爯獥潴敲映潬正映潲⁭湳灡桳瑯愠⁴敬敶⁬瑳牡⁴湩瑳慥⁤景氠瑥楴杮猠慰湷牥⁳灳睡⁮桴楥⁲湩瑩慩⁬潢摩ੳ唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤湓灡桳瑯⤢ऊ潢汯戠慗浲瑓牡䙴潲卭慮獰潨㭴ऊ⼯湳灡桳瑯映汩⁥敲瑳牯摥眠敨⁮潮猠慮獰潨⁴獡敳⁴獩猠瑥⠠敲慬楴敶瀠瑡獨愠敲椠獮摩⁥慓敶⽤汆捯卫慮獰潨獴਩唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤湓灡桳瑯Ⱒ洠瑥⁡‽䔨楤䍴湯楤楴湯㴠∠坢牡卭慴瑲牆浯湓灡桳瑯⤢਩䘉瑓楲杮匠慮獰潨䙴汩㭥ऊ⼯敳潣摮⁳晡整⁲敬敶⁬瑳牡⁴潴挠灡畴敲愠猠慮獰潨⁴畡潴慭楴慣汬⁹〨㴠渠癥牥Ⱙ挠湡戠⁥敳⁴楷桴ⴠ汆捯卫慮獰潨䍴灡畴敲㰽敳潣摮㹳ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩卼慮獰潨≴‬敭慴㴠⠠汃浡䵰湩㴠∠⸰∰⤩ऊ汦慯⁴畁潴慃瑰牵䑥汥祡਻ऊ⼯楴敭⁲潦⁲畡潴慭楴⁣湳灡桳瑯挠灡畴敲ऊ呆浩牥慈摮敬䌠灡畴敲楔敭䡲湡汤㭥ऊ⼯湳灡桳瑯琠敨映潬正椠⁳敲瑳牯摥映潲Ɑ猠瑥漠据⁥瑩栠獡戠敥⁮潬摡摥愠摮栠獡戠楯獤琠⁯敲瑳牯੥唉剐偏剅奔吨慲獮敩瑮਩唉汆捯卫慮獰潨䅴獳瑥‪慗浲瑓牡却慮獰潨㭴ऊ潢汯戠慗浲瑓牡䱴慯敤㭤ਊ⼉氯慯⁤湳灡桳瑯愠獳瑥漠⁲楦敬漠据⁥桷湥眠牡⁭瑳牡楴杮‬敲畴湲⁳畮汬椠⁦瑩挠畯摬❮⁴敢氠慯敤⁤牯栠獡渠⁯潢摩ੳ唉汆捯卫慮獰潨䅴獳瑥‪潌摡慗浲瑓牡却慮獰潨⡴㬩ਊ⼉爯獥潴敲映潬正猠瑥楴杮⁳湡⁤潢摩猠慴整映潲⁭湳灡桳瑯‬潢摩愠瑣牯⁳牡⁥灳睡敮⁤潦⁲桴⁥瑳瑡⁥祢琠敨猠慰湷焠敵敵ऊ潶摩删獥潴敲汆捯卫慮獰潨⡴䙕潬正湓灡桳瑯獁敳⩴匠慮獰潨⥴਻⼉术瑥映汵⁬慰桴漠⁦湳灡桳瑯映汩੥䘉瑓楲杮䜠瑥湓灡桳瑯楆敬慐桴⤨挠湯瑳਻瀊扵楬㩣ऊ⼯慣瑰牵⁥畣牲湥⁴汦捯⁫湩潴琠敨猠慮獰潨⁴獡敳⁴椨⁦敳⥴愠摮琠敨猠慮獰潨⁴楦敬ऊ䙕乕呃佉⡎求敵牰湩䍴污慬汢ⱥ䌠污䥬䕮楤潴Ⱳ䌠瑡来牯⁹‽䈢楯籤湓灡桳瑯⤢ऊ潶摩䌠灡畴敲汆捯卫慮獰潨⡴㬩ऊ⼯牴敵椠⁦汦捯⁫獩爠獥潴敲⁤牦浯愠猠慮獰潨⁴瑡氠癥汥猠慴瑲⠠慦獬⁥晩眠牡⁭瑳牡楴杮戠瑵琠敨猠慮獰潨⁴潣汵湤琧戠⁥潬摡摥਩唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩卼慮獰潨≴਩戉潯⁬獉慗浲瑓牡整⡤㬩ਊ⼉刯偅䥌䅃䥔乏瀊潲整瑣摥਺⼉猯湥⁤汦捯⁫瑳瑡⁥潴挠楬湥獴愠⁳畱湡楴敺⁤湳灡桳瑯⁳戨楯⁤捡潴獲搠湯琧爠灥楬慣整‬汣敩瑮⁳灳睡⁮桴楥⁲睯⥮ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩剼灥楬慣楴湯⤢ऊ潢汯戠敒汰捩瑡䙥潬正਻⼉猯慮獰潨獴猠湥⁴潴挠楬湥獴瀠牥猠捥湯੤唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤敒汰捩瑡潩≮‬敭慴㴠⠠汃浡䵰湩㴠∠⸱∰‬摅瑩潃摮瑩潩⁮‽戢敒汰捩瑡䙥潬正⤢਩昉潬瑡匠慮獰潨剴瑡㭥ऊ⼯畮扭牥漠⁦湳灡桳瑯⁳数⁲敫晹慲敭‬桴⁥湳灡桳瑯⁳敢睴敥⁮敫晹慲敭⁳牡⁥敳瑮愠⁳敤瑬獡漠⁦桴⁥慬瑳欠祥牦浡੥唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤敒汰捩瑡潩≮‬敭慴㴠⠠汃浡䵰湩㴠∠∱‬摅瑩潃摮瑩潩⁮‽戢敒汰捩瑡䙥潬正⤢਩椉瑮㈳䬠祥牦浡䥥瑮牥慶㭬ऊ⼯楳敺漠⁦潰楳楴湯焠慵瑮穩瑡潩⁮瑳灥椠⁮潷汲⁤湵瑩ੳ唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤敒汰捩瑡潩≮‬敭慴㴠⠠汃浡䵰湩㴠∠⸰∱‬摅瑩潃摮瑩潩⁮‽戢敒汰捩瑡䙥潬正⤢਩昉潬瑡倠獯瑩潩偮敲楣楳湯਻⼉洯硡浩浵渠浵敢⁲景戠楯獤瀠牥瀠捡敫ⱴ氠牡敧⁲汦捯獫愠敲猠汰瑩椠瑮⁯敳敶慲⁬慰正瑥⹳瀠捡敫獴愠敲愠獬⁯畣⁴敢潦敲琠敨⁹牧睯瀠獡ੴ⼉ㄯ䉋‬潳愠戠楯⁤潣湵⁴扡癯⁥桷瑡映瑩⁳愨潲湵⁤〱‰潢摩⥳栠獡渠⁯晥敦瑣ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩剼灥楬慣楴湯Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽ㄢⰢ䌠慬灭慍⁸‽㈢㈹Ⱒ䔠楤䍴湯楤楴湯㴠∠剢灥楬慣整汆捯≫⤩ऊ湩㍴′慍䉸楯獤敐偲捡敫㭴ऊ⼯潬⁧祢整⁳数⁲敳潣摮猠湥⁴潴攠捡⁨汣敩瑮ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩剼灥楬慣楴湯Ⱒ洠瑥⁡‽䔨楤䍴湯楤楴湯㴠∠剢灥楬慣整汆捯≫⤩ऊ潢汯戠潌剧灥楬慣楴湯瑓瑡㭳ਊ⼉琯灹⁥景戠楯⁤灳睡敮⁤湯挠楬湥獴映牯爠灥楬慣整⁤潢摩ੳ唉剐偏剅奔刨灥楬慣整⥤ऊ協扵汣獡佳㱦䉁楯㹤删灥楬慣整䉤楯呤灹㭥ਊ⼉爯汥祡漠⁦慥档爠浥瑯⁥汰祡牥挠湯牴汯敬Ⱳ猠湥獤琠慨⁴潣湮捥楴湯椠獴猠慮獰潨獴⠠敳癲牥漠汮⥹ऊ偕佒䕐呒⡙਩吉慍㱰偁慬敹䍲湯牴汯敬⩲‬䙕潬正敒慬䍹浯潰敮瑮㸪䘠潬正敒慬獹਻ऊ⼯敤潣敤⁳湳灡桳瑯⁳敲散癩摥映潲⁭桴⁥敳癲牥⠠汣敩瑮漠汮ⱹ攠捡⁨敲慬⁹慨⁳瑩⁳睯⁮湥潣敤⁲湯琠敨猠牥敶⥲ऊ䙆潬正敎䍴摯捥丠瑥潃敤㭣ऊ⼯捳慲捴⁨畢晦牥⁳敲獵摥戠瑥敷湥猠慮獰潨獴ऊ䅔牲祡䘼汆捯乫瑥潂摩‾敎䉴楯獤਻吉牁慲㱹䙆潬正敎䉴楯㹤䌠湯敮瑣潩䉮楯獤਻吉牁慲㱹䙆潬正敎䍴畬瑳牥‾敎䍴畬瑳牥㭳ऊ䅔牲祡甼湩㡴‾敎側捡敫㭴ऊ䅔牲祡吼慐物昼潬瑡‬湩㍴㸲‾牐潩楲楴敺䉤楯獤਻吉牁慲㱹湩㍴㸲䌠畬瑳牥摥潂摩㭳ऊ䵔灡䘼湉噴捥潴Ⱳ椠瑮㈳‾汃獵整䍲汥獬਻⼉琯浩⁥楳据⁥慬瑳猠慮獰潨⁴慷⁳敳瑮ऊ汦慯⁴湓灡桳瑯捁畣畭慬潴㭲ऊ⼯祢整⁳敳瑮琠⁯污⁬汣敩瑮⁳楳据⁥瑳瑡⁳敷敲氠獡⁴敭獡牵摥ऊ湩㍴′敒汰捩瑡潩䉮瑹獥਻昉潬瑡删灥楬慣楴湯瑓瑡味浩㭥ऊ汦慯⁴敒汰捩瑡潩䉮瑹獥敐卲捥湯㭤ਊ⼉振楬湥⁴楳敤戠楯獤戠⁹敳癲牥栠湡汤੥吉慍㱰湩㍴ⰲ䘠敒汰捩瑡摥潂摩‾敒汰捩瑡摥潂摩㭳ਊ⼉猯牥敶㩲瀠捡⁫汦捯⁫湩潴猠慮獰潨⁴慰正瑥⁳湡⁤敳摮琠敨⁭潴攠敶祲挠楬湥ੴ瘉楯⁤敓摮汆捯卫慮獰潨⡴㬩ऊ⼯汣敩瑮›潭敶戠楯獤愠潬杮琠敨物爠灥楬慣整⁤敶潬楣祴甠瑮汩琠敨渠硥⁴湳灡桳瑯愠牲癩獥ऊ潶摩䔠瑸慲潰慬整汆捯⡫汦慯⁴敄瑬呡浩⥥਻⼉振楬湥㩴爠浥癯⁥潬慣⁬潢摩愠摮椠獴愠瑣牯ऊ潶摩删浥癯剥灥楬慣整䉤楯⡤湩㍴′潌慣䡬湡汤⥥਻ऊ⼯义䕔䕒呓䴠乁䝁䵅久੔牰瑯捥整㩤ऊ⼯潢摩⁳汣獯牥琠慨⁮桴獩琠⁯⁡汣敩瑮猧瘠敩⁷牡⁥敳瑮椠⁮癥牥⁹湳灡桳瑯ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩剼灥楬慣楴湯Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽〢〮Ⱒ䔠楤䍴湯楤楴湯㴠∠剢灥楬慣整汆捯≫⤩ऊ汦慯⁴畆汬慒整楄瑳湡散਻⼉戯楯獤椠⁮⁡汣敩瑮猧瘠敩⁷湡⁤汣獯牥琠慨⁮桴獩愠敲猠湥⁴癥牥⁹敒畤散剤瑡䑥癩獩牯猠慮獰潨獴‬瑯敨獲愠敲漠汮⁹敳瑮愠⁳汣獵整獲ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩剼灥楬慣楴湯Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽〢〮Ⱒ䔠楤䍴湯楤楴湯㴠∠剢灥楬慣整汆捯≫⤩ऊ汦慯⁴敒畤散剤瑡䑥獩慴据㭥ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩剼灥楬慣楴湯Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽ㄢⰢ䔠楤䍴湯楤楴湯㴠∠剢灥楬慣整汆捯≫⤩ऊ湩㍴′敒畤散剤瑡䑥癩獩牯਻⼉猯穩⁥景朠楲⁤散汬⁳潢摩⁳牡⁥畳浭牡獩摥椠⁮桷湥琠敨⁹牡湥琧猠湥⁴湩楤楶畤污祬ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩剼灥楬慣楴湯Ⱒ洠瑥⁡‽䌨慬灭楍⁮‽ㄢ〰〮Ⱒ䔠楤䍴湯楤楴湯㴠∠剢灥楬慣整汆捯≫⤩ऊ汦慯⁴汃獵整䍲汥卬穩㭥ऊ⼯慭楸畭⁭畮扭牥漠⁦潬慣⁬潢摩⁳⁡汣敩瑮攠灸湡獤愠挠畬瑳牥椠瑮੯唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤敒汰捩瑡潩≮‬敭慴㴠⠠汃浡䵰湩㴠∠∱‬摅瑩潃摮瑩潩⁮‽戢敒汰捩瑡䙥潬正⤢਩椉瑮㈳䴠硡潂摩偳牥汃獵整㭲ऊ⼯慭楸畭⁭汦捯⁫湳灡桳瑯戠瑹獥瀠牥猠捥湯⁤敳瑮琠⁯慥档挠楬湥ੴ唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤敒汰捩瑡潩≮‬敭慴㴠⠠汃浡䵰湩㴠∠∰‬摅瑩潃摮瑩潩⁮‽戢敒汰捩瑡䙥潬正⤢਩椉瑮㈳䴠硡祂整偳牥敓潣摮਻⼉洯硡浩浵映慲瑣潩⁮景愠挠楬湥❴⁳敮⁴灳敥⁤獵摥戠⁹汦捯⁫湳灡桳瑯ⱳ琠敨爠獥⁴獩氠晥⁴潦⁲慧敭汰祡愠瑣牯ੳ唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤敒汰捩瑡潩≮‬敭慴㴠⠠汃浡䵰湩㴠∠⸰∰‬汃浡䵰硡㴠∠⸱∰‬摅瑩潃摮瑩潩⁮‽戢敒汰捩瑡䙥潬正⤢਩昉潬瑡䴠硡敎却数摥牆捡楴湯਻ऊ⼯汣敩瑮猠摩⁥汣獵整⁲牰硯敩⁳祢朠楲⁤散汬ऊ䵔灡䘼湉噴捥潴Ⱳ䘠汆捯䍫畬瑳牥牐硯㹹䌠畬瑳牥牐硯敩㭳ਊ⼉猯牥敶㩲朠瑥漠⁲牣慥整爠汥祡映牯瀠慬敹⁲潣瑮潲汬牥ऊ䙕潬正敒慬䍹浯潰敮瑮‪敇䙴潬正敒慬⡹偁慬敹䍲湯牴汯敬⩲倠慬敹䍲湯牴汯敬⥲਻⼉猯牥敶㩲挠潨獯⁥潢摩⁳湡⁤汣獵整獲映牯漠敮挠楬湥⁴楷桴湩椠獴戠摵敧⁴湡⁤敳摮琠敨੭瘉楯⁤敓摮湓灡桳瑯潔敒慬⡹䙕潬正敒慬䍹浯潰敮瑮‪敒慬ⱹ䄠汐祡牥潃瑮潲汬牥‪汐祡牥潃瑮潲汬牥㬩ऊ⼯敳癲牥›敳摮挠慯獲⁥汣獵整獲琠⁯癥牥⁹汣敩瑮眠楨敬琠敨映潬正椠⁳楳畭慬整⁤潣牡敳祬ऊ潶摩匠湥䍤慯獲卥慮獰潨⡴㬩ऊ⼯敳癲牥›摡⁤潢摩⁳潴琠敨渠瑥挠畬瑳牥漠⁦桴⁥牧摩挠汥⁬桴祥爧⁥湩ऊ潶摩䄠摤潔敎䍴畬瑳牥挨湯瑳䘠敖瑣牯…潐楳楴湯‬潣獮⁴噆捥潴♲嘠汥捯瑩ⱹ椠瑮㈳䌠畯瑮㬩ਊ異汢捩਺⼉爯灥楬慣整⁤牰灯牥楴獥ऊ楶瑲慵⁬潶摩䜠瑥楌敦楴敭敒汰捩瑡摥牐灯⡳䅔牲祡䘼楌敦楴敭牐灯牥祴☾传瑵楌敦楴敭牐灯⥳挠湯瑳漠敶牲摩㭥ਊ⼉振楬湥㩴愠灰祬猠慮獰潨⁴牯挠畬瑳牥瀠捡敫⁴敲散癩摥映潲⁭桴⁥敳癲牥ऊ潶摩删捥楥敶汆捯卫慮獰潨⡴潣獮⁴䅔牲祡甼湩㡴☾倠捡敫⥴਻瘉楯⁤敒散癩䙥潬正汃獵整獲挨湯瑳吠牁慲㱹極瑮㸸…慐正瑥㬩ਊ⼉愯敶慲敧戠瑹獥瀠牥猠捥湯⁤敳瑮琠⁯慥档挠楬湥⁴潦⁲汦捯⁫湳灡桳瑯ੳ唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩剼灥楬慣楴湯⤢ऊ湩楬敮映潬瑡䜠瑥敒汰捩瑡潩䉮瑹獥敐卲捥湯⡤ ⁻敲畴湲删灥楬慣楴湯祂整偳牥敓潣摮※㭽ਊ⼉䘯佌䭃删卅呅ऊ⼯佔佄›摡⁤敲敳⁴畦据楴湯琠⁯敤瑳潲⁹畣牲湥⁴汦捯⁫湡⁤敧敮慲整渠睥漠敮甠楳杮愠獳杩敮⁤灳睡敮獲ਊ⼉䘯佌䭃倠䕒䕓協ऊ⼯佔佄›摡⁤汦捯⁫牰獥瑥⁳桴瑡猠潴敲猠瑥楴杮⁳潦⁲朢湥牥污•潢摩戠桥癡潩Ⱳ挠湡戠⁥獵摥琠⁯敲敳⁴潢摩愠⁴潧摯猠慴瑲湩⁧敳瑴湩獧紊਻
\ No newline at end of file
@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⼯慐正⁳汦捯⁫瑳瑡⁥湩潴挠浯慰瑣瀠捡敫獴猠⁯⁡汆捯⁫慍慮敧⁲慣⁮敲汰捩瑡⁥⁡桷汯⁥汦捯⁫楷桴畯⁴敲汰捩瑡湩⁧潢摩愠瑣牯⹳⼊䬯祥牦浡獥挠牡祲攠捡⁨潢摩猧瀠獯瑩潩⁮畱湡楴敺⁤敲慬楴敶琠⁯桴⁥汦捯⁫牯杩湩‬敤瑬⁡慰正瑥⁳慣牲⁹湯祬琠敨搠晩敦敲据੥⼯牦浯琠敨戠楯❤⁳潰楳楴湯椠⁮桴⁥慬瑳欠祥牦浡⹥䠠慥楤杮⁳牡⁥捯慴敨牤污攠据摯摥椠瑮⁯′祢整⁳湡⁤灳敥獤椠瑮⁯‱祢整ਮ⼯桔⁥敳癲牥愠摮挠楬湥⁴慥档欠敥⁰桴⁥慬瑳欠祥牦浡⁥獡琠敨戠獡汥湩⁥潳搠汥慴⁳敤潣敤琠⁯桴⁥慳敭焠慵瑮穩摥瀠獯瑩潩獮ਮ⼯慐正瑥⁳牡⁥楦汬摥甠⁰潴愠戠瑹⁥楳敺⠠敢潬⁷湯⁥呍⁕祢搠晥畡瑬 潳琠敨⁹瑳祡甠摮牥琠敨攠杮湩❥⁳偒⁃牡慲⁹楬業ੴ⼯渨瑥䴮硡敒䅰牲祡楓敺Ⱙ愠映潬正猧欠祥牦浡⁥牯搠汥慴椠⁳敳瑮愠⁳獡洠湡⁹慰正瑥⁳獡椠⁴慴敫⹳⼊䈯楯獤愠挠楬湥⁴潤獥❮⁴敮摥椠摮癩摩慵汬⁹慣⁮敢猠湥⁴獡挠畬瑳牥猠浵慭楲獥⠠牧摩挠汥ⱬ挠湥牴楯Ɽ挠畯瑮‬敭湡瘠汥捯瑩⥹ਮ⼯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⌊牰条慭漠据੥⼊椯据畬敤ੳ椣据畬敤∠潃敲楍楮慭⹬≨ਊ⼯慬杲獥⁴慰正瑥琠敨挠摯捥眠楲整ⱳ爠汥慩汢⁥偒⁃牡慲⁹牡畧敭瑮⁳潬杮牥琠慨⁮敮⹴慍剸灥牁慲卹穩⁥牢慥⁫桴⁥潣湮捥楴湯挊湯瑳椠瑮㈳䘠潬正敎䵴硡慐正瑥祂整⁳‽〲㠴਻⼊戯楯⁤瑳瑡⁥敳瑮漠敶⁲桴⁥敮睴牯Ⱬ椠敤瑮晩敩⁤祢椠獴映潬正栠湡汤⁥湯琠敨猠牥敶ੲ瑳畲瑣䘠汆捯乫瑥潂摩笊ऊ湩㍴′慈摮敬਻䘉敖瑣牯倠獯瑩潩㭮ऊ噆捥潴⁲敖潬楣祴਻㭽ਊ⼯畳浭牡⁹景琠敨戠楯獤椠⁮湯⁥牧摩挠汥ⱬ攠灸湡敤⁤湩潴氠捯污戠楯獤戠⁹桴⁥汣敩瑮猊牴捵⁴䙆潬正敎䍴畬瑳牥笊ऊ䥆瑮敖瑣牯䌠汥㭬ऊ噆捥潴⁲敃瑮潲摩਻䘉敖瑣牯嘠汥捯瑩㭹ऊ湩㍴′潃湵㭴紊਻挊慬獳䈠䥏卄䅟䥐䘠汆捯乫瑥潃敤੣੻異汢捩਺⼉猯穩⁥景瀠獯瑩潩⁮畱湡楴慺楴湯猠整⁰湩眠牯摬甠楮獴ऊ汦慯⁴潐楳楴湯牐捥獩潩⁮‽⸲昰਻⼉瀯捡敫獴愠敲映汩敬⁤灵琠⁯桴獩洠湡⁹祢整ⱳ挠慬灭摥琠⁯汆捯乫瑥慍偸捡敫䉴瑹獥ऊ湩㍴′慍偸捡敫䉴瑹獥㴠ㄠ㈰㬴ਊ⼉猯慴瑲愠渠睥欠祥牦浡⁥牡畯摮漠楲楧Ɱ映汯潬楷杮欠祥牦浡⁥慰正瑥⁳敲汰捡⁥桴⁥敤瑬⁡慢敳楬敮ऊ潶摩䈠来湩敋晹慲敭挨湯瑳䘠敖瑣牯…敎佷楲楧⥮਻⼉支据摯⁥灵琠⁯慍䉸楯獤戠楯獤⠠潳瑲摥戠⁹慨摮敬 牦浯䘠物瑳潂摩椠瑮⁯⁡敫晹慲敭漠⁲敤瑬⁡慰正瑥漠⁦瑡洠獯⁴慍偸捡敫䉴瑹獥ਬ⼉爯瑥牵獮琠敨渠浵敢⁲景戠楯獤攠据摯摥⠠瑡氠慥瑳漠敮Ⱙ琠敨渠硥⁴慰正瑥猠慴瑲⁳晡整⁲桴浥ऊ湩㍴′湅潣敤慐正瑥挨湯瑳吠牁慲㱹䙆潬正敎䉴楯㹤…潂摩ⱳ椠瑮㈳䘠物瑳潂摩‬湩㍴′慍䉸楯獤‬潢汯戠敋晹慲敭‬汦慯⁴楍卮数摥‬汦慯⁴慍卸数摥‬䅔牲祡甼湩㡴☾传瑵慐正瑥㬩ऊ⼯敤潣敤瀠捡敫⁴湩潴戠楯獤‬敲畴湲⁳慦獬⁥晩瀠捡敫⁴獩洠污潦浲摥漠⁲瑩⁳敫晹慲敭眠獡❮⁴敲散癩摥ऊ潢汯䐠捥摯⡥潣獮⁴䅔牲祡甼湩㡴☾倠捡敫ⱴ吠牁慲㱹䙆潬正敎䉴楯㹤…畏䉴楯獤㬩ਊ⼉支据摯⁥汣獵整⁲畳浭牡敩⁳景朠楲⁤散汬⁳景䌠汥卬穩⁥挨畬瑳牥⁳潤❮⁴獵⁥桴⁥敫晹慲敭戠獡汥湩⥥‬汣獵整獲瀠獡ੴ⼉䘯潬正敎䵴硡慐正瑥祂整⁳牡⁥牤灯数⁤潳挠畬瑳牥⁳桳畯摬戠⁥潳瑲摥戠⁹浩潰瑲湡散ऊ瑳瑡捩瘠楯⁤湅潣敤汃獵整獲挨湯瑳吠牁慲㱹䙆潬正敎䍴畬瑳牥☾䌠畬瑳牥ⱳ映潬瑡䌠汥卬穩ⱥ映潬瑡䴠硡灓敥Ɽ吠牁慲㱹極瑮㸸…畏側捡敫⥴਻⼉搯捥摯⁥汣獵整⁲畳浭牡敩ⱳ爠瑥牵獮映污敳椠⁦慰正瑥椠⁳慭晬牯敭੤猉慴楴⁣潢汯䐠捥摯䍥畬瑳牥⡳潣獮⁴䅔牲祡甼湩㡴☾倠捡敫ⱴ吠牁慲㱹䙆潬正敎䍴畬瑳牥☾传瑵汃獵整獲㬩ਊ⼉是牯敧⁴敫晹慲敭戠獡汥湩੥瘉楯⁤敒敳⡴㬩ਊ牰癩瑡㩥ऊ⼯摩漠⁦畣牲湥⁴敫晹慲敭‬牷灡⁳牡畯摮ऊ極瑮‸敋晹慲敭摉㴠〠਻⼉琯畲⁥湯散琠敨猠慴瑲漠⁦桴⁥畣牲湥⁴敫晹慲敭栠獡戠敥⁮湥潣敤⽤敤潣敤Ɽ搠汥慴⁳牡⁥湯祬瘠污摩愠瑦牥椠ੴ戉潯⁬䡢獡敋晹慲敭㴠映污敳਻⼉焯慵瑮穩瑡潩⁮牯杩湩愠摮瀠敲楣楳湯漠⁦畣牲湥⁴敫晹慲敭ऊ噆捥潴⁲牏杩湩㴠䘠敖瑣牯㨺敚潲敖瑣牯਻昉潬瑡䬠祥牦浡健敲楣楳湯㴠㈠〮㭦ऊ⼯畱湡楴敺⁤敫晹慲敭瀠獯瑩潩⁮景攠捡⁨潢摩栠湡汤੥吉慍㱰湩㍴ⰲ䘠湉噴捥潴㹲䈠獡汥湩㭥紊਻
\ No newline at end of file
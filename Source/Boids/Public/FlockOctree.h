@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⼯灓瑡慩⁬湩敤⁸敲畢汩⁴祢琠敨䘠潬正䴠湡条牥攠敶祲映慲敭映潲⁭桴⁥潰楳楴湯⁳湡⁤敨摡湩獧漠⁦瑩⁳潢摩⹳⼊䔯捡⁨潮敤猠潴敲⁳条牧来瑡獥漠⁦桴⁥潢摩⁳瑩挠湯慴湩⁳挨畯瑮‬潰楳楴湯猠浵‬敨摡湩⁧畳⥭猠⁯桴瑡挠桯獥潩⁮湡⁤污杩浮湥ੴ⼯癯牥愠氠牡敧瀠牥散瑰潩⁮慲楤獵挠湡甠敳愠眠潨敬搠獩慴瑮渠摯⁥獡愠猠湩汧⁥瀢敳摵ⵯ汦捯浫瑡≥⠠慂湲獥䠭瑵猠祴敬 湩瑳慥⁤景⼊瘯獩瑩湩⁧癥牥⁹潢摩椠獮摩⁥景椠⹴⼊倯慬慮⁲汦捯獫戠極摬琠敨琠敲⁥獡愠焠慵瑤敲ⱥ渠摯獥愠敲漠汮⁹灳楬⁴污湯⁧⁘湡⁤⁙潳愠焠敵祲瘠獩瑩⁳‴湩瑳慥⁤景㠠挠楨摬敲⁮数⁲潮敤ਮ⼯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⌊牰条慭漠据੥⼊椯据畬敤ੳ椣据畬敤∠潃敲楍楮慭⹬≨ਊ⼯捯牴敥渠摯ⱥ挠楨摬敲⁮景愠渠摯⁥牡⁥瑳牯摥挠湯楴畧畯汳⁹瑳牡楴杮愠⁴楆獲䍴楨摬猊牴捵⁴䙆潬正捏牴敥潎敤笊ऊ⼯畣敢戠畯摮⁳景渠摯੥䘉敖瑣牯䌠湥整㭲ऊ汦慯⁴慈晬楓敺਻ऊ⼯慲杮⁥景琠敨漠瑣敲⁥湩敤⁸楬瑳漠湷摥戠⁹桴獩渠摯੥椉瑮㈳䘠物瑳湉敤㭸ऊ湩㍴′潃湵㭴ਊ⼉椯摮硥漠⁦楦獲⁴景㠠挠楨摬敲Ɱ㐠椠⁮⁡汰湡牡琠敲⁥䤨䑎塅也乏⁅潦⁲敬晡渠摯獥਩椉瑮㈳䘠物瑳桃汩㭤ਊ⼉愯杧敲慧整⁳景愠汬戠楯獤椠獮摩⁥桴⁥潮敤ऊ噆捥潴⁲潐楳楴湯畓㭭ऊ噆捥潴⁲效摡湩卧浵਻ऊ湩楬敮戠潯⁬獉敌晡⤨挠湯瑳笠爠瑥牵⁮楆獲䍴楨摬㴠‽义䕄彘低䕎※੽㭽ਊ⼯捡畣畭慬整⁤潣敨楳湯愠摮愠楬湧敭瑮椠灮瑵⁳慧桴牥摥映潲⁭⁡畱牥੹瑳畲瑣䘠汆捯䅫杧敲慧整笊ऊ⼯畳⁭景映潬正慭整瀠獯瑩潩獮甠敳⁤潦⁲潣敨楳湯ऊ噆捥潴⁲潐楳楴湯畓⁭‽噆捥潴㩲娺牥噯捥潴㭲ऊ湩㍴′潃敨楳湯潃湵⁴‽㬰ਊ⼉猯浵漠⁦汦捯浫瑡⁥敨摡湩獧⠠潮浲污穩摥瘠汥捯瑩敩⥳甠敳⁤潦⁲污杩浮湥ੴ䘉敖瑣牯䠠慥楤杮畓⁭‽噆捥潴㩲娺牥噯捥潴㭲ऊ湩㍴′汁杩浮湥䍴畯瑮㴠〠਻㭽ਊ汣獡⁳佂䑉当偁⁉䙆潬正捏牴敥笊瀊扵楬㩣ऊ⼯慭楸畭⁭畮扭牥漠⁦潢摩⁳瑳牯摥椠⁮⁡敬晡戠晥牯⁥瑩椠⁳灳楬ੴ椉瑮㈳䴠硡敌晡楓敺㴠ㄠ㬶ऊ⼯慭楸畭⁭敤瑰⁨景琠敲ⱥ猠潴獰猠扵楤楶楳湯漠⁦潢摩⁳瑳捡敫⁤湩琠敨猠浡⁥灳瑯ऊ湩㍴′慍䑸灥桴㴠ㄠ㬲ऊ⼯畢汩⁤⁡畱摡牴敥映牯戠楯獤漠⁮⁡潨楲潺瑮污瀠慬敮‬潢摩⁳畭瑳猠慨敲琠敨猠浡⁥ਗ਼戉潯⁬偢慬慮⁲‽慦獬㭥ਊ⼉爯扥極摬琠敨琠敲⁥牦浯琠敨映潬正猧瀠獯瑩潩獮愠摮栠慥楤杮⁳愨牲祡⁳畭瑳戠⁥桴⁥慳敭猠穩⥥ऊ潶摩䈠極摬挨湯瑳吠牁慲㱹噆捥潴㹲…潐楳楴湯ⱳ挠湯瑳吠牁慲㱹噆捥潴㹲…效摡湩獧㬩ਊ⼉支灭祴琠敨琠敲੥瘉楯⁤敒敳⡴㬩ਊ⼉术瑡敨⁲潣敨楳湯愠摮愠楬湧敭瑮椠灮瑵⁳潦⁲⁡潢摩愠⁴潌慣楴湯映捡湩⁧潆睲牡⹤ऊ⼯潮敤⁳桴瑡愠敲映牡攠潮杵⁨睡祡⠠潮敤猠穩⁥ 楤瑳湡散㰠传数楮杮湁汧⥥愠敲甠敳⁤獡愠猠湩汧⁥条牧来瑡ⱥ挠潬敳⁲潮敤⁳牡⁥灯湥摥愠摮琠敨物戠楯獤瘠獩瑩摥椠摮癩摩慵汬⹹ऊ⼯湡传数楮杮湁汧⁥景〠瘠獩瑩⁳癥牥⁹潢摩椠⁮慲杮⁥硥捡汴⹹ऊ䙆潬正杁牧来瑡⁥畑牥䅹杧敲慧整挨湯瑳䘠敖瑣牯…潌慣楴湯‬潣獮⁴噆捥潴♲䘠牯慷摲‬汦慯⁴慒楤獵‬汦慯⁴潃敨楳湯但ⱖ映潬瑡䄠楬湧敭瑮但ⱖ映潬瑡传数楮杮湁汧ⱥ椠瑮㈳䔠捸畬敤湉敤⥸挠湯瑳਻ऊ⼯慧桴牥琠敨椠摮捩獥漠⁦癥牥⁹潢摩眠瑩楨⁮慒楤獵漠⁦潌慣楴湯‬瑳灯⁳湯散䴠硡敎杩扨畯獲愠敲映畯摮⠠‰‽潮氠浩瑩਩瘉楯⁤慇桴牥敎杩扨畯獲挨湯瑳䘠敖瑣牯…潌慣楴湯‬汦慯⁴慒楤獵‬湩㍴′硅汣摵䥥摮硥‬䅔牲祡椼瑮㈳☾传瑵敎杩扨畯獲‬湩㍴′慍乸楥桧潢牵⁳‽⤰挠湯瑳਻ऊ⼯敧⁴湩敤⁸景琠敨氠慥⁦潮敤挠湯慴湩湩⁧潌慣楴湯⠠义䕄彘低䕎椠⁦牴敥椠⁳浥瑰⥹ऊ湩㍴′楆摮敌晡挨湯瑳䘠敖瑣牯…潌慣楴湯 潣獮㭴ਊ椉汮湩⁥湩㍴′敇乴浵潎敤⡳ 潣獮⁴⁻敲畴湲丠摯獥丮浵⤨※੽椉汮湩⁥潣獮⁴䙆潬正捏牴敥潎敤…敇乴摯⡥湩㍴′潎敤湉敤⥸挠湯瑳笠爠瑥牵⁮潎敤孳潎敤湉敤嵸※੽⼉港浵敢⁲景挠楨摬敲⁮景愠渠湯氭慥⁦潮敤ऊ湩楬敮椠瑮㈳䜠瑥畎䍭楨摬敲⡮ 潣獮⁴⁻敲畴湲戠汐湡牡㼠㐠㨠㠠※੽瀊楲慶整਺⼉爯捥牵楳敶祬猠扵楤楶敤渠摯⁥湵楴⁬敬晡猠穩⁥牯洠硡搠灥桴椠⁳敲捡敨੤瘉楯⁤畂汩乤摯⡥湩㍴′潎敤湉敤ⱸ椠瑮㈳䐠灥桴㬩ਊ⼉术瑥挠楨摬漠⁦⁡潮敤挠湯慴湩湩⁧潐楳楴湯⠠楢⁴‰‽堫‬楢⁴‱‽夫‬楢⁴′‽娫甠汮獥⁳汰湡牡਩䘉剏䕃义䥌䕎椠瑮㈳䜠瑥捏慴瑮挨湯瑳䘠敖瑣牯…敃瑮牥‬潣獮⁴噆捥潴♲倠獯瑩潩⥮挠湯瑳ऊ੻उ敲畴湲⠠潐楳楴湯堮㸠‽敃瑮牥堮㼠ㄠ㨠〠 ⁼倨獯瑩潩⹮⁙㴾䌠湥整⹲⁙‿′›⤰簠⠠戡汐湡牡☠…潐楳楴湯娮㸠‽敃瑮牥娮㼠㐠㨠〠㬩ऊ੽ऊ⼯牴敥渠摯獥‬潲瑯椠⁳瑡椠摮硥〠ऊ䅔牲祡䘼汆捯佫瑣敲乥摯㹥丠摯獥਻ऊ⼯潢摩椠摮捩獥猠牯整⁤潳琠慨⁴癥牥⁹潮敤漠湷⁳⁡潣瑮杩潵獵爠湡敧ऊ䅔牲祡椼瑮㈳‾湉楤散㭳ऊ⼯捳慲捴⁨畢晦牥甠敳⁤桷汩⁥慰瑲瑩潩楮杮椠摮捩獥椠瑮⁯捯慴瑮ੳ吉牁慲㱹湩㍴㸲匠牣瑡档湉楤散㭳ਊ⼉瘯敩獷漠⁦桴⁥牡慲獹琠敨琠敲⁥慷⁳畢汩⁴牦浯‬慶楬⁤湵楴⁬桴⁥敮瑸戠極摬ऊ潣獮⁴䅔牲祡䘼敖瑣牯⨾䈠楯偤獯瑩潩獮㴠渠汵灬牴਻按湯瑳吠牁慲㱹噆捥潴㹲‪潂摩效摡湩獧㴠渠汵灬牴਻㭽
\ No newline at end of file
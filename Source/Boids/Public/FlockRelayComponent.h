@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⼯潃灭湯湥⁴摡敤⁤祢愠䘠潬正䴠湡条牥琠⁯慥档爠浥瑯⁥汰祡牥挠湯牴汯敬⁲湯琠敨猠牥敶⁲潴猠湥⁤桴瑡挠楬湥⁴瑩⁳汦捯⁫湳灡桳瑯⹳⼊䔯捡⁨敲慬⁹敫灥⁳瑩⁳睯⁮敫晹慲敭戠獡汥湩⁥湡⁤畢杤瑥猠慴整‬潳攠敶祲挠湯敮瑣潩⁮敧獴琠敨戠楯獤琠慨⁴慭瑴牥琠⁯瑩⁳楶睥牥ਮ⼯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⌊牰条慭漠据੥⼊椯据畬敤ੳ椣据畬敤∠潃敲楍楮慭⹬≨⌊湩汣摵⁥䌢浯潰敮瑮⽳捁潴䍲浯潰敮瑮栮ਢ椣据畬敤∠汆捯乫瑥潃敤⹣≨⌊湩汣摵⁥䘢潬正敒慬䍹浯潰敮瑮朮湥牥瑡摥栮ਢ⼊是牯慷摲搠捥慬敲ੳ汣獡⁳䙁潬正慍慮敧㭲ਊ䍕䅌卓⤨挊慬獳䈠䥏卄䅟䥐唠汆捯剫汥祡潃灭湯湥⁴›異汢捩唠捁潴䍲浯潰敮瑮笊ऊ䕇䕎䅒䕔彄佂奄⤨ਊ異汢捩਺⼉搯晥畡瑬挠湯瑳畲瑣牯ऊ䙕潬正敒慬䍹浯潰敮瑮⤨਻ऊ⼯汦捯⁫慭慮敧⁲桴獩爠汥祡猠湥獤猠慮獰潨獴映牯⠠敳癲牥漠汮⥹ऊ偕佒䕐呒⡙਩䄉汆捯䵫湡条牥‪汆捯䵫湡条牥਻ऊ⼯湳灡桳瑯攠据摯湩⁧瑳瑡⁥景琠楨⁳潣湮捥楴湯⠠敳癲牥漠汮⥹ऊ䙆潬正敎䍴摯捥丠瑥潃敤㭣ऊ湩㍴′湓灡桳瑯即湩散敋晹慲敭਻甉湩㍴′湓灡桳瑯潃湵㭴ਊ⼉欯祥牦浡獥愠敲爠汥慩汢⁥潳搠汥慴⁳污慷獹栠癡⁥⁡慢敳楬敮‬敤瑬獡愠摮挠畬瑳牥⁳牡⁥湵敲楬扡敬猠湩散渠睥牥漠敮⁳敲汰捡⁥桴浥ऊ䙕乕呃佉⡎汃敩瑮‬敒楬扡敬਩瘉楯⁤汃敩瑮敒散癩䙥潬正敋晹慲敭䄨汆捯䵫湡条牥‪慍慮敧Ⱳ挠湯瑳吠牁慲㱹極瑮㸸…慐正瑥㬩ऊ䙕乕呃佉⡎汃敩瑮‬湕敲楬扡敬਩瘉楯⁤汃敩瑮敒散癩䙥潬正敄瑬⡡䙁潬正慍慮敧⩲䴠湡条牥‬潣獮⁴䅔牲祡甼湩㡴☾倠捡敫⥴਻唉商䍎䥔乏䌨楬湥ⱴ唠牮汥慩汢⥥ऊ潶摩䌠楬湥剴捥楥敶汆捯䍫畬瑳牥⡳䙁潬正慍慮敧⩲䴠湡条牥‬潣獮⁴䅔牲祡甼湩㡴☾倠捡敫⥴਻㭽
\ No newline at end of file
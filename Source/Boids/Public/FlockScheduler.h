@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⼯潗汲⁤畳獢獹整⁭捳敨畤楬杮琠敨愠祳据牨湯畯⁳楳畭慬楴湯漠⁦癥牥⁹汆捯⁫慍慮敧⁲湩愠眠牯摬漠⁮桴⁥慴歳朠慲桰猧猠慨敲⁤潷歲牥瀠潯⹬⼊䔯捡⁨汦捯⁫獩猠汰瑩椠瑮⁯楦敮朠慲湩摥琠獡獫⠠潭敶敭瑮挠畨歮ⱳ漠敮猠慰楴污椠摮硥琠獡Ⱬ渠楥桧潢牵氠獩⁴档湵獫猠楴捴敨⁤祢漠敮琠獡Ⱬ⼊猯整牥湩⁧档湵獫眠瑩⁨桴楥⁲癡楯慤据⁥牴捡獥‬桴湥愠挠浯汰瑥潩⁮慴歳洠牥楧杮琠敨挠畨歮⥳猠⁯⁡慬杲⁥汦捯⁫灳敲摡⁳癯牥攠敶祲眠牯敫ੲ⼯湩瑳慥⁤景戠捥浯湩⁧桴⁥牣瑩捩污瀠瑡⁨桷汩⁥浳污⁬汦捯獫氠慥敶眠牯敫獲椠汤⹥䈠極摬湩⁧桴⁥捯牴敥椠⁳桴⁥湯⁥敳楲污猠整⁰敬瑦ਮ⼯慔歳⁳桳睯甠⁰湵敤⁲猢慴⁴潂摩≳‮潗歲牥⁳慴敫琠獡獫漠⁦湡⁹汦捯⁫獡琠敨⁹牦敥甠Ɒ攠捡⁨汦捯⁫敧獴椠獴漠湷⼊振浯汰瑥潩⁮癥湥⁴樨楯敮⁤祢椠獴洠湡条牥猧挠浯業⁴楴正 湡⁤桴⁥畳獢獹整⁭敫灥⁳数⁲牦浡⁥潬摡猠慴楴瑳捩⁳景愠汬映潬正⹳⼊縯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾ਊ瀣慲浧⁡湯散ਊ⼯湩汣摵獥⌊湩汣摵⁥䌢牯䵥湩浩污栮ਢ椣据畬敤∠畓獢獹整獭圯牯摬畓獢獹整⹭≨⌊湩汣摵⁥䄢祳据启獡䝫慲桰湉整晲捡獥栮ਢ椣据畬敤∠汆捯卫档摥汵牥朮湥牥瑡摥栮ਢ⼊是牯慷摲搠捥慬敲ੳ汣獡⁳䙁潬正慍慮敧㭲ਊ⼯潷歲漠⁦湯⁥汦捯⁫捳敨畤敬⁤湩愠映慲敭猊牴捵⁴䙆潬正潌摡笊ऊ坔慥佫橢捥側牴䄼汆捯䵫湡条牥‾汆捯䵫湡条牥਻椉瑮㈳丠浵潂摩⁳‽㬰ऊ湩㍴′畎呭獡獫㴠〠਻⼉琯浩⁥灳湥⁴湩琠敨映潬正猧琠獡獫猠浵敭⁤癯牥眠牯敫獲‬湡⁤楴敭映潲⁭捳敨畤楬杮甠瑮汩椠獴氠獡⁴慴歳映湩獩敨੤昉潬瑡圠牯䵫⁳‽⸰昰਻昉潬瑡匠慰䵮⁳‽⸰昰਻㭽ਊ䍕䅌卓⤨挊慬獳䈠䥏卄䅟䥐唠汆捯卫档摥汵牥畓獢獹整⁭›異汢捩唠潗汲卤扵祳瑳浥笊ऊ䕇䕎䅒䕔彄佂奄⤨ਊ異汢捩਺⼉焯敵敵琠敨琠獡獫猠浩汵瑡湩⁧⁡汦捯⁫椨獴猠整牥湩⁧档湵獫洠獵⁴敢戠極瑬Ⱙ爠瑥牵獮琠敨攠敶瑮挠浯汰瑥湩⁧湯散琠敨映潬正椠⁳楳畭慬整੤䘉片灡䕨敶瑮敒⁦捓敨畤敬汆捯⡫䙁潬正慍慮敧⩲䘠潬正慍慮敧Ⱳ映潬瑡䐠汥慴楔敭㬩ਊ⼉猯慴瑲愠渠睥映慲敭眠瑩⁨⁡慣汬牥挠潨敳⁮摩‬潦⁲汦捯獫猠整灰摥漠瑵楳敤琠敨攠杮湩⁥潬灯⠠⹩⹥洠湡⁹瑳灥⁳楷桴湩漠敮攠杮湩⁥牦浡⥥ਮ⼉漯据⁥慣汬摥‬汦捯獫愠敲挠畯瑮摥椠⁮桴⁥慬瑳映慲敭戠来湵栠牥⁥湩瑳慥⁤景映汯潬楷杮琠敨攠杮湩❥⁳牦浡⁥潣湵整ੲ瘉楯⁤敂楧䙮慲敭用湩㙴‴牆浡䥥⥤਻⼉椯⁤景琠敨映慲敭映潬正⁳牡⁥畣牲湥汴⁹捳敨畤敬⁤湩ऊ湩楬敮甠湩㙴‴敇䙴慲敭摉⤨挠湯瑳笠爠瑥牵⁮潌摡牆浡㭥素ਊ⼉港浵敢⁲景戠楯獤洠癯摥愠摮猠整牥摥戠⁹湯⁥慴歳⠠潣獮汯⁥慶楲扡敬䈠楯獤匮档摥汵牥䌮畨歮楓敺‬瑡氠慥瑳ㄠ⤶ऊ湩㍴′敇䍴畨歮楓敺⤨挠湯瑳਻ऊ⼯潬摡漠⁦癥牥⁹汦捯⁫湩琠敨氠獡⁴楦楮桳摥映慲敭ऊ䅔牲祡䘼汆捯䱫慯㹤䜠瑥牆浡䱥慯獤⤨挠湯瑳਻⼉猯潭瑯敨⁤潷歲漠⁦污⁬汦捯獫瀠牥映慲敭‬湡⁤楴敭映潲⁭桴⁥楦獲⁴汦捯⁫敢湩⁧捳敨畤敬⁤湵楴⁬桴⁥慬瑳漠敮眠獡搠湯੥椉汮湩⁥汦慯⁴敇坴牯䵫⡳ 潣獮⁴⁻敲畴湲圠牯䵫㭳素ऊ湩楬敮映潬瑡䜠瑥灓湡獍⤨挠湯瑳笠爠瑥牵⁮灓湡獍※੽⼉猯慨敲漠⁦桴⁥潷歲牥❳琠浩⁥灳湥⁴楳畭慬楴杮映潬正⁳畤楲杮琠敨猠慰⁮ㄨ㴠攠敶祲眠牯敫⁲畢祳甠瑮汩琠敨氠獡⁴汦捯⁫慷⁳潤敮਩昉潬瑡䜠瑥瑕汩穩瑡潩⡮ 潣獮㭴ਊ牰癩瑡㩥ऊ⼯楦楮桳氠慯⁤瑳瑡獩楴獣漠⁦桴⁥慬瑳映慲敭眠敨⁮桴⁥楦獲⁴汦捯⁫景愠渠睥映慲敭椠⁳捳敨畤敬⁤木浡⁥桴敲摡਩瘉楯⁤瑓牡䙴慲敭用湩㙴‴牆浡䥥⥤਻⼉是慲敭⁳牡⁥敢畧⁮祢琠敨挠污敬⁲湩瑳慥⁤景映汯潬楷杮琠敨攠杮湩❥⁳牦浡⁥潣湵整ੲ戉潯⁬䕢灸楬楣䙴慲敭⁳‽慦獬㭥ऊ⼯敲潣摲愠映潬正猧眠牯⁫湯散椠獴挠浯汰瑥潩⁮慴歳爠湵⁳愨祮琠牨慥⥤ऊ潶摩删捥牯䙤潬正潌摡用湩㙴‴牆浡ⱥ椠瑮㈳䰠慯䥤摮硥‬汦慯⁴汆捯坫牯䵫ⱳ搠畯汢⁥捓敨畤敬楔敭㬩ਊ⼉氯慯獤漠⁦桴⁥牦浡⁥敢湩⁧捳敨畤敬⁤湡⁤景琠敨氠獡⁴楦楮桳摥映慲敭‬畧牡敤⁤祢琠敨氠捯੫洉瑵扡敬䘠牃瑩捩污敓瑣潩⁮潌摡潌正਻吉牁慲㱹䙆潬正潌摡‾潌摡㭳ऊ䅔牲祡䘼汆捯䱫慯㹤䘠慲敭潌摡㭳ऊ極瑮㐶䰠慯䙤慲敭㴠〠਻搉畯汢⁥牆浡卥慴瑲楔敭㴠〠〮਻搉畯汢⁥牆浡䕥摮楔敭㴠〠〮਻ऊ⼯浳潯桴摥猠慴楴瑳捩⁳湡⁤楴敭猠湩散琠敨⁹敷敲氠獡⁴潬杧摥ऊ汦慯⁴潗歲獍㴠〠〮㭦ऊ汦慯⁴灓湡獍㴠〠〮㭦ऊ汦慯⁴畎䙭潬正⁳‽⸰昰਻昉潬瑡丠浵慔歳⁳‽⸰昰਻搉畯汢⁥瑓瑡䱳杯楔敭㴠〠〮਻㭽
\ No newline at end of file
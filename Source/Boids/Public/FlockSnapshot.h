@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⼯慄慴愠獳瑥栠汯楤杮愠挠灡畴敲⁤汦捯⁫瀨獯瑩潩獮‬敶潬楣楴獥‬浳潯桴摥洠獥⁨潲慴楴湯⁳湡⁤汦捯⁫敳瑴湩獧⸩⼊䄯䘠潬正䴠湡条牥挠湡爠獥潴敲椠⁴瑡氠癥汥猠慴瑲猠⁯汰祡牥⁳敳⁥湡愠牬慥祤猠瑥汴摥映潬正椠獮整摡漠⁦潢摩⁳潣癮牥楧杮映潲⁭慲摮浯猠慰湷⹳⼊匯慮獰潨獴愠敲挠灡畴敲⁤牦浯愠爠湵楮杮映潬正椠⁮䥐⁅椨瑮⁯桴⁥獡敳⥴漠⁲牦浯愠栠慥汤獥⁳畲⁮椨瑮⁯⁡楢慮祲映汩⁥湩匠癡摥䘯潬正湓灡桳瑯⥳ਮ⼯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⌊牰条慭漠据੥⼊椯据畬敤ੳ椣据畬敤∠潃敲楍楮慭⹬≨⌊湩汣摵⁥䔢杮湩⽥慄慴獁敳⹴≨⌊湩汣摵⁥䘢潬正湓灡桳瑯朮湥牥瑡摥栮ਢ⼊是牯慷摲搠捥慬敲ੳ汣獡⁳䉁楯㭤ਊ⼯汦捯⁫慭慮敧⁲敳瑴湩獧猠潴敲⁤楷桴愠猠慮獰潨ⱴ愠獬⁯潣楰摥戠⁹桴⁥汦捯⁫慭慮敧⁲獡琠敨猠瑥楴杮⁳瑩⁳楳畭慬楴湯爠慥獤唊呓啒呃䈨畬灥楲瑮祔数਩瑳畲瑣䘠汆捯卫慮獰潨側牡浡瑥牥ੳ੻䜉久剅呁䑅䉟䑏⡙਩ऊ偕佒䕐呒⡙楖楳汢䅥祮桷牥ⱥ䈠畬灥楲瑮敒摡湏祬‬慃整潧祲㴠∠潂摩䵼癯浥湥≴਩昉潬瑡䴠硡灓敥⁤‽〷⸰昰਻唉剐偏剅奔嘨獩扩敬湁睹敨敲‬求敵牰湩剴慥佤汮ⱹ䌠瑡来牯⁹‽䈢楯籤潍敶敭瑮⤢ऊ汦慯⁴楍卮数摥㴠㌠〰〮㭦ਊ唉剐偏剅奔嘨獩扩敬湁睹敨敲‬求敵牰湩剴慥佤汮ⱹ䌠瑡来牯⁹‽䈢楯籤瑓敥楲杮⤢ऊ汦慯⁴汁杩浮湥却牴湥瑧⁨‽〲⸰昰਻唉剐偏剅奔嘨獩扩敬湁睹敨敲‬求敵牰湩剴慥佤汮ⱹ䌠瑡来牯⁹‽䈢楯籤瑓敥楲杮⤢ऊ汦慯⁴敓慰慲楴湯瑓敲杮桴㴠㌠⸰昰਻唉剐偏剅奔嘨獩扩敬湁睹敨敲‬求敵牰湩剴慥佤汮ⱹ䌠瑡来牯⁹‽䈢楯籤瑓敥楲杮⤢ऊ汦慯⁴潃敨楳湯瑓敲杮桴㴠㔠〮㭦ऊ偕佒䕐呒⡙楖楳汢䅥祮桷牥ⱥ䈠畬灥楲瑮敒摡湏祬‬慃整潧祲㴠∠潂摩卼整牥湩≧਩昉潬瑡䄠潶摩湡散瑓敲杮桴㴠ㄠ〰〰〮㭦ਊ唉剐偏剅奔嘨獩扩敬湁睹敨敲‬求敵牰湩剴慥佤汮ⱹ䌠瑡来牯⁹‽䈢楯籤敐捲灥楴湯⤢ऊ汦慯⁴敓慰慲楴湯但⁖‽ㄭ〮㭦ऊ偕佒䕐呒⡙楖楳汢䅥祮桷牥ⱥ䈠畬灥楲瑮敒摡湏祬‬慃整潧祲㴠∠潂摩偼牥散瑰潩≮਩昉潬瑡䄠楬湧敭瑮但⁖‽⸰昵਻唉剐偏剅奔嘨獩扩敬湁睹敨敲‬求敵牰湩剴慥佤汮ⱹ䌠瑡来牯⁹‽䈢楯籤敐捲灥楴湯⤢ऊ汦慯⁴潃敨楳湯但⁖‽〭㔮㭦紊਻唊䱃十⡓求敵牰湩呴灹⥥挊慬獳䈠䥏卄䅟䥐唠汆捯卫慮獰潨䅴獳瑥㨠瀠扵楬⁣䑕瑡䅡獳瑥笊ऊ䕇䕎䅒䕔彄佂奄⤨ਊ異汢捩਺⼉琯灹⁥景戠楯⁤灳睡敮⁤潦⁲桴⁥敲瑳牯摥映潬正ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩卼慮獰潨≴਩吉畓换慬獳晏䄼潂摩‾潂摩祔数਻ऊ⼯汦捯⁫敳瑴湩獧愠⁴桴⁥楴敭漠⁦慣瑰牵⁥猨牥慩楬敺⁤楷桴琠敨戠楯⁤瑳瑡⥥ऊ偕佒䕐呒⡙楖楳汢䅥祮桷牥ⱥ吠慲獮敩瑮‬慃整潧祲㴠∠潂摩卼慮獰潨≴਩䘉汆捯卫慮獰潨側牡浡瑥牥⁳慐慲敭整獲਻ऊ⼯慣瑰牵摥戠楯⁤瑳瑡ⱥ椠摮硥洠瑡档獥愠牣獯⁳牡慲獹ऊ䅔牲祡䘼敖瑣牯‾潐楳楴湯㭳ऊ䅔牲祡䘼敖瑣牯‾敖潬楣楴獥਻吉牁慲㱹剆瑯瑡牯‾敍桳潒慴楴湯㭳ਊ唉商䍎䥔乏䈨畬灥楲瑮慃汬扡敬‬慃整潧祲㴠∠潂摩卼慮獰潨≴਩椉汮湩⁥湩㍴′敇乴浵潂摩⡳ 潣獮⁴⁻敲畴湲倠獯瑩潩獮丮浵⤨※㭽ਊ⼉猯牥慩楬敺⁳汦捯⁫敳瑴湩獧愠摮戠楯⁤瑳瑡⁥獡戠汵⁫楢慮祲搠瑡੡瘉楯⁤敓楲污穩䙥潬正䘨牁档癩♥䄠⥲਻瘉物畴污瘠楯⁤敓楲污穩⡥䅆捲楨敶…牁 癯牥楲敤਻ऊ⼯慳敶氯慯⁤湳灡桳瑯愠⁳⁡楢慮祲映汩⁥畯獴摩⁥景琠敨挠湯整瑮映汯敤⁲用敳⁤潦⁲敨摡敬獳挠灡畴敲⥳ऊ潢汯匠癡呥䙯汩⡥潣獮⁴卆牴湩♧䘠汩健瑡⥨਻戉潯⁬潌摡牆浯楆敬挨湯瑳䘠瑓楲杮…楆敬慐桴㬩紊਻
\ No newline at end of file
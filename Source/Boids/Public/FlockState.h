@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⼯敐⵲潢摩猠浩汵瑡潩⁮瑳瑡⁥睯敮⁤祢愠䘠潬正䴠湡条牥‬瑳牯摥愠⁳慰慲汬汥愠牲祡⁳漨敮攠瑮祲瀠牥戠楯⥤ਮ⼯潂摩⁳牡⁥敲敦敲据摥映潲⁭畯獴摩⁥桴潲杵⁨瑳扡敬栠湡汤獥猠⁯桴⁥牡慲獹挠湡戠⁥潣灭捡整⁤湯爠浥癯污愠摮瀠牥潩楤慣汬੹⼯敲猭牯整⁤污湯⁧⁡ⵚ牯敤⁲䴨牯潴⥮挠牵敶‬敫灥湩⁧灳瑡慩⁬敮杩扨畯獲挠潬敳琠杯瑥敨⁲湩洠浥牯⹹⼊縯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾ਊ瀣慲浧⁡湯散ਊ⼯湩汣摵獥⌊湩汣摵⁥䌢牯䵥湩浩污栮ਢ⼊是牯慷摲搠捥慬敲ੳ汣獡⁳䉁楯㭤ਊ⼯⁡慨摮敬椠⁳⁡汳瑯椠⁮桴⁥潬敷⁲楢獴愠摮琠敨猠潬❴⁳敳楲污椠⁮桴⁥灵数⁲楢獴‬桴⁥敳楲污挠慨杮獥眠敨敮敶⁲桴⁥汳瑯猧戠楯⁤獩⼊爯浥癯摥猠⁯⁡慨摮敬欠灥⁴晡整⁲瑩⁳潢摩椠⁳潧敮搠敯湳琧愠摤敲獳琠敨渠硥⁴潢摩朠癩湥琠敨猠浡⁥汳瑯⠠灵琠⁯䴱戠楯獤瀠牥映潬正਩潣獮⁴湩㍴′汆捯䡫湡汤卥潬䉴瑩⁳‽〲਻潣獮⁴湩㍴′汆捯䡫湡汤卥潬䵴獡⁫‽ㄨ㰠‼汆捯䡫湡汤卥潬䉴瑩⥳ⴠㄠ਻潣獮⁴湩㍴′汆捯䡫湡汤卥牥慩䵬獡⁫‽ㄨ㰠‼㌨‱‭汆捯䡫湡汤卥潬䉴瑩⥳ ‭㬱ਊ汣獡⁳佂䑉当偁⁉䙆潬正瑓瑡੥੻異汢捩਺⼉戯楯⁤瑳瑡ⱥ愠汬愠牲祡⁳牡⁥桴⁥慳敭猠穩⁥湡⁤湡椠摮硥爠晥牥⁳潴琠敨猠浡⁥潢摩椠⁮慥档ऊ䅔牲祡䘼敖瑣牯‾潐楳楴湯㭳ऊ䅔牲祡䘼敖瑣牯‾敖潬楣楴獥਻⼉猯潭瑯敨⁤潲慴楴湯漠⁦潢摩洠獥੨吉牁慲㱹剆瑯瑡牯‾敍桳潒慴楴湯㭳ऊ⼯楷杮戠慥⁴桰獡⁥〨ㄭ‬湯⁥畦汬映慬⁰数⁲祣汣⥥‬浳潯桴摥映慬⁰晥潦瑲⠠‰‽汧摩湩Ⱨㄠ㴠映汵⁬汦灡 湡⁤浳潯桴摥戠湡⁫湡汧੥⼉椯⁮慲楤湡⁳瀨獯瑩癩⁥桷湥琠牵楮杮爠杩瑨Ⱙ爠慥⁤祢琠敨戠楯⁤敭桳猧洠瑡牥慩੬吉牁慲㱹汦慯㹴䘠慬偰慨敳㭳ऊ䅔牲祡昼潬瑡‾汆灡晅潦瑲㭳ऊ䅔牲祡昼潬瑡‾慂歮湁汧獥਻⼉戯楯⁤捡潴⁲敲牰獥湥楴杮琠敨猠慴整ऊ䅔牲祡䄼潂摩㸪䈠楯獤਻⼉栯湡汤⁥景攠捡⁨潢摩ऊ䅔牲祡椼瑮㈳‾慈摮敬㭳ਊ⼉愯摤愠戠楯⁤湡⁤敲畴湲椠獴栠湡汤੥椉瑮㈳䄠摤䄨潂摩‪潂摩‬潣獮⁴噆捥潴♲倠獯瑩潩Ɱ挠湯瑳䘠敖瑣牯…敖潬楣祴‬潣獮⁴剆瑯瑡牯…敍桳潒慴楴湯㬩ऊ⼯敲潭敶愠戠楯⁤祢栠湡汤ⱥ氠獡⁴潢摩椠⁳潭敶⁤湩潴椠獴瀠慬散ऊ潶摩删浥癯⡥湩㍴′慈摮敬㬩ऊ⼯敲潭敶攠敶祲戠楯੤瘉楯⁤浅瑰⡹㬩ऊ⼯敲敳癲⁥灳捡⁥潦⁲⁡畮扭牥漠⁦潢摩ੳ瘉楯⁤敒敳癲⡥湩㍴′畎䉭楯獤㬩ਊ⼉术瑥挠牵敲瑮愠牲祡椠摮硥漠⁦慨摮敬⠠义䕄彘低䕎椠⁦慨摮敬椠湳琧椠⁮獵⁥牯椠獴戠楯⁤慨⁳敢湥爠浥癯摥਩椉汮湩⁥湩㍴′敇䥴摮硥椨瑮㈳䠠湡汤⥥挠湯瑳ऊ੻उ潣獮⁴湩㍴′汓瑯㴠䜠瑥慈摮敬汓瑯䠨湡汤⥥਻उ敲畴湲䠠湡汤⁥㴾〠☠…汓瑯慈摮敬⹳獉慖楬䥤摮硥匨潬⥴☠…汓瑯慈摮敬孳汓瑯⁝㴽䠠湡汤⁥‿汓瑯潔湉敤學汓瑯⁝›义䕄彘低䕎਻紉ऊ湩楬敮戠潯⁬獉慖楬䡤湡汤⡥湩㍴′慈摮敬 潣獮⁴⁻敲畴湲䜠瑥湉敤⡸慈摮敬 㴡䤠䑎塅也乏㭅素ऊ湩楬敮椠瑮㈳丠浵⤨挠湯瑳笠爠瑥牵⁮潐楳楴湯⹳畎⡭㬩素ऊ⼯汳瑯漠⁦⁡慨摮敬‬汳瑯⁳牡⁥敲獵摥戠⁹敮⁷潢摩⁳畢⁴牡⁥敮敶⁲桳牡摥戠⁹睴⁯潢摩⁳瑡漠据੥猉慴楴⁣湩楬敮椠瑮㈳䜠瑥慈摮敬汓瑯椨瑮㈳䠠湡汤⥥笠爠瑥牵⁮慈摮敬☠䘠潬正慈摮敬汓瑯慍歳※੽⼉港浵敢⁲景猠潬獴栠湡敤⁤畯⁴潳映牡‬桴⁥汳瑯漠⁦癥牥⁹慨摮敬椠⁮獵⁥獩戠汥睯椠ੴ椉汮湩⁥湩㍴′敇乴浵汓瑯⡳ 潣獮⁴⁻敲畴湲匠潬呴䥯摮硥丮浵⤨※੽⼉术瑥挠牵敲瑮愠牲祡椠摮硥漠⁦桴⁥潢摩椠⁮⁡汳瑯⠠义䕄彘低䕎映牯甠畮敳⁤汳瑯⥳ऊ湩楬敮椠瑮㈳䜠瑥汓瑯湉敤⡸湩㍴′汓瑯 潣獮⁴⁻敲畴湲匠潬呴䥯摮硥䤮噳污摩湉敤⡸汓瑯 ‿汓瑯潔湉敤學汓瑯⁝›义䕄彘低䕎※੽⼉振慨杮獥眠敨敮敶⁲潢摩⁳牡⁥摡敤Ɽ爠浥癯摥漠⁲敲牯敤敲Ɽ甠敳⁤潴椠癮污摩瑡⁥湩楤散⁳慣档摥戠瑥敷湥映慲敭ੳ椉汮湩⁥極瑮㈳䜠瑥慌潹瑵敖獲潩⡮ 潣獮⁴⁻敲畴湲䰠祡畯噴牥楳湯※੽ऊ⼯敲牯敤⁲污⁬潢摩愠牲祡⁳祢琠敨䴠牯潴⁮潣敤漠⁦桴楥⁲潰楳楴湯猠⁯桴瑡渠慥扲⁹潢摩⁳牡⁥瑳牯摥挠潬敳琠杯瑥敨Ⱳ爠瑥牵獮映污敳椠⁦污敲摡⁹湩漠摲牥ऊ潢汯匠牯䉴䵹牯潴䍮摯⡥㬩ऊ⼯牯敤⁲景琠敨氠獡⁴潳瑲‬桴⁥潢摩渠睯愠⁴湩敤⁸⁩慷⁳瑡椠摮硥䜠瑥潓瑲牏敤⡲嬩嵩戠晥牯⁥瑩ऊ湩楬敮挠湯瑳吠牁慲㱹湩㍴㸲…敇却牯佴摲牥⤨挠湯瑳笠爠瑥牵⁮潓瑲牏敤㭲素ਊ牰癩瑡㩥ऊ⼯牡慲⁹湩敤⁸景攠捡⁨汳瑯‬义䕄彘低䕎映牯甠畮敳⁤汳瑯ੳ吉牁慲㱹湩㍴㸲匠潬呴䥯摮硥਻⼉振牵敲瑮栠湡汤⁥景攠捡⁨汳瑯⠠桴⁥慨摮敬椠獴渠硥⁴潢摩朠瑥⁳桷汩⁥桴⁥汳瑯椠⁳湵獵摥਩吉牁慲㱹湩㍴㸲匠潬䡴湡汤獥਻⼉猯潬獴愠慶汩扡敬映牯爠略敳ऊ䅔牲祡椼瑮㈳‾牆敥汓瑯㭳ਊ⼉术癩⁥⁡汳瑯愠渠睥猠牥慩⁬湡⁤牦敥椠⁴潦⁲敲獵੥瘉楯⁤牆敥汓瑯椨瑮㈳匠潬⥴਻甉湩㍴′慌潹瑵敖獲潩⁮‽㬰ਊ⼉猯牣瑡档戠晵敦獲爠略敳⁤敢睴敥⁮潳瑲ੳ吉牁慲㱹極瑮㐶‾潓瑲敋獹਻吉牁慲㱹湩㍴㸲匠牯佴摲牥਻㭽
\ No newline at end of file
@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⼯潃浭湡汤瑥爠湵楮杮愠朠楲⁤景䘠潬正䴠湡条牥猠瑥楴杮⁳獡栠慥汤獥⁳汦捯⁫楳畭慬楴湯ⱳ甠敳⁤潴洠灡琠敨焠慵楬祴瀯牥潦浲湡散⼊琯慲敤漭晦漠⁦瑳敥楲杮猠瑥楴杮⁳癯牥楮桧⁴湩瑳慥⁤景攠楤楴杮搠晥畡瑬⁳湡⁤敲汰祡湩⁧⁡敬敶⁬祢栠湡⹤⼊䔯敶祲瀠牡浡瑥牥猠瑥椠⁳畲⁮湯散瀠牥猠敥⁤獡椠獴漠湷映潬正椠⁮⁡潬摡摥洠灡⠠潳戠楯獤愠潶摩椠獴氠癥汥朠潥敭牴⥹‬楷桴戠楯獤⼊猯慰湷摥映潲⁭桴⁥敳摥‮畒獮愠敲猠整灰摥椠⁮慢捴敨⁳湯琠敨猠慨敲⁤汦捯⁫捳敨畤敬Ⱳ戠瑥敷湥洠慥畳敲⁤瑳灥⁳癥牥⁹汦捯⁫景愠⼊戯瑡档椠⁳楳畭慬整⁤潴敧桴牥猠⁯慢捴敨⁳楦汬攠敶祲眠牯敫⹲䴠慥畳敲⁤瑳灥⁳畲⁮湯⁥汦捯⁫瑡愠琠浩ⱥ猠⁯⁡畲❮⁳楳畭慬楴湯琠浩੥⼯獩❮⁴桳牡摥眠瑩⁨桴⁥瑯敨⁲畲獮漠⁦瑩⁳慢捴ⱨ愠摮漠汮⁹敢慨楶畯⁲眨楨档搠敯湳琧搠灥湥⁤湯琠浩湩⥧椠⁳敭獡牵摥椠⁮慰慲汬汥ਮ⼯慅档爠湵爠灥牯獴椠獴挠獯⁴猨浩汵瑡潩⁮獭漠⁦瑩⁳敭獡牵摥猠整獰‬癡楯慤据⁥牴捡獥瀠牥猠整⥰愠摮戠桥癡潩牵⠠潰慬楲慺楴湯ਬ⼯敮牡獥⁴敮杩扨畯⁲楤瑳湡散愠摮猠慨敲漠⁦潢摩⁳楷桴渠⁯敮杩扨畯Ⱳ戠楯⁤潣汬獩潩獮愠摮漠獢慴汣⁥潣瑮捡獴 獡愠爠睯漠⁦⁡千⁖楦敬ਮ⼯⼊唯㑅摅瑩牯䌭摭攮數䈠楯獤甮牰橯捥⁴爭湵䘽潬正睓敥⁰䴭灡⼽慇敭䴯灡⽳敎瑳湩䝧潲湵獤ⴠ片摩∽汁杩浮湥却牴湥瑧㵨〱ⰰ〲ⰰ〴㬰畎卭湥潳獲㈽ⰵ〵ㄬ〰ਢ⼯ⴉ片摩⼠ⴠ片摩楆敬猉敷瑰渠浵牥捩䘠潬正䴠湡条牥瀠潲数瑲敩⁳獡丠浡㵥慖畬ⱥ慖畬㭥慎敭嘽污敵⸬⸮⠠⁡牧摩映汩⁥潨摬⁳湯⁥牰灯牥祴瀠牥氠湩⥥⼊य䴭灡उउ慭⁰牰癯摩湩⁧敬敶⁬敧浯瑥祲愠摮琠敨琠浥汰瑡⁥汆捯⁫慍慮敧⁲昨物瑳漠敮映畯摮漠⁲吭浥汰瑡㵥渼浡㹥Ⱙ攠灭祴眠牯摬椠⁦潮⁴敳ੴ⼯ⴉ潂摩⁳匭敥獤ⴠ瑓灥⁳圭牡畭⁰䴭慥畳敲癅牥⁹匭整呰浩⁥倭牡污敬⁬䈭楯䍤慬獳ⴠ畏灴瑵⠠敳⁥慍湩映牯搠晥畡瑬⥳⼊縯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾ਊ瀣慲浧⁡湯散ਊ⼯湩汣摵獥⌊湩汣摵⁥䌢牯䵥湩浩污栮ਢ椣据畬敤∠潃浭湡汤瑥⽳潃浭湡汤瑥栮ਢ椣据畬敤∠汆捯呫汥浥瑥祲栮ਢ椣据畬敤∠汆捯卫敷灥潃浭湡汤瑥朮湥牥瑡摥栮ਢ⼊是牯慷摲搠捥慬敲ੳ汣獡⁳䙁潬正慍慮敧㭲挊慬獳䄠潂摩਻汣獡⁳乆浵牥捩牐灯牥祴਻⼊猯敷瑰映潬正洠湡条牥瀠潲数瑲⁹湡⁤桴⁥慶畬獥椠⁴慴敫ੳ瑳畲瑣䘠汆捯卫敷灥硁獩笊ऊ卆牴湩⁧慎敭਻䘉畎敭楲偣潲数瑲⩹倠潲数瑲⁹‽畮汬瑰㭲ऊ䅔牲祡䘼瑓楲杮‾慖畬獥਻㭽ਊ⼯湯⁥慰慲敭整⁲敳⁴畲⁮楷桴漠敮猠敥੤瑳畲瑣䘠汆捯卫敷灥畒੮੻⼉瘯污敵漠⁦慥档猠敷瑰瀠潲数瑲ⱹ椠⁮桴⁥牯敤⁲景琠敨愠數ੳ吉牁慲㱹卆牴湩㹧嘠污敵㭳ऊ湩㍴′敓摥㴠〠਻䄉汆捯䵫湡条牥‪汆捯䵫湡条牥㴠渠汵灬牴਻ऊ⼯敢慨楶畯⁲畳浭摥漠敶⁲敭獡牵摥猠整獰‬潢摩⁳楷桴畯⁴⁡汦捯浫瑡⁥湩猠慥捲⁨慲楤獵挠畯瑮愠⁳獩汯瑡摥椠獮整摡漠⁦潴慷摲⁳桴⁥敮牡獥⁴楤瑳湡散ऊ湩㍴′畎䵭慥畳敲⁳‽㬰ऊ潤扵敬倠汯牡穩瑡潩卮浵㴠〠〮਻搉畯汢⁥敎牡獥䑴獩慴据卥浵㴠〠〮਻椉瑮㐶丠浵敎牡獥⁴‽㬰ऊ湩㙴‴畎䥭潳慬整⁤‽㬰ऊ湩㙴‴潃汬獩潩獮㴠〠਻椉瑮㐶传獢慴汣䍥湯慴瑣⁳‽㬰ਊ⼉猯浩汵瑡潩⁮楴敭漠⁦敭獡牵摥猠整獰‬瑳灥数⁤楷桴畯⁴桴⁥瑯敨⁲畲獮漠⁦桴⁥慢捴੨椉瑮㈳丠浵楔敭卤整獰㴠〠਻搉畯汢⁥楓䵭即浵㴠〠〮਻搉畯汢⁥灓湡獍畓⁭‽⸰㬰ऊ汦慯⁴慍卸浩獍㴠〠〮㭦ਊ⼉港楥桧潢牵愠摮愠潶摩湡散挠畯瑮⁳景琠敨爠湵愠瑦牥眠牡畭Ɒ猠浵慭楲敳⁤牦浯琠敨映潬正猧琠汥浥瑥祲眠敨⁮桴⁥畲⁮湥獤ऊ䙆潬正敔敬敭牴卹浡汰⁥潃瑳਻㭽ਊ䍕䅌卓⤨挊慬獳䈠䥏卄䅟䥐唠汆捯卫敷灥潃浭湡汤瑥㨠瀠扵楬⁣䍕浯慭摮敬ੴ੻䜉久剅呁䑅䉟䑏⡙਩瀊扵楬㩣ऊ⼯敤慦汵⁴潣獮牴捵潴ੲ唉汆捯卫敷灥潃浭湡汤瑥⤨਻ऊ⼯畲⁮睳敥Ɒ爠瑥牵獮〠漠⁮畳捣獥ੳ瘉物畴污椠瑮㈳䴠楡⡮潣獮⁴卆牴湩♧倠牡浡⥳漠敶牲摩㭥ਊ牰癩瑡㩥ऊ⼯敲摡猠敷瑰瀠潲数瑲敩⁳牦浯ⴠ片摩漠⁲䜭楲䙤汩ⱥ爠瑥牵獮映污敳漠⁮湵湫睯⁮牰灯牥楴獥ऊ潢汯倠牡敳片摩挨湯瑳䘠瑓楲杮…慐慲獭‬䅔牲祡䘼汆捯卫敷灥硁獩☾传瑵硁獥 潣獮㭴ਊ⼉氯慯⁤慭⁰漨⁲牣慥整愠⁮浥瑰⁹潷汲⥤愠摮爠来獩整⁲瑩⁳潣灭湯湥獴猠⁯潢摩⁳慣⁮牴捡⁥敬敶⁬敧浯瑥祲ऊ坕牯摬‪牃慥整睓敥坰牯摬挨湯瑳䘠瑓楲杮…慍买浡⥥挠湯瑳਻瘉楯⁤敄瑳潲卹敷灥潗汲⡤坕牯摬‪潗汲⥤挠湯瑳਻ऊ⼯灳睡⁮⁡敨摡敬獳映潬正洠湡条牥映牯愠爠湵映潲⁭桴⁥整灭慬整‬灡汰⁹桴⁥畲❮⁳慰慲敭整獲愠摮猠慰湷椠獴戠楯獤映潲⁭瑩⁳敳摥ऊ䙁潬正慍慮敧⩲匠慰湷畒䙮潬正唨潗汲⩤圠牯摬‬䙁潬正慍慮敧⩲吠浥汰瑡ⱥ挠湯瑳吠牁慲㱹䙆潬正睓敥䅰楸㹳…硁獥‬潣獮⁴䙆潬正睓敥剰湵…畒⥮挠湯瑳਻ऊ⼯摡⁤敢慨楶畯⁲景愠爠湵猧映潬正愠⁴桴⁥畣牲湥⁴瑳灥⠠湡⁹桴敲摡਩瘉楯⁤敍獡牵剥湵䘨汆捯卫敷灥畒♮删湵 潣獮㭴ਊ⼉眯楲整漠敮爠睯瀠牥爠湵‬敲畴湲⁳慦獬⁥晩琠敨映汩⁥潣汵湤琧戠⁥牷瑩整੮戉潯⁬牗瑩剥獥汵獴挨湯瑳䘠瑓楲杮…楆敬慐桴‬潣獮⁴䅔牲祡䘼汆捯卫敷灥硁獩☾䄠數ⱳ挠湯瑳吠牁慲㱹䙆潬正睓敥剰湵☾删湵⥳挠湯瑳਻ऊ⼯睳敥⁰敳瑴湩獧爠慥⁤牦浯琠敨挠浯慭摮氠湩੥椉瑮㈳丠浵潂摩㭳ऊ湩㍴′畎卭整獰਻椉瑮㈳圠牡畭印整獰਻椉瑮㈳䴠慥畳敲湉整癲污਻昉潬瑡匠整呰浩㭥ऊ協扵汣獡佳㱦䉁楯㹤䈠楯呤灹㭥ऊ⼯敲楧湯戠楯獤愠敲猠慰湷摥椠੮䘉潂⁸灓睡䉮畯摮㭳ऊ⼯慲楤獵漠⁦潢摩挠汯楬楳湯猠桰牥獥‬潢摩⁳汣獯牥琠慨⁮睴捩⁥景椠⁴潣汬摩੥昉潬瑡䌠汯楬楳湯慒楤獵਻㭽
\ No newline at end of file
@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⼯畒湮湩⁧整敬敭牴⁹景愠䘠潬正䴠湡条牥猧猠浩汵瑡潩Ɱ甠敳⁤潴映湩⁤畯⁴桷⁹潳敭映慲敭⁳牡⁥硥数獮癩⹥⼊启敨猠整牥湩⁧敫湲汥爠捥牯獤攠捡⁨潢摩猧渠楥桧潢牵挠畯瑮愠摮攠敶祲愠潶摩湡散猠敷灥椠⁴牴杩敧獲‬桴⁥慭慮敧⁲敲潣摲ੳ⼯慥档映慲敭猧猠浩汵瑡潩⁮楴敭‮癅牥⁹慳灭敬椠瑮牥慶⁬桴⁥牦浡獥愠敲猠浵慭楲敳⁤湩潴愠猠浡汰⁥潴敧桴牥眠瑩⁨⁡潣牡敳⼊搯湥楳祴朠楲⁤景琠敨映潬正‬湡⁤慳灭敬⁳慣⁮敢攠灸牯整⁤潴䌠噓漠⁲半乏琠⁯楬敮甠⁰牦浡⁥楴敭猠楰敫⁳楷桴映潬正琠灯汯杯⹹⼊縯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾ਊ瀣慲浧⁡湯散ਊ⼯湩汣摵獥⌊湩汣摵⁥䌢牯䵥湩浩污栮ਢ⼊港浵敢⁲景渠楥桧潢牵挠畯瑮栠獩潴牧浡戠湩㩳〠‬ⰱ㈠‬ⴳⰴ㔠㠭‬ⴹ㘱‬㜱㌭ⰲ㌠⬳挊湯瑳椠瑮㈳䘠潬正敔敬敭牴䡹獩潴牧浡楂獮㴠㠠਻⼊猯浵慭祲漠⁦桴⁥牦浡獥戠瑥敷湥琠潷琠汥浥瑥祲猠浡汰獥猊牴捵⁴䙆潬正敔敬敭牴卹浡汰੥੻⼉眯牯摬琠浩⁥桴⁥慳灭敬眠獡琠歡湥ऊ汦慯⁴楔敭㴠〠〮㭦ऊ湩㍴′畎䙭慲敭⁳‽㬰ऊ湩㍴′畎䉭楯獤㴠〠਻ऊ⼯楳畭慬楴湯琠浩⁥数⁲牦浡੥昉潬瑡䴠慥卮浩楔敭獍㴠〠〮㭦ऊ汦慯⁴慍卸浩楔敭獍㴠〠〮㭦ਊ⼉港楥桧潢牵⁳数⁲瑳敥敲⁤潢摩ऊ汦慯⁴敍湡敎杩扨畯獲㴠〠〮㭦ऊ湩㍴′慍乸楥桧潢牵⁳‽㬰ऊ湩㍴′敎杩扨畯䡲獩潴牧浡䙛潬正敔敬敭牴䡹獩潴牧浡楂獮⁝‽⁻‰㭽ਊ⼉愯潶摩湡散猠敷灥⁳数⁲牦浡⁥戨楯獤琠慨⁴潦湵⁤湡漠獢慴汣⁥桡慥⁤湡⁤敳牡档摥映牯愠映敲⁥楤敲瑣潩⥮ऊ汦慯⁴癁楯慤据卥敷灥偳牥牆浡⁥‽⸰昰਻⼉愯潶摩湡散氠湩⁥牴捡獥瀠牥映慲敭⠠潦睲牡⁤敳獮牯挠敨正⁳湡⁤睳敥⁰牴捡獥਩昉潬瑡吠慲散偳牥牆浡⁥‽⸰昰਻ऊ⼯捯畣楰摥搠湥楳祴朠楲⁤散汬⁳湡⁤潢摩⁳湩琠敨洠獯⁴牣睯敤⁤散汬ऊ湩㍴′捏畣楰摥敃汬⁳‽㬰ऊ湩㍴′慍䍸汥䑬湥楳祴㴠〠਻㭽ਊ⼯敮杩扨畯⁲湡⁤癡楯慤据⁥潣湵獴爠捥牯敤⁤祢琠敨猠整牥湩⁧敫湲汥‬慥档猠整牥湩⁧档湵⁫敲潣摲⁳瑩⁳睯⁮湡⁤桴祥爧⁥敭杲摥漠据⁥瑩猧搠湯੥瑳畲瑣䘠汆捯呫汥浥瑥祲潃湵獴笊ऊ湩㙴‴敎杩扨畯卲浵㴠〠਻椉瑮㈳匠整牥摥潂摩⁳‽㬰ऊ湩㍴′慍乸楥桧潢牵⁳‽㬰ऊ湩㍴′敎杩扨畯䡲獩潴牧浡䙛潬正敔敬敭牴䡹獩潴牧浡楂獮⁝‽⁻‰㭽ऊ湩㍴′癁楯慤据卥敷灥⁳‽㬰ऊ湩㍴′牔捡獥㴠〠਻ऊ⼯敲潣摲渠楥桧潢牵⁳潦湵⁤潦⁲⁡瑳敥敲⁤潢摩ऊ但䍒䥅䱎义⁅潶摩删捥牯乤楥桧潢牵⡳湩㍴′畎乭楥桧潢牵⥳਻⼉爯捥牯⁤湡愠潶摩湡散猠敷灥ऊ但䍒䥅䱎义⁅潶摩删捥牯䅤潶摩湡散睓敥⡰ ⁻癁楯慤据卥敷灥⭳㬫素ऊ⼯敲潣摲愠潶摩湡散氠湩⁥牴捡獥ऊ但䍒䥅䱎义⁅潶摩删捥牯呤慲散⡳湩㍴′畎呭慲散⥳笠吠慲散⁳㴫丠浵牔捡獥※੽㭽ਊ汣獡⁳佂䑉当偁⁉䙆潬正敔敬敭牴੹੻異汢捩਺⼉猯穩⁥景搠湥楳祴朠楲⁤散汬⁳湩眠牯摬甠楮獴ऊ汦慯⁴敃汬楓敺㴠㈠〰⸰昰਻⼉洯硡浩浵渠浵敢⁲景猠浡汰獥欠灥ⱴ漠摬獥⁴慳灭敬⁳牡⁥牤灯数੤椉瑮㈳䴠硡慓灭敬⁳‽㘳〰਻ऊ⼯摡⁤潣湵獴爠捥牯敤⁤祢琠敨猠浩汵瑡潩੮瘉楯⁤摁䍤畯瑮⡳潣獮⁴䙆潬正敔敬敭牴䍹畯瑮♳䌠畯瑮⥳਻ऊ⼯敲潣摲猠浩汵瑡潩⁮楴敭漠⁦⁡楦楮桳摥映慲敭ऊ潶摩删捥牯䙤慲敭昨潬瑡匠浩楔敭獍㬩ऊ⼯畳浭牡獩⁥牦浡獥猠湩散琠敨氠獡⁴慳灭敬愠摮爠扥極摬琠敨搠湥楳祴朠楲⁤牦浯琠敨映潬正猧瀠獯瑩潩獮ऊ潶摩吠歡卥浡汰⡥汦慯⁴楔敭‬潣獮⁴䅔牲祡䘼敖瑣牯☾倠獯瑩潩獮㬩ऊ⼯潦杲瑥猠浡汰獥愠摮映慲敭ੳ瘉楯⁤敒敳⡴㬩ਊ⼉眯楲整猠浡汰獥琠⁯楦敬‬敲畴湲⁳慦獬⁥晩琠敨映汩⁥潣汵湤琧戠⁥牷瑩整੮戉潯⁬硅潰瑲千⡖潣獮⁴卆牴湩♧䘠汩健瑡⥨挠湯瑳਻⼉眯楲整猠浡汰獥愠摮琠敨氠瑡獥⁴敤獮瑩⁹牧摩琠⁯楦敬‬敲畴湲⁳慦獬⁥晩琠敨映汩⁥潣汵湤琧戠⁥牷瑩整੮戉潯⁬硅潰瑲半乏挨湯瑳䘠瑓楲杮…楆敬慐桴 潣獮㭴ਊ椉汮湩⁥潣獮⁴䅔牲祡䘼汆捯呫汥浥瑥祲慓灭敬☾䜠瑥慓灭敬⡳ 潣獮⁴⁻敲畴湲匠浡汰獥※੽⼉戯楯獤椠⁮慥档漠捣灵敩⁤敤獮瑩⁹牧摩挠汥⁬瑡琠敨氠獡⁴慳灭敬ऊ湩楬敮挠湯瑳吠慍㱰䥆瑮敖瑣牯‬湩㍴㸲…敇䑴湥楳祴片摩⤨挠湯瑳笠爠瑥牵⁮敄獮瑩䝹楲㭤素ऊ湩楬敮椠瑮㈳䜠瑥慍䍸汥䑬湥楳祴⤨挠湯瑳笠爠瑥牵⁮慓灭敬⹳畎⡭ ‾‰‿慓灭敬⹳慌瑳⤨䴮硡敃汬敄獮瑩⁹›㬰素ਊ⼉栯獩潴牧浡戠湩漠⁦⁡敮杩扨畯⁲潣湵ੴ猉慴楴⁣但䍒䥅䱎义⁅湩㍴′敇䡴獩潴牧浡楂⡮湩㍴′畎乭楥桧潢牵⥳ऊ੻उ敲畴湲丠浵敎杩扨畯獲㰠‽‰‿‰›䵆瑡㩨䴺湩ㄨ⬠椠瑮㈳䘨慍桴㨺敃汩潌呧潷用湩㍴⠲畎乭楥桧潢牵⥳⤩‬汆捯呫汥浥瑥祲楈瑳杯慲䉭湩⁳‭⤱਻紉ऊ⼯慬敢⁬景栠獩潴牧浡戠湩甠敳⁤湩攠灸牯整⁤楦敬ੳ猉慴楴⁣潣獮⁴䍔䅈⩒䜠瑥楈瑳杯慲䉭湩慌敢⡬湩㍴′楂⥮਻瀊楲慶整਺⼉振敬牡瘠污敵⁳捡畣畭慬整⁤楳据⁥桴⁥慬瑳猠浡汰੥瘉楯⁤敒敳䙴慲敭⡳㬩ਊ⼉愯捣浵汵瑡摥猠湩散琠敨氠獡⁴慳灭敬ऊ湩㍴′畎䙭慲敭⁳‽㬰ऊ汦慯⁴楓呭浩卥浵㴠〠〮㭦ऊ汦慯⁴慍卸浩楔敭㴠〠〮㭦ऊ䙆潬正敔敬敭牴䍹畯瑮⁳牆浡䍥畯瑮㭳ਊ吉牁慲㱹䙆潬正敔敬敭牴卹浡汰㹥匠浡汰獥਻吉慍㱰䥆瑮敖瑣牯‬湩㍴㸲䐠湥楳祴片摩਻㭽ਊ但䍒䥅䱎义⁅潶摩䘠汆捯呫汥浥瑥祲潃湵獴㨺敒潣摲敎杩扨畯獲椨瑮㈳丠浵敎杩扨畯獲਩੻三楥桧潢牵畓⁭㴫丠浵敎杩扨畯獲਻匉整牥摥潂摩⭳㬫ऊ慍乸楥桧潢牵⁳‽䵆瑡㩨䴺硡䴨硡敎杩扨畯獲‬畎乭楥桧潢牵⥳਻三楥桧潢牵楈瑳杯慲孭䙆潬正敔敬敭牴㩹䜺瑥楈瑳杯慲䉭湩丨浵敎杩扨畯獲崩⬫਻੽
\ No newline at end of file
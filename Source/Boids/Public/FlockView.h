@@ -0,0 +1 @@
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⼯敒摡漭汮⁹潣祰漠⁦⁡汦捯⁫異汢獩敨⁤祢椠獴䘠潬正䴠湡条牥漠据⁥数⁲牦浡ⱥ愠瑦牥琠敨猠浩汵瑡潩⁮慨⁳敢湥挠浯業瑴摥ਮ⼯瑏敨⁲祳瑳浥⁳愨摵潩‬䥁‬䥕 敲摡戠楯獤椠⁮畢歬映潲⁭桴⁥楶睥椠獮整摡漠⁦慣汬湩⁧湩潴攠捡⁨潢摩愠瑣牯‮⁁楶睥渠癥牥⼊振慨杮獥漠据⁥異汢獩敨⁤湡⁤瑳祡⁳污癩⁥桷汩⁥湡潹敮栠汯獤椠ⱴ猠⁯瑩挠湡戠⁥敲摡映潲⁭湡⁹桴敲摡眠楨敬琠敨渠硥⁴牦浡੥⼯獩猠浩汵瑡摥‮楖睥⁳牡⁥敶獲潩敮⁤潳爠慥敤獲挠湡琠汥⁬晩琠敨❹敶愠牬慥祤猠敥⁮⁡牦浡⹥⼊縯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾ਊ瀣慲浧⁡湯散ਊ⼯湩汣摵獥⌊湩汣摵⁥䌢牯䵥湩浩污栮ਢ椣据畬敤∠汆捯䝫潲灵⹳≨ਊ⼯潦睲牡⁤敤汣牡獥挊慬獳䘠汆捯卫慴整਻挊慬獳䈠䥏卄䅟䥐䘠汆捯噫敩੷੻異汢捩਺⼉椯据敲獡獥眠瑩⁨癥牥⁹異汢獩敨⁤楶睥⠠‰‽潮桴湩⁧異汢獩敨⁤敹⥴ऊ極瑮㐶嘠牥楳湯㴠〠਻⼉眯牯摬琠浩⁥桴⁥楶睥眠獡瀠扵楬桳摥ऊ汦慯⁴楔敭㴠〠〮㭦ਊ⼉戯楯⁤瑳瑡ⱥ椠摮硥洠瑡档獥愠牣獯⁳牡慲獹⠠湩楤散⁳牡⁥湯祬瘠污摩眠瑩楨⁮桴獩瘠敩ⱷ甠敳栠湡汤獥琠⁯潦汬睯愠戠楯⁤捡潲獳瘠敩獷਩吉牁慲㱹噆捥潴㹲倠獯瑩潩獮਻吉牁慲㱹噆捥潴㹲嘠汥捯瑩敩㭳ऊ䅔牲祡椼瑮㈳‾慈摮敬㭳ਊ⼉愯杧敲慧整⁳景琠敨眠潨敬映潬正ऊ噆捥潴⁲敃瑮潲摩㴠䘠敖瑣牯㨺敚潲敖瑣牯਻䘉敖瑣牯䴠慥噮汥捯瑩⁹‽噆捥潴㩲娺牥噯捥潴㭲ऊ䉆硯䈠畯摮⁳‽䉆硯䘨牯散湉瑩㬩ਊ⼉术潲灵⁳桴⁥汦捯⁫慨⁳灳楬⁴湩潴⠠浥瑰⁹湵敬獳琠敨洠湡条牥琠慲正⁳牧畯獰Ⱙ愠摮椠摮硥椠瑮⁯牧畯獰漠⁦慥档戠楯⁤䤨䑎塅也乏⁅潦⁲湵牧畯数⁤潢摩⥳ऊ䅔牲祡䘼汆捯䝫潲灵‾片畯獰਻吉牁慲㱹湩㍴㸲䜠潲灵湉楤散㭳ਊ椉汮湩⁥湩㍴′畎⡭ 潣獮⁴⁻敲畴湲倠獯瑩潩獮丮浵⤨※੽⼉术瑥椠摮硥漠⁦⁡潢摩椠⁮桴獩瘠敩⁷祢映潬正栠湡汤⁥䤨䑎塅也乏⁅晩琠敨戠楯⁤獩❮⁴湩椠⥴ऊ湩㍴′敇䥴摮硥椨瑮㈳䠠湡汤⥥挠湯瑳਻ऊ⼯潣祰猠慴整愠摮朠潲灵⁳湡⁤潣灭瑵⁥条牧来瑡獥⠠湯祬挠污敬⁤祢琠敨映潬正洠湡条牥戠晥牯⁥異汢獩楨杮਩瘉楯⁤畂汩⡤潣獮⁴䙆潬正瑓瑡♥䘠潬正瑓瑡ⱥ挠湯瑳䘠汆捯䝫潲灵⩳䘠潬正片畯獰‬極瑮㐶䤠噮牥楳湯‬汦慯⁴湉楔敭㬩ਊ牰癩瑡㩥ऊ⼯湩敤⁸景琠敨戠楯⁤湩攠捡⁨慨摮敬猠潬⁴䤨䑎塅也乏⁅潦⁲湵獵摥猠潬獴਩吉牁慲㱹湩㍴㸲匠潬䥴摮捩獥਻㭽ਊ⼯桳牡摥瘠敩⁷慨摮摥琠⁯敲摡牥ⱳ猠慴獹瘠污摩甠瑮汩琠敨氠獡⁴敲摡牥爠汥慥敳⁳瑩琊灹摥晥吠桓牡摥瑐㱲潣獮⁴䙆潬正楖睥‬卅䵐摯㩥吺牨慥卤晡㹥䘠汆捯噫敩偷牴਻
\ No newline at end of file
@@ -1,57 +1 @@
-// Copyright ©2020 Samuel Harrison
-
-//README:~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-//An actor you can place in the world and spawn a number of Boids from its location that go in random directions.
-//
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-
-#pragma once
-
-//includes
-#include "CoreMinimal.h"
-#include "GameFramework/Actor.h"
-#include "PointSpawner.generated.h"
-
-//forward declares
-class UBillboardComponent;
-class ABoid;
-class AFlockManager;
-
-UCLASS()
-class BOIDS_API APointSpawner : public AActor
-{
-	GENERATED_BODY()
-
-public:
-	//default constructor
-	APointSpawner();
-
-protected:
-	//called on level start or when spawned
-	virtual void BeginPlay() override;
-
-	//COMPONENTS
-protected:
-	//scene component
-	UPROPERTY(VisibleAnywhere, Category = "Boid|Components")
-	UBillboardComponent* SpawnPointBillboard;
-
-	//SPAWNING
-protected:
-	//number of boids to spawn initially
-	UPROPERTY(EditAnywhere, Category = "Boid|Spawn")
-	int32 NumBoidsToSpawn;
-
-	//type of boid to spawn
-	UPROPERTY(EditAnywhere, Category = "Boid|Spawn")
-	TSubclassOf<ABoid> BoidType;
-
-	//spawn flock of boids at point
-	void SpawnBoids(int32 NumBoids);
-
-	//flock manager that has been assigned to spawned boids
-	UPROPERTY(EditAnywhere, Category = "Boid|Spawn")
-	AFlockManager* AssignedFlockManager;
-
-	//TODO: add ramped spawning feature, allowing boids to be spawned over duration instead of all at once to reduce processing load on single frame to multiple frames
-};
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾⼊䄯⁮捡潴⁲潹⁵慣⁮汰捡⁥湩琠敨眠牯摬愠摮猠慰湷愠渠浵敢⁲景䈠楯獤映潲⁭瑩⁳潬慣楴湯琠慨⁴潧椠⁮慲摮浯搠物捥楴湯⹳⼊ਯ⼯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⌊牰条慭漠据੥⼊椯据畬敤ੳ椣据畬敤∠潃敲楍楮慭⹬≨⌊湩汣摵⁥䜢浡䙥慲敭潷歲䄯瑣牯栮ਢ椣据畬敤∠潐湩却慰湷牥朮湥牥瑡摥栮ਢ⼊是牯慷摲搠捥慬敲ੳ汣獡⁳䉕汩扬慯摲潃灭湯湥㭴挊慬獳䄠潂摩਻汣獡⁳䙁潬正慍慮敧㭲ਊ䍕䅌卓⤨挊慬獳䈠䥏卄䅟䥐䄠潐湩却慰湷牥㨠瀠扵楬⁣䅁瑣牯笊ऊ䕇䕎䅒䕔彄佂奄⤨ਊ異汢捩਺⼉搯晥畡瑬挠湯瑳畲瑣牯ऊ偁楯瑮灓睡敮⡲㬩ਊ牰瑯捥整㩤ऊ⼯慣汬摥漠⁮敬敶⁬瑳牡⁴牯眠敨⁮灳睡敮੤瘉物畴污瘠楯⁤敂楧偮慬⡹ 癯牥楲敤਻ऊ⼯佃偍乏久協瀊潲整瑣摥਺⼉猯散敮挠浯潰敮瑮ऊ偕佒䕐呒⡙楖楳汢䅥祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤潃灭湯湥獴⤢ऊ䉕汩扬慯摲潃灭湯湥⩴匠慰湷潐湩䉴汩扬慯摲਻ऊ⼯偓坁䥎䝎瀊潲整瑣摥਺⼉港浵敢⁲景戠楯獤琠⁯灳睡⁮湩瑩慩汬੹唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤灓睡≮਩椉瑮㈳丠浵潂摩味卯慰湷਻ऊ⼯祴数漠⁦潢摩琠⁯灳睡੮唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤灓睡≮਩吉畓换慬獳晏䄼潂摩‾潂摩祔数਻ऊ⼯畱略⁥汦捯⁫景戠楯獤琠⁯敢猠慰湷摥愠⁴潰湩⁴祢琠敨愠獳杩敮⁤汦捯⁫慭慮敧ੲ瘉楯⁤灓睡䉮楯獤椨瑮㈳丠浵潂摩⥳਻ऊ⼯汦捯⁫慭慮敧⁲桴瑡栠獡戠敥⁮獡楳湧摥琠⁯灳睡敮⁤潢摩ੳ唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤灓睡≮਩䄉汆捯䵫湡条牥‪獁楳湧摥汆捯䵫湡条牥਻㭽
\ No newline at end of file
@@ -1,79 +1 @@
-// Copyright ©2020 Samuel Harrison
-
-//README:~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-//An actor that can be placed in the world to attract/repel Boids by applying steering forces on all Boids within its range.
-//
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-
-#pragma once
-
-//includes
-#include "CoreMinimal.h"
-#include "GameFramework/Actor.h"
-#include "TargetObject.generated.h"
-
-//forward declares
-class USphereComponent;
-class UStaticMeshComponent;
-class ABoid;
-
-UCLASS()
-class BOIDS_API ATargetObject : public AActor
-{
-	GENERATED_BODY()
-
-public:
-	//default constructor
-	ATargetObject();
-
-protected:
-	//setup logic called when level starts or spawned
-	virtual void BeginPlay() override;
-
-public:
-	//called to update each frame
-	virtual void Tick(float DeltaTime) override;
-
-	//COMPONENTS
-protected:
-	//target collision component
-	UPROPERTY(VisibleAnywhere, Category = "Boid|Components")
-	USphereComponent* TargetCollision;
-
-	//target static mesh component for visuals
-	UPROPERTY(VisibleAnywhere, Category = "Boid|Components")
-	UStaticMeshComponent* TargetMesh;
-
-	//OVERLAP EVENT DELEGATES
-protected:
-	//delegate for target collision component event OnBeginOverlap
-	UFUNCTION()
-	void OnTargetOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult & SweepResult);
-	//delegate for target collision component event OnEndOverlap
-	UFUNCTION()
-	void OnTargetOverlapEnd(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
-
-	//BOID FORCES
-protected:
-	//force strength, (+)attract, (-)repel
-	UPROPERTY(EditAnywhere, Category = "Boid|TargetForce")
-	float TargetForceStrength;
-
-	//set force to scale with distance from boid to target (i.e. closer to target, stronger the force)
-	UPROPERTY(EditAnywhere, Category = "Boid|TargetForce")
-	bool bProximityScaled;
-
-	//set if proximity scaling is inverted (i.e. further from target yields stronger force)
-	UPROPERTY(EditAnywhere, Category = "Boid|TargetForce")
-	bool bInvertProximityScaling;
-
-	//set if force has a range or limitless range (i.e. only affects overlapping boids or all boids universally)
-	UPROPERTY(EditAnywhere, Category = "Boid|TargetForce")
-	bool bHasRange;
-
-	//list of boids in range
-	TArray<ABoid*> BoidsInRange;
-
-	//add target forces to the affected boids
-	void ApplyTargetForces();
-};
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾⼊䄯⁮捡潴⁲桴瑡挠湡戠⁥汰捡摥椠⁮桴⁥潷汲⁤潴愠瑴慲瑣爯灥汥䈠楯獤戠⁹灡汰楹杮猠整牥湩⁧潦捲獥漠⁮污⁬潂摩⁳楷桴湩椠獴爠湡敧ਮ⼯⼊縯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾ਊ瀣慲浧⁡湯散ਊ⼯湩汣摵獥⌊湩汣摵⁥䌢牯䵥湩浩污栮ਢ椣据畬敤∠慇敭牆浡睥牯⽫捁潴⹲≨⌊湩汣摵⁥吢牡敧佴橢捥⹴敧敮慲整⹤≨ਊ⼯潦睲牡⁤敤汣牡獥挊慬獳唠灓敨敲潃灭湯湥㭴挊慬獳唠瑓瑡捩敍桳潃灭湯湥㭴挊慬獳䄠潂摩਻唊䱃十⡓਩汣獡⁳佂䑉当偁⁉呁牡敧佴橢捥⁴›異汢捩䄠捁潴ੲ੻䜉久剅呁䑅䉟䑏⡙਩瀊扵楬㩣ऊ⼯敤慦汵⁴潣獮牴捵潴ੲ䄉慔杲瑥扏敪瑣⤨਻瀊潲整瑣摥਺⼉猯瑥灵氠杯捩挠污敬⁤桷湥氠癥汥猠慴瑲⁳牯猠慰湷摥ऊ楶瑲慵⁬潶摩䈠来湩汐祡⤨漠敶牲摩㭥ਊ異汢捩਺⼉振污敬⁤潴甠摰瑡⁥慥档映慲敭ऊ楶瑲慵⁬潶摩吠捩⡫汦慯⁴敄瑬呡浩⥥漠敶牲摩㭥ਊ⼉䌯䵏佐䕎呎੓牰瑯捥整㩤ऊ⼯慴杲瑥挠汯楬楳湯挠浯潰敮瑮ऊ偕佒䕐呒⡙楖楳汢䅥祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤潃灭湯湥獴⤢ऊ单桰牥䍥浯潰敮瑮‪慔杲瑥潃汬獩潩㭮ਊ⼉琯牡敧⁴瑳瑡捩洠獥⁨潣灭湯湥⁴潦⁲楶畳污ੳ唉剐偏剅奔嘨獩扩敬湁睹敨敲‬慃整潧祲㴠∠潂摩䍼浯潰敮瑮≳਩唉瑓瑡捩敍桳潃灭湯湥⩴吠牡敧䵴獥㭨ਊ⼉伯䕖䱒偁䔠䕖呎䐠䱅䝅呁卅瀊潲整瑣摥਺⼉搯汥来瑡⁥潦⁲慴杲瑥挠汯楬楳湯挠浯潰敮瑮攠敶瑮传䉮来湩癏牥慬ੰ唉商䍎䥔乏⤨ऊ潶摩传呮牡敧佴敶汲灡敂楧⡮偕楲業楴敶潃灭湯湥⩴传敶汲灡数䍤浯潰敮瑮‬䅁瑣牯‪瑏敨䅲瑣牯‬偕楲業楴敶潃灭湯湥⩴传桴牥潃灭‬湩㍴′瑏敨䉲摯䥹摮硥‬潢汯戠牆浯睓敥Ɒ挠湯瑳䘠楈剴獥汵⁴…睓敥剰獥汵⥴਻⼉搯汥来瑡⁥潦⁲慴杲瑥挠汯楬楳湯挠浯潰敮瑮攠敶瑮传䕮摮癏牥慬ੰ唉商䍎䥔乏⤨ऊ潶摩传呮牡敧佴敶汲灡湅⡤偕楲業楴敶潃灭湯湥⩴传敶汲灡数䍤浯潰敮瑮‬䅁瑣牯‪瑏敨䅲瑣牯‬偕楲業楴敶潃灭湯湥⩴传桴牥潃灭‬湩㍴′瑏敨䉲摯䥹摮硥㬩ਊ⼉䈯䥏⁄但䍒卅瀊潲整瑣摥਺⼉是牯散猠牴湥瑧ⱨ⠠⤫瑡牴捡ⱴ⠠⤭敲数੬唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤慔杲瑥潆捲≥਩昉潬瑡吠牡敧䙴牯散瑓敲杮桴਻ऊ⼯敳⁴潦捲⁥潴猠慣敬眠瑩⁨楤瑳湡散映潲⁭潢摩琠⁯慴杲瑥⠠⹩⹥挠潬敳⁲潴琠牡敧ⱴ猠牴湯敧⁲桴⁥潦捲⥥ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩呼牡敧䙴牯散⤢ऊ潢汯戠牐硯浩瑩卹慣敬㭤ਊ⼉猯瑥椠⁦牰硯浩瑩⁹捳污湩⁧獩椠癮牥整⁤椨攮‮畦瑲敨⁲牦浯琠牡敧⁴楹汥獤猠牴湯敧⁲潦捲⥥ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩呼牡敧䙴牯散⤢ऊ潢汯戠湉敶瑲牐硯浩瑩卹慣楬杮਻ऊ⼯敳⁴晩映牯散栠獡愠爠湡敧漠⁲楬業汴獥⁳慲杮⁥椨攮‮湯祬愠晦捥獴漠敶汲灡楰杮戠楯獤漠⁲污⁬潢摩⁳湵癩牥慳汬⥹ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩呼牡敧䙴牯散⤢ऊ潢汯戠慈剳湡敧਻ऊ⼯楬瑳漠⁦潢摩⁳湩爠湡敧ऊ䅔牲祡䄼潂摩㸪䈠楯獤湉慒杮㭥ਊ⼉愯摤琠牡敧⁴潦捲獥琠⁯桴⁥晡敦瑣摥戠楯獤ऊ潶摩䄠灰祬慔杲瑥潆捲獥⤨਻㭽
\ No newline at end of file
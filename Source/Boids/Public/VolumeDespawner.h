@@ -1,48 +1 @@
-// Copyright ©2020 Samuel Harrison
-
-//README:~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-//An actor that can be placed in the world that despawns Boids that enter it.
-//Used with attraction forces from BoidTargetObjects to "pull" Boids into it and emulate flock leaving the world (i.e. entering nest, exiting migration area, etc.).
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-
-#pragma once
-
-//includes
-#include "CoreMinimal.h"
-#include "GameFramework/Actor.h"
-#include "VolumeDespawner.generated.h"
-
-//forward declares
-class UBoxComponent;
-class UStaticMeshComponent;
-class ABoid;
-
-UCLASS()
-class BOIDS_API AVolumeDespawner : public AActor
-{
-	GENERATED_BODY()
-
-public:
-	//default constructor
-	AVolumeDespawner();
-
-protected:
-	//called on level start or when spawned
-	virtual void BeginPlay() override;
-
-	//COMPONENTS
-protected:
-	//box component detects boid collision and processes it for level "exit" and deletion
-	UPROPERTY(VisibleAnywhere, Category = "Boid|Components")
-	UBoxComponent* VolumeDespawnerCollision;
-
-	//static mesh component used for visuals of boid volume despawner actor
-	UPROPERTY(VisibleAnywhere, Category = "Components")
-	UStaticMeshComponent* VolumeDespawnerMesh;
-
-	//OVERLAP BEGIN EVENT DELEGATE
-protected:
-	//delegate for target collision component event OnBeginOverlap
-	UFUNCTION()
-	void OnOutletOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult & SweepResult);
-};
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾⼊䄯⁮捡潴⁲桴瑡挠湡戠⁥汰捡摥椠⁮桴⁥潷汲⁤桴瑡搠獥慰湷⁳潂摩⁳桴瑡攠瑮牥椠⹴⼊唯敳⁤楷桴愠瑴慲瑣潩⁮潦捲獥映潲⁭潂摩慔杲瑥扏敪瑣⁳潴∠異汬•潂摩⁳湩潴椠⁴湡⁤浥汵瑡⁥汦捯⁫敬癡湩⁧桴⁥潷汲⁤椨攮‮湥整楲杮渠獥ⱴ攠楸楴杮洠杩慲楴湯愠敲ⱡ攠捴⤮ਮ⼯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾੾⌊牰条慭漠据੥⼊椯据畬敤ੳ椣据畬敤∠潃敲楍楮慭⹬≨⌊湩汣摵⁥䜢浡䙥慲敭潷歲䄯瑣牯栮ਢ椣据畬敤∠潖畬敭敄灳睡敮⹲敧敮慲整⹤≨ਊ⼯潦睲牡⁤敤汣牡獥挊慬獳唠潂䍸浯潰敮瑮਻汣獡⁳单慴楴䵣獥䍨浯潰敮瑮਻汣獡⁳䉁楯㭤ਊ䍕䅌卓⤨挊慬獳䈠䥏卄䅟䥐䄠潖畬敭敄灳睡敮⁲›異汢捩䄠捁潴ੲ੻䜉久剅呁䑅䉟䑏⡙਩瀊扵楬㩣ऊ⼯敤慦汵⁴潣獮牴捵潴ੲ䄉潖畬敭敄灳睡敮⡲㬩ਊ牰瑯捥整㩤ऊ⼯慣汬摥漠⁮敬敶⁬瑳牡⁴牯眠敨⁮灳睡敮੤瘉物畴污瘠楯⁤敂楧偮慬⡹ 癯牥楲敤਻ऊ⼯佃偍乏久協瀊潲整瑣摥਺⼉戯硯挠浯潰敮瑮搠瑥捥獴戠楯⁤潣汬獩潩⁮湡⁤牰捯獥敳⁳瑩映牯氠癥汥∠硥瑩•湡⁤敤敬楴湯ऊ偕佒䕐呒⡙楖楳汢䅥祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤潃灭湯湥獴⤢ऊ䉕硯潃灭湯湥⩴嘠汯浵䑥獥慰湷牥潃汬獩潩㭮ਊ⼉猯慴楴⁣敭桳挠浯潰敮瑮甠敳⁤潦⁲楶畳污⁳景戠楯⁤潶畬敭搠獥慰湷牥愠瑣牯ऊ偕佒䕐呒⡙楖楳汢䅥祮桷牥ⱥ䌠瑡来牯⁹‽䌢浯潰敮瑮≳਩唉瑓瑡捩敍桳潃灭湯湥⩴嘠汯浵䑥獥慰湷牥敍桳਻ऊ⼯噏剅䅌⁐䕂䥇⁎噅久⁔䕄䕌䅇䕔瀊潲整瑣摥਺⼉搯汥来瑡⁥潦⁲慴杲瑥挠汯楬楳湯挠浯潰敮瑮攠敶瑮传䉮来湩癏牥慬ੰ唉商䍎䥔乏⤨ऊ潶摩传佮瑵敬佴敶汲灡敂楧⡮偕楲業楴敶潃灭湯湥⩴传敶汲灡数䍤浯潰敮瑮‬䅁瑣牯‪瑏敨䅲瑣牯‬偕楲業楴敶潃灭湯湥⩴传桴牥潃灭‬湩㍴′瑏敨䉲摯䥹摮硥‬潢汯戠牆浯睓敥Ɒ挠湯瑳䘠楈剴獥汵⁴…睓敥剰獥汵⥴਻㭽
\ No newline at end of file
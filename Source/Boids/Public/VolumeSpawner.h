@@ -1,90 +1 @@
-// Copyright ©2020 Samuel Harrison
-
-//README:~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-//An actor you can place in the world that spawns a set number of Boids in a Volume and headed in the direction of the flow Arrow.
-//Allows the emulation of small burst of Boids exiting a finite space (i.e. nest) or a continuous flow of Boids similar to an enormous flock leaving a cave or directional migration over vast area.
-//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-
-#pragma once
-
-//includes
-#include "CoreMinimal.h"
-#include "GameFramework/Actor.h"
-#include "VolumeSpawner.generated.h"
-
-//forward declares
-class UBoxComponent;
-class UArrowComponent;
-class UStaticMeshComponent;
-class ABoid;
-class AFlockManager;
-
-//spawner type enum
-//TODO: move to separate file for use with other boid spawners
-UENUM()
-enum SpawnerType
-{
-	Burst     UMETA(DisplayName = "Burst"),	//spawns finite burst of boids over a small range of frames
-	Flow      UMETA(DisplayName = "Flow"),	//spawns infinite amount of boids with a given rate of flow
-	//TODO: could add more complex spawning for "pulsing", "finite flow", "hybrid", etc.
-};
-
-UCLASS()
-class BOIDS_API AVolumeSpawner : public AActor
-{
-	GENERATED_BODY()
-
-public:
-	//default constructor
-	AVolumeSpawner();
-
-protected:
-	//called on level start or when spawned
-	virtual void BeginPlay() override;
-
-	//COMPONENTS
-protected:
-	//box component used to spawn boids inside volume
-	UPROPERTY(VisibleAnywhere, Category = "Boid|Components")
-	UBoxComponent* VolumeSpawnerCollision;
-
-	//arrow component used to control the direction of flow of the spawning boids
-	UPROPERTY(VisibleAnywhere, Category = "Boid|Components")
-	UArrowComponent* VolumeSpawnerFlowArrow;
-
-	//static mesh component used for visuals of boid volume spawning actor
-	UPROPERTY(VisibleAnywhere, Category = "Boid|Components")
-	UStaticMeshComponent* VolumeSpawnerMesh;
-
-	//SPAWNING
-protected:
-	//type of spawning (i.e. burst, flow, etc.)
-	UPROPERTY(EditAnywhere, Category = "Boid|Spawn")
-	TEnumAsByte<SpawnerType> SpawnType;
-
-	//number of boids to spawn initially or per interval for flow spawning
-	UPROPERTY(EditAnywhere, Category = "Boid|Spawn")
-	int32 NumBoidsToSpawn;
-
-	//interval between flow spawns
-	UPROPERTY(EditAnywhere, Category = "Boid|Spawn")	//TODO: add clamping to reasonable range
-	float SpawnInterval;
-
-	//timer handle and delegate for periodic spawning
-	FTimerHandle SpawnTimerHandle;
-	FTimerDelegate SpawnTimerDelegate;
-
-	//type of boid to spawn
-	UPROPERTY(EditAnywhere, Category = "Boid|Spawn")
-	TSubclassOf<ABoid> BoidType;
-
-	//spawn flock of boids at point
-	UFUNCTION()
-	void SpawnBoids(int32 NumBoids);
-
-	//flock manager that has been assigned to spawned boids
-	UPROPERTY(EditAnywhere, Category = "Boid|Spawn")
-	AFlockManager* AssignedFlockManager;
-
-	//TODO: add ramped spawning feature, allowing boids to be spawned over duration instead of all at once to reduce processing load on single frame to multiple frames
-};
+⼯䌠灯特杩瑨술㊩㈰‰慓畭汥䠠牡楲潳੮⼊刯䅅䵄㩅繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾⼊䄯⁮捡潴⁲潹⁵慣⁮汰捡⁥湩琠敨眠牯摬琠慨⁴灳睡獮愠猠瑥渠浵敢⁲景䈠楯獤椠⁮⁡潖畬敭愠摮栠慥敤⁤湩琠敨搠物捥楴湯漠⁦桴⁥汦睯䄠牲睯ਮ⼯汁潬獷琠敨攠畭慬楴湯漠⁦浳污⁬畢獲⁴景䈠楯獤攠楸楴杮愠映湩瑩⁥灳捡⁥椨攮‮敮瑳 牯愠挠湯楴畮畯⁳汦睯漠⁦潂摩⁳楳業慬⁲潴愠⁮湥牯潭獵映潬正氠慥楶杮愠挠癡⁥牯搠物捥楴湯污洠杩慲楴湯漠敶⁲慶瑳愠敲⹡⼊縯繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾繾ਊ瀣慲浧⁡湯散ਊ⼯湩汣摵獥⌊湩汣摵⁥䌢牯䵥湩浩污栮ਢ椣据畬敤∠慇敭牆浡睥牯⽫捁潴⹲≨⌊湩汣摵⁥嘢汯浵卥慰湷牥朮湥牥瑡摥栮ਢ⼊是牯慷摲搠捥慬敲ੳ汣獡⁳䉕硯潃灭湯湥㭴挊慬獳唠牁潲䍷浯潰敮瑮਻汣獡⁳单慴楴䵣獥䍨浯潰敮瑮਻汣獡⁳䉁楯㭤挊慬獳䄠汆捯䵫湡条牥਻⼊猯慰湷牥琠灹⁥湥浵⼊启䑏㩏洠癯⁥潴猠灥牡瑡⁥楦敬映牯甠敳眠瑩⁨瑯敨⁲潢摩猠慰湷牥ੳ䕕啎⡍਩湥浵匠慰湷牥祔数笊ऊ畂獲⁴††䵕呅⡁楄灳慬乹浡⁥‽䈢牵瑳⤢ब⼯灳睡獮映湩瑩⁥畢獲⁴景戠楯獤漠敶⁲⁡浳污⁬慲杮⁥景映慲敭ੳ䘉潬⁷††唠䕍䅔䐨獩汰祡慎敭㴠∠汆睯⤢ब⼯灳睡獮椠普湩瑩⁥浡畯瑮漠⁦潢摩⁳楷桴愠朠癩湥爠瑡⁥景映潬੷⼉启䑏㩏挠畯摬愠摤洠牯⁥潣灭敬⁸灳睡楮杮映牯∠異獬湩≧‬昢湩瑩⁥汦睯Ⱒ∠票牢摩Ⱒ攠捴ਮ㭽ਊ䍕䅌卓⤨挊慬獳䈠䥏卄䅟䥐䄠潖畬敭灓睡敮⁲›異汢捩䄠捁潴ੲ੻䜉久剅呁䑅䉟䑏⡙਩瀊扵楬㩣ऊ⼯敤慦汵⁴潣獮牴捵潴ੲ䄉潖畬敭灓睡敮⡲㬩ਊ牰瑯捥整㩤ऊ⼯慣汬摥漠⁮敬敶⁬瑳牡⁴牯眠敨⁮灳睡敮੤瘉物畴污瘠楯⁤敂楧偮慬⡹ 癯牥楲敤਻瀊扵楬㩣ऊ⼯慣汬摥琠⁯灵慤整攠捡⁨牦浡ⱥ攠業獴戠楯獤挠湯楴畮畯汳⁹潦⁲汦睯猠慰湷湩੧瘉物畴污瘠楯⁤楔正昨潬瑡䐠汥慴楔敭 癯牥楲敤਻ऊ⼯佃偍乏久協瀊潲整瑣摥਺⼉戯硯挠浯潰敮瑮甠敳⁤潴猠慰湷戠楯獤椠獮摩⁥潶畬敭ऊ偕佒䕐呒⡙楖楳汢䅥祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤潃灭湯湥獴⤢ऊ䉕硯潃灭湯湥⩴嘠汯浵卥慰湷牥潃汬獩潩㭮ਊ⼉愯牲睯挠浯潰敮瑮甠敳⁤潴挠湯牴汯琠敨搠物捥楴湯漠⁦汦睯漠⁦桴⁥灳睡楮杮戠楯獤ऊ偕佒䕐呒⡙楖楳汢䅥祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤潃灭湯湥獴⤢ऊ䅕牲睯潃灭湯湥⩴嘠汯浵卥慰湷牥汆睯牁潲㭷ਊ⼉猯慴楴⁣敭桳挠浯潰敮瑮甠敳⁤潦⁲楶畳污⁳景戠楯⁤潶畬敭猠慰湷湩⁧捡潴ੲ唉剐偏剅奔嘨獩扩敬湁睹敨敲‬慃整潧祲㴠∠潂摩䍼浯潰敮瑮≳਩唉瑓瑡捩敍桳潃灭湯湥⩴嘠汯浵卥慰湷牥敍桳਻ऊ⼯偓坁䥎䝎瀊潲整瑣摥਺⼉琯灹⁥景猠慰湷湩⁧椨攮‮畢獲ⱴ映潬ⱷ攠捴⤮ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩卼慰湷⤢ऊ䕔畮䅭䉳瑹㱥灓睡敮呲灹㹥匠慰湷祔数਻ऊ⼯畮扭牥漠⁦潢摩⁳潴猠慰湷椠楮楴污祬漠⁲数⁲湩整癲污映牯映潬⁷灳睡楮杮ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩卼慰湷⤢ऊ湩㍴′畎䉭楯獤潔灓睡㭮ਊ⼉椯瑮牥慶⁬敢睴敥⁮汦睯猠慰湷ⱳ映潬⁷灳睡敮獲攠業⁴畎䉭楯獤潔灓睡⁮潢摩⁳癥湥祬漠敶⁲慥档椠瑮牥慶੬唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤灓睡≮‬敭慴㴠⠠汃浡䵰湩㴠∠⸰㄰⤢਩昉潬瑡匠慰湷湉整癲污਻ऊ⼯牦捡楴湯污戠楯獤挠牡楲摥漠敶⁲敢睴敥⁮牦浡獥映牯映潬⁷灳睡楮杮ऊ汦慯⁴汆睯捁畣畭慬潴㭲ਊ⼉琯灹⁥景戠楯⁤潴猠慰湷ऊ偕佒䕐呒⡙摅瑩湁睹敨敲‬慃整潧祲㴠∠潂摩卼慰湷⤢ऊ協扵汣獡佳㱦䉁楯㹤䈠楯呤灹㭥ਊ⼉焯敵敵映潬正漠⁦潢摩⁳潴戠⁥灳睡敮⁤湩瘠汯浵⁥祢琠敨愠獳杩敮⁤汦捯⁫慭慮敧ੲ瘉楯⁤灓睡䉮楯獤椨瑮㈳丠浵潂摩⥳਻ऊ⼯汦捯⁫慭慮敧⁲桴瑡栠獡戠敥⁮獡楳湧摥琠⁯灳睡敮⁤潢摩ੳ唉剐偏剅奔䔨楤䅴祮桷牥ⱥ䌠瑡来牯⁹‽䈢楯籤灓睡≮਩䄉汆捯䵫湡条牥‪獁楳湧摥汆捯䵫湡条牥਻㭽
\ No newline at end of file